@@ -26,11 +26,15 @@
 #define CONFGEN_COMMONFUNCTIONS_HPP
 
 #include <string>
+#include <sstream>
+#include <locale>
+#include <cstddef>
 
 #include <boost/program_options/errors.hpp>
 #include <boost/algorithm/string.hpp>
 
 #include "CDPL/ConfGen/ForceFieldType.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/Internal/StringUtilities.hpp"
 
 
@@ -118,6 +122,88 @@ namespace ConfGen
 
         return "UNKNOWN";
     }
+
+    void writeJSONString(std::ostream& os, const std::string& str)
+    {
+        os << '"';
+
+        for (std::string::const_iterator it = str.begin(), end = str.end(); it != end; ++it) {
+            char c = *it;
+
+            switch (c) {
+
+                case '"':
+                    os << "\\\"";
+                    break;
+
+                case '\\':
+                    os << "\\\\";
+                    break;
+
+                case '\n':
+                    os << "\\n";
+                    break;
+
+                case '\r':
+                    os << "\\r";
+                    break;
+
+                case '\t':
+                    os << "\\t";
+                    break;
+
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        const char* hex_digits = "0123456789abcdef";
+
+                        os << "\\u00" << hex_digits[(c >> 4) & 0xf] << hex_digits[c & 0xf];
+                        break;
+                    }
+
+                    os << c;
+            }
+        }
+
+        os << '"';
+    }
+
+    /*
+     * Returns a single line JSON object holding the statistics of a conformer generation run for the
+     * specified input molecule record.
+     */
+    std::string statisticsToJSON(const CDPL::ConfGen::ConformerGeneratorStatistics& stats, std::size_t rec_idx,
+                                 const std::string& mol_name, unsigned int ret_code)
+    {
+        using namespace CDPL::ConfGen;
+
+        std::ostringstream oss;
+
+        oss.imbue(std::locale::classic());
+        oss << "{\"record\": " << rec_idx << ", \"name\": ";
+
+        writeJSONString(oss, mol_name);
+
+        oss << ", \"return_code\": " << ret_code << ", \"total_time\": " << stats.getTotalTime() << ", \"stage_times\": {";
+
+        for (std::size_t i = 0; i < ConformerGeneratorStatistics::NUM_STAGES; i++) {
+            ConformerGeneratorStatistics::Stage stage = ConformerGeneratorStatistics::Stage(i);
+
+            oss << (i > 0 ? ", \"" : "\"") << ConformerGeneratorStatistics::getStageName(stage) << "\": " << stats.getStageTime(stage);
+        }
+
+        oss << "}, \"counters\": {";
+
+        for (std::size_t i = 0; i < ConformerGeneratorStatistics::NUM_COUNTERS; i++) {
+            ConformerGeneratorStatistics::Counter counter = ConformerGeneratorStatistics::Counter(i);
+
+            oss << (i > 0 ? ", \"" : "\"") << ConformerGeneratorStatistics::getCounterName(counter) << "\": " << stats.getCounter(counter);
+        }
+
+        oss << "}, \"fragment_library_hit_rate\": " << stats.getFragmentLibraryHitRate()
+            << ", \"fragment_cache_hit_rate\": " << stats.getFragmentCacheHitRate() << '}';
+
+        return oss.str();
+    }
 } // namespace ConfGen
 
 #endif // CONFGEN_COMMONFUNCTIONS_HPP
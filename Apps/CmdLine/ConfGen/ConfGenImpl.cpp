@@ -201,6 +201,9 @@ private:
                 ret_code = confGen.generate(molecule);
 
             if (!no_fss_match) {
+                if (ret_code != ReturnCode::ABORTED && parent->statsOutput.is_open())
+                    parent->writeStatistics(confGen.getStatistics(), rec_idx, molecule, ret_code);
+
                 switch (ret_code) {
 
                     case ReturnCode::ABORTED:
@@ -442,6 +445,9 @@ ConfGenImpl::ConfGenImpl():
               value<std::string>(&outputFile)->required());
     addOption("failed,f", "Failed molecule output file.",
               value<std::string>(&failedFile));
+    addOption("stats-file", "Per-molecule conformer generation statistics output file (JSON lines format, "
+              "one object with stage times and counter values per processed molecule).",
+              value<std::string>(&statsFile));
     addOption("num-threads,t", "Number of parallel execution threads (default: no multithreading, implicit value: " +
               std::to_string(std::thread::hardware_concurrency()) + 
               " threads, must be >= 0, 0 disables multithreading).", 
@@ -520,6 +526,9 @@ ConfGenImpl::ConfGenImpl():
               " consider convergence to be reached (only effective in stochastic sampling mode, default: " +
               std::to_string(settings.getConvergenceCheckCycleSize()) + ", must be > 0).", 
               value<std::size_t>()->notifier(std::bind(&ConfGenImpl::setConvergenceCheckCycleSize, this, _1)));
+    addOption("sampling-threads", "Number of threads that sample the conformers of a single molecule in parallel (default: " +
+              std::to_string(settings.getNumSamplingThreads()) + ", must be >= 0, 0 or 1 disables parallel sampling).", 
+              value<std::size_t>()->notifier(std::bind(&ConfGenImpl::setNumSamplingThreads, this, _1)));
     addOption("mc-rot-bond-count-thresh,Z", "Number of rotatable bonds in a ring above which stochastic sampling will be performed"
               "(only effective in sampling mode AUTO, default: " +
               std::to_string(settings.getMacrocycleRotorBondCountThreshold()) + ", must be > 0).", 
@@ -762,6 +771,11 @@ void ConfGenImpl::setConvergenceCheckCycleSize(std::size_t size)
     settings.setConvergenceCheckCycleSize(size);
 }
 
+void ConfGenImpl::setNumSamplingThreads(std::size_t num_threads)
+{
+    settings.setNumSamplingThreads(num_threads);
+}
+
 void ConfGenImpl::setMacrocycleRotorBondCountThreshold(std::size_t min_count)
 {
     if (min_count == 0)
@@ -1018,6 +1032,7 @@ int ConfGenImpl::process()
 
     initInputReader();
     initOutputWriters();
+    initStatisticsOutput();
 
     if (termSignalCaught())
         return EXIT_FAILURE;
@@ -1262,6 +1277,17 @@ void ConfGenImpl::doWriteMolecule(const CDPL::Chem::MolecularGraph& mol, bool fa
         throw CDPL::Base::IOError("could not write generated conformers");
 }
 
+void ConfGenImpl::writeStatistics(const CDPL::ConfGen::ConformerGeneratorStatistics& stats, std::size_t rec_idx,
+                                  const CDPL::Chem::Molecule& mol, unsigned int ret_code)
+{
+    std::string json_rec = statisticsToJSON(stats, rec_idx, getName(mol), ret_code);
+
+    std::lock_guard<std::mutex> lock(writeStatsMutex);
+
+    if (!(statsOutput << json_rec << '\n'))
+        throw CDPL::Base::IOError("could not write conformer generation statistics");
+}
+
 void ConfGenImpl::checkInputFiles() const
 {
     using namespace CDPL;
@@ -1391,6 +1417,7 @@ void ConfGenImpl::printOptionSummary()
 
     printMessage(VERBOSE, " Output File:                         " + outputFile);
     printMessage(VERBOSE, " Failed Molecule Output File:         " + (failedFile.empty() ? std::string("None") : failedFile));
+    printMessage(VERBOSE, " Statistics Output File:              " + (statsFile.empty() ? std::string("None") : statsFile));
     printMessage(VERBOSE, " Conformer Generation Preset:         " + confGenPreset);
     printMessage(VERBOSE, " Fragment Build Preset:               " + fragBuildPreset);
     printMessage(VERBOSE, " Conformer Sampling Mode:             " + getSamplingModeString());
@@ -1417,6 +1444,7 @@ void ConfGenImpl::printOptionSummary()
     printMessage(VERBOSE, " Max. Pool Size:                      " + std::to_string(settings.getMaxPoolSize()));
     printMessage(VERBOSE, " Max. Num. Sampled Conformers:        " + std::to_string(settings.getMaxNumSampledConformers()));
     printMessage(VERBOSE, " Convergence Check Cycle Size:        " + std::to_string(settings.getConvergenceCheckCycleSize()));
+    printMessage(VERBOSE, " Num. Sampling Threads per Molecule:  " + std::to_string(settings.getNumSamplingThreads()));
     printMessage(VERBOSE, " Macrocycle Rot. Bond Count Theshold: " + std::to_string(settings.getMacrocycleRotorBondCountThreshold()));
     printMessage(VERBOSE, " Refinement Energy Tolerance:         " + (boost::format("%.4f") % settings.getRefinementTolerance()).str());
     printMessage(VERBOSE, " Max. Num. Refinement Iterations:     " + std::to_string(settings.getMaxNumRefinementIterations()));
@@ -1487,6 +1515,15 @@ void ConfGenImpl::loadFragmentLibrary()
     if (fragmentLibName.empty())
         return;
 
+    fragmentLib.reset(new FragmentLibrary());
+
+    if (fragmentLib->mapFile(fragmentLibName)) {
+        printMessage(INFO, "Mapped Fragment Library '" + fragmentLibName + "'");
+        printMessage(INFO, " - Indexed " + std::to_string(fragmentLib->getNumMappedEntries()) + " fragments");
+        printMessage(INFO, "");
+        return;
+    }
+
     std::ifstream is(fragmentLibName);
 
     if (!is) 
@@ -1494,7 +1531,6 @@ void ConfGenImpl::loadFragmentLibrary()
 
     printMessage(INFO, "Loading Fragment Library '" + fragmentLibName + "'...");
 
-    fragmentLib.reset(new FragmentLibrary());
     fragmentLib->load(is);
 
     if (termSignalCaught())
@@ -1527,11 +1563,10 @@ void ConfGenImpl::initInputReader()
             return;
 
         const std::string& file_path = inputFiles[i];
-        Chem::MoleculeReader::SharedPointer reader_ptr;
+        CompMoleculeReader::ReaderPointer reader_ptr;
 
         try {
-            reader_ptr.reset(inputFormat.empty() ? new Chem::MoleculeReader(file_path) :
-                             new Chem::MoleculeReader(file_path, inputFormat));
+            reader_ptr = CmdLineLib::createInputReader<Chem::Molecule, Chem::BasicMolecule>(file_path, inputFormat, numThreads);
 
         } catch (const Base::IOError& e) {
             throw Base::IOError("no input handler found for file '" + file_path + '\'');
@@ -1593,6 +1628,17 @@ void ConfGenImpl::initOutputWriters()
     }
 }
 
+void ConfGenImpl::initStatisticsOutput()
+{
+    if (statsFile.empty())
+        return;
+
+    statsOutput.open(statsFile.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!statsOutput)
+        throw CDPL::Base::IOError("opening statistics output file '" + statsFile + "' failed");
+}
+
 std::string ConfGenImpl::getSamplingModeString() const
 {
     using namespace CDPL::ConfGen;
@@ -28,12 +28,14 @@
 #include <cstddef>
 #include <vector>
 #include <string>
+#include <fstream>
 #include <mutex>
 
 #include "CDPL/Util/CompoundDataReader.hpp"
 #include "CDPL/Chem/MolecularGraphWriter.hpp"
 #include "CDPL/Chem/Molecule.hpp"
 #include "CDPL/ConfGen/ConformerGeneratorSettings.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/ConfGen/TorsionLibrary.hpp"
 #include "CDPL/ConfGen/FragmentLibrary.hpp"
 #include "CDPL/Internal/Timer.hpp"
@@ -78,6 +80,7 @@ namespace ConfGen
         void setDistExponent(double exp);
         void setMaxNumSampledConfs(std::size_t max_confs);
         void setConvergenceCheckCycleSize(std::size_t size);
+        void setNumSamplingThreads(std::size_t num_threads);
         void setMacrocycleRotorBondCountThreshold(std::size_t min_count);
         void setRefTolerance(double tol);
         void setMaxNumRefIterations(std::size_t num_iter);
@@ -115,6 +118,9 @@ namespace ConfGen
         void writeMolecule(const CDPL::Chem::MolecularGraph& mol, bool failed);
         void doWriteMolecule(const CDPL::Chem::MolecularGraph& mol, bool failed);
 
+        void writeStatistics(const CDPL::ConfGen::ConformerGeneratorStatistics& stats, std::size_t rec_idx,
+                             const CDPL::Chem::Molecule& mol, unsigned int ret_code);
+
         void setErrorMessage(const std::string& msg);
         bool haveErrorMessage();
 
@@ -129,6 +135,7 @@ namespace ConfGen
         void loadFragmentLibrary();
         void initInputReader();
         void initOutputWriters();
+        void initStatisticsOutput();
 
         std::string getSamplingModeString() const;
         std::string getNitrogenEnumModeString() const;
@@ -156,6 +163,7 @@ namespace ConfGen
         StringList                 inputFiles;
         std::string                outputFile;
         std::string                failedFile;
+        std::string                statsFile;
         std::size_t                numThreads;
         ConformerGeneratorSettings settings;
         StringList                 maxNumConfsOptArgs;
@@ -188,9 +196,11 @@ namespace ConfGen
         MoleculeWriterPtr          outputWriter;
         std::string                failedOutputFormat;
         MoleculeWriterPtr          failedOutputWriter;
+        std::ofstream              statsOutput;
         std::mutex                 mutex;
         std::mutex                 readMolMutex;
         std::mutex                 writeMolMutex;
+        std::mutex                 writeStatsMutex;
         std::string                errorMessage;
         Timer                      timer;
     };
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <thread>
 #include <chrono>
+#include <limits>
 
 #include <boost/format.hpp>
 #include <boost/algorithm/string.hpp>
@@ -41,6 +42,7 @@
 #include "CDPL/ConfGen/MoleculeFunctions.hpp"
 #include "CDPL/ConfGen/MolecularGraphFunctions.hpp"
 #include "CDPL/ConfGen/FragmentLibraryGenerator.hpp"
+#include "CDPL/ConfGen/CanonicalFragment.hpp"
 #include "CDPL/ConfGen/ReturnCode.hpp"
 #include "CDPL/ConfGen/ForceFieldType.hpp"
 #include "CDPL/Util/FileFunctions.hpp"
@@ -86,7 +88,7 @@ class GenFragLibImpl::FragLibGenerationWorker
 public:
     FragLibGenerationWorker(GenFragLibImpl* parent):
         parent(parent), fragLibGen(parent->fragmentLibPtr), verbLevel(parent->getVerbosityLevel()),
-        numProcMols(0), numProcFrags(0), numErrorFrags(0), numAddedFrags(0), totalNumConfs(0)  
+        filterByHash(parent->numShards > 1 && parent->shardingMode == SHARD_BY_HASH), numProcMols(0), numProcFrags(0), numErrorFrags(0), numAddedFrags(0), totalNumConfs(0)  
     {
         fragLibGen.setAbortCallback(std::bind(&FragLibGenerationWorker::abort, this));
         fragLibGen.getSettings() = parent->settings;
@@ -152,6 +154,13 @@ private:
             for (FragmentList::ConstElementIterator it = fragList.getElementsBegin(), end = fragList.getElementsEnd(); it != end; ++it) {
                 const Fragment& frag = *it;
 
+                if (filterByHash) {
+                    canonFrag.create(frag, molecule);
+
+                    if (!parent->isFragmentInShard(canonFrag.getHashCode()))
+                        continue;
+                }
+
                 if (verbLevel >= DEBUG) 
                     logRecordStream << "Fragment " << getSMILES(frag) << ':' << std::endl;
 
@@ -286,9 +295,11 @@ private:
     CDPL::Chem::FragmentList                fragList;
     CDPL::Util::BitSet                      fragLinkBondMask;
     CDPL::ConfGen::FragmentLibraryGenerator fragLibGen;
+    CDPL::ConfGen::CanonicalFragment        canonFrag;
     CDPL::Chem::BasicMolecule               molecule;
     std::stringstream                       logRecordStream;
     VerbosityLevel                          verbLevel;
+    bool                                    filterByHash;
     std::size_t                             numProcMols;
     std::size_t                             numProcFrags;
     std::size_t                             numErrorFrags;
@@ -299,7 +310,8 @@ private:
 
 GenFragLibImpl::GenFragLibImpl(): 
     numThreads(0), mode(CREATE), settings(ConformerGeneratorSettings::THOROUGH), preset("THOROUGH"),
-    maxLibSize(0), inputFormat(), fragmentLibPtr(new CDPL::ConfGen::FragmentLibrary())
+    maxLibSize(0), numShards(1), shardIndex(0), shardingMode(SHARD_BY_HASH), mergeRule(KEEP_FIRST),
+    startRecordIndex(0), endRecordIndex(0), inputFormat(), fragmentLibPtr(new CDPL::ConfGen::FragmentLibrary())
 {
     using namespace std::placeholders;
     
@@ -325,6 +337,15 @@ GenFragLibImpl::GenFragLibImpl():
               value<std::size_t>()->notifier(std::bind(&GenFragLibImpl::setTimeout, this, _1)));
     addOption("max-lib-size,n", "Maximum number of output fragments (default: 0, must be >= 0, 0 disables limit, only valid in CREATE mode).",
               value<std::size_t>(&maxLibSize));
+    addOption("num-shards", "Number of shards the fragment library generation work is split into (default: 1, must be > 0, only valid in CREATE and UPDATE mode).", 
+              value<std::size_t>(&numShards));
+    addOption("shard-index", "Zero-based index of the shard to process (default: 0, must be < number of shards).", 
+              value<std::size_t>(&shardIndex));
+    addOption("shard-by", "Specifies how the work gets split into shards (RECORDS, HASH, default: HASH).", 
+              value<std::string>()->notifier(std::bind(&GenFragLibImpl::setShardingMode, this, _1)));
+    addOption("merge-rule", "Rule for the selection of the output fragment if multiple input libraries contain fragments with the same hash code "
+              "(FIRST, MAX_CONFS, default: FIRST, only valid in MERGE mode).", 
+              value<std::string>()->notifier(std::bind(&GenFragLibImpl::setMergeRule, this, _1)));
     addOption("e-window,e", "Energy window for small ring system conformers (default: " + 
               (boost::format("%.1f") % settings.getSmallRingSystemSettings().getEnergyWindow()).str() + ", must be >= 0).",
               value<double>()->notifier(std::bind(&GenFragLibImpl::setEnergyWindow, this, _1)));
@@ -373,6 +394,26 @@ void GenFragLibImpl::addOptionLongDescriptions()
                              formats_str +
                              "\n\nIn MERGE mode, specifies multiple existing fragment libraries in CDF format.");
 
+    addOptionLongDescription("shard-by", 
+                             "Specifies how the fragment library generation work gets split into the number of shards specified by the option --num-shards.\n\n"
+                             "Supported Modes:\n"
+                             " - RECORDS: the input molecules are split into contiguous record ranges of (almost) equal size and only the molecules of the "
+                             "selected range are processed\n"
+                             " - HASH: all input molecules are processed but only fragments whose hash code modulo the number of shards equals the shard index "
+                             "are stored in the output library\n\n"
+                             "In HASH mode, the fragment libraries of different shards do not overlap. The partial libraries created by independent runs "
+                             "(e.g. on different machines) can be combined in MERGE mode.");
+
+    addOptionLongDescription("merge-rule", 
+                             "Specifies which fragment is stored in the output library if more than one of the merged input libraries contains a fragment "
+                             "with the same hash code.\n\n"
+                             "Supported Rules:\n"
+                             " - FIRST: the fragment of the input library specified first is kept\n"
+                             " - MAX_CONFS: the fragment with the higher number of conformers is kept, if equal the one with the lower minimum conformer energy, "
+                             "if still equal the fragment of the input library specified first\n\n"
+                             "Since the output library entries are written in the order of their hash codes, merging the same input libraries always results "
+                             "in the same output file.");
+
     addOptionLongDescription("input-format", 
                              "Allows to explicitly specify the format of the input file(s) by providing one of the supported "
                              "file-extensions (without leading dot!) as argument.\n\n" +
@@ -466,6 +507,30 @@ void GenFragLibImpl::setMode(const std::string& mode_str)
         throwValidationError("mode");
 }
 
+void GenFragLibImpl::setShardingMode(const std::string& mode_str)
+{
+    using namespace CDPL;
+
+    if (Internal::isEqualCI(mode_str, "RECORDS"))
+        shardingMode = SHARD_BY_RECORDS;
+    else if (Internal::isEqualCI(mode_str, "HASH"))
+        shardingMode = SHARD_BY_HASH;
+    else
+        throwValidationError("shard-by");
+}
+
+void GenFragLibImpl::setMergeRule(const std::string& rule_str)
+{
+    using namespace CDPL;
+
+    if (Internal::isEqualCI(rule_str, "FIRST"))
+        mergeRule = KEEP_FIRST;
+    else if (Internal::isEqualCI(rule_str, "MAX_CONFS"))
+        mergeRule = MAX_CONFORMERS;
+    else
+        throwValidationError("merge-rule");
+}
+
 void GenFragLibImpl::setInputFormat(const std::string& file_ext)
 {
     using namespace CDPL;
@@ -484,6 +549,7 @@ int GenFragLibImpl::process()
     printMessage(INFO, "");
 
     checkInputFiles();
+    checkShardingOptions();
     printOptionSummary();
 
     if (mode == MERGE) {
@@ -537,17 +603,65 @@ void GenFragLibImpl::mergeFragmentLibraries()
         if (GenFragLibImpl::termSignalCaught())
             return;
 
-        std::size_t old_num_frags = fragmentLibPtr->getNumEntries();
+        std::size_t num_added_frags = 0;
+        std::size_t num_repl_frags = 0;
 
         printMessage(INFO, "Adding Fragments to Output Library...");
 
-        fragmentLibPtr->addEntries(input_lib);
+        for (FragmentLibrary::ConstEntryIterator e_it = input_lib.getEntriesBegin(), e_end = input_lib.getEntriesEnd(); e_it != e_end; ++e_it) {
+            const CDPL::ConfGen::FragmentLibraryEntry::SharedPointer& curr_entry = fragmentLibPtr->getEntry(e_it->first);
+
+            if (!curr_entry) {
+                fragmentLibPtr->addEntry(e_it->second);
+                num_added_frags++;
+                continue;
+            }
+
+            if (!isPreferredMergeEntry(*e_it->second, *curr_entry))
+                continue;
+
+            fragmentLibPtr->removeEntry(e_it->first);
+            fragmentLibPtr->addEntry(e_it->second);
+            num_repl_frags++;
+        }
+
+        printMessage(INFO, " - Added " + std::to_string(num_added_frags) + " fragment(s)");
+
+        if (mergeRule != KEEP_FIRST)
+            printMessage(INFO, " - Replaced " + std::to_string(num_repl_frags) + " fragment(s)");
 
-        printMessage(INFO, " - Added " + std::to_string(fragmentLibPtr->getNumEntries() - old_num_frags) + " fragment(s)");
         printMessage(INFO, "");
     }
 }
 
+bool GenFragLibImpl::isPreferredMergeEntry(const CDPL::ConfGen::FragmentLibraryEntry& entry,
+                                           const CDPL::ConfGen::FragmentLibraryEntry& curr_entry) const
+{
+    typedef CDPL::ConfGen::FragmentLibraryEntry FragLibEntry;
+
+    if (mergeRule == KEEP_FIRST)
+        return false;
+
+    if (entry.getNumConformers() != curr_entry.getNumConformers())
+        return (entry.getNumConformers() > curr_entry.getNumConformers());
+
+    auto min_energy = [](const FragLibEntry& fl_entry) {
+        double min_e = std::numeric_limits<double>::max();
+
+        for (FragLibEntry::ConstConformerIterator it = fl_entry.getConformersBegin(), end = fl_entry.getConformersEnd(); it != end; ++it)
+            min_e = std::min(min_e, it->getEnergy());
+
+        return min_e;
+    };
+
+    return (min_energy(entry) < min_energy(curr_entry));
+}
+
+bool GenFragLibImpl::isFragmentInShard(std::uint64_t hash_code) const
+{
+    return ((hash_code % numShards) == shardIndex);
+}
+
 void GenFragLibImpl::processSingleThreaded()
 {
     using namespace CDPL;
@@ -703,7 +817,7 @@ int GenFragLibImpl::saveFragmentLibrary()
             fragmentLibPtr->removeEntry(it->first);
     }
 
-    fragmentLibPtr->save(os);
+    fragmentLibPtr->save(os, true);
 
     if (!os)
         throw Base::IOError("saving fragments to library '" + outputFile + "' failed");
@@ -773,9 +887,10 @@ std::size_t GenFragLibImpl::doReadNextMolecule(CDPL::Chem::Molecule& mol)
 {
     while (true) {
         try {
-            printProgress("Generating Fragments...   ", double(inputReader.getRecordIndex()) / inputReader.getNumRecords());
+            printProgress("Generating Fragments...   ", endRecordIndex > startRecordIndex ?
+                          double(inputReader.getRecordIndex() - startRecordIndex) / (endRecordIndex - startRecordIndex) : 1.0);
 
-            if (inputReader.getRecordIndex() >= inputReader.getNumRecords()) 
+            if (inputReader.getRecordIndex() >= endRecordIndex) 
                 return 0;
 
             if (!inputReader.read(mol)) {
@@ -815,6 +930,20 @@ void GenFragLibImpl::checkInputFiles() const
         throw Base::IOError("updated output library '" + outputFile + "' does not exist");
 }
 
+void GenFragLibImpl::checkShardingOptions() const
+{
+    if (numShards == 0)
+        throwValidationError("num-shards");
+
+    if (shardIndex >= numShards)
+        throwValidationError("shard-index");
+
+    // fragment occurrence counts of a single shard do not allow to decide which fragments belong into a size limited library
+
+    if (numShards > 1 && maxLibSize > 0)
+        throwValidationError("max-lib-size");
+}
+
 void GenFragLibImpl::printMessage(VerbosityLevel level, const std::string& msg, bool nl, bool file_only)
 {
     if (numThreads == 0) {
@@ -839,6 +968,9 @@ void GenFragLibImpl::printOptionSummary()
      printMessage(VERBOSE,     " Mode:                                " + getModeString());
      printMessage(VERBOSE,     " Preset:                              " + preset);
 
+    if (mode == MERGE)
+        printMessage(VERBOSE, " Merge Rule:                          " + getMergeRuleString());
+
     if (mode != MERGE) {
         printMessage(VERBOSE, " Multithreading:                      " + std::string(numThreads > 0 ? "Yes" : "No"));
 
@@ -847,6 +979,13 @@ void GenFragLibImpl::printOptionSummary()
 
         printMessage(VERBOSE, " Input File Format:                   " + (!inputFormat.empty() ? inputFormat : std::string("Auto-detect")));
         printMessage(VERBOSE, " Max. Output Library Size:            " + std::to_string(maxLibSize));
+        printMessage(VERBOSE, " Number of Shards:                    " + std::to_string(numShards));
+
+        if (numShards > 1) {
+            printMessage(VERBOSE, " Shard Index:                         " + std::to_string(shardIndex));
+            printMessage(VERBOSE, " Sharding Mode:                       " + getShardingModeString());
+        }
+
         printMessage(VERBOSE, " Timeout:                             " + std::to_string(settings.getMacrocycleSettings().getTimeout() / 1000) + "s");
         printMessage(VERBOSE, " Min. RMSD:                           " + (boost::format("%.4f") % settings.getMacrocycleSettings().getMinRMSD()).str());
         printMessage(VERBOSE, " Energy Window:                       " + std::to_string(settings.getSmallRingSystemSettings().getEnergyWindow()));
@@ -881,11 +1020,10 @@ void GenFragLibImpl::initInputReader()
             return;
 
         const std::string& file_path = inputFiles[i];
-        Chem::MoleculeReader::SharedPointer reader_ptr;
+        CompMoleculeReader::ReaderPointer reader_ptr;
 
         try {
-            reader_ptr.reset(inputFormat.empty() ? new Chem::MoleculeReader(file_path) :
-                             new Chem::MoleculeReader(file_path, inputFormat));
+            reader_ptr = CmdLineLib::createInputReader<Chem::Molecule, Chem::BasicMolecule>(file_path, inputFormat, numThreads);
 
         } catch (const Base::IOError& e) {
             throw Base::IOError("no input handler found for file '" + file_path + '\'');
@@ -910,6 +1048,22 @@ void GenFragLibImpl::initInputReader()
         return;
 
     printMessage(INFO, " - Found " + std::to_string(inputReader.getNumRecords()) + " input molecule(s)");
+
+    startRecordIndex = 0;
+    endRecordIndex = inputReader.getNumRecords();
+
+    if (numShards > 1 && shardingMode == SHARD_BY_RECORDS) {
+        std::size_t num_recs = endRecordIndex;
+
+        startRecordIndex = num_recs * shardIndex / numShards;
+        endRecordIndex = num_recs * (shardIndex + 1) / numShards;
+
+        inputReader.setRecordIndex(startRecordIndex);
+
+        printMessage(INFO, " - Processing shard molecule(s) " + std::to_string(startRecordIndex + 1) + " to " +
+                     std::to_string(endRecordIndex));
+    }
+
     printMessage(INFO, "");
 }
 
@@ -929,6 +1083,28 @@ std::string GenFragLibImpl::getModeString() const
     return "UNKNOWN";
 }
 
+std::string GenFragLibImpl::getShardingModeString() const
+{
+    if (shardingMode == SHARD_BY_RECORDS)
+        return "RECORDS";
+
+    if (shardingMode == SHARD_BY_HASH)
+        return "HASH";
+
+    return "UNKNOWN";
+}
+
+std::string GenFragLibImpl::getMergeRuleString() const
+{
+    if (mergeRule == KEEP_FIRST)
+        return "FIRST";
+
+    if (mergeRule == MAX_CONFORMERS)
+        return "MAX_CONFS";
+
+    return "UNKNOWN";
+}
+
 std::string GenFragLibImpl::createMoleculeIdentifier(std::size_t rec_idx, const CDPL::Chem::Molecule& mol)
 {
     if (!getName(mol).empty())
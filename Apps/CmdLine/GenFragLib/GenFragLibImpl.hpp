@@ -71,6 +71,20 @@ namespace GenFragLib
             MERGE
         };
 
+        enum ShardingMode
+        {
+
+            SHARD_BY_RECORDS,
+            SHARD_BY_HASH
+        };
+
+        enum MergeRule
+        {
+
+            KEEP_FIRST,
+            MAX_CONFORMERS
+        };
+
         const char* getProgName() const;
         const char* getProgAboutText() const;
 
@@ -85,6 +99,8 @@ namespace GenFragLib
         void setSmallRingSystemSamplingFactor(std::size_t factor);
         void setForceFieldType(const std::string& type_str);
         void setMode(const std::string& mode_str);
+        void setShardingMode(const std::string& mode_str);
+        void setMergeRule(const std::string& rule_str);
         void setInputFormat(const std::string& file_ext);
 
         int process();
@@ -93,6 +109,10 @@ namespace GenFragLib
         void processSingleThreaded();
         void processMultiThreaded();
 
+        bool isFragmentInShard(std::uint64_t hash_code) const;
+        bool isPreferredMergeEntry(const CDPL::ConfGen::FragmentLibraryEntry& entry,
+                                   const CDPL::ConfGen::FragmentLibraryEntry& curr_entry) const;
+
         void loadFragmentLibrary(const std::string& fname, FragmentLibrary& lib);
         int  saveFragmentLibrary();
 
@@ -110,10 +130,13 @@ namespace GenFragLib
                              std::size_t num_added_frags, std::size_t num_gen_confs);
 
         void checkInputFiles() const;
+        void checkShardingOptions() const;
         void printOptionSummary();
         void initInputReader();
 
         std::string getModeString() const;
+        std::string getShardingModeString() const;
+        std::string getMergeRuleString() const;
 
         std::string createMoleculeIdentifier(std::size_t rec_idx, const CDPL::Chem::Molecule& mol);
         std::string createMoleculeIdentifier(std::size_t rec_idx);
@@ -136,6 +159,12 @@ namespace GenFragLib
         ConformerGeneratorSettings     settings;
         std::string                    preset;
         std::size_t                    maxLibSize;
+        std::size_t                    numShards;
+        std::size_t                    shardIndex;
+        ShardingMode                   shardingMode;
+        MergeRule                      mergeRule;
+        std::size_t                    startRecordIndex;
+        std::size_t                    endRecordIndex;
         std::string                    inputFormat;
         CompMoleculeReader             inputReader;
         FragmentLibrary::SharedPointer fragmentLibPtr;
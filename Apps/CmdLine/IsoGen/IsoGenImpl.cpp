@@ -26,6 +26,7 @@
 #include <chrono>
 #include <iterator>
 #include <functional>
+#include <thread>
 
 #include "CDPL/Chem/BasicMolecule.hpp"
 #include "CDPL/Chem/ControlParameterFunctions.hpp"
@@ -73,12 +74,47 @@ public:
 };
 
 
+namespace
+{
+
+    void setStereoDescriptors(CDPL::Chem::Molecule& mol, const CDPL::Chem::StereoisomerGenerator::StereoDescriptorArray& atom_descrs,
+                              const CDPL::Chem::StereoisomerGenerator::StereoDescriptorArray& bond_descrs)
+    {
+        using namespace CDPL;
+
+        Util::forEachPair(mol.getAtomsBegin(), mol.getAtomsEnd(), atom_descrs.getElementsBegin(),
+                          static_cast<void (*)(Chem::Atom&, const Chem::StereoDescriptor&)>(&Chem::setStereoDescriptor));
+        Util::forEachPair(mol.getBondsBegin(), mol.getBondsEnd(), bond_descrs.getElementsBegin(),
+                          static_cast<void (*)(Chem::Bond&, const Chem::StereoDescriptor&)>(&Chem::setStereoDescriptor));
+    }
+}
+
+
+class IsoGenImpl::IsomerData
+{
+
+public:
+    typedef std::shared_ptr<CDPL::Chem::BasicMolecule>               MoleculePtr;
+    typedef CDPL::Chem::StereoisomerGenerator::StereoDescriptorArray StereoDescriptorArray;
+    typedef std::vector<StereoDescriptorArray>                       StereoDescriptorArrayList;
+
+    IsomerData(const MoleculePtr& mol, const std::string& mol_name):
+        molecule(mol), molName(mol_name), firstIsomerNo(1) {}
+
+    MoleculePtr               molecule;
+    std::string               molName;
+    std::size_t               firstIsomerNo;
+    StereoDescriptorArrayList atomDescriptors;
+    StereoDescriptorArrayList bondDescriptors;
+};
+
+
 class IsoGenImpl::IsomerGenerationWorker
 {
 
 public:
     IsomerGenerationWorker(IsoGenImpl* parent):
-        parent(parent) {}
+        parent(parent), molecule(new CDPL::Chem::BasicMolecule()), numProcMols(0), numGenIsomers(0), numTimeouts(0) {}
 
     void operator()() {
         try {
@@ -94,7 +130,21 @@ public:
         }
     }
 
+    std::size_t getNumProcMolecules() const {
+        return numProcMols;
+    }
+
+    std::size_t getNumGenIsomers() const {
+        return numGenIsomers;
+    }
+
+    std::size_t getNumTimeouts() const {
+        return numTimeouts;
+    }
+
 private:
+    typedef IsomerData::MoleculePtr MoleculePtr;
+
     void init() {
         using namespace CDPL;
         using namespace Chem;
@@ -114,83 +164,111 @@ private:
         using namespace CDPL;
         using namespace Chem;
         
-        for (auto& atom: molecule.getAtoms())
+        for (auto& atom: molecule->getAtoms())
             switch (getStereoDescriptor(atom).getConfiguration()) {
 
                 case AtomConfiguration::EITHER:
                 case AtomConfiguration::UNDEF:
-                    setStereoDescriptor(atom, calcStereoDescriptor(atom, molecule, dim));
+                    setStereoDescriptor(atom, calcStereoDescriptor(atom, *molecule, dim));
             }
         
-        for (auto& bond: molecule.getBonds())
+        for (auto& bond: molecule->getBonds())
              switch (getStereoDescriptor(bond).getConfiguration()) {
 
                 case BondConfiguration::EITHER:
                 case BondConfiguration::UNDEF:
-                    setStereoDescriptor(bond, calcStereoDescriptor(bond, molecule, dim));
+                    setStereoDescriptor(bond, calcStereoDescriptor(bond, *molecule, dim));
              }
     }
     
     bool processNextMolecule() {
         using namespace CDPL;
         
-        std::size_t rec_idx = parent->readNextMolecule(molecule);
+        std::size_t mol_idx = 0;
+        std::size_t rec_idx = parent->readNextMolecule(*molecule, mol_idx);
 
         if (!rec_idx)
             return false;
 
-        std::string orig_mol_name = getName(molecule);
+        std::string orig_mol_name = getName(*molecule);
 
         try {
-            calcImplicitHydrogenCounts(molecule, false);
-            setRingFlags(molecule, false);
-            perceiveHybridizationStates(molecule, false);
-            perceiveSSSR(molecule, false);
-            setAromaticityFlags(molecule, false);
+            calcImplicitHydrogenCounts(*molecule, false);
+            setRingFlags(*molecule, false);
+            perceiveHybridizationStates(*molecule, false);
+            perceiveSSSR(*molecule, false);
+            setAromaticityFlags(*molecule, false);
 
-            perceiveAtomStereoCenters(molecule, false, false, !parent->incInvNitrogens,
+            perceiveAtomStereoCenters(*molecule, false, false, !parent->incInvNitrogens,
                                       !parent->incInvNitrogens);
-            perceiveBondStereoCenters(molecule, false, false, true, true,
+            perceiveBondStereoCenters(*molecule, false, false, true, true,
                                       std::min(std::size_t(8), parent->minRingSize));
-            calcAtomStereoDescriptors(molecule, false, 0);
-            calcBondStereoDescriptors(molecule, false, 0);
+            calcAtomStereoDescriptors(*molecule, false, 0);
+            calcBondStereoDescriptors(*molecule, false, 0);
           
-            if (parent->use2DCoords && hasCoordinates(molecule, 2))
+            if (parent->use2DCoords && hasCoordinates(*molecule, 2))
                 perceiveUnspecConfigs(2);
 
-            if (parent->use3DCoords && hasCoordinates(molecule, 3))
+            if (parent->use3DCoords && hasCoordinates(*molecule, 3))
                 perceiveUnspecConfigs(3);
 
-            calcCIPPriorities(molecule, false);
-            perceiveComponents(molecule, false);
-            setAtomSymbolsFromTypes(molecule, false);
+            calcCIPPriorities(*molecule, false);
+            perceiveComponents(*molecule, false);
+            setAtomSymbolsFromTypes(*molecule, false);
 
-            isoGen.setup(molecule);
+            isoGen.setup(*molecule);
+            timer.reset();
 
+            // isomers get written directly as soon as all output of preceding molecules is done, otherwise
+            // they are buffered until it is the molecule's turn
+
+            IsomerDataPtr iso_data(new IsomerData(molecule, orig_mol_name));
+            bool streaming = false;
+            bool timed_out = false;
             std::size_t gen_iso_cnt = 0;
 
             for ( ; parent->maxNumIsomers == 0 || gen_iso_cnt < parent->maxNumIsomers; ) {
-                Util::forEachPair(molecule.getAtomsBegin(), molecule.getAtomsEnd(),
-                                  isoGen.getAtomDescriptors().getElementsBegin(),
-                                  static_cast<void (*)(Chem::Atom&, const Chem::StereoDescriptor&)>(&Chem::setStereoDescriptor));
-                Util::forEachPair(molecule.getBondsBegin(), molecule.getBondsEnd(),
-                                  isoGen.getBondDescriptors().getElementsBegin(),
-                                  static_cast<void (*)(Chem::Bond&, const Chem::StereoDescriptor&)>(&Chem::setStereoDescriptor));
-                
-                if (parent->titleSuffix)
-                    setName(molecule, orig_mol_name + '_' + std::to_string(gen_iso_cnt + 1));
+                if (!streaming && parent->isNextOutputMolecule(mol_idx)) {
+                    parent->writeIsomers(*iso_data);
+                    streaming = true;
+                }
+
+                if (streaming) {
+                    setStereoDescriptors(*molecule, isoGen.getAtomDescriptors(), isoGen.getBondDescriptors());
+                    parent->writeIsomer(*molecule, orig_mol_name, gen_iso_cnt + 1);
+
+                } else {
+                    iso_data->atomDescriptors.push_back(isoGen.getAtomDescriptors());
+                    iso_data->bondDescriptors.push_back(isoGen.getBondDescriptors());
+                }
 
-                parent->writeMolecule(molecule);
                 gen_iso_cnt++;
-                
+
+                if (parent->timeout > 0 && timer.elapsed() >= std::chrono::seconds(parent->timeout)) {
+                    timed_out = true;
+                    break;
+                }
+
                 if (!isoGen.generate())
                     break;
             }
 
+            bool buffered = (!streaming && !iso_data->atomDescriptors.empty());
+
+            parent->finishMolecule(mol_idx, iso_data);
+
+            if (buffered)
+                molecule.reset(new Chem::BasicMolecule());
+
             parent->printMessage(VERBOSE, "Molecule " + parent->createMoleculeIdentifier(rec_idx, orig_mol_name) + ": " +
-                                 std::to_string(gen_iso_cnt) + (gen_iso_cnt == 1 ? " stereoisomer" : " stereoisomers"));
-            parent->numProcMols++;
-            
+                                 std::to_string(gen_iso_cnt) + (gen_iso_cnt == 1 ? " stereoisomer" : " stereoisomers") +
+                                 (timed_out ? " (time limit exceeded)" : ""));
+            numProcMols++;
+            numGenIsomers += gen_iso_cnt;
+
+            if (timed_out)
+                numTimeouts++;
+
             return true;
 
         } catch (const std::exception& e) {
@@ -205,15 +283,19 @@ private:
 
     IsoGenImpl*                       parent;
     CDPL::Chem::StereoisomerGenerator isoGen;
-    CDPL::Chem::BasicMolecule         molecule;
+    MoleculePtr                       molecule;
+    Timer                             timer;
+    std::size_t                       numProcMols;
+    std::size_t                       numGenIsomers;
+    std::size_t                       numTimeouts;
 };
 
 
 IsoGenImpl::IsoGenImpl(): 
-    maxNumIsomers(0), inputFormat(), outputFormat(), enumAtomConfig(true), enumBondConfig(true),
+    numThreads(0), maxNumIsomers(0), timeout(0), inputFormat(), outputFormat(), enumAtomConfig(true), enumBondConfig(true),
     incSpecCtrs(false), incSymCtrs(false), incInvNitrogens(false), incBridgeheads(false), incRingBonds(false), 
-    use2DCoords(true), use3DCoords(false), minRingSize(8), titleSuffix(false), outputWriter(), numProcMols(0),
-    numOutIsomers(0)
+    use2DCoords(true), use3DCoords(false), minRingSize(8), titleSuffix(false), outputWriter(), numReadMols(0),
+    nextOutputMolIdx(0), numOutIsomers(0)
 {
     using namespace std::placeholders;
     
@@ -225,8 +307,15 @@ IsoGenImpl::IsoGenImpl():
               value<std::string>()->notifier(std::bind(&IsoGenImpl::setInputFormat, this, _1)));
     addOption("output-format,O", "Output file format (default: auto-detect from file extension).", 
               value<std::string>()->notifier(std::bind(&IsoGenImpl::setOutputFormat, this, _1)));
+    addOption("num-threads,t", "Number of parallel execution threads (default: no multithreading, implicit value: " +
+              std::to_string(std::thread::hardware_concurrency()) + 
+              " threads, must be >= 0, 0 disables multithreading).", 
+              value<std::size_t>(&numThreads)->implicit_value(std::thread::hardware_concurrency()));
     addOption("max-num-isomers,m", "Maximum number of output stereoisomers per molecule (default: 0, must be >= 0, 0 disables limit).",
               value<std::size_t>(&maxNumIsomers));
+    addOption("timeout,T", "Time in seconds after which the stereoisomer enumeration for a molecule will be stopped "
+              "(default: 0, must be >= 0, 0 disables timeout).",
+              value<std::size_t>(&timeout));
     addOption("enum-atom-cfg,a", "Enumerate configurations of atom stereocenters (default: true).",
               value<bool>(&enumAtomConfig)->implicit_value(true));
     addOption("enum-bond-cfg,b", "Enumerate configurations of bond stereocenters (default: true).",
@@ -352,7 +441,10 @@ int IsoGenImpl::process()
     } else
         printMessage(INFO, "Generating Steroisomers...");
 
-    genIsomers();
+    if (numThreads > 0)
+        processMultiThreaded();
+    else
+        processSingleThreaded();
 
     if (haveErrorMessage()) {
         printMessage(ERROR, "Error: " + errorMessage); 
@@ -365,11 +457,13 @@ int IsoGenImpl::process()
     return EXIT_SUCCESS;
 }
 
-void IsoGenImpl::genIsomers()
+void IsoGenImpl::processSingleThreaded()
 {
     using namespace CDPL;
 
-    IsomerGenerationWorker(this)();
+    IsomerGenerationWorker worker(this);
+
+    worker();
 
     printMessage(INFO, "");
 
@@ -379,32 +473,108 @@ void IsoGenImpl::genIsomers()
     if (termSignalCaught())
         return;
 
-    printStatistics();
+    printStatistics(worker.getNumProcMolecules(), worker.getNumGenIsomers(), worker.getNumTimeouts());
+}
+
+void IsoGenImpl::processMultiThreaded()
+{
+    using namespace CDPL;
+
+    typedef std::shared_ptr<IsomerGenerationWorker> IsomerGenerationWorkerPtr;
+    typedef std::vector<IsomerGenerationWorkerPtr> IsomerGenerationWorkerList;
+    typedef std::vector<std::thread> ThreadGroup;
+    
+    ThreadGroup thread_grp;
+    IsomerGenerationWorkerList worker_list;
+
+    try {
+        for (std::size_t i = 0; i < numThreads; i++) {
+            if (termSignalCaught())
+                break;
+
+            IsomerGenerationWorkerPtr worker_ptr(new IsomerGenerationWorker(this));
+
+            thread_grp.emplace_back(std::bind(&IsomerGenerationWorker::operator(), worker_ptr));
+            worker_list.push_back(worker_ptr);
+        }
+
+    } catch (const std::exception& e) {
+        setErrorMessage(std::string("error while creating worker-threads: ") + e.what());
+
+    } catch (...) {
+        setErrorMessage("unspecified error while creating worker-threads");
+    }
+
+    try {
+        for (auto& thread : thread_grp)
+            thread.join();
+
+    } catch (const std::exception& e) {
+        setErrorMessage(std::string("error while waiting for worker-threads to finish: ") + e.what());
+
+    } catch (...) {
+        setErrorMessage("unspecified error while waiting for worker-threads to finish");
+    }
+    
+    printMessage(INFO, "");
+
+    if (haveErrorMessage())
+        return;
+
+    if (termSignalCaught())
+        return;
+    
+    std::size_t num_proc_mols = 0;
+    std::size_t num_gen_isomers = 0;
+    std::size_t num_timeouts = 0;
+
+    for (const auto& worker : worker_list) {
+        num_proc_mols += worker->getNumProcMolecules();
+        num_gen_isomers += worker->getNumGenIsomers();
+        num_timeouts += worker->getNumTimeouts();
+    }
+
+    printStatistics(num_proc_mols, num_gen_isomers, num_timeouts);
 }
 
 void IsoGenImpl::setErrorMessage(const std::string& msg)
 {
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (errorMessage.empty())
+            errorMessage = msg;
+        return;
+    }
+
     if (errorMessage.empty())
         errorMessage = msg;
 }
 
 bool IsoGenImpl::haveErrorMessage()
 {
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return !errorMessage.empty();
+    }
+
     return !errorMessage.empty();
 }
 
-void IsoGenImpl::printStatistics()
+void IsoGenImpl::printStatistics(std::size_t num_proc_mols, std::size_t num_gen_isomers, std::size_t num_timeouts)
 {
     std::size_t proc_time = std::chrono::duration_cast<std::chrono::seconds>(timer.elapsed()).count();
     
     printMessage(INFO, "Statistics:");
-    printMessage(INFO, " Processed Molecules:     " + std::to_string(numProcMols));
-    printMessage(INFO, " Generated Stereoisomers: " + std::to_string(numOutIsomers));
+    printMessage(INFO, " Processed Molecules:     " + std::to_string(num_proc_mols));
+    printMessage(INFO, " Generated Stereoisomers: " + std::to_string(num_gen_isomers));
+    printMessage(INFO, " Output Stereoisomers:    " + std::to_string(numOutIsomers));
+    printMessage(INFO, " Timed out Molecules:     " + std::to_string(num_timeouts));
     printMessage(INFO, " Processing Time:         " + CmdLineLib::formatTimeDuration(proc_time));
     printMessage(INFO, "");
 }
 
-std::size_t IsoGenImpl::readNextMolecule(CDPL::Chem::Molecule& mol)
+std::size_t IsoGenImpl::readNextMolecule(CDPL::Chem::Molecule& mol, std::size_t& mol_idx)
 {
     if (termSignalCaught())
         return 0;
@@ -412,6 +582,17 @@ std::size_t IsoGenImpl::readNextMolecule(CDPL::Chem::Molecule& mol)
     if (haveErrorMessage())
         return 0;
 
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(readMolMutex);
+
+        return doReadNextMolecule(mol, mol_idx);
+    }
+
+    return doReadNextMolecule(mol, mol_idx);
+}
+
+std::size_t IsoGenImpl::doReadNextMolecule(CDPL::Chem::Molecule& mol, std::size_t& mol_idx)
+{
     while (true) {
         try {
             printProgress("Generating Steroisomers... ", double(inputReader.getRecordIndex()) / inputReader.getNumRecords());
@@ -426,6 +607,8 @@ std::size_t IsoGenImpl::readNextMolecule(CDPL::Chem::Molecule& mol)
                 continue;
             }
             
+            mol_idx = numReadMols++;
+
             return inputReader.getRecordIndex();
 
         } catch (const std::exception& e) {
@@ -441,14 +624,84 @@ std::size_t IsoGenImpl::readNextMolecule(CDPL::Chem::Molecule& mol)
     return 0;
 }
 
-void IsoGenImpl::writeMolecule(const CDPL::Chem::MolecularGraph& mol)
+bool IsoGenImpl::isNextOutputMolecule(std::size_t mol_idx)
+{
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(writeMolMutex);
+
+        return (mol_idx == nextOutputMolIdx);
+    }
+
+    return (mol_idx == nextOutputMolIdx);
+}
+
+void IsoGenImpl::writeIsomer(CDPL::Chem::BasicMolecule& mol, const std::string& mol_name, std::size_t iso_no)
+{
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(writeMolMutex);
+
+        doWriteIsomer(mol, mol_name, iso_no);
+
+    } else
+        doWriteIsomer(mol, mol_name, iso_no);
+}
+
+void IsoGenImpl::writeIsomers(IsomerData& iso_data)
+{
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(writeMolMutex);
+
+        doWriteIsomers(iso_data);
+
+    } else
+        doWriteIsomers(iso_data);
+}
+
+void IsoGenImpl::finishMolecule(std::size_t mol_idx, const IsomerDataPtr& iso_data)
+{
+    std::unique_lock<std::mutex> lock(writeMolMutex, std::defer_lock);
+
+    if (numThreads > 0)
+        lock.lock();
+
+    if (mol_idx != nextOutputMolIdx) {
+        pendingOutput.emplace(mol_idx, iso_data);
+        return;
+    }
+
+    doWriteIsomers(*iso_data);
+
+    // flush the buffered isomers of subsequent molecules that have already been processed
+
+    for (auto it = pendingOutput.find(++nextOutputMolIdx); it != pendingOutput.end(); it = pendingOutput.find(++nextOutputMolIdx)) {
+        doWriteIsomers(*it->second);
+        pendingOutput.erase(it);
+    }
+}
+
+void IsoGenImpl::doWriteIsomer(CDPL::Chem::BasicMolecule& mol, const std::string& mol_name, std::size_t iso_no)
 {
+    if (titleSuffix)
+        setName(mol, mol_name + '_' + std::to_string(iso_no));
+
     if (!outputWriter->write(mol))
         throw CDPL::Base::IOError("could not write generated stereoisomer");
 
     numOutIsomers++;
 }
 
+void IsoGenImpl::doWriteIsomers(IsomerData& iso_data)
+{
+    for (std::size_t i = 0, num_isomers = iso_data.atomDescriptors.size(); i < num_isomers; i++) {
+        setStereoDescriptors(*iso_data.molecule, iso_data.atomDescriptors[i], iso_data.bondDescriptors[i]);
+        doWriteIsomer(*iso_data.molecule, iso_data.molName, iso_data.firstIsomerNo + i);
+    }
+
+    iso_data.firstIsomerNo += iso_data.atomDescriptors.size();
+    iso_data.atomDescriptors.clear();
+    iso_data.bondDescriptors.clear();
+}
+
 void IsoGenImpl::checkInputFiles() const
 {
     using namespace CDPL;
@@ -468,6 +721,13 @@ void IsoGenImpl::checkInputFiles() const
 
 void IsoGenImpl::printMessage(VerbosityLevel level, const std::string& msg, bool nl, bool file_only)
 {
+    if (numThreads == 0) {
+        CmdLineBase::printMessage(level, msg, nl, file_only);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
     CmdLineBase::printMessage(level, msg, nl, file_only);
 }
 
@@ -482,7 +742,13 @@ void IsoGenImpl::printOptionSummary()
     printMessage(VERBOSE, " Output File:                           " + outputFile);
     printMessage(VERBOSE, " Input File Format:                     " + (!inputFormat.empty() ? inputFormat : std::string("Auto-detect")));
     printMessage(VERBOSE, " Output File Format:                    " + (!outputFormat.empty() ? outputFormat : std::string("Auto-detect")));
+    printMessage(VERBOSE, " Multithreading:                        " + std::string(numThreads > 0 ? "Yes" : "No"));
+
+    if (numThreads > 0)
+        printMessage(VERBOSE, " Number of Threads:                     " + std::to_string(numThreads));
+
     printMessage(VERBOSE, " Max. Num. Stereoisomers:               " + std::to_string(maxNumIsomers));
+    printMessage(VERBOSE, " Timeout:                               " + std::to_string(timeout) + "s");
     printMessage(VERBOSE, " Enum. atom configurations:             " + std::string(enumAtomConfig ? "Yes" : "No"));
     printMessage(VERBOSE, " Enum. bond configurations:             " + std::string(enumBondConfig ? "Yes" : "No"));
     printMessage(VERBOSE, " Include specified stereocenters:       " + std::string(incSpecCtrs ? "Yes" : "No"));
@@ -517,11 +783,10 @@ void IsoGenImpl::initInputReader()
             return;
 
         const std::string& file_path = inputFiles[i];
-        Chem::MoleculeReader::SharedPointer reader_ptr;
+        CompMoleculeReader::ReaderPointer reader_ptr;
         
         try {
-            reader_ptr.reset(inputFormat.empty() ? new Chem::MoleculeReader(file_path) :
-                             new Chem::MoleculeReader(file_path, inputFormat));
+            reader_ptr = CmdLineLib::createInputReader<Chem::Molecule, Chem::BasicMolecule>(file_path, inputFormat, numThreads);
 
         } catch (const Base::IOError& e) {
             throw Base::IOError("no input handler found for file '" + file_path + '\'');
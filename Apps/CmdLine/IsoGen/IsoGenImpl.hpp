@@ -28,6 +28,9 @@
 #include <cstddef>
 #include <vector>
 #include <string>
+#include <map>
+#include <memory>
+#include <mutex>
 
 #include "CDPL/Util/CompoundDataReader.hpp"
 #include "CDPL/Chem/MolecularGraphWriter.hpp"
@@ -43,6 +46,7 @@ namespace CDPL
     {
 
         class Molecule;
+        class BasicMolecule;
         class MolecularGraph;
     } // namespace Chem
 } // namespace CDPL
@@ -65,18 +69,32 @@ namespace IsoGen
         void setOutputFormat(const std::string& file_ext);
 
         int process();
-        void genIsomers();
 
-        std::size_t readNextMolecule(CDPL::Chem::Molecule& mol);
+        void processSingleThreaded();
+        void processMultiThreaded();
 
-        void writeMolecule(const CDPL::Chem::MolecularGraph& mol);
+        std::size_t readNextMolecule(CDPL::Chem::Molecule& mol, std::size_t& mol_idx);
+        std::size_t doReadNextMolecule(CDPL::Chem::Molecule& mol, std::size_t& mol_idx);
+
+        class IsomerData;
+
+        typedef std::shared_ptr<IsomerData> IsomerDataPtr;
+
+        bool isNextOutputMolecule(std::size_t mol_idx);
+
+        void writeIsomer(CDPL::Chem::BasicMolecule& mol, const std::string& mol_name, std::size_t iso_no);
+        void writeIsomers(IsomerData& iso_data);
+        void finishMolecule(std::size_t mol_idx, const IsomerDataPtr& iso_data);
+
+        void doWriteIsomer(CDPL::Chem::BasicMolecule& mol, const std::string& mol_name, std::size_t iso_no);
+        void doWriteIsomers(IsomerData& iso_data);
 
         void setErrorMessage(const std::string& msg);
         bool haveErrorMessage();
 
         void printMessage(VerbosityLevel level, const std::string& msg, bool nl = true, bool file_only = false);
 
-        void printStatistics();
+        void printStatistics(std::size_t num_proc_mols, std::size_t num_gen_isomers, std::size_t num_timeouts);
 
         void checkInputFiles() const;
         void printOptionSummary();
@@ -94,11 +112,14 @@ namespace IsoGen
         typedef std::vector<std::string>                             StringList;
         typedef CDPL::Util::CompoundDataReader<CDPL::Chem::Molecule> CompMoleculeReader;
         typedef CDPL::Chem::MolecularGraphWriter::SharedPointer      MoleculeWriterPtr;
+        typedef std::map<std::size_t, IsomerDataPtr>                 IsomerDataMap;
         typedef CDPL::Internal::Timer                                Timer;
 
         StringList         inputFiles;
         std::string        outputFile;
+        std::size_t        numThreads;
         std::size_t        maxNumIsomers;
+        std::size_t        timeout;
         std::string        inputFormat;
         std::string        outputFormat;
         bool               enumAtomConfig;
@@ -114,9 +135,14 @@ namespace IsoGen
         bool               titleSuffix;
         CompMoleculeReader inputReader;
         MoleculeWriterPtr  outputWriter;
+        std::mutex         mutex;
+        std::mutex         readMolMutex;
+        std::mutex         writeMolMutex;
         std::string        errorMessage;
         Timer              timer;
-        std::size_t        numProcMols;
+        std::size_t        numReadMols;
+        std::size_t        nextOutputMolIdx;
+        IsomerDataMap      pendingOutput;
         std::size_t        numOutIsomers;
     };
 } // namespace IsoGen
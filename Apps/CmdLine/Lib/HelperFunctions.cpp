@@ -25,6 +25,13 @@
 #include "HelperFunctions.hpp"
 
 
+bool CmdLineLib::isParallelParsingFormat(const CDPL::Base::DataFormat& fmt)
+{
+    // formats with self-contained records whose readers can safely be used on multiple threads
+
+    return (fmt.matchesName("SDF") || fmt.matchesName("SMILES") || fmt.matchesName("MOL2") || fmt.matchesName("CDF"));
+}
+
 std::string CmdLineLib::formatTimeDuration(std::size_t secs)
 {
     std::string time_str;
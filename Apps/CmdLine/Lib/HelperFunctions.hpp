@@ -29,6 +29,8 @@
 #include <cstddef>
 
 #include "CDPL/Base/DataIOManager.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+#include "CDPL/Util/ParallelDataReader.hpp"
 
 
 namespace CmdLineLib
@@ -94,6 +96,33 @@ namespace CmdLineLib
         }
     }
 
+    bool isParallelParsingFormat(const CDPL::Base::DataFormat& fmt);
+
+    template <typename T, typename ObjType = T>
+    typename CDPL::Base::DataReader<T>::SharedPointer
+    createInputReader(const std::string& file_path, const std::string& fmt, std::size_t num_threads)
+    {
+        using namespace CDPL;
+
+        typename Base::DataIOManager<T>::InputHandlerPointer handler;
+
+        if (fmt.empty()) {
+            for (std::string::size_type i = file_path.find_first_of('.', 0); !handler && i != std::string::npos;
+                 i = file_path.find_first_of('.', i))
+                handler = Base::DataIOManager<T>::getInputHandlerByFileExtension(file_path.substr(++i));
+
+        } else
+            handler = Base::DataIOManager<T>::getInputHandlerByFileExtension(fmt);
+
+        if (!handler)
+            throw Base::IOError("no input handler found for file '" + file_path + '\'');
+
+        const Base::DataFormat& data_fmt = handler->getDataFormat();
+
+        return typename Base::DataReader<T>::SharedPointer(
+            new Util::ParallelDataReader<T, ObjType>(file_path, data_fmt, isParallelParsingFormat(data_fmt) ? num_threads : 0));
+    }
+
     std::string formatTimeDuration(std::size_t secs);
 
 } // namespace CmdLineLib
@@ -582,11 +582,10 @@ void PSDCreateImpl::initInputReader()
             return;
 
         const std::string& file_path = inputFiles[i];
-        Chem::MoleculeReader::SharedPointer reader_ptr;
+        CompMoleculeReader::ReaderPointer reader_ptr;
 
         try {
-            reader_ptr.reset(inputFormat.empty() ? new Chem::MoleculeReader(file_path) :
-                             new Chem::MoleculeReader(file_path, inputFormat));
+            reader_ptr = CmdLineLib::createInputReader<Chem::Molecule, Chem::BasicMolecule>(file_path, inputFormat, numThreads);
 
         } catch (const Base::IOError& e) {
             throw Base::IOError("no input handler found for file '" + file_path + '\'');
@@ -23,6 +23,7 @@
 
 
 #include <cstdlib>
+#include <vector>
 #include <algorithm>
 #include <iterator>
 #include <numeric>
@@ -87,6 +88,30 @@ struct PSDScreenImpl::ScreeningWorker
             scr_proc.setHitCallback(std::bind(&ScreeningWorker::reportHit, this, _1, _2));
             scr_proc.setProgressCallback(std::bind(&ScreeningWorker::reportProgress, this, _1, _2));
 
+            if (parent->singlePass) {
+                std::vector<BasicPharmacophore> query_pharms(parent->numQueryPharms);
+                ScreeningProcessor::QueryPharmacophoreList queries;
+
+                for (queryIndex = 0; queryIndex < parent->numQueryPharms; queryIndex++) {
+                    if (PSDScreenImpl::termSignalCaught() || parent->haveErrorMessage())
+                        return;
+
+                    if (!parent->getQueryPharmacophore(queryIndex, query_pharms[queryIndex]))
+                        return;
+
+                    queries.push_back(&query_pharms[queryIndex]);
+                }
+
+                queryIndex = 0;
+
+                scr_proc.searchDB(queries, startMolIndex, endMolIndex);
+
+                if (parent->printScrStats)
+                    parent->addScreeningStatistics(scr_proc.getStatistics());
+
+                return;
+            }
+
             for (queryIndex = 0; queryIndex < parent->numQueryPharms; queryIndex++) {
                 if (PSDScreenImpl::termSignalCaught() || parent->haveErrorMessage())
                     return;
@@ -95,6 +120,9 @@ struct PSDScreenImpl::ScreeningWorker
                     return;
                 
                 scr_proc.searchDB(query_pharm, startMolIndex, endMolIndex);
+
+                if (parent->printScrStats)
+                    parent->addScreeningStatistics(scr_proc.getStatistics());
             }
 
         } catch (const std::exception& e) {
@@ -120,7 +148,7 @@ struct PSDScreenImpl::ScreeningWorker
 
             if (parent->outputPharmIndex)
                 struc_data->addEntry(PHARM_IDX_PROPERTY_NAME, 
-                                     std::to_string(queryIndex));
+                                     std::to_string(parent->singlePass ? hit.getQueryPharmacophoreIndex() : queryIndex));
             if (parent->outputPharmName)
                 struc_data->addEntry(PHARM_NAME_PROPERTY_NAME, 
                                      getName(hit.getHitPharmacophore()));
@@ -134,7 +162,8 @@ struct PSDScreenImpl::ScreeningWorker
                                                                            hit.getHitAlignmentTransform(),
                                                                            hit.getHitPharmacophoreIndex(),
                                                                            hit.getHitMoleculeIndex(),
-                                                                           hit.getHitConformationIndex()),
+                                                                           hit.getHitConformationIndex(),
+                                                                           hit.getQueryPharmacophoreIndex()),
                                       score);
         }
 
@@ -147,6 +176,9 @@ struct PSDScreenImpl::ScreeningWorker
         
         double progress = double(i) / max_val;
 
+        if (parent->singlePass)
+            return parent->printProgress(workerIndex, progress);
+
         return parent->printProgress(workerIndex, (queryIndex + progress) / parent->numQueryPharms);
     }
 
@@ -160,7 +192,8 @@ struct PSDScreenImpl::ScreeningWorker
 
 PSDScreenImpl::PSDScreenImpl(): 
     checkXVols(true), alignConfs(true), bestAlignments(false), outputScore(true), outputMolIndex(false), 
-    outputConfIndex(false), outputDBName(false), outputPharmName(false), outputPharmIndex(false),  
+    outputConfIndex(false), outputDBName(false), outputPharmName(false), outputPharmIndex(false), uniqueHits(false),
+    printScrStats(false), singlePass(false),
     numThreads(0), startMolIndex(0), endMolIndex(0), maxOmittedFtrs(0),
     matchingMode(CDPL::Pharm::ScreeningProcessor::FIRST_MATCHING_CONF), hitOutputFormat(), 
     queryInputFormat(), numQueryPharms(0), numDBMolecules(0), numDBPharms(0), numHits(0), maxNumHits(0),
@@ -213,6 +246,10 @@ PSDScreenImpl::PSDScreenImpl():
               value<std::string>()->notifier(std::bind(&PSDScreenImpl::setQueryInputFormat, this, _1)));
     addOption("unique-hits,u", "Report molecules matched by multiple query pharmacophores only once (default: false).", 
               value<bool>(&uniqueHits)->implicit_value(true));
+    addOption("stats", "Print per-stage screening filter statistics (default: false).", 
+              value<bool>(&printScrStats)->implicit_value(true));
+    addOption("single-pass", "Screen the database for all query pharmacophores in a single pass (default: false).", 
+              value<bool>(&singlePass)->implicit_value(true));
   
     addOptionLongDescriptions();
 }
@@ -536,6 +573,18 @@ bool PSDScreenImpl::doPrintProgress(std::size_t worker_idx, double progress)
     return false;
 }
 
+void PSDScreenImpl::addScreeningStatistics(const CDPL::Pharm::ScreeningProcessorStatistics& stats)
+{
+    if (numThreads > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        scrStatistics += stats;
+        return;
+    }
+
+    scrStatistics += stats;
+}
+
 void PSDScreenImpl::setErrorMessage(const std::string& msg)
 {
     if (numThreads > 0) {
@@ -591,6 +640,56 @@ void PSDScreenImpl::printStatistics()
     }
 
     printMessage(INFO, " Processing Time:         " + CmdLineLib::formatTimeDuration(proc_time));
+
+    if (printScrStats)
+        printScreeningStatistics();
+}
+
+void PSDScreenImpl::printScreeningStatistics()
+{
+    using namespace CDPL;
+    using namespace Pharm;
+
+    typedef ScreeningProcessorStatistics Statistics;
+
+    auto format_time = [](double secs) {
+        std::ostringstream oss;
+
+        oss << std::fixed << std::setprecision(3) << secs << 's';
+        return oss.str();
+    };
+
+    printMessage(INFO, "");
+    printMessage(INFO, "Screening Statistics:");
+    std::ostringstream hdr_oss;
+
+    hdr_oss << ' ' << std::left << std::setw(30) << "Stage" << std::right << std::setw(10) << "Tested"
+            << std::setw(13) << "Passed" << std::setw(11) << "Pass %" << std::setw(10) << "Time";
+
+    printMessage(INFO, hdr_oss.str());
+
+    for (std::size_t i = 0; i < Statistics::NUM_STAGES; i++) {
+        Statistics::Stage stage = Statistics::Stage(i);
+        std::ostringstream oss;
+
+        oss << ' ' << std::left << std::setw(30) << Statistics::getStageName(stage) << std::right
+            << std::setw(10) << scrStatistics.getNumTested(stage)
+            << std::setw(13) << scrStatistics.getNumPassed(stage)
+            << std::setw(11) << std::fixed << std::setprecision(2) << (scrStatistics.getPassRate(stage) * 100.0)
+            << std::setw(10) << format_time(scrStatistics.getStageTime(stage));
+
+        printMessage(INFO, oss.str());
+    }
+
+    printMessage(INFO, " Num. Screened Pharmacophores:    " + std::to_string(scrStatistics.getCounter(Statistics::NUM_SCREENED_PHARMACOPHORES)));
+    printMessage(INFO, " Num. Skipped Pharmacophores:     " + std::to_string(scrStatistics.getCounter(Statistics::NUM_SKIPPED_PHARMACOPHORES)));
+    printMessage(INFO, " Num. Loaded Pharmacophores:      " + std::to_string(scrStatistics.getCounter(Statistics::NUM_LOADED_PHARMACOPHORES)));
+    printMessage(INFO, " Num. Loaded Molecules:           " + std::to_string(scrStatistics.getCounter(Statistics::NUM_LOADED_MOLECULES)));
+    printMessage(INFO, " Num. Bytes Read:                 " + std::to_string(scrStatistics.getCounter(Statistics::NUM_BYTES_READ)));
+    printMessage(INFO, " Pharmacophore Load Time:         " + format_time(scrStatistics.getPharmacophoreLoadTime()));
+    printMessage(INFO, " Molecule Load Time:              " + format_time(scrStatistics.getMoleculeLoadTime()));
+    printMessage(INFO, " Data Decoding Time:              " + format_time(scrStatistics.getDataDecodingTime()));
+    printMessage(INFO, " Accumulated Search Time:         " + format_time(scrStatistics.getTotalTime()));
 }
 
 void PSDScreenImpl::checkInputFiles() const
@@ -625,6 +724,8 @@ void PSDScreenImpl::printOptionSummary()
     printMessage(VERBOSE, " Output Pharm. Name Property:  " + std::string(outputPharmName ? "Yes" : "No"));
     printMessage(VERBOSE, " Output Pharm. Index Property: " + std::string(outputPharmIndex ? "Yes" : "No"));
     printMessage(VERBOSE, " Unique Hits:                  " + std::string(uniqueHits ? "Yes" : "No"));
+    printMessage(VERBOSE, " Print Screening Statistics:   " + std::string(printScrStats ? "Yes" : "No"));
+    printMessage(VERBOSE, " Single Pass Screening:        " + std::string(singlePass ? "Yes" : "No"));
     printMessage(VERBOSE, " Multithreading:               " + std::string(numThreads > 0 ? "Yes" : "No"));
 
     if (numThreads > 0)
@@ -33,6 +33,7 @@
 #include <unordered_set>
 
 #include "CDPL/Pharm/ScreeningProcessor.hpp"
+#include "CDPL/Pharm/ScreeningProcessorStatistics.hpp"
 #include "CDPL/Pharm/PharmacophoreReader.hpp"
 #include "CDPL/Chem/MolecularGraphWriter.hpp"
 #include "CDPL/Internal/Timer.hpp"
@@ -88,6 +89,7 @@ namespace PSDScreen
         bool haveErrorMessage();
 
         void printStatistics();
+        void printScreeningStatistics();
         void printOptionSummary();
 
         void checkInputFiles() const;
@@ -101,6 +103,8 @@ namespace PSDScreen
         bool collectHit(const SearchHit& hit, double score);
         bool doCollectHit(const SearchHit& hit, double score);
 
+        void addScreeningStatistics(const CDPL::Pharm::ScreeningProcessorStatistics& stats);
+
         bool printProgress(std::size_t worker_idx, double progress);
         bool doPrintProgress(std::size_t worker_idx, double progress);
 
@@ -129,6 +133,8 @@ namespace PSDScreen
         bool                outputPharmName;
         bool                outputPharmIndex;
         bool                uniqueHits;
+        bool                printScrStats;
+        bool                singlePass;
         std::size_t         numThreads;
         std::size_t         startMolIndex;
         std::size_t         endMolIndex;
@@ -151,6 +157,7 @@ namespace PSDScreen
         std::size_t         maxNumHits;
         int                 lastProgValue;
         WorkerProgressArray workerProgArray;
+        CDPL::Pharm::ScreeningProcessorStatistics scrStatistics;
     };
 } // namespace PSDScreen
 
@@ -1173,8 +1173,7 @@ void ShapeScreenImpl::initDatabaseReader()
         return;
 
     try {
-        databaseReader.reset(databaseFormat.empty() ? new Chem::MoleculeReader(databaseFile) :
-                                                      new Chem::MoleculeReader(databaseFile, databaseFormat));
+        databaseReader = CmdLineLib::createInputReader<Chem::Molecule, Chem::BasicMolecule>(databaseFile, databaseFormat, numThreads);
 
     } catch (const Base::IOError& e) {
         throw Base::IOError("no input handler found for screening database file '" + databaseFile + '\'');
@@ -160,14 +160,14 @@ namespace ShapeScreen
 
         std::string getOutputFileName(const std::string& file_name_tmplt, std::size_t query_mol_idx) const;
 
-        typedef std::shared_ptr<std::ostream>             OStreamPtr;
-        typedef CDPL::Chem::MoleculeReader::SharedPointer MoleculeReaderPtr;
-        typedef std::vector<MoleculePtr>                  QueryMoleculeList;
-        typedef std::multiset<HitMoleculeData>            HitList;
-        typedef std::vector<HitList>                      HitListArray;
-        typedef std::vector<OStreamPtr>                   OStreamArray;
-        typedef std::vector<MoleculeWriterPtr>            MoleculeWriterArray;
-        typedef CDPL::Internal::Timer                     Timer;
+        typedef std::shared_ptr<std::ostream>                             OStreamPtr;
+        typedef CDPL::Base::DataReader<CDPL::Chem::Molecule>::SharedPointer MoleculeReaderPtr;
+        typedef std::vector<MoleculePtr>                                  QueryMoleculeList;
+        typedef std::multiset<HitMoleculeData>                            HitList;
+        typedef std::vector<HitList>                                      HitListArray;
+        typedef std::vector<OStreamPtr>                                   OStreamArray;
+        typedef std::vector<MoleculeWriterPtr>                            MoleculeWriterArray;
+        typedef CDPL::Internal::Timer                                     Timer;
 
         std::string         queryFile;
         std::string         databaseFile;
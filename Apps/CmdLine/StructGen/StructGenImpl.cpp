@@ -192,6 +192,9 @@ private:
                 ret_code = structGen.generate(molecule);
 
             if (!no_fss_match) {
+                if (ret_code != ReturnCode::ABORTED && parent->statsOutput.is_open())
+                    parent->writeStatistics(structGen.getStatistics(), rec_idx, molecule, ret_code);
+
                 switch (ret_code) {
 
                     case ReturnCode::ABORTED:
@@ -423,6 +426,9 @@ StructGenImpl::StructGenImpl():
               value<std::string>(&outputFile)->required());
     addOption("failed,f", "Failed molecule output file.", 
               value<std::string>(&failedFile));
+    addOption("stats-file", "Per-molecule structure generation statistics output file (JSON lines format, "
+              "one object with stage times and counter values per processed molecule).",
+              value<std::string>(&statsFile));
     addOption("num-threads,t", "Number of parallel execution threads (default: no multithreading, implicit value: " +
               std::to_string(std::thread::hardware_concurrency()) + 
               " threads, must be >= 0, 0 disables multithreading).", 
@@ -755,6 +761,7 @@ int StructGenImpl::process()
 
     initInputReader();
     initOutputWriters();
+    initStatisticsOutput();
 
     if (termSignalCaught())
         return EXIT_FAILURE;
@@ -987,6 +994,17 @@ void StructGenImpl::doWriteMolecule(const CDPL::Chem::MolecularGraph& mol, bool
         throw CDPL::Base::IOError("could not write generated conformers");
 }
 
+void StructGenImpl::writeStatistics(const CDPL::ConfGen::ConformerGeneratorStatistics& stats, std::size_t rec_idx,
+                                    const CDPL::Chem::Molecule& mol, unsigned int ret_code)
+{
+    std::string json_rec = ConfGen::statisticsToJSON(stats, rec_idx, getName(mol), ret_code);
+
+    std::lock_guard<std::mutex> lock(writeStatsMutex);
+
+    if (!(statsOutput << json_rec << '\n'))
+        throw CDPL::Base::IOError("could not write structure generation statistics");
+}
+
 void StructGenImpl::checkInputFiles() const
 {
     using namespace CDPL;
@@ -1122,6 +1140,7 @@ void StructGenImpl::printOptionSummary()
 
     printMessage(VERBOSE, " Output File:                         " + outputFile);
     printMessage(VERBOSE, " Failed Molecule Output File:         " + (failedFile.empty() ? std::string("None") : failedFile));
+    printMessage(VERBOSE, " Statistics Output File:              " + (statsFile.empty() ? std::string("None") : statsFile));
     printMessage(VERBOSE, " Fragment Build Preset:               " + fragBuildPreset);
     printMessage(VERBOSE, " Structure Generation Mode:           " + getGenerationModeString());
     printMessage(VERBOSE, " Sample Whole Tor. Angle Tol. Range:  " + std::string(settings.sampleAngleToleranceRanges() ? "Yes" : "No"));
@@ -1197,6 +1216,15 @@ void StructGenImpl::loadFragmentLibrary()
     if (fragmentLibName.empty())
         return;
 
+    fragmentLib.reset(new FragmentLibrary());
+
+    if (fragmentLib->mapFile(fragmentLibName)) {
+        printMessage(INFO, "Mapped Fragment Library '" + fragmentLibName + "'");
+        printMessage(INFO, " - Indexed " + std::to_string(fragmentLib->getNumMappedEntries()) + " fragments");
+        printMessage(INFO, "");
+        return;
+    }
+
     std::ifstream is(fragmentLibName);
 
     if (!is) 
@@ -1204,7 +1232,6 @@ void StructGenImpl::loadFragmentLibrary()
 
     printMessage(INFO, "Loading Fragment Library '" + fragmentLibName + "'...");
 
-    fragmentLib.reset(new FragmentLibrary());
     fragmentLib->load(is);
 
     if (StructGenImpl::termSignalCaught())
@@ -1237,11 +1264,10 @@ void StructGenImpl::initInputReader()
             return;
 
         const std::string& file_path = inputFiles[i];
-        Chem::MoleculeReader::SharedPointer reader_ptr;
+        CompMoleculeReader::ReaderPointer reader_ptr;
 
         try {
-            reader_ptr.reset(inputFormat.empty() ? new Chem::MoleculeReader(file_path) :
-                             new Chem::MoleculeReader(file_path, inputFormat));
+            reader_ptr = CmdLineLib::createInputReader<Chem::Molecule, Chem::BasicMolecule>(file_path, inputFormat, numThreads);
 
         } catch (const Base::IOError& e) {
             throw Base::IOError("no input handler found for file '" + file_path + '\'');
@@ -1298,6 +1324,17 @@ void StructGenImpl::initOutputWriters()
     }
 }
 
+void StructGenImpl::initStatisticsOutput()
+{
+    if (statsFile.empty())
+        return;
+
+    statsOutput.open(statsFile.c_str(), std::ios_base::out | std::ios_base::trunc);
+
+    if (!statsOutput)
+        throw CDPL::Base::IOError("opening statistics output file '" + statsFile + "' failed");
+}
+
 std::string StructGenImpl::getGenerationModeString() const
 {
     using namespace CDPL::ConfGen;
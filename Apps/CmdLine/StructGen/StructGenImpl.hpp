@@ -28,12 +28,14 @@
 #include <cstddef>
 #include <vector>
 #include <string>
+#include <fstream>
 #include <mutex>
 
 #include "CDPL/Util/CompoundDataReader.hpp"
 #include "CDPL/Chem/MolecularGraphWriter.hpp"
 #include "CDPL/Chem/Molecule.hpp"
 #include "CDPL/ConfGen/StructureGeneratorSettings.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/ConfGen/TorsionLibrary.hpp"
 #include "CDPL/ConfGen/FragmentLibrary.hpp"
 #include "CDPL/Internal/Timer.hpp"
@@ -101,6 +103,9 @@ namespace StructGen
         void writeMolecule(const CDPL::Chem::MolecularGraph& mol, bool failed);
         void doWriteMolecule(const CDPL::Chem::MolecularGraph& mol, bool failed);
 
+        void writeStatistics(const CDPL::ConfGen::ConformerGeneratorStatistics& stats, std::size_t rec_idx,
+                             const CDPL::Chem::Molecule& mol, unsigned int ret_code);
+
         void setErrorMessage(const std::string& msg);
         bool haveErrorMessage();
 
@@ -115,6 +120,7 @@ namespace StructGen
         void loadFragmentLibrary();
         void initInputReader();
         void initOutputWriters();
+        void initStatisticsOutput();
 
         std::string getGenerationModeString() const;
 
@@ -139,6 +145,7 @@ namespace StructGen
         StringList                 inputFiles;
         std::string                outputFile;
         std::string                failedFile;
+        std::string                statsFile;
         std::size_t                numThreads;
         StructureGeneratorSettings settings;
         std::string                fragBuildPreset;
@@ -165,9 +172,11 @@ namespace StructGen
         MoleculeWriterPtr          outputWriter;
         std::string                failedOutputFormat;
         MoleculeWriterPtr          failedOutputWriter;
+        std::ofstream              statsOutput;
         std::mutex                 mutex;
         std::mutex                 readMolMutex;
         std::mutex                 writeMolMutex;
+        std::mutex                 writeStatsMutex;
         std::string                errorMessage;
         Timer                      timer;
     };
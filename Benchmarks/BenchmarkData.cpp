@@ -0,0 +1,109 @@
+/*
+ * BenchmarkData.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+
+#include "CDPL/Chem/SDFMoleculeReader.hpp"
+#include "CDPL/Chem/AtomContainerFunctions.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+using namespace CDPL;
+
+
+namespace
+{
+
+    CDPLBenchmarks::MoleculeList readMolecules()
+    {
+        std::string   file_path = CDPLBenchmarks::getDatasetFilePath(CDPLBenchmarks::DATASET_FILE_NAME);
+        std::ifstream is(file_path);
+
+        if (!is)
+            throw std::runtime_error("could not open benchmark dataset file '" + file_path + '\'');
+
+        Chem::SDFMoleculeReader      reader(is);
+        CDPLBenchmarks::MoleculeList mols;
+
+        while (mols.size() < CDPLBenchmarks::NUM_DATASET_MOLECULES) {
+            Chem::BasicMolecule::SharedPointer mol_ptr(new Chem::BasicMolecule());
+
+            if (!reader.read(*mol_ptr))
+                break;
+
+            mols.push_back(mol_ptr);
+        }
+
+        if (mols.empty())
+            throw std::runtime_error("benchmark dataset file '" + file_path + "' does not contain any molecules");
+
+        return mols;
+    }
+}
+
+
+std::string CDPLBenchmarks::getDatasetFilePath(const std::string& file_name)
+{
+    if (const char* data_dir = std::getenv("CDPKIT_BENCHMARK_DATA_DIR"))
+        return (std::string(data_dir) + '/' + file_name);
+
+    return (std::string(CDPKIT_BENCHMARK_DATA_DIR) + '/' + file_name);
+}
+
+const CDPLBenchmarks::MoleculeList& CDPLBenchmarks::getRawMolecules()
+{
+    static const MoleculeList mols = readMolecules();
+
+    return mols;
+}
+
+const CDPLBenchmarks::MoleculeList& CDPLBenchmarks::getPreparedMolecules()
+{
+    static const MoleculeList mols = []() {
+        MoleculeList prep_mols;
+
+        for (const auto& mol : getRawMolecules()) {
+            prep_mols.emplace_back(new Chem::BasicMolecule(*mol));
+            prepareMolecule(*prep_mols.back());
+        }
+
+        return prep_mols;
+    }();
+
+    return mols;
+}
+
+void CDPLBenchmarks::prepareMolecule(Chem::Molecule& mol)
+{
+    Chem::calcImplicitHydrogenCounts(mol, false);
+    Chem::perceiveHybridizationStates(mol, false);
+    Chem::perceiveSSSR(mol, false);
+    Chem::setRingFlags(mol, false);
+    Chem::setAromaticityFlags(mol, false);
+    Chem::perceiveComponents(mol, false);
+}
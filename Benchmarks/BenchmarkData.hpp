@@ -0,0 +1,69 @@
+/*
+ * BenchmarkData.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef CDPL_BENCHMARKS_BENCHMARKDATA_HPP
+#define CDPL_BENCHMARKS_BENCHMARKDATA_HPP
+
+#include <vector>
+#include <string>
+
+#include "CDPL/Chem/BasicMolecule.hpp"
+
+
+namespace CDPLBenchmarks
+{
+
+    typedef std::vector<CDPL::Chem::BasicMolecule::SharedPointer> MoleculeList;
+
+    /*
+     * Returns the path of the specified file in the dataset directory. The directory defaults to the
+     * Data/Datasets directory of the source tree and can be overridden by the environment variable
+     * CDPKIT_BENCHMARK_DATA_DIR.
+     */
+    std::string getDatasetFilePath(const std::string& file_name);
+
+    /*
+     * Returns the first NUM_DATASET_MOLECULES molecules of the benchmark dataset as read from the SD-file
+     * (hydrogen complete, with 3D coordinates) without any further processing.
+     */
+    const MoleculeList& getRawMolecules();
+
+    /*
+     * Returns copies of the molecules returned by getRawMolecules() with all structural properties (implicit
+     * hydrogen counts, hybridization states, SSSR, ring and aromaticity flags, components) needed by the
+     * benchmarked algorithms perceived in advance.
+     */
+    const MoleculeList& getPreparedMolecules();
+
+    void prepareMolecule(CDPL::Chem::Molecule& mol);
+
+    /*
+     * The benchmark input gets fixed by the dataset file and the number of molecules read from it
+     * which makes results of different builds comparable.
+     */
+    constexpr const char* DATASET_FILE_NAME     = "LogSTrainingSetMolecules.sdf";
+    constexpr std::size_t NUM_DATASET_MOLECULES = 250;
+} // namespace CDPLBenchmarks
+
+#endif // CDPL_BENCHMARKS_BENCHMARKDATA_HPP
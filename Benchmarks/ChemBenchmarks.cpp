@@ -0,0 +1,99 @@
+/*
+ * ChemBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the performance of substructure searching with a set of SMARTS patterns of varying complexity
+ * on the molecules of the benchmark dataset.
+ */
+
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/Chem/SubstructureSearch.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/UtilityFunctions.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    const char* QUERY_PATTERNS[] = {
+        "c1ccccc1",                           // benzene ring
+        "[CX3](=O)[OX2H1]",                   // carboxylic acid
+        "[NX3;H2,H1;!$(NC=O)]",               // primary or secondary amine
+        "[#6]~[#7,#8]~[#6]~[#6]~[#7,#8]",     // generic chain
+        "[R2;a]@[R2;a]",                      // aromatic ring fusion
+        "[$([OH]-c1ccccc1),$([SH]-c1ccccc1)]" // phenol or thiophenol (recursive SMARTS)
+    };
+
+    constexpr std::size_t NUM_QUERY_PATTERNS = sizeof(QUERY_PATTERNS) / sizeof(const char*);
+
+
+    const CDPLBenchmarks::MoleculeList& getTargetMolecules()
+    {
+        static const CDPLBenchmarks::MoleculeList mols = []() {
+            CDPLBenchmarks::MoleculeList tgt_mols;
+
+            for (const auto& mol : CDPLBenchmarks::getPreparedMolecules()) {
+                tgt_mols.emplace_back(new Chem::BasicMolecule(*mol));
+
+                Chem::initSubstructureSearchTarget(*tgt_mols.back(), false);
+            }
+
+            return tgt_mols;
+        }();
+
+        return mols;
+    }
+
+    void BM_SubstructureSearch(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = getTargetMolecules();
+        Chem::Molecule::SharedPointer       query = Chem::parseSMARTS(QUERY_PATTERNS[state.range(0)]);
+        Chem::SubstructureSearch            sub_search(*query);
+        std::size_t                         num_hits = 0;
+
+        sub_search.setMaxNumMappings(1);
+
+        for (auto _ : state) {
+            num_hits = 0;
+
+            for (const auto& mol : mols)
+                num_hits += sub_search.findMappings(*mol);
+        }
+
+        state.SetLabel(QUERY_PATTERNS[state.range(0)]);
+        state.SetItemsProcessed(state.iterations() * mols.size());
+        state.counters["hits"] = num_hits;
+    }
+} // namespace
+
+
+BENCHMARK(BM_SubstructureSearch)->DenseRange(0, NUM_QUERY_PATTERNS - 1)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,136 @@
+/*
+ * ConfGenBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the time needed by ConfGen::ConformerGenerator for the generation of a conformer ensemble (default
+ * settings) for each of the first molecules of the benchmark dataset. The cold start benchmarks additionally
+ * measure the loading of the builtin torsion library and the first conformer generation run with a freshly
+ * loaded library.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/ConfGen/ConformerGenerator.hpp"
+#include "CDPL/ConfGen/MoleculeFunctions.hpp"
+#include "CDPL/ConfGen/ReturnCode.hpp"
+#include "CDPL/ConfGen/TorsionLibrary.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    constexpr std::size_t NUM_MOLECULES = 10;
+
+
+    const CDPLBenchmarks::MoleculeList& getMolecules()
+    {
+        static const CDPLBenchmarks::MoleculeList mols = []() {
+            CDPLBenchmarks::MoleculeList confgen_mols;
+
+            for (const auto& mol : CDPLBenchmarks::getRawMolecules()) {
+                if (confgen_mols.size() == NUM_MOLECULES)
+                    break;
+
+                confgen_mols.emplace_back(new Chem::BasicMolecule(*mol));
+
+                ConfGen::prepareForConformerGeneration(*confgen_mols.back());
+            }
+
+            return confgen_mols;
+        }();
+
+        return mols;
+    }
+
+    void BM_ConformerGeneration(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = getMolecules();
+
+        if (std::size_t(state.range(0)) >= mols.size()) {
+            state.SkipWithError("molecule index out of range");
+            return;
+        }
+
+        const Chem::MolecularGraph& mol = *mols[state.range(0)];
+        ConfGen::ConformerGenerator conf_gen;
+        unsigned int                ret_code = ConfGen::ReturnCode::SUCCESS;
+
+        for (auto _ : state)
+            ret_code = conf_gen.generate(mol);
+
+        state.SetLabel("atoms: " + std::to_string(mol.getNumAtoms()));
+        state.counters["confs"] = conf_gen.getNumConformers();
+        state.counters["ret_code"] = ret_code;
+    }
+
+    void BM_TorsionLibraryLoading(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            ConfGen::TorsionLibrary tor_lib;
+
+            tor_lib.loadDefaults();
+
+            benchmark::DoNotOptimize(tor_lib.getNumCategories());
+        }
+    }
+
+    void BM_ColdStartConformerGeneration(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = getMolecules();
+
+        if (mols.empty()) {
+            state.SkipWithError("no molecules available");
+            return;
+        }
+
+        const Chem::MolecularGraph& mol = *mols.front();
+        unsigned int                ret_code = ConfGen::ReturnCode::SUCCESS;
+
+        for (auto _ : state) {
+            ConfGen::TorsionLibrary::SharedPointer tor_lib(new ConfGen::TorsionLibrary());
+
+            tor_lib->loadDefaults();
+            ConfGen::TorsionLibrary::set(tor_lib);
+
+            ConfGen::ConformerGenerator conf_gen;
+
+            ret_code = conf_gen.generate(mol);
+        }
+
+        ConfGen::TorsionLibrary::set(ConfGen::TorsionLibrary::SharedPointer());
+
+        state.SetLabel("atoms: " + std::to_string(mol.getNumAtoms()));
+        state.counters["ret_code"] = ret_code;
+    }
+} // namespace
+
+
+BENCHMARK(BM_ConformerGeneration)->DenseRange(0, NUM_MOLECULES - 1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TorsionLibraryLoading)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ColdStartConformerGeneration)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,85 @@
+/*
+ * DescrBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the performance of ECFP (circular) and MACCS key fingerprint generation for the molecules of
+ * the benchmark dataset.
+ */
+
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/Descr/CircularFingerprintGenerator.hpp"
+#include "CDPL/Descr/MACCSFingerprintGenerator.hpp"
+#include "CDPL/Util/BitSet.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    void BM_ECFPGeneration(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = CDPLBenchmarks::getPreparedMolecules();
+        Descr::CircularFingerprintGenerator ecfp_gen;
+        Util::BitSet                        fp(2048);
+
+        ecfp_gen.setNumIterations(state.range(0));
+
+        for (auto _ : state) {
+            for (const auto& mol : mols) {
+                ecfp_gen.generate(*mol);
+                ecfp_gen.setFeatureBits(fp);
+
+                benchmark::DoNotOptimize(fp.count());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * mols.size());
+    }
+
+    void BM_MACCSFingerprintGeneration(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = CDPLBenchmarks::getPreparedMolecules();
+        Descr::MACCSFingerprintGenerator    maccs_gen;
+        Util::BitSet                        fp;
+
+        for (auto _ : state) {
+            for (const auto& mol : mols) {
+                maccs_gen.generate(*mol, fp);
+
+                benchmark::DoNotOptimize(fp.count());
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * mols.size());
+    }
+} // namespace
+
+
+BENCHMARK(BM_ECFPGeneration)->Arg(2)->Arg(3)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MACCSFingerprintGeneration)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,162 @@
+/*
+ * ForceFieldBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the performance of MMFF94 force field setup, energy and gradient calculations for the
+ * molecules of the benchmark dataset, and the time needed for loading the builtin MMFF94 parameter tables.
+ */
+
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/ForceField/MMFF94InteractionParameterizer.hpp"
+#include "CDPL/ForceField/MMFF94InteractionData.hpp"
+#include "CDPL/ForceField/MMFF94EnergyCalculator.hpp"
+#include "CDPL/ForceField/MMFF94GradientCalculator.hpp"
+#include "CDPL/ForceField/MMFF94AngleBendingParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94BondStretchingParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94StretchBendParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94OutOfPlaneBendingParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94TorsionParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94BondChargeIncrementTable.hpp"
+#include "CDPL/ForceField/MMFF94ParameterSet.hpp"
+#include "CDPL/Chem/Entity3DContainerFunctions.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    struct MMFF94Data
+    {
+
+        MMFF94Data()
+        {
+            ForceField::MMFF94InteractionParameterizer parameterizer;
+
+            for (const auto& mol : CDPLBenchmarks::getPreparedMolecules()) {
+                interactionData.emplace_back();
+                coordinates.emplace_back();
+
+                parameterizer.parameterize(*mol, interactionData.back(), ForceField::InteractionType::ALL, false);
+                Chem::get3DCoordinates(*mol, coordinates.back());
+            }
+        }
+
+        std::vector<ForceField::MMFF94InteractionData> interactionData;
+        std::vector<Math::Vector3DArray>               coordinates;
+    };
+
+
+    const MMFF94Data& getMMFF94Data()
+    {
+        static const MMFF94Data data;
+
+        return data;
+    }
+
+    void BM_MMFF94Parameterization(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList&        mols = CDPLBenchmarks::getPreparedMolecules();
+        ForceField::MMFF94InteractionParameterizer parameterizer;
+        ForceField::MMFF94InteractionData          ia_data;
+
+        for (auto _ : state)
+            for (const auto& mol : mols)
+                parameterizer.parameterize(*mol, ia_data, ForceField::InteractionType::ALL, false);
+
+        state.SetItemsProcessed(state.iterations() * mols.size());
+    }
+
+    void BM_MMFF94Energy(benchmark::State& state)
+    {
+        const MMFF94Data&                          data = getMMFF94Data();
+        ForceField::MMFF94EnergyCalculator<double> calculator;
+        std::size_t                                num_mols = data.interactionData.size();
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < num_mols; i++) {
+                calculator.setup(data.interactionData[i]);
+
+                benchmark::DoNotOptimize(calculator(data.coordinates[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * num_mols);
+    }
+
+    void BM_MMFF94Gradient(benchmark::State& state)
+    {
+        const MMFF94Data&                            data = getMMFF94Data();
+        ForceField::MMFF94GradientCalculator<double> calculator;
+        Math::Vector3DArray                          grad;
+        std::size_t                                  num_mols = data.interactionData.size();
+
+        for (auto _ : state) {
+            for (std::size_t i = 0; i < num_mols; i++) {
+                const Math::Vector3DArray& coords = data.coordinates[i];
+
+                grad.resize(coords.getSize());
+                calculator.setup(data.interactionData[i], coords.getSize());
+
+                benchmark::DoNotOptimize(calculator(coords, grad));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * num_mols);
+    }
+
+    void BM_MMFF94ParameterTableLoading(benchmark::State& state)
+    {
+        for (auto _ : state) {
+            ForceField::MMFF94AngleBendingParameterTable      angle_table;
+            ForceField::MMFF94BondStretchingParameterTable    bond_table;
+            ForceField::MMFF94StretchBendParameterTable       sb_table;
+            ForceField::MMFF94OutOfPlaneBendingParameterTable oop_table;
+            ForceField::MMFF94TorsionParameterTable           tor_table;
+            ForceField::MMFF94BondChargeIncrementTable        bci_table;
+
+            angle_table.loadDefaults();
+            bond_table.loadDefaults();
+            sb_table.loadDefaults();
+            oop_table.loadDefaults(ForceField::MMFF94ParameterSet::STATIC);
+            tor_table.loadDefaults(ForceField::MMFF94ParameterSet::STATIC);
+            bci_table.loadDefaults();
+
+            benchmark::DoNotOptimize(angle_table.getNumEntries() + tor_table.getNumEntries());
+        }
+    }
+} // namespace
+
+
+BENCHMARK(BM_MMFF94Parameterization)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MMFF94Energy)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MMFF94Gradient)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MMFF94ParameterTableLoading)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,155 @@
+/*
+ * IOBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the throughput of the molecule readers and writers for the SDF, SMILES and CDF formats. The input
+ * data of the reader benchmarks are generated in memory from the benchmark dataset so that file system
+ * performance does not influence the results.
+ */
+
+
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/Chem/SDFMoleculeReader.hpp"
+#include "CDPL/Chem/SDFMolecularGraphWriter.hpp"
+#include "CDPL/Chem/SMILESMoleculeReader.hpp"
+#include "CDPL/Chem/SMILESMolecularGraphWriter.hpp"
+#include "CDPL/Chem/CDFMoleculeReader.hpp"
+#include "CDPL/Chem/CDFMolecularGraphWriter.hpp"
+#include "CDPL/Chem/ControlParameterFunctions.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    template <typename WriterType>
+    std::string writeMolecules(const CDPLBenchmarks::MoleculeList& mols, bool canon = false)
+    {
+        std::ostringstream os;
+        WriterType         writer(os);
+
+        if (canon)
+            Chem::setSMILESWriteCanonicalFormParameter(writer, true);
+
+        for (const auto& mol : mols)
+            writer.write(*mol);
+
+        return os.str();
+    }
+
+    template <typename WriterType>
+    const std::string& getMoleculeData()
+    {
+        static const std::string data = writeMolecules<WriterType>(CDPLBenchmarks::getPreparedMolecules());
+
+        return data;
+    }
+
+    template <typename ReaderType, typename WriterType>
+    void readMolecules(benchmark::State& state)
+    {
+        const std::string&  data = getMoleculeData<WriterType>();
+        Chem::BasicMolecule mol;
+        std::size_t         num_mols = 0;
+
+        for (auto _ : state) {
+            std::istringstream is(data);
+            ReaderType         reader(is);
+
+            while (reader.read(mol))
+                num_mols++;
+        }
+
+        state.SetItemsProcessed(num_mols);
+        state.SetBytesProcessed(state.iterations() * data.size());
+    }
+
+    template <typename WriterType>
+    void writeMolecules(benchmark::State& state, bool canon = false)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = CDPLBenchmarks::getPreparedMolecules();
+        std::size_t                         num_bytes = 0;
+
+        for (auto _ : state) {
+            std::string data = writeMolecules<WriterType>(mols, canon);
+
+            benchmark::DoNotOptimize(data.data());
+            num_bytes += data.size();
+        }
+
+        state.SetItemsProcessed(state.iterations() * mols.size());
+        state.SetBytesProcessed(num_bytes);
+    }
+
+    void BM_SDFRead(benchmark::State& state)
+    {
+        readMolecules<Chem::SDFMoleculeReader, Chem::SDFMolecularGraphWriter>(state);
+    }
+
+    void BM_SDFWrite(benchmark::State& state)
+    {
+        writeMolecules<Chem::SDFMolecularGraphWriter>(state);
+    }
+
+    void BM_SMILESRead(benchmark::State& state)
+    {
+        readMolecules<Chem::SMILESMoleculeReader, Chem::SMILESMolecularGraphWriter>(state);
+    }
+
+    void BM_SMILESWrite(benchmark::State& state)
+    {
+        writeMolecules<Chem::SMILESMolecularGraphWriter>(state);
+    }
+
+    void BM_CanonicalSMILESWrite(benchmark::State& state)
+    {
+        writeMolecules<Chem::SMILESMolecularGraphWriter>(state, true);
+    }
+
+    void BM_CDFRead(benchmark::State& state)
+    {
+        readMolecules<Chem::CDFMoleculeReader, Chem::CDFMolecularGraphWriter>(state);
+    }
+
+    void BM_CDFWrite(benchmark::State& state)
+    {
+        writeMolecules<Chem::CDFMolecularGraphWriter>(state);
+    }
+} // namespace
+
+
+BENCHMARK(BM_SDFRead)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SDFWrite)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SMILESRead)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SMILESWrite)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CanonicalSMILESWrite)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CDFRead)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CDFWrite)->Unit(benchmark::kMillisecond);
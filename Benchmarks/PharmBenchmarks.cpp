@@ -0,0 +1,221 @@
+/*
+ * PharmBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the performance of pharmacophore screening with Pharm::ScreeningProcessor. The screening database
+ * gets created once from the molecules of the benchmark dataset in a temporary file and the query pharmacophore
+ * is generated from the first dataset molecule.
+ *
+ * Also measures the performance of Pharm::DefaultInteractionAnalyzer for the pharmacophore of the first dataset molecule
+ * against the merged pharmacophores of all dataset molecules, with and without a prebuilt feature index, and the
+ * generation of interaction fingerprints with Pharm::InteractionFingerprintGenerator for a series of rigidly shifted
+ * poses of the first dataset molecule in the environment formed by the second one.
+ */
+
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/Pharm/PSDScreeningDBCreator.hpp"
+#include "CDPL/Pharm/PSDScreeningDBAccessor.hpp"
+#include "CDPL/Pharm/ScreeningProcessor.hpp"
+#include "CDPL/Pharm/DefaultPharmacophoreGenerator.hpp"
+#include "CDPL/Pharm/BasicPharmacophore.hpp"
+#include "CDPL/Pharm/DefaultInteractionAnalyzer.hpp"
+#include "CDPL/Pharm/FeatureMapping.hpp"
+#include "CDPL/Pharm/InteractionFingerprintGenerator.hpp"
+#include "CDPL/Chem/Entity3DContainerFunctions.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+#include "CDPL/Util/Array.hpp"
+#include "CDPL/Pharm/MoleculeFunctions.hpp"
+#include "CDPL/Util/FileFunctions.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    struct ScreeningData
+    {
+
+        ScreeningData():
+            dbFilePath(Util::genCheckedTempFilePath("", "cdpl-benchmark-%%%%-%%%%-%%%%.psd"))
+        {
+            Pharm::DefaultPharmacophoreGenerator pharm_gen;
+
+            {
+                Pharm::PSDScreeningDBCreator db_creator(dbFilePath);
+
+                for (const auto& mol : CDPLBenchmarks::getPreparedMolecules()) {
+                    Chem::BasicMolecule pharm_mol(*mol);
+
+                    Pharm::prepareForPharmacophoreGeneration(pharm_mol);
+
+                    if (queryPharm.getNumFeatures() == 0)
+                        pharm_gen.generate(pharm_mol, queryPharm);
+
+                    db_creator.process(pharm_mol);
+                }
+            }
+
+            dbAccessor.reset(new Pharm::PSDScreeningDBAccessor(dbFilePath));
+        }
+
+        ~ScreeningData()
+        {
+            dbAccessor.reset();
+
+            std::remove(dbFilePath.c_str());
+        }
+
+        std::string                                    dbFilePath;
+        Pharm::BasicPharmacophore                      queryPharm;
+        std::unique_ptr<Pharm::PSDScreeningDBAccessor> dbAccessor;
+    };
+
+
+    ScreeningData& getScreeningData()
+    {
+        static ScreeningData data;
+
+        return data;
+    }
+
+    void BM_PharmacophoreScreening(benchmark::State& state)
+    {
+        ScreeningData&            data = getScreeningData();
+        Pharm::ScreeningProcessor scr_proc(*data.dbAccessor);
+        std::size_t               num_hits = 0;
+
+        scr_proc.setMaxNumOmittedFeatures(state.range(0));
+
+        for (auto _ : state)
+            num_hits = scr_proc.searchDB(data.queryPharm);
+
+        state.SetLabel("query features: " + std::to_string(data.queryPharm.getNumFeatures()));
+        state.SetItemsProcessed(state.iterations() * data.dbAccessor->getNumMolecules());
+        state.counters["hits"] = num_hits;
+    }
+
+    struct InteractionData
+    {
+
+        InteractionData()
+        {
+            Pharm::DefaultPharmacophoreGenerator pharm_gen;
+
+            for (const auto& mol : CDPLBenchmarks::getPreparedMolecules()) {
+                Chem::BasicMolecule pharm_mol(*mol);
+
+                Pharm::prepareForPharmacophoreGeneration(pharm_mol);
+
+                if (ligandPharm.getNumFeatures() == 0)
+                    pharm_gen.generate(pharm_mol, ligandPharm);
+
+                pharm_gen.generate(pharm_mol, envPharm, true);
+            }
+        }
+
+        Pharm::BasicPharmacophore ligandPharm;
+        Pharm::BasicPharmacophore envPharm;
+    };
+
+    InteractionData& getInteractionData()
+    {
+        static InteractionData data;
+
+        return data;
+    }
+
+    void BM_InteractionAnalysis(benchmark::State& state)
+    {
+        InteractionData&                  data = getInteractionData();
+        Pharm::DefaultInteractionAnalyzer analyzer;
+        Pharm::FeatureMapping             iactions;
+        bool                              use_index = state.range(0);
+
+        if (use_index)
+            analyzer.indexFeatures(data.envPharm);
+
+        for (auto _ : state) {
+            if (use_index)
+                analyzer.analyze(data.ligandPharm, iactions);
+            else
+                analyzer.analyze(data.ligandPharm, data.envPharm, iactions);
+        }
+
+        state.SetLabel(use_index ? "indexed" : "per-call index");
+        state.counters["env features"] = data.envPharm.getNumFeatures();
+        state.counters["interactions"] = iactions.getSize();
+    }
+
+    constexpr std::size_t NUM_IFP_FRAMES = 200;
+
+    void BM_InteractionFingerprintGeneration(benchmark::State& state)
+    {
+        const auto&         mols = CDPLBenchmarks::getPreparedMolecules();
+        Chem::BasicMolecule ligand(*mols[0]);
+        Chem::BasicMolecule env(*mols[1]);
+
+        Pharm::prepareForPharmacophoreGeneration(ligand);
+        Pharm::prepareForPharmacophoreGeneration(env);
+
+        Pharm::InteractionFingerprintGenerator ifp_gen;
+
+        ifp_gen.setNumThreads(state.range(0));
+        ifp_gen.setup(ligand, env);
+
+        Math::Vector3DArray lig_coords;
+        Math::Vector3DArray frame_coords;
+
+        Chem::get3DCoordinates(ligand, lig_coords);
+
+        for (std::size_t i = 0; i < NUM_IFP_FRAMES; i++) {
+            double shift = 0.05 * i;
+
+            for (std::size_t j = 0; j < lig_coords.getSize(); j++)
+                frame_coords.addElement(lig_coords[j] + Math::vec(shift, -shift, 0.5 * shift));
+        }
+
+        Math::Vector3DArray env_coords;
+        Util::BitSetArray   fps;
+
+        for (auto _ : state)
+            ifp_gen.generate(frame_coords, env_coords, NUM_IFP_FRAMES, fps);
+
+        state.SetItemsProcessed(state.iterations() * NUM_IFP_FRAMES);
+        state.counters["bits"] = ifp_gen.getNumBits();
+    }
+} // namespace
+
+
+BENCHMARK(BM_PharmacophoreScreening)->Arg(0)->Arg(2)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_InteractionAnalysis)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_InteractionFingerprintGeneration)->Arg(1)->Arg(4)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,212 @@
+/*
+ * PropertyLookupBenchmark.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the cost of atom and bond property lookups for the property keys registered for fast access
+ * (see Base::PropertyContainer::registerFastAccessKey()). For comparison, each property value is also stored
+ * under an unregistered key which has to be looked up in the hash table of the property container (i.e. the
+ * lookup path used for all properties before fast access keys were introduced).
+ */
+
+
+#include <vector>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/AtomProperty.hpp"
+#include "CDPL/Chem/BondProperty.hpp"
+#include "CDPL/Chem/Entity3DProperty.hpp"
+#include "CDPL/ForceField/AtomProperty.hpp"
+#include "CDPL/Base/LookupKey.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    constexpr std::size_t NUM_ATOMS = 1000;
+
+
+    struct PropertyKeyInfo
+    {
+
+        PropertyKeyInfo(const Base::LookupKey& key, bool bond_prop):
+            fastAccessKey(key), hashedKey(Base::LookupKey::create(key.getName() + "_HASHED")), bondProperty(bond_prop) {}
+
+        Base::LookupKey fastAccessKey;
+        Base::LookupKey hashedKey;
+        bool            bondProperty;
+    };
+
+    typedef std::vector<PropertyKeyInfo> PropertyKeyInfoList;
+
+
+    struct BenchmarkData
+    {
+
+        BenchmarkData()
+        {
+            using namespace Chem;
+
+            const Base::LookupKey atom_keys[] = {
+                AtomProperty::SYMBOL, AtomProperty::TYPE, AtomProperty::FORMAL_CHARGE, AtomProperty::ISOTOPE,
+                AtomProperty::HYBRIDIZATION, AtomProperty::RING_FLAG, AtomProperty::AROMATICITY_FLAG,
+                AtomProperty::UNPAIRED_ELECTRON_COUNT, AtomProperty::IMPLICIT_HYDROGEN_COUNT, AtomProperty::STEREO_DESCRIPTOR,
+                AtomProperty::MATCH_CONSTRAINTS, Entity3DProperty::COORDINATES_3D, ForceField::AtomProperty::MMFF94_SYMBOLIC_TYPE,
+                ForceField::AtomProperty::MMFF94_NUMERIC_TYPE, ForceField::AtomProperty::MMFF94_CHARGE
+            };
+
+            const Base::LookupKey bond_keys[] = {
+                BondProperty::ORDER, BondProperty::RING_FLAG, BondProperty::AROMATICITY_FLAG, BondProperty::STEREO_DESCRIPTOR,
+                BondProperty::MATCH_CONSTRAINTS
+            };
+
+            for (const Base::LookupKey& key : atom_keys)
+                keys.emplace_back(key, false);
+
+            for (const Base::LookupKey& key : bond_keys)
+                keys.emplace_back(key, true);
+
+            // a chain of atoms carrying a typical number of additional (non fast access) properties
+
+            for (std::size_t i = 0; i < NUM_ATOMS; i++) {
+                Atom& atom = molecule.addAtom();
+
+                atom.setProperty(AtomProperty::NAME, std::string("A"));
+                atom.setProperty(AtomProperty::CANONICAL_NUMBER, i);
+                atom.setProperty(AtomProperty::SYBYL_TYPE, 1U);
+
+                if (i > 0) {
+                    Bond& bond = molecule.addBond(i - 1, i);
+
+                    bond.setProperty(BondProperty::SYBYL_TYPE, 1U);
+                }
+            }
+
+            for (const PropertyKeyInfo& key_info : keys) {
+                if (key_info.bondProperty) {
+                    for (Bond& bond : molecule.getBonds()) {
+                        bond.setProperty(key_info.fastAccessKey, std::size_t(1));
+                        bond.setProperty(key_info.hashedKey, std::size_t(1));
+                    }
+
+                } else {
+                    for (Atom& atom : molecule.getAtoms()) {
+                        atom.setProperty(key_info.fastAccessKey, std::size_t(1));
+                        atom.setProperty(key_info.hashedKey, std::size_t(1));
+                    }
+                }
+            }
+        }
+
+        PropertyKeyInfoList keys;
+        Chem::BasicMolecule molecule;
+    };
+
+
+    const BenchmarkData& getBenchmarkData()
+    {
+        static const BenchmarkData data;
+
+        return data;
+    }
+
+    template <typename ContainerRange>
+    std::size_t lookupProperty(const ContainerRange& range, const Base::LookupKey& key)
+    {
+        std::size_t num_found = 0;
+
+        for (const auto& cntnr : range)
+            num_found += !cntnr.getProperty(key, false).isEmpty();
+
+        return num_found;
+    }
+
+    void lookupProperty(benchmark::State& state, bool fast_access)
+    {
+        const BenchmarkData&   data = getBenchmarkData();
+        const PropertyKeyInfo& key_info = data.keys[state.range(0)];
+        const Base::LookupKey& key = (fast_access ? key_info.fastAccessKey : key_info.hashedKey);
+        std::size_t            num_lookups = 0;
+
+        for (auto _ : state) {
+            std::size_t num_found = (key_info.bondProperty ? lookupProperty(data.molecule.getBonds(), key) :
+                                                             lookupProperty(data.molecule.getAtoms(), key));
+
+            benchmark::DoNotOptimize(num_found);
+            num_lookups += (key_info.bondProperty ? data.molecule.getNumBonds() : data.molecule.getNumAtoms());
+        }
+
+        state.SetLabel(key_info.fastAccessKey.getName() + (key_info.bondProperty ? " (bond)" : " (atom)"));
+        state.SetItemsProcessed(num_lookups);
+    }
+
+    void lookupAllProperties(benchmark::State& state, bool fast_access)
+    {
+        const BenchmarkData& data = getBenchmarkData();
+        std::size_t          num_lookups = 0;
+
+        for (auto _ : state) {
+            for (const PropertyKeyInfo& key_info : data.keys) {
+                const Base::LookupKey& key = (fast_access ? key_info.fastAccessKey : key_info.hashedKey);
+                std::size_t num_found = (key_info.bondProperty ? lookupProperty(data.molecule.getBonds(), key) :
+                                                                 lookupProperty(data.molecule.getAtoms(), key));
+
+                benchmark::DoNotOptimize(num_found);
+                num_lookups += (key_info.bondProperty ? data.molecule.getNumBonds() : data.molecule.getNumAtoms());
+            }
+        }
+
+        state.SetItemsProcessed(num_lookups);
+    }
+
+    void BM_FastAccessPropertyLookup(benchmark::State& state)
+    {
+        lookupProperty(state, true);
+    }
+
+    void BM_HashedPropertyLookup(benchmark::State& state)
+    {
+        lookupProperty(state, false);
+    }
+
+    void BM_FastAccessPropertyLookupAll(benchmark::State& state)
+    {
+        lookupAllProperties(state, true);
+    }
+
+    void BM_HashedPropertyLookupAll(benchmark::State& state)
+    {
+        lookupAllProperties(state, false);
+    }
+}
+
+
+BENCHMARK(BM_FastAccessPropertyLookup)->DenseRange(0, 19);
+BENCHMARK(BM_HashedPropertyLookup)->DenseRange(0, 19);
+BENCHMARK(BM_FastAccessPropertyLookupAll);
+BENCHMARK(BM_HashedPropertyLookupAll);
@@ -0,0 +1,110 @@
+/*
+ * ShapeBenchmarks.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/*
+ * Measures the performance of Gaussian shape generation and of shape alignments performed by
+ * Shape::FastGaussianShapeAlignment for the molecules of the benchmark dataset (first molecule as
+ * reference, single conformer per molecule).
+ */
+
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "CDPL/Shape/GaussianShapeGenerator.hpp"
+#include "CDPL/Shape/FastGaussianShapeAlignment.hpp"
+#include "CDPL/Shape/GaussianShapeSet.hpp"
+
+#include "BenchmarkData.hpp"
+
+
+namespace
+{
+
+    using namespace CDPL;
+
+    void initShapeGenerator(Shape::GaussianShapeGenerator& shape_gen)
+    {
+        shape_gen.generatePharmacophoreShape(false);
+        shape_gen.multiConformerMode(false);
+        shape_gen.includeHydrogens(false);
+    }
+
+    const std::vector<Shape::GaussianShapeSet>& getShapes()
+    {
+        static const std::vector<Shape::GaussianShapeSet> shapes = []() {
+            std::vector<Shape::GaussianShapeSet> mol_shapes;
+            Shape::GaussianShapeGenerator        shape_gen;
+
+            initShapeGenerator(shape_gen);
+
+            for (const auto& mol : CDPLBenchmarks::getPreparedMolecules())
+                mol_shapes.push_back(shape_gen.generate(*mol));
+
+            return mol_shapes;
+        }();
+
+        return shapes;
+    }
+
+    void BM_GaussianShapeGeneration(benchmark::State& state)
+    {
+        const CDPLBenchmarks::MoleculeList& mols = CDPLBenchmarks::getPreparedMolecules();
+        Shape::GaussianShapeGenerator       shape_gen;
+
+        initShapeGenerator(shape_gen);
+
+        for (auto _ : state)
+            for (const auto& mol : mols)
+                benchmark::DoNotOptimize(shape_gen.generate(*mol).getSize());
+
+        state.SetItemsProcessed(state.iterations() * mols.size());
+    }
+
+    void BM_FastGaussianShapeAlignment(benchmark::State& state)
+    {
+        const std::vector<Shape::GaussianShapeSet>& shapes = getShapes();
+        Shape::FastGaussianShapeAlignment           alignment(shapes.front());
+        std::size_t                                 num_aligned = 0;
+
+        alignment.optimizeOverlap(state.range(0) != 0);
+        alignment.setRandomSeed(1);
+
+        for (auto _ : state) {
+            num_aligned = 0;
+
+            for (const auto& shape : shapes)
+                num_aligned += alignment.align(shape);
+        }
+
+        state.SetLabel(state.range(0) != 0 ? "optimized overlap" : "starting poses only");
+        state.SetItemsProcessed(state.iterations() * shapes.size());
+        state.counters["aligned"] = num_aligned;
+    }
+} // namespace
+
+
+BENCHMARK(BM_GaussianShapeGeneration)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FastGaussianShapeAlignment)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
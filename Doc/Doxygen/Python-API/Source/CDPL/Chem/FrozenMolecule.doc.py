@@ -0,0 +1,201 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief A compact Chem.Molecule implementation with a fixed set of atoms and bonds.
+# 
+# The atoms and bonds of a <tt>FrozenMolecule</tt> are stored contiguously and the atom connectivity is represented in compressed sparse row (CSR) format, i.e. the bonded neighbors of atom \e i are given by the entries <em>[getNeighborOffsets()[i], getNeighborOffsets()[i + 1])</em> of the arrays returned by getNeighborAtomIndices() and getNeighborBondIndices().
+# 
+# The molecular graph can only be (re-)built as a whole by copying another Chem.MolecularGraph instance. All methods that add or remove individual atoms and bonds (or change their order) throw an exception of type Base.OperationFailed. Atom, bond and molecule properties remain modifiable.
+# 
+# For fast sequential access, the values of frequently used atom and bond properties (element, formal charge, implicit hydrogen count, aromaticity and ring membership flags, 3D coordinates and bond orders) are additionally stored in typed arrays that get filled when the molecular graph is built. Later property modifications are not reflected by these arrays until updatePropertyArrays() gets called.
+# 
+# \since 1.2
+# 
+class FrozenMolecule(Molecule):
+
+    ##
+    # \brief Constructs an empty <tt>FrozenMolecule</tt> instance.
+    # 
+    def __init__() -> None: pass
+
+    ##
+    # \brief Constructs a copy of the <tt>FrozenMolecule</tt> instance <em>mol</em>.
+    # 
+    # \param mol The other <tt>FrozenMolecule</tt> instance to copy.
+    # 
+    def __init__(mol: FrozenMolecule) -> None: pass
+
+    ##
+    # \brief Constructs a <tt>FrozenMolecule</tt> instance with copies of the atoms and bonds of the Chem.MolecularGraph instance <em>molgraph</em>.
+    # 
+    # \param molgraph The Chem.MolecularGraph instance providing the atoms and bonds to copy.
+    # 
+    def __init__(molgraph: MolecularGraph) -> None: pass
+
+    ##
+    # \brief Replaces the current set of atoms, bonds and properties by a copy of the atoms, bonds and properties of the molecule <em>mol</em>.
+    # 
+    # \param mol The molecule to copy.
+    # 
+    def copy(mol: FrozenMolecule) -> None: pass
+
+    ##
+    # \brief Replaces the current set of atoms, bonds and properties by a copy of the atoms, bonds and properties of the molecule <em>mol</em>.
+    # 
+    # \param mol The molecule to copy.
+    # 
+    def copy(mol: Molecule) -> None: pass
+
+    ##
+    # \brief Replaces the current set of atoms, bonds and properties by a copy of the atoms, bonds and properties of the molecular graph <em>molgraph</em>.
+    # 
+    # \param molgraph The Chem.MolecularGraph instance providing the atoms, bonds and properties to copy.
+    # 
+    def copy(molgraph: MolecularGraph) -> None: pass
+
+    ##
+    # \brief Replaces the current set of atoms, bonds and properties by a copy of the atoms, bonds and properties of the molecule <em>mol</em>.
+    # 
+    # \param mol The molecule to copy.
+    # 
+    # \return \a self
+    # 
+    def assign(mol: FrozenMolecule) -> FrozenMolecule: pass
+
+    ##
+    # \brief Replaces the current set of atoms, bonds and properties by a copy of the atoms, bonds and properties of the molecule <em>mol</em>.
+    # 
+    # \param mol The molecule to copy.
+    # 
+    # \return \a self
+    # 
+    def assign(mol: Molecule) -> FrozenMolecule: pass
+
+    ##
+    # \brief Replaces the current set of atoms, bonds and properties by a copy of the atoms, bonds and properties of the molecular graph <em>molgraph</em>.
+    # 
+    # \param molgraph The Chem.MolecularGraph instance providing the atoms and bonds to copy.
+    # 
+    # \return \a self
+    # 
+    def assign(molgraph: MolecularGraph) -> FrozenMolecule: pass
+
+    ##
+    # \brief Updates the typed property arrays with the current property values of the atoms and bonds.
+    # 
+    def updatePropertyArrays() -> None: pass
+
+    ##
+    # \brief Returns the offsets of the bonded neighbor lists of the atoms.
+    # \return An array of size getNumAtoms() + 1 where the element at index \e i specifies the start index of the neighbors of atom \e i in the arrays returned by getNeighborAtomIndices() and getNeighborBondIndices().
+    # 
+    def getNeighborOffsets() -> Util.STArray: pass
+
+    ##
+    # \brief Returns the concatenated indices of the bonded neighbor atoms of all atoms.
+    # \return The neighbor atom index array.
+    # 
+    def getNeighborAtomIndices() -> Util.STArray: pass
+
+    ##
+    # \brief Returns the concatenated indices of the incident bonds of all atoms.
+    # \return The neighbor bond index array.
+    # 
+    def getNeighborBondIndices() -> Util.STArray: pass
+
+    ##
+    # \brief Returns the types (see namespace Chem.AtomType) of the atoms.
+    # \return An array holding the type of each atom.
+    # 
+    def getAtomTypes() -> Util.UIArray: pass
+
+    ##
+    # \brief Returns the formal charges of the atoms.
+    # \return An array holding the formal charge of each atom.
+    # 
+    def getAtomFormalCharges() -> Util.LArray: pass
+
+    ##
+    # \brief Returns the implicit hydrogen counts of the atoms.
+    # \return An array holding the implicit hydrogen count of each atom (\e 0 if not set).
+    # 
+    def getAtomImplicitHydrogenCounts() -> Util.STArray: pass
+
+    ##
+    # \brief Returns a bitmask where the bits of aromatic atoms are set.
+    # \return The aromatic atom mask.
+    # 
+    def getAromaticAtomMask() -> Util.BitSet: pass
+
+    ##
+    # \brief Returns a bitmask where the bits of ring atoms are set.
+    # \return The ring atom mask.
+    # 
+    def getRingAtomMask() -> Util.BitSet: pass
+
+    ##
+    # \brief Returns the 3D coordinates of the atoms.
+    # \return An array holding the 3D coordinates of each atom or an empty array if not all atoms have 3D coordinates.
+    # 
+    def getAtom3DCoordinates() -> Math.Vector3DArray: pass
+
+    ##
+    # \brief Returns the orders of the bonds.
+    # \return An array holding the order of each bond.
+    # 
+    def getBondOrders() -> Util.STArray: pass
+
+    ##
+    # \brief Returns a bitmask where the bits of aromatic bonds are set.
+    # \return The aromatic bond mask.
+    # 
+    def getAromaticBondMask() -> Util.BitSet: pass
+
+    ##
+    # \brief Returns a bitmask where the bits of ring bonds are set.
+    # \return The ring bond mask.
+    # 
+    def getRingBondMask() -> Util.BitSet: pass
+
+    neighborOffsets = property(getNeighborOffsets)
+
+    neighborAtomIndices = property(getNeighborAtomIndices)
+
+    neighborBondIndices = property(getNeighborBondIndices)
+
+    atomTypes = property(getAtomTypes)
+
+    atomFormalCharges = property(getAtomFormalCharges)
+
+    atomImplicitHydrogenCounts = property(getAtomImplicitHydrogenCounts)
+
+    aromaticAtomMask = property(getAromaticAtomMask)
+
+    ringAtomMask = property(getRingAtomMask)
+
+    atom3DCoordinates = property(getAtom3DCoordinates)
+
+    bondOrders = property(getBondOrders)
+
+    aromaticBondMask = property(getAromaticBondMask)
+
+    ringBondMask = property(getRingBondMask)
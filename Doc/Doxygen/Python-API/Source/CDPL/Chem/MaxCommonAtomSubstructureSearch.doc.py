@@ -169,6 +169,108 @@ class MaxCommonAtomSubstructureSearch(Boost.Python.instance):
     # 
     def setMinSubstructureSize(min_size: int) -> None: pass
 
+    ##
+    # \brief Specifies a function that gets periodically called during a common substructure search to check whether the search shall be terminated prematurely.
+    # 
+    # If the callback function returns <tt>True</tt>, the search will be stopped and all atom/bond mappings of the largest common substructures found so far are kept (see searchAborted()).
+    # 
+    # \param func The abort callback function.
+    # 
+    # \note The callback function is invoked only by the thread that called the search method.
+    # 
+    # \since 1.2
+    #
+    def setAbortCallback(func: BoolFunctor) -> None: pass
+
+    ##
+    # \brief Returns the function that gets called to check whether the search shall be terminated prematurely.
+    # 
+    # \return A reference to the abort callback function.
+    # 
+    # \since 1.2
+    #
+    def getAbortCallback() -> BoolFunctor: pass
+
+    ##
+    # \brief Allows to specify a time limit for the common substructure search.
+    # 
+    # If the search takes longer than <em>mil_secs</em> milliseconds, it will be stopped and the atom/bond mappings of the largest common substructures found so far are kept (see searchAborted()).
+    # 
+    # \param mil_secs The time limit in milliseconds.
+    # 
+    # \note By default, no time limit is imposed (value zero).
+    # 
+    # \since 1.2
+    #
+    def setTimeout(mil_secs: int) -> None: pass
+
+    ##
+    # \brief Returns the specified time limit for the common substructure search.
+    # 
+    # \return The time limit in milliseconds.
+    # 
+    # \see setTimeout()
+    # \since 1.2
+    #
+    def getTimeout() -> int: pass
+
+    ##
+    # \brief Allows to specify a limit on the number of association graph search nodes that get visited in a common substructure search.
+    # 
+    # If the search visits more than (approximately) <em>max_num_nodes</em> search tree nodes, it will be stopped and the atom/bond mappings of the largest common substructures found so far are kept (see searchAborted()).
+    # 
+    # \param max_num_nodes The maximum number of visited search tree nodes.
+    # 
+    # \note By default, no limit is imposed (value zero).
+    # 
+    # \since 1.2
+    #
+    def setMaxNumSearchNodes(max_num_nodes: int) -> None: pass
+
+    ##
+    # \brief Returns the specified limit on the number of visited search tree nodes.
+    # 
+    # \return The maximum number of visited search tree nodes.
+    # 
+    # \see setMaxNumSearchNodes()
+    # \since 1.2
+    #
+    def getMaxNumSearchNodes() -> int: pass
+
+    ##
+    # \brief Allows to specify the number of threads that are used for a common substructure search.
+    # 
+    # If <em>num_threads</em> is greater than one, the top-level branches of the search tree get distributed among the specified number of threads. The size of the found common substructures does not depend on the number of threads but the order of the stored atom/bond mappings and, if the number of stored mappings is limited, the particular set of mappings may differ from a single-threaded search.
+    # 
+    # \param num_threads The number of threads to use.
+    # 
+    # \note By default, the search runs single-threaded (value zero). Queries with match expressions that require an atom/bond mapping for their evaluation are always processed single-threaded.
+    # 
+    # \since 1.2
+    #
+    def setNumThreads(num_threads: int) -> None: pass
+
+    ##
+    # \brief Returns the number of threads that are used for a common substructure search.
+    # 
+    # \return The number of search threads.
+    # 
+    # \see setNumThreads()
+    # \since 1.2
+    #
+    def getNumThreads() -> int: pass
+
+    ##
+    # \brief Tells whether the last common substructure search was stopped prematurely.
+    # 
+    # The search gets stopped prematurely if the abort callback function returned <tt>True</tt>, the time limit was exceeded or the maximum number of search tree nodes has been visited. In that case, the stored atom/bond mappings represent the largest common substructures found until the stop and do not necessarily have maximum size.
+    # 
+    # \return <tt>True</tt> if the last search was stopped prematurely, and <tt>False</tt> otherwise.
+    # 
+    # \since 1.2
+    #
+    def searchAborted() -> bool: pass
+
     ##
     # \brief Allows to specify a new query structure.
     # 
@@ -212,3 +314,11 @@ class MaxCommonAtomSubstructureSearch(Boost.Python.instance):
     maxNumMappings = property(getMaxNumMappings, setMaxNumMappings)
 
     minSubstructureSize = property(getMinSubstructureSize, setMinSubstructureSize)
+
+    abortCallback = property(getAbortCallback, setAbortCallback)
+
+    timeout = property(getTimeout, setTimeout)
+
+    maxNumSearchNodes = property(getMaxNumSearchNodes, setMaxNumSearchNodes)
+
+    numThreads = property(getNumThreads, setNumThreads)
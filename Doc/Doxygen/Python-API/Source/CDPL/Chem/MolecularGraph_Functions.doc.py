@@ -707,6 +707,75 @@ def calcCIPPriorities(molgraph: MolecularGraph, overwrite: bool) -> None: pass
 #
 def calcBasicProperties(molgraph: MolecularGraph, overwrite: bool) -> None: pass
 
+##
+# \brief Returns the perception steps (see class Chem.PerceptionFlag) that have been carried out by prepareMolecularGraph() for the current structure of \a molgraph.
+# 
+# The recorded perception state becomes invalid (and <em>PerceptionFlag.NONE</em> gets returned) as soon as atoms or bonds are added, removed or reordered, the type, isotope or formal charge of an atom or the order of a bond changes, or the state has been copied from another Chem.MolecularGraph instance.
+# 
+# \param molgraph The molecular graph.
+# 
+# \return The still valid perception steps.
+# 
+# \since 1.2
+#
+def getPerceptionState(molgraph: MolecularGraph) -> int: pass
+
+##
+# \brief Records the perception steps \a flags as carried out for the current structure of \a molgraph.
+# 
+# \param molgraph The molecular graph.
+# \param flags The carried out perception steps (see class Chem.PerceptionFlag).
+# 
+# \since 1.2
+#
+def setPerceptionState(molgraph: MolecularGraph, flags: int) -> None: pass
+
+##
+# \brief 
+# \param molgraph 
+#
+# \since 1.2
+#
+def clearPerceptionState(molgraph: MolecularGraph) -> None: pass
+
+##
+# \brief Carries out the perception steps specified by \a flags unless they are already recorded as valid in the perception state of \a molgraph.
+# 
+# Steps get carried out in a fixed order that respects their dependencies. A recorded step is only skipped if all of its results are still present, i.e. have not been cleared in the meantime (e.g. by clearSSSR() or Chem.clearAromaticityFlag()). The carried out steps are added to the perception state afterwards so that subsequent calls for the unmodified structure can skip them. If \a overwrite is <tt>False</tt>, already present property values are kept (as done by the corresponding perception functions) and a step thus only gets recorded if none of its results were present before or these were recorded as valid. Steps that depend on present but unrecorded results are not recorded either.
+# 
+# \param molgraph The molecular graph.
+# \param flags The requested perception steps (see class Chem.PerceptionFlag).
+# \param overwrite Specifies whether present property values shall be replaced by newly perceived ones.
+# 
+# \since 1.2
+#
+def prepareMolecularGraph(molgraph: MolecularGraph, flags: int, overwrite: bool) -> None: pass
+
+##
+# \brief Returns the number of perception steps carried out by prepareMolecularGraph() since program start or the last call to resetPerceptionCounters().
+# 
+# \return The number of carried out perception steps.
+# 
+# \since 1.2
+#
+def getNumPerformedPerceptions() -> int: pass
+
+##
+# \brief Returns the number of requested perception steps that prepareMolecularGraph() skipped because they were recorded as valid.
+# 
+# \return The number of skipped perception steps.
+# 
+# \since 1.2
+#
+def getNumSkippedPerceptions() -> int: pass
+
+##
+# \brief 
+#
+# \since 1.2
+#
+def resetPerceptionCounters() -> None: pass
+
 ##
 # \brief 
 # \param molgraph 
@@ -0,0 +1,91 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief Reader for molecule data files in any supported format that decodes the molecule records on multiple threads.
+# 
+class ParallelMoleculeReader(MoleculeReaderBase):
+
+    ##
+    # \brief Initializes the \e %ParallelMoleculeReader instance.
+    # \param file_name 
+    # \param num_threads 
+    # \param mode 
+    # 
+    def __init__(file_name: str, num_threads: int, mode: OpenMode = Base.IOStream.OpenMode(12)) -> None: pass
+
+    ##
+    # \brief Initializes the \e %ParallelMoleculeReader instance.
+    # \param file_name 
+    # \param fmt 
+    # \param num_threads 
+    # \param mode 
+    # 
+    def __init__(file_name: str, fmt: str, num_threads: int, mode: OpenMode = Base.IOStream.OpenMode(12)) -> None: pass
+
+    ##
+    # \brief Initializes the \e %ParallelMoleculeReader instance.
+    # \param file_name 
+    # \param fmt 
+    # \param num_threads 
+    # \param mode 
+    # 
+    def __init__(file_name: str, fmt: Base.DataFormat, num_threads: int, mode: OpenMode = Base.IOStream.OpenMode(12)) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getDataFormat() -> Base.DataFormat: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getNumThreads() -> int: pass
+
+    ##
+    # \brief Tells whether the data records are decoded by worker threads.
+    # \return <tt>True</tt> if the data records are decoded in parallel, and <tt>False</tt> if the reader operates sequentially.
+    #
+    def isParallel() -> bool: pass
+
+    ##
+    # \brief Sets the maximum number of data records that may get decoded ahead of the current record index.
+    # \param max_num_recs The maximum number of buffered data records. Values smaller than the number of worker threads are raised to this number.
+    #
+    # \note The setting has no effect on readers operating sequentially.
+    #
+    def setMaxNumBufferedRecords(max_num_recs: int) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getMaxNumBufferedRecords() -> int: pass
+
+    dataFormat = property(getDataFormat)
+
+    numThreads = property(getNumThreads)
+
+    parallel = property(isParallel)
+
+    maxNumBufferedRecords = property(getMaxNumBufferedRecords, setMaxNumBufferedRecords)
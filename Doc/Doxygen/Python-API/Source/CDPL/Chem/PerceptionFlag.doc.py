@@ -0,0 +1,77 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief Provides flags for the specification of structure perception steps carried out on Chem.MolecularGraph instances.
+# 
+# \since 1.2
+#
+class PerceptionFlag(Boost.Python.instance):
+
+    ##
+    # \brief Represents an empty set of perception steps.
+    # 
+    NONE = 0
+
+    ##
+    # \brief Specifies the perception of the connected components.
+    # 
+    COMPONENTS = 1
+
+    ##
+    # \brief Specifies the perception of the smallest set of smallest rings.
+    # 
+    SSSR = 2
+
+    ##
+    # \brief Specifies the perception of atom and bond ring membership flags.
+    # 
+    RING_FLAGS = 4
+
+    ##
+    # \brief Specifies the calculation of implicit hydrogen counts.
+    # 
+    IMPLICIT_H_COUNTS = 8
+
+    ##
+    # \brief Specifies the perception of atom hybridization states.
+    # 
+    HYBRIDIZATION_STATES = 16
+
+    ##
+    # \brief Specifies the perception of atom and bond aromaticity flags.
+    # 
+    AROMATICITY_FLAGS = 32
+
+    ##
+    # \brief Specifies the calculation of atom CIP priorities.
+    # 
+    CIP_PRIORITIES = 64
+
+    ##
+    # \brief Specifies the calculation of the topological distance matrix.
+    # 
+    TOPOLOGICAL_DISTANCE_MATRIX = 128
+
+    ##
+    # \brief Represents the set of perception steps carried out by Chem.calcBasicProperties().
+    # 
+    BASIC_PROPERTIES = 63
@@ -105,6 +105,12 @@ class ConformerGenerator(Boost.Python.instance):
     #
     def getLogMessageCallback() -> LogMessageCallbackFunction: pass
 
+    ##
+    # \brief Returns the timing and counter statistics of the last generate() call.
+    # \return 
+    #
+    def getStatistics() -> ConformerGeneratorStatistics: pass
+
     ##
     # \brief 
     # \param molgraph 
@@ -165,4 +171,6 @@ class ConformerGenerator(Boost.Python.instance):
 
     timeoutCallback = property(getTimeoutCallback, setTimeoutCallback)
 
+    statistics = property(getStatistics)
+
     logMessageCallback = property(getLogMessageCallback, setLogMessageCallback)
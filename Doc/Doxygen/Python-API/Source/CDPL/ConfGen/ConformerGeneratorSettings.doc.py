@@ -410,6 +410,18 @@ class ConformerGeneratorSettings(Boost.Python.instance):
     #
     def getConvergenceCheckCycleSize() -> int: pass
 
+    ##
+    # \brief 
+    # \param num_threads 
+    #
+    def setNumSamplingThreads(num_threads: int) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getNumSamplingThreads() -> int: pass
+
     ##
     # \brief 
     # \param max_size 
@@ -474,6 +486,8 @@ class ConformerGeneratorSettings(Boost.Python.instance):
 
     convCheckCycleSize = property(getConvergenceCheckCycleSize, setConvergenceCheckCycleSize)
 
+    numSamplingThreads = property(getNumSamplingThreads, setNumSamplingThreads)
+
     macrocycleRotorBondCountThresh = property(getMacrocycleRotorBondCountThreshold, setMacrocycleRotorBondCountThreshold)
 
     fragmentBuildSettings = property(getFragmentBuildSettings)
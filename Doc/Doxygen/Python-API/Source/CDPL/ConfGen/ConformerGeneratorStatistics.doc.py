@@ -0,0 +1,284 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief Per-stage wall clock times and counter values collected during a conformer generation run.
+# 
+# \since 1.2
+#
+class ConformerGeneratorStatistics(Boost.Python.instance):
+
+    ##
+    # \brief 
+    #
+    class Stage(Boost.Python.enum):
+
+        ##
+        # \brief FORCE_FIELD_SETUP.
+        #
+        FORCE_FIELD_SETUP = 0
+
+        ##
+        # \brief FRAGMENT_LIBRARY_LOOKUP.
+        #
+        FRAGMENT_LIBRARY_LOOKUP = 1
+
+        ##
+        # \brief FRAGMENT_CONFORMER_GENERATION.
+        #
+        FRAGMENT_CONFORMER_GENERATION = 2
+
+        ##
+        # \brief TORSION_RULE_MATCHING.
+        #
+        TORSION_RULE_MATCHING = 3
+
+        ##
+        # \brief TORSION_DRIVING.
+        #
+        TORSION_DRIVING = 4
+
+        ##
+        # \brief FRAGMENT_COMBINATION.
+        #
+        FRAGMENT_COMBINATION = 5
+
+        ##
+        # \brief STRUCTURE_EMBEDDING.
+        #
+        STRUCTURE_EMBEDDING = 6
+
+        ##
+        # \brief ENERGY_MINIMIZATION.
+        #
+        ENERGY_MINIMIZATION = 7
+
+        ##
+        # \brief OUTPUT_SELECTION.
+        #
+        OUTPUT_SELECTION = 8
+
+    ##
+    # \brief 
+    #
+    class Counter(Boost.Python.enum):
+
+        ##
+        # \brief NUM_ROTATABLE_BONDS.
+        #
+        NUM_ROTATABLE_BONDS = 0
+
+        ##
+        # \brief NUM_TORSION_FRAGMENTS.
+        #
+        NUM_TORSION_FRAGMENTS = 1
+
+        ##
+        # \brief NUM_FRAGMENT_LIBRARY_HITS.
+        #
+        NUM_FRAGMENT_LIBRARY_HITS = 2
+
+        ##
+        # \brief NUM_FRAGMENT_CACHE_HITS.
+        #
+        NUM_FRAGMENT_CACHE_HITS = 3
+
+        ##
+        # \brief NUM_GENERATED_FRAGMENTS.
+        #
+        NUM_GENERATED_FRAGMENTS = 4
+
+        ##
+        # \brief NUM_FRAGMENT_CONFORMER_COMBINATIONS.
+        #
+        NUM_FRAGMENT_CONFORMER_COMBINATIONS = 5
+
+        ##
+        # \brief NUM_SAMPLED_CONFORMERS.
+        #
+        NUM_SAMPLED_CONFORMERS = 6
+
+        ##
+        # \brief NUM_STRUCTURE_GENERATION_FAILURES.
+        #
+        NUM_STRUCTURE_GENERATION_FAILURES = 7
+
+        ##
+        # \brief NUM_MINIMIZATIONS.
+        #
+        NUM_MINIMIZATIONS = 8
+
+        ##
+        # \brief NUM_MINIMIZATION_ITERATIONS.
+        #
+        NUM_MINIMIZATION_ITERATIONS = 9
+
+        ##
+        # \brief NUM_REJECTED_CONFORMERS.
+        #
+        NUM_REJECTED_CONFORMERS = 10
+
+        ##
+        # \brief NUM_OUTPUT_CONFORMERS.
+        #
+        NUM_OUTPUT_CONFORMERS = 11
+
+    ##
+    # \brief 
+    #
+    NUM_STAGES = 9
+
+    ##
+    # \brief 
+    #
+    NUM_COUNTERS = 12
+
+    ##
+    # \brief Initializes the \e %ConformerGeneratorStatistics instance.
+    # 
+    def __init__() -> None: pass
+
+    ##
+    # \brief Initializes a copy of the \e %ConformerGeneratorStatistics instance \a stats.
+    # \param stats The \e %ConformerGeneratorStatistics instance to copy.
+    # 
+    def __init__(stats: ConformerGeneratorStatistics) -> None: pass
+
+    ##
+    # \brief Returns the numeric identifier (ID) of the wrapped C++ class instance.
+    # 
+    # Different Python \e %ConformerGeneratorStatistics instances may reference the same underlying C++ class instance. The commonly used Python expression
+    # <tt>a is not b</tt> thus cannot tell reliably whether the two \e %ConformerGeneratorStatistics instances \e a and \e b reference different C++ objects. 
+    # The numeric identifier returned by this method allows to correctly implement such an identity test via the simple expression
+    # <tt>a.getObjectID() != b.getObjectID()</tt>.
+    # 
+    # \return The numeric ID of the internally referenced C++ class instance.
+    # 
+    def getObjectID() -> int: pass
+
+    ##
+    # \brief Replaces the current state of \a self with a copy of the state of the \e %ConformerGeneratorStatistics instance \a stats.
+    # \param stats The \e %ConformerGeneratorStatistics instance to copy.
+    # \return \a self
+    # 
+    def assign(stats: ConformerGeneratorStatistics) -> ConformerGeneratorStatistics: pass
+
+    ##
+    # \brief 
+    #
+    def clear() -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getTotalTime() -> float: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def setTotalTime(time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \return 
+    #
+    def getStageTime(stage: Stage) -> float: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \param time 
+    #
+    def setStageTime(stage: Stage, time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \param time 
+    #
+    def addStageTime(stage: Stage, time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param counter 
+    # \return 
+    #
+    def getCounter(counter: Counter) -> int: pass
+
+    ##
+    # \brief 
+    # \param counter 
+    # \param value 
+    #
+    def setCounter(counter: Counter, value: int) -> None: pass
+
+    ##
+    # \brief 
+    # \param counter 
+    # \param inc 
+    #
+    def increaseCounter(counter: Counter, inc: int = 1) -> None: pass
+
+    ##
+    # \brief Returns the fraction of fragments whose conformers were found in one of the fragment libraries.
+    # \return The fragment library hit rate in the range [0, 1], or \e 0 if no fragment lookups were performed.
+    #
+    def getFragmentLibraryHitRate() -> float: pass
+
+    ##
+    # \brief Returns the fraction of fragments not found in the fragment libraries whose conformers were retrieved from the fragment conformer cache.
+    # \return The fragment conformer cache hit rate in the range [0, 1], or \e 0 if no cache lookups were performed.
+    #
+    def getFragmentCacheHitRate() -> float: pass
+
+    ##
+    # \brief Performs the in-place addition operation <tt>self += stats</tt>.
+    # \param stats Specifies the second addend.
+    # \return The updated \e %ConformerGeneratorStatistics instance \a self.
+    # 
+    def __iadd__(stats: ConformerGeneratorStatistics) -> ConformerGeneratorStatistics: pass
+
+    ##
+    # \brief Returns a lower case identifier for the specified stage (e.g. \c "torsion_driving").
+    # \param stage The stage.
+    # \return The stage identifier.
+    #
+    @staticmethod
+    def getStageName(stage: Stage) -> str: pass
+
+    ##
+    # \brief Returns a lower case identifier for the specified counter (e.g. \c "num_sampled_conformers").
+    # \param counter The counter.
+    # \return The counter identifier.
+    #
+    @staticmethod
+    def getCounterName(counter: Counter) -> str: pass
+
+    objectID = property(getObjectID)
+
+    totalTime = property(getTotalTime, setTotalTime)
+
+    fragmentLibraryHitRate = property(getFragmentLibraryHitRate)
+
+    fragmentCacheHitRate = property(getFragmentCacheHitRate)
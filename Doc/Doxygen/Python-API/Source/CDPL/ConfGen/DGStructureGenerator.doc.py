@@ -73,6 +73,12 @@ class DGStructureGenerator(Boost.Python.instance):
     #
     def setup(molgraph: Chem.MolecularGraph, ia_data: ForceField.MMFF94InteractionData) -> None: pass
 
+    ##
+    # \brief 
+    # \param seed 
+    #
+    def setRandomSeed(seed: int) -> None: pass
+
     ##
     # \brief 
     # \param coords 
@@ -78,6 +78,24 @@ class DGStructureGeneratorSettings(DGConstraintGeneratorSettings):
     #
     def enablePlanarityConstraints() -> bool: pass
 
+    ##
+    # \brief Specifies the number of structures that get embedded together in a single batched run.
+    # \param size The embedding batch size.
+    #
+    # \since 1.2
+    #
+    def setEmbeddingBatchSize(size: int) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    # \since 1.2
+    #
+    def getEmbeddingBatchSize() -> int: pass
+
     boxSize = property(getBoxSize, setBoxSize)
 
     planarityConstraints = property(enablePlanarityConstraints, enablePlanarityConstraints)
+
+    embeddingBatchSize = property(getEmbeddingBatchSize, setEmbeddingBatchSize)
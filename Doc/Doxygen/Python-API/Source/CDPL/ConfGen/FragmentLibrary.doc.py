@@ -110,10 +110,44 @@ class FragmentLibrary(Boost.Python.instance):
     def loadDefaults() -> None: pass
 
     ##
-    # \brief 
-    # \param os 
+    # \brief Writes the entries held in memory to the output stream \a os.
+    # \param os The output stream.
+    # \param write_index If <tt>True</tt>, an additional record mapping the entry hash codes to the file offsets of the entries gets written (required by mapFile()).
+    #
+    def save(os: Base.OStream, write_index: bool = False) -> None: pass
+
+    ##
+    # \brief Memory-maps the indexed fragment library file \a file_name for lazy entry lookup.
+    #
+    # The entries stored in the file are not loaded but get decoded on their first lookup by getEntry(). Entries held in memory take precedence over mapped entries with the same hash code. 
+    # Mapped entries are not returned by getEntries() and are not counted by getNumEntries(). Since the mapped file pages are read-only, they can be shared between multiple processes. 
+    # Any previously mapped file gets unmapped.
     #
-    def save(os: Base.OStream) -> None: pass
+    # \param file_name The path to a fragment library file written by save() with index output enabled.
+    #
+    # \return <tt>True</tt> if the file was mapped, and <tt>False</tt> if the file is empty or does not provide an index.
+    #
+    # \throw Base.IOError if the file cannot be mapped or the index is corrupt.
+    #
+    # \since 1.2
+    #
+    def mapFile(file_name: str) -> bool: pass
+
+    ##
+    # \brief Releases the currently mapped fragment library file.
+    #
+    # \since 1.2
+    #
+    def unmapFile() -> None: pass
+
+    ##
+    # \brief Returns the number of entries provided by the currently mapped fragment library file.
+    #
+    # \return The number of mapped entries.
+    #
+    # \since 1.2
+    #
+    def getNumMappedEntries() -> int: pass
 
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %FragmentLibrary instance \a lib.
@@ -141,4 +175,6 @@ class FragmentLibrary(Boost.Python.instance):
 
     numEntries = property(getNumEntries)
 
+    numMappedEntries = property(getNumMappedEntries)
+
     entries = property(getEntries)
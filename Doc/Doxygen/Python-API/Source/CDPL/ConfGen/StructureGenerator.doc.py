@@ -105,6 +105,12 @@ class StructureGenerator(Boost.Python.instance):
     #
     def getLogMessageCallback() -> LogMessageCallbackFunction: pass
 
+    ##
+    # \brief Returns the timing and counter statistics of the last generate() call.
+    # \return 
+    #
+    def getStatistics() -> ConformerGeneratorStatistics: pass
+
     ##
     # \brief 
     # \param molgraph 
@@ -151,4 +157,6 @@ class StructureGenerator(Boost.Python.instance):
 
     timeoutCallback = property(getTimeoutCallback, setTimeoutCallback)
 
+    statistics = property(getStatistics)
+
     logMessageCallback = property(getLogMessageCallback, setLogMessageCallback)
@@ -167,6 +167,18 @@ class TorsionDriverSettings(Boost.Python.instance):
     #
     def getDistanceExponent() -> float: pass
 
+    ##
+    # \brief 
+    # \param num_threads 
+    #
+    def setNumThreads(num_threads: int) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getNumThreads() -> int: pass
+
     objectID = property(getObjectID)
 
     sampleHetAtomHydrogens = property(sampleHeteroAtomHydrogens, sampleHeteroAtomHydrogens)
@@ -181,6 +193,8 @@ class TorsionDriverSettings(Boost.Python.instance):
 
     distanceExponent = property(getDistanceExponent, setDistanceExponent)
 
+    numThreads = property(getNumThreads, setNumThreads)
+
     energyOrdered = property(orderByEnergy, orderByEnergy)
 
     energyWindow = property(getEnergyWindow, setEnergyWindow)
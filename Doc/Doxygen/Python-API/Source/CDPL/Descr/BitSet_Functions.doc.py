@@ -166,3 +166,79 @@ def calcTanimotoSimilarity(bs1: Util.BitSet, bs2: Util.BitSet) -> float: pass
 # \return The calculated similarity measure.
 # 
 def calcTverskySimilarity(bs1: Util.BitSet, bs2: Util.BitSet, a: float, b: float) -> float: pass
+
+##
+# \brief Calculates the <em>Tanimoto</em> similarities of all pairs of bitsets in <em>bitsets1</em> and <em>bitsets2</em>.
+# 
+# If <em>bitsets2</em> is <tt>None</tt>, the symmetric similarity matrix of the bitsets in <em>bitsets1</em> is calculated.
+# 
+# \param bitsets1 A sequence of Util.BitSet instances (matrix rows).
+# \param bitsets2 A sequence of Util.BitSet instances (matrix columns) or <tt>None</tt>.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(len(bitsets1), len(bitsets2))</em> with the calculated similarities.
+# \since 1.2
+# 
+def calcTanimotoSimilarityMatrix(bitsets1: object, bitsets2: object = None, num_threads: int = 0) -> object: pass
+
+##
+# \brief Calculates the <em>Cosine</em> similarities of all pairs of bitsets in <em>bitsets1</em> and <em>bitsets2</em>.
+# 
+# \param bitsets1 A sequence of Util.BitSet instances (matrix rows).
+# \param bitsets2 A sequence of Util.BitSet instances (matrix columns) or <tt>None</tt> for the symmetric matrix of <em>bitsets1</em>.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(len(bitsets1), len(bitsets2))</em> with the calculated similarities.
+# \since 1.2
+# 
+def calcCosineSimilarityMatrix(bitsets1: object, bitsets2: object = None, num_threads: int = 0) -> object: pass
+
+##
+# \brief Calculates the <em>Euclidean</em> similarities of all pairs of bitsets in <em>bitsets1</em> and <em>bitsets2</em>.
+# 
+# \param bitsets1 A sequence of Util.BitSet instances (matrix rows).
+# \param bitsets2 A sequence of Util.BitSet instances (matrix columns) or <tt>None</tt> for the symmetric matrix of <em>bitsets1</em>.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(len(bitsets1), len(bitsets2))</em> with the calculated similarities.
+# \since 1.2
+# 
+def calcEuclideanSimilarityMatrix(bitsets1: object, bitsets2: object = None, num_threads: int = 0) -> object: pass
+
+##
+# \brief Calculates the <em>Dice</em> similarities of all pairs of bitsets in <em>bitsets1</em> and <em>bitsets2</em>.
+# 
+# \param bitsets1 A sequence of Util.BitSet instances (matrix rows).
+# \param bitsets2 A sequence of Util.BitSet instances (matrix columns) or <tt>None</tt> for the symmetric matrix of <em>bitsets1</em>.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(len(bitsets1), len(bitsets2))</em> with the calculated similarities.
+# \since 1.2
+# 
+def calcDiceSimilarityMatrix(bitsets1: object, bitsets2: object = None, num_threads: int = 0) -> object: pass
+
+##
+# \brief Calculates the <em>Manhattan</em> similarities of all pairs of bitsets in <em>bitsets1</em> and <em>bitsets2</em>.
+# 
+# \param bitsets1 A sequence of Util.BitSet instances (matrix rows).
+# \param bitsets2 A sequence of Util.BitSet instances (matrix columns) or <tt>None</tt> for the symmetric matrix of <em>bitsets1</em>.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(len(bitsets1), len(bitsets2))</em> with the calculated similarities.
+# \since 1.2
+# 
+def calcManhattanSimilarityMatrix(bitsets1: object, bitsets2: object = None, num_threads: int = 0) -> object: pass
+
+##
+# \brief Calculates the <em>Tversky</em> similarities of all pairs of bitsets in <em>bitsets1</em> and <em>bitsets2</em>.
+# 
+# \param bitsets1 A sequence of Util.BitSet instances (matrix rows).
+# \param bitsets2 A sequence of Util.BitSet instances (matrix columns) or <tt>None</tt> for <em>bitsets1</em>.
+# \param a Weights the contribution of the first bitset.
+# \param b Weights the contribution of the second bitset.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(len(bitsets1), len(bitsets2))</em> with the calculated similarities.
+# \since 1.2
+# 
+def calcTverskySimilarityMatrix(bitsets1: object, bitsets2: object, a: float, b: float, num_threads: int = 0) -> object: pass
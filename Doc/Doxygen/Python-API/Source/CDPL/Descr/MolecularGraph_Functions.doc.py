@@ -102,3 +102,70 @@ def calcRingComplexity(molgraph: Chem.MolecularGraph) -> float: pass
 # \return 
 #
 def calcMolecularComplexity(molgraph: Chem.MolecularGraph) -> float: pass
+
+##
+# \brief Generates the fingerprints of multiple molecular graphs on multiple threads.
+# 
+# \param gen The fingerprint generator (copies are used by the worker threads).
+# \param molgraphs A sequence of Chem.MolecularGraph instances or a Chem.MoleculeReader that provides the molecules
+#                  (basic properties of read molecules get calculated by Chem.calcBasicProperties()).
+# \param num_bits The fingerprint size.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of type <em>uint8</em> and shape <em>(num_molgraphs, num_bits)</em> storing the fingerprint bits.
+# \since 1.2
+# 
+def generateFingerprints(gen: CircularFingerprintGenerator, molgraphs: object, num_bits: int, num_threads: int = 0) -> object: pass
+
+##
+# \brief Generates the fingerprints of multiple molecular graphs on multiple threads.
+# 
+# \param gen The fingerprint generator (copies are used by the worker threads).
+# \param molgraphs A sequence of Chem.MolecularGraph instances or a Chem.MoleculeReader that provides the molecules.
+# \param num_bits The fingerprint size.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of type <em>uint8</em> and shape <em>(num_molgraphs, num_bits)</em> storing the fingerprint bits.
+# \since 1.2
+# 
+def generateFingerprints(gen: PathFingerprintGenerator, molgraphs: object, num_bits: int, num_threads: int = 0) -> object: pass
+
+##
+# \brief Generates the MACCS key fingerprints of multiple molecular graphs on multiple threads.
+# 
+# \param gen The fingerprint generator (copies are used by the worker threads).
+# \param molgraphs A sequence of Chem.MolecularGraph instances or a Chem.MoleculeReader that provides the molecules.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of type <em>uint8</em> and shape <em>(num_molgraphs, 166)</em> storing the fingerprint bits.
+# \since 1.2
+# 
+def generateFingerprints(gen: MACCSFingerprintGenerator, molgraphs: object, num_threads: int = 0) -> object: pass
+
+##
+# \brief Generates the PubChem fingerprints of multiple molecular graphs on multiple threads.
+# 
+# \param gen The fingerprint generator (copies are used by the worker threads).
+# \param molgraphs A sequence of Chem.MolecularGraph instances or a Chem.MoleculeReader that provides the molecules.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of type <em>uint8</em> and shape <em>(num_molgraphs, 881)</em> storing the fingerprint bits.
+# \since 1.2
+# 
+def generateFingerprints(gen: PubChemFingerprintGenerator, molgraphs: object, num_threads: int = 0) -> object: pass
+
+##
+# \brief Calculates the descriptors of multiple molecular graphs on multiple threads.
+# 
+# The overloads for the other descriptor calculator types (Descr.MoleculeAutoCorr2DDescriptorCalculator,
+# Descr.MoleculeAutoCorr3DDescriptorCalculator and Descr.MoleculeRDFDescriptorCalculator) work the same way.
+# 
+# \param calc The descriptor calculator (copies are used by the worker threads).
+# \param molgraphs A sequence of Chem.MolecularGraph instances or a Chem.MoleculeReader that provides the molecules.
+# \param num_threads The number of threads to use (<em>0</em> means one per hardware thread).
+# 
+# \return A NumPy array of shape <em>(num_molgraphs, descr_size)</em> storing the calculated descriptors (shorter
+#         descriptors are padded with zeros).
+# \since 1.2
+# 
+def calcDescriptors(calc: AutoCorrelation2DVectorCalculator, molgraphs: object, num_threads: int = 0) -> object: pass
@@ -0,0 +1,140 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief A size-limited cache for MMFF94 interaction parameters of previously parameterized molecular graphs.
+#
+# Cache entries are keyed by the connection table of the molecular graph in combination with the parameterization settings.
+# If the maximum number of entries is reached, the least recently used entry gets discarded.
+#
+# \since 1.2
+#
+class MMFF94InteractionDataCache(Boost.Python.instance):
+
+    ##
+    # \brief 
+    #
+    DEF_MAX_SIZE = 200
+
+    ##
+    # \brief Initializes the \e %MMFF94InteractionDataCache instance.
+    # \param max_size The maximum number of cached entries.
+    # 
+    def __init__(max_size: int = 200) -> None: pass
+
+    ##
+    # \brief Returns the numeric identifier (ID) of the wrapped C++ class instance.
+    # 
+    # Different Python \e %MMFF94InteractionDataCache instances may reference the same underlying C++ class instance. The commonly used Python expression
+    # <tt>a is not b</tt> thus cannot tell reliably whether the two \e %MMFF94InteractionDataCache instances \e a and \e b reference different C++ objects. 
+    # The numeric identifier returned by this method allows to correctly implement such an identity test via the simple expression
+    # <tt>a.getObjectID() != b.getObjectID()</tt>.
+    # 
+    # \return The numeric ID of the internally referenced C++ class instance.
+    # 
+    def getObjectID() -> int: pass
+
+    ##
+    # \brief Specifies the maximum number of cached entries.
+    # \param max_size The maximum number of entries (<em>0</em> disables caching).
+    #
+    def setMaxSize(max_size: int) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getMaxSize() -> int: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getSize() -> int: pass
+
+    ##
+    # \brief 
+    #
+    def clear() -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getNumHits() -> int: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getNumMisses() -> int: pass
+
+    ##
+    # \brief 
+    #
+    def resetStatistics() -> None: pass
+
+    ##
+    # \brief Looks up the interaction data of the given molecular graph and parameterization settings.
+    # \param molgraph The parameterized molecular graph.
+    # \param param_set The used MMFF94 parameter set.
+    # \param ia_types The parameterized interaction types.
+    # \param strict The strict mode flag.
+    # \param de_const The dielectric constant used for electrostatic interactions.
+    # \param dist_expo The distance exponent used for electrostatic interactions.
+    # \param ia_data Receives a copy of the cached interaction data.
+    # \return <tt>True</tt> if an entry was found, and <tt>False</tt> otherwise.
+    #
+    def getData(molgraph: Chem.MolecularGraph, param_set: int, ia_types: int, strict: bool, de_const: float, dist_expo: float, ia_data: MMFF94InteractionData) -> bool: pass
+
+    ##
+    # \brief Stores a copy of the interaction data of the given molecular graph and parameterization settings.
+    # \param molgraph The parameterized molecular graph.
+    # \param param_set The used MMFF94 parameter set.
+    # \param ia_types The parameterized interaction types.
+    # \param strict The strict mode flag.
+    # \param de_const The dielectric constant used for electrostatic interactions.
+    # \param dist_expo The distance exponent used for electrostatic interactions.
+    # \param ia_data The interaction data to store.
+    #
+    def addData(molgraph: Chem.MolecularGraph, param_set: int, ia_types: int, strict: bool, de_const: float, dist_expo: float, ia_data: MMFF94InteractionData) -> None: pass
+
+    ##
+    # \brief Writes the cache entries in a compact binary format to the output stream \a os.
+    # \param os The output stream.
+    #
+    def write(os: Base.OStream) -> None: pass
+
+    ##
+    # \brief Replaces the current cache entries by the entries read from the input stream \a is.
+    # \param is The input stream providing data in the format written by write().
+    #
+    def read(is: Base.IStream) -> None: pass
+
+    objectID = property(getObjectID)
+
+    maxSize = property(getMaxSize, setMaxSize)
+
+    size = property(getSize)
+
+    numHits = property(getNumHits)
+
+    numMisses = property(getNumMisses)
@@ -215,6 +215,26 @@ class MMFF94InteractionParameterizer(Boost.Python.instance):
     #
     def setParameterSet(param_set: int) -> None: pass
 
+    ##
+    # \brief Specifies a cache for the lookup of previously calculated interaction data.
+    #
+    # The cache is only consulted if the builtin parameter tables of the current parameter set are in use and
+    # no interaction filter functions have been specified.
+    #
+    # \param cache The cache to use or <tt>None</tt> if caching shall be disabled.
+    #
+    # \since 1.2
+    #
+    def setInteractionDataCache(cache: MMFF94InteractionDataCache) -> None: pass
+
+    ##
+    # \brief Returns the used interaction data cache.
+    # \return The used cache or <tt>None</tt> if no cache has been specified.
+    #
+    # \since 1.2
+    #
+    def getInteractionDataCache() -> MMFF94InteractionDataCache: pass
+
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %MMFF94InteractionParameterizer instance \a parameterizer.
     # \param parameterizer The \e %MMFF94InteractionParameterizer instance to copy.
@@ -232,3 +252,5 @@ class MMFF94InteractionParameterizer(Boost.Python.instance):
     def parameterize(molgraph: Chem.MolecularGraph, ia_data: MMFF94InteractionData, ia_types: int = 127, strict: bool = True) -> None: pass
 
     objectID = property(getObjectID)
+
+    interactionDataCache = property(getInteractionDataCache, setInteractionDataCache)
@@ -64,6 +64,17 @@ class MMFF94VanDerWaalsInteraction(Boost.Python.instance):
     # 
     def __init__(atom1_idx: int, atom2_idx: int, atom_params1: MMFF94VanDerWaalsAtomParameters, atom_params2: MMFF94VanDerWaalsAtomParameters, expo: float, fact_b: float, beta: float, fact_darad: float, fact_daeps: float) -> None: pass
 
+    ##
+    # \brief Initializes the \e %MMFF94VanDerWaalsInteraction instance with the already calculated well depth \a e_IJ and minimum-energy separation \a r_IJ.
+    # \param atom1_idx 
+    # \param atom2_idx 
+    # \param e_IJ 
+    # \param r_IJ 
+    # 
+    # \since 1.2
+    #
+    def __init__(atom1_idx: int, atom2_idx: int, e_IJ: float, r_IJ: float) -> None: pass
+
     ##
     # \brief 
     # \return 
@@ -172,6 +172,14 @@ class FGrid(Boost.Python.instance):
     #
     def toArray() -> object: pass
 
+    ##
+    # \brief Returns a NumPy array of shape <em>(size1, size2, size3)</em> that directly references the grid data (no copy is made).
+    # \return The NumPy array view or <tt>None</tt> if NumPy is not available.
+    # \note The view is only valid as long as the grid does not get resized.
+    # \since 1.2
+    #
+    def asArray() -> object: pass
+
     ##
     # \brief 
     # \return 
@@ -236,6 +236,24 @@ class Vector2FArray(Boost.Python.instance):
     #
     def toArray(as_vec: bool) -> object: pass
 
+    ##
+    # \brief Returns a NumPy array that directly references the vector data of the array (no copy is made).
+    # \param as_vec If <tt>True</tt>, the returned array is one-dimensional, otherwise it has a shape of <em>(size, dim)</em>.
+    # \return The NumPy array view or <tt>None</tt> if NumPy is not available.
+    # \note The view is only valid as long as the array does not get resized.
+    # \since 1.2
+    #
+    def asArray(as_vec: bool = False) -> object: pass
+
+    ##
+    # \brief Implements the NumPy array interface (e.g. <tt>numpy.asarray(array)</tt> returns a view without copying the data).
+    # \param dtype 
+    # \param copy 
+    # \return 
+    # \since 1.2
+    #
+    def __array__(dtype: object = None, copy: object = None) -> object: pass
+
     ##
     # \brief 
     # \param idx 
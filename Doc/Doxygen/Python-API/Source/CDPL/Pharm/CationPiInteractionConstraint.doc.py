@@ -85,6 +85,15 @@ class CationPiInteractionConstraint(Boost.Python.instance):
     #
     def getMaxAngle() -> float: pass
 
+    ##
+    # \brief Returns an upper bound for the distance between the positions of two features that fulfill the constraints.
+    # 
+    # \return The maximum feature distance.
+    # 
+    # \since 1.2
+    #
+    def getMaxFeatureDistance() -> float: pass
+
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %CationPiInteractionConstraint instance \a constr.
     # \param constr The \e %CationPiInteractionConstraint instance to copy.
@@ -107,3 +116,5 @@ class CationPiInteractionConstraint(Boost.Python.instance):
     maxDistance = property(getMaxDistance)
 
     maxAngle = property(getMaxAngle)
+
+    maxFeatureDistance = property(getMaxFeatureDistance)
@@ -97,6 +97,15 @@ class HBondingInteractionConstraint(Boost.Python.instance):
     #
     def getMaxAcceptorAngle() -> float: pass
 
+    ##
+    # \brief Returns an upper bound for the distance between the positions of two features that fulfill the constraints.
+    # 
+    # \return The maximum feature distance.
+    # 
+    # \since 1.2
+    #
+    def getMaxFeatureDistance() -> float: pass
+
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %HBondingInteractionConstraint instance \a constr.
     # \param constr The \e %HBondingInteractionConstraint instance to copy.
@@ -121,3 +130,5 @@ class HBondingInteractionConstraint(Boost.Python.instance):
     minAHDAngle = property(getMinAHDAngle)
 
     maxAcceptorAngle = property(getMaxAcceptorAngle)
+
+    maxFeatureDistance = property(getMaxFeatureDistance)
@@ -24,6 +24,13 @@
 # 
 class InteractionAnalyzer(Boost.Python.instance):
 
+    ##
+    # \brief Value specifying that the interaction distance of a feature type pair is not limited.
+    # 
+    # \since 1.2
+    #
+    NO_DISTANCE_LIMIT = 1.7976931348623157e+308
+
     ##
     # \brief Constructs the <tt>InteractionAnalyzer</tt> instance.
     # 
@@ -56,6 +63,18 @@ class InteractionAnalyzer(Boost.Python.instance):
     # 
     def setConstraintFunction(type1: int, type2: int, func: BoolFeature2Functor) -> None: pass
 
+    ##
+    # \brief Specifies a function that gets used for checking whether all constraints are actually fulfilled for an interaction between a pair of features of the specified types.
+    # 
+    # \param type1 An identifier for the type of the first feature.
+    # \param type2 An identifier for the type of the second feature.
+    # \param func The constraint check function.
+    # \param max_dist The maximum distance between the positions of two features that may fulfill the constraints.
+    # 
+    # \since 1.2
+    #
+    def setConstraintFunction(type1: int, type2: int, func: BoolFeature2Functor, max_dist: float) -> None: pass
+
     ##
     # \brief Removes the constraint check function that was registered for the specified pair of feature types.
     # 
@@ -74,6 +93,45 @@ class InteractionAnalyzer(Boost.Python.instance):
     # 
     def getConstraintFunction(type1: int, type2: int) -> BoolFeature2Functor: pass
 
+    ##
+    # \brief Returns the maximum interaction distance that was registered for the specified pair of feature types.
+    # 
+    # \param type1 An identifier for the type of the first feature.
+    # \param type2 An identifier for the type of the second feature.
+    # 
+    # \return The maximum interaction distance or InteractionAnalyzer.NO_DISTANCE_LIMIT if the distance is not limited or no constraint function has been registered.
+    # 
+    # \since 1.2
+    #
+    def getMaxInteractionDistance(type1: int, type2: int) -> float: pass
+
+    ##
+    # \brief Builds the cell list of the features in <em>cntnr2</em> that will be used by subsequent calls to analyze(cntnr1: FeatureContainer, iactions: FeatureMapping, append: bool = False).
+    # 
+    # The feature positions are recorded at the time of the call. If the positions of the features in <em>cntnr2</em> change or features get added or removed, the method has to be called again. Cell sizes are derived from the maximum interaction distances of the constraint functions registered at the time of the call.
+    # 
+    # \param cntnr2 The feature container that will act as the second feature container of subsequent analyses.
+    # 
+    # \since 1.2
+    #
+    def indexFeatures(cntnr2: FeatureContainer) -> None: pass
+
+    ##
+    # \brief Releases the cell list built by the last call to indexFeatures().
+    # 
+    # \since 1.2
+    #
+    def clearFeatureIndex() -> None: pass
+
+    ##
+    # \brief Tells whether a cell list has been built by a call to indexFeatures().
+    # 
+    # \return <tt>True</tt> if a cell list is available, and <tt>False</tt> otherwise.
+    # 
+    # \since 1.2
+    #
+    def hasFeatureIndex() -> bool: pass
+
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %InteractionAnalyzer instance \a analyzer.
     # \param analyzer The \e %InteractionAnalyzer instance to copy.
@@ -93,4 +151,19 @@ class InteractionAnalyzer(Boost.Python.instance):
     # 
     def analyze(cntnr1: FeatureContainer, cntnr2: FeatureContainer, iactions: FeatureMapping, append: bool = False) -> None: pass
 
+    ##
+    # \brief Analyzes possible interactions of the features in feature container <em>cntnr1</em> with the features of the container that was specified in the last call to indexFeatures().
+    # 
+    # The reported interactions are the same as for analyze(cntnr1: FeatureContainer, cntnr2: FeatureContainer, iactions: FeatureMapping, append: bool = False) called with the indexed container as second argument.
+    # 
+    # \param cntnr1 The first feature container.
+    # \param iactions An output map that contains features of <em>cntnr1</em> as keys and interacting indexed features as values.
+    # \param append If <tt>False</tt>, <em>iactions</em> gets cleared before adding any feature mappings.
+    # 
+    # \throw Base.OperationFailed if no cell list has been built.
+    # 
+    # \since 1.2
+    #
+    def analyze(cntnr1: FeatureContainer, iactions: FeatureMapping, append: bool = False) -> None: pass
+
     objectID = property(getObjectID)
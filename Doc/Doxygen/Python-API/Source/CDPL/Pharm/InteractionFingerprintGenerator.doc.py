@@ -0,0 +1,183 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+
+##
+# \brief Generates interaction fingerprints for series of ligand/environment coordinate sets (e.g. MD trajectory frames or docking poses).
+# 
+# The pharmacophores of the ligand and its environment get generated only once by a call to setup(). For each processed frame, the positions and orientations of the features are then updated from the supplied atom coordinates by superimposing the reference coordinates of the feature atoms and their bonded neighbors onto the new coordinates. Feature interactions get detected by the interaction analyzer returned by getInteractionAnalyzer(). The analyzer does not get modified by the generation of fingerprints (a feature index built by InteractionAnalyzer.indexFeatures() is neither used nor released), which allows concurrent calls of generate() as long as the analyzer's constraint functions remain unchanged.
+# 
+# The fingerprint of a frame comprises one bit (or counter) for every pair of an environment feature and a ligand feature type. The bit for the environment feature with index <em>i</em> and ligand features of type <em>t</em> (see namespace Pharm.FeatureType) has the index <em>i * NUM_LIGAND_FEATURE_TYPES + t</em>.
+# 
+# Coordinates are passed as Math.Vector3DArray instances or NumPy arrays of shape <em>(N, 3)</em> holding the atom coordinates in the atom order of the molecular graphs specified in the last call to setup(). Arrays that contain data for multiple frames store the coordinates of the frames consecutively (e.g. a NumPy array of shape <em>(F, N, 3)</em> reshaped to <em>(F * N, 3)</em>). An empty array selects the coordinates the pharmacophores were generated from.
+# 
+# \since 1.2
+# 
+class InteractionFingerprintGenerator(Boost.Python.instance):
+
+    ##
+    # \brief 
+    #
+    NUM_LIGAND_FEATURE_TYPES = 10
+
+    ##
+    # \brief Constructs the <tt>InteractionFingerprintGenerator</tt> instance.
+    # 
+    def __init__() -> None: pass
+
+    ##
+    # \brief Returns the numeric identifier (ID) of the wrapped C++ class instance.
+    # 
+    # Different Python \e %InteractionFingerprintGenerator instances may reference the same underlying C++ class instance. The commonly used Python expression
+    # <tt>a is not b</tt> thus cannot tell reliably whether the two \e %InteractionFingerprintGenerator instances \e a and \e b reference different C++ objects. 
+    # The numeric identifier returned by this method allows to correctly implement such an identity test via the simple expression
+    # <tt>a.getObjectID() != b.getObjectID()</tt>.
+    # 
+    # \return The numeric ID of the internally referenced C++ class instance.
+    # 
+    def getObjectID() -> int: pass
+
+    ##
+    # \brief Specifies the number of threads that are used for processing multiple frames.
+    # 
+    # \param num_threads The number of threads to use.
+    # 
+    # \note By default, frames get processed in the calling thread only (value zero).
+    # 
+    def setNumThreads(num_threads: int) -> None: pass
+
+    ##
+    # \brief Returns the number of threads that are used for processing multiple frames.
+    # 
+    # \return The number of threads.
+    # 
+    def getNumThreads() -> int: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getLigandPharmacophoreGenerator() -> PharmacophoreGenerator: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getEnvironmentPharmacophoreGenerator() -> PharmacophoreGenerator: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getInteractionAnalyzer() -> InteractionAnalyzer: pass
+
+    ##
+    # \brief Generates the ligand and environment pharmacophores that will be used for processing subsequent frames.
+    # 
+    # \param ligand The ligand molecular graph.
+    # \param env The environment (e.g. receptor) molecular graph.
+    # 
+    # \note The molecular graphs have to be prepared for pharmacophore generation and must not be modified as long as frames get processed.
+    # 
+    def setup(ligand: MolecularGraph, env: MolecularGraph) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getLigandPharmacophore() -> Pharmacophore: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getEnvironmentPharmacophore() -> Pharmacophore: pass
+
+    ##
+    # \brief Returns the number of fingerprint bits.
+    # 
+    # \return The number of environment features times <tt>NUM_LIGAND_FEATURE_TYPES</tt>.
+    # 
+    def getNumBits() -> int: pass
+
+    ##
+    # \brief Generates the interaction fingerprint of a single frame.
+    # 
+    # \param lig_coords The ligand atom coordinates.
+    # \param env_coords The environment atom coordinates.
+    # \param fp The output fingerprint.
+    # 
+    # \throw Base.SizeError if the size of a coordinates array is neither zero nor the atom count of the respective molecular graph.
+    # 
+    def generate(lig_coords: Math.Vector3DArray, env_coords: Math.Vector3DArray, fp: Util.BitSet) -> None: pass
+
+    ##
+    # \brief Counts the interactions per fingerprint bit for a single frame.
+    # 
+    # \param lig_coords The ligand atom coordinates.
+    # \param env_coords The environment atom coordinates.
+    # \param counts The output vector receiving the number of interactions per fingerprint bit.
+    # 
+    # \throw Base.SizeError if the size of a coordinates array is neither zero nor the atom count of the respective molecular graph.
+    # 
+    def generate(lig_coords: Math.Vector3DArray, env_coords: Math.Vector3DArray, counts: Math.ULVector) -> None: pass
+
+    ##
+    # \brief Generates the interaction fingerprints of multiple frames.
+    # 
+    # Each coordinates array has to provide the coordinates of all <em>num_frames</em> frames, of a single frame (used for all frames) or has to be empty. If the environment coordinates do not change between the frames, the cell list of the environment features gets built only once.
+    # 
+    # \param lig_coords The ligand atom coordinates.
+    # \param env_coords The environment atom coordinates.
+    # \param num_frames The number of frames.
+    # \param fps The output array receiving the fingerprint of each frame.
+    # 
+    # \throw Base.SizeError if the size of a coordinates array does not match.
+    # 
+    def generate(lig_coords: Math.Vector3DArray, env_coords: Math.Vector3DArray, num_frames: int, fps: Util.BitSetArray) -> None: pass
+
+    ##
+    # \brief Counts the interactions per fingerprint bit for multiple frames.
+    # 
+    # \param lig_coords The ligand atom coordinates.
+    # \param env_coords The environment atom coordinates.
+    # \param num_frames The number of frames.
+    # \param counts The output matrix whose rows receive the interaction counts of the frames (<tt>counts.toArray()</tt> returns a NumPy array copy).
+    # 
+    # \throw Base.SizeError if the size of a coordinates array does not match.
+    # 
+    def generate(lig_coords: Math.Vector3DArray, env_coords: Math.Vector3DArray, num_frames: int, counts: Math.ULMatrix) -> None: pass
+
+    objectID = property(getObjectID)
+
+    numThreads = property(getNumThreads, setNumThreads)
+
+    numBits = property(getNumBits)
+
+    ligandPharmacophoreGenerator = property(getLigandPharmacophoreGenerator)
+
+    envPharmacophoreGenerator = property(getEnvironmentPharmacophoreGenerator)
+
+    interactionAnalyzer = property(getInteractionAnalyzer)
+
+    ligandPharmacophore = property(getLigandPharmacophore)
+
+    envPharmacophore = property(getEnvironmentPharmacophore)
@@ -96,6 +96,15 @@ class ParallelPiPiInteractionConstraint(Boost.Python.instance):
     #
     def getMaxAngle() -> float: pass
 
+    ##
+    # \brief Returns an upper bound for the distance between the positions of two features that fulfill the constraints.
+    # 
+    # \return The maximum feature distance.
+    # 
+    # \since 1.2
+    #
+    def getMaxFeatureDistance() -> float: pass
+
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %ParallelPiPiInteractionConstraint instance \a constr.
     # \param constr The \e %ParallelPiPiInteractionConstraint instance to copy.
@@ -120,3 +129,5 @@ class ParallelPiPiInteractionConstraint(Boost.Python.instance):
     maxHDistance = property(getMaxHDistance)
 
     maxAngle = property(getMaxAngle)
+
+    maxFeatureDistance = property(getMaxFeatureDistance)
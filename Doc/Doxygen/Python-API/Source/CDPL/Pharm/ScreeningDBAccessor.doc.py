@@ -131,6 +131,48 @@ class ScreeningDBAccessor(Boost.Python.instance):
     #
     def getFeatureCounts(mol_idx: int, mol_conf_idx: int) -> FeatureTypeHistogram: pass
 
+    ##
+    # \brief Announces that the pharmacophores with the specified indices are going to be requested next.
+    # 
+    # Implementations may use this hint to load and decode the corresponding data in advance (e.g. in a single database query and in a background thread). The default implementation does nothing.
+    # 
+    # \param pharm_indices The indices of the pharmacophores that will be requested.
+    #
+    # \since 1.2
+    #
+    def prefetchPharmacophores(pharm_indices: Util.STArray) -> None: pass
+
+    ##
+    # \brief Retrieves the 3D coordinates and van der Waals radii of the atoms of the molecule conformation the pharmacophore at index <em>pharm_idx</em> has been generated from.
+    # 
+    # Allows to check for exclusion volume clashes without loading and decoding the whole molecule. The default implementation does not provide such data and returns <tt>False</tt>.
+    # 
+    # \param pharm_idx The zero-based index of the pharmacophore.
+    # \param coords The array receiving the atom coordinates (previous content gets overwritten).
+    # \param radii The array receiving the atom van der Waals radii (previous content gets overwritten).
+    #
+    # \return <tt>True</tt> if the data are available, and <tt>False</tt> otherwise.
+    #
+    # \since 1.2
+    #
+    def getAtomCoordinatesAndRadii(pharm_idx: int, coords: Math.Vector3DArray, radii: Util.DArray) -> bool: pass
+
+    ##
+    # \brief Returns the number of bytes of encoded molecule and pharmacophore data read since the database was opened.
+    # \return The number of bytes read.
+    #
+    # \since 1.2
+    #
+    def getNumBytesRead() -> int: pass
+
+    ##
+    # \brief Returns the accumulated time in seconds spent on decoding molecule and pharmacophore data since the database was opened.
+    # \return The data decoding time.
+    #
+    # \since 1.2
+    #
+    def getDataDecodingTime() -> float: pass
+
     objectID = property(getObjectID)
 
     databaseName = property(getDatabaseName)
@@ -138,3 +180,7 @@ class ScreeningDBAccessor(Boost.Python.instance):
     numMolecules = property(getNumMolecules)
 
     numPharmacophores = property(getNumPharmacophores)
+
+    numBytesRead = property(getNumBytesRead)
+
+    dataDecodingTime = property(getDataDecodingTime)
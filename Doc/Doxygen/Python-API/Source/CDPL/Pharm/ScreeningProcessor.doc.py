@@ -59,8 +59,9 @@ class ScreeningProcessor(Boost.Python.instance):
         # \param pharm_idx 
         # \param mol_idx 
         # \param conf_idx 
+        # \param qry_pharm_idx 
         # 
-        def __init__(hit_prov: ScreeningProcessor, qry_pharm: FeatureContainer, hit_pharm: FeatureContainer, mol: Chem.Molecule, xform: Math.Matrix4D, pharm_idx: int, mol_idx: int, conf_idx: int) -> None: pass
+        def __init__(hit_prov: ScreeningProcessor, qry_pharm: FeatureContainer, hit_pharm: FeatureContainer, mol: Chem.Molecule, xform: Math.Matrix4D, pharm_idx: int, mol_idx: int, conf_idx: int, qry_pharm_idx: int = 0) -> None: pass
 
         ##
         # \brief Initializes a copy of the \e %SearchHit instance \a hit.
@@ -135,6 +136,13 @@ class ScreeningProcessor(Boost.Python.instance):
         #
         def getHitConformationIndex() -> int: pass
 
+        ##
+        # \brief Returns the index of the matched query pharmacophore in the query list passed to ScreeningProcessor.searchDB().
+        # \return The query pharmacophore index (always \e 0 for single query searches).
+        # \since 1.2
+        #
+        def getQueryPharmacophoreIndex() -> int: pass
+
         objectID = property(getObjectID)
 
         hitProvider = property(getHitProvider)
@@ -153,6 +161,8 @@ class ScreeningProcessor(Boost.Python.instance):
 
         hitConformationIndex = property(getHitConformationIndex)
 
+        queryPharmacophoreIndex = property(getQueryPharmacophoreIndex)
+
     ##
     # \brief Constructs the <tt>ScreeningProcessor</tt> instance for the given screening database accessor <em>db_acc</em>.
     # 
@@ -277,6 +287,28 @@ class ScreeningProcessor(Boost.Python.instance):
     #
     def searchDB(query: FeatureContainer, mol_start_idx: int = 0, mol_end_idx: int = 0) -> int: pass
 
+    ##
+    # \brief Screens the database for molecules matching any of the query pharmacophores in \a queries in a single pass.
+    # 
+    # Each database pharmacophore is loaded only once and then checked against all queries. The index of the
+    # matched query is reported by ScreeningProcessor.SearchHit.getQueryPharmacophoreIndex().
+    #
+    # \param queries A sequence of FeatureContainer instances specifying the query pharmacophores.
+    # \param mol_start_idx 
+    # \param mol_end_idx 
+    # \return The number of reported hits.
+    # \since 1.2
+    #
+    def searchDB(queries: object, mol_start_idx: int = 0, mol_end_idx: int = 0) -> int: pass
+
+    ##
+    # \brief Returns the statistics collected during the last call to searchDB().
+    # \return The screening statistics of the last search.
+    #
+    # \since 1.2
+    #
+    def getStatistics() -> ScreeningProcessorStatistics: pass
+
     objectID = property(getObjectID)
 
     dbAcccessor = property(getDBAccessor, setDBAccessor)
@@ -294,3 +326,5 @@ class ScreeningProcessor(Boost.Python.instance):
     checkXVolumes = property(xVolumeClashesChecked, checkXVolumeClashes)
 
     bestAlignments = property(bestAlignmentsSeeked, seekBestAlignments)
+
+    statistics = property(getStatistics)
@@ -0,0 +1,320 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief Per-stage candidate counts, wall clock times and I/O counters collected during a pharmacophore screening run.
+# 
+# \since 1.2
+#
+class ScreeningProcessorStatistics(Boost.Python.instance):
+
+    ##
+    # \brief 
+    #
+    class Stage(Boost.Python.enum):
+
+        ##
+        # \brief FEATURE_COUNT_FILTER.
+        #
+        FEATURE_COUNT_FILTER = 0
+
+        ##
+        # \brief TWO_POINT_PHARMACOPHORE_FILTER.
+        #
+        TWO_POINT_PHARMACOPHORE_FILTER = 1
+
+        ##
+        # \brief TOPOLOGICAL_ALIGNMENT.
+        #
+        TOPOLOGICAL_ALIGNMENT = 2
+
+        ##
+        # \brief SPATIAL_ALIGNMENT.
+        #
+        SPATIAL_ALIGNMENT = 3
+
+        ##
+        # \brief XVOLUME_CLASH_FILTER.
+        #
+        XVOLUME_CLASH_FILTER = 4
+
+        ##
+        # \brief SCORING.
+        #
+        SCORING = 5
+
+    ##
+    # \brief 
+    #
+    class Counter(Boost.Python.enum):
+
+        ##
+        # \brief NUM_SCREENED_PHARMACOPHORES.
+        #
+        NUM_SCREENED_PHARMACOPHORES = 0
+
+        ##
+        # \brief NUM_SKIPPED_PHARMACOPHORES.
+        #
+        NUM_SKIPPED_PHARMACOPHORES = 1
+
+        ##
+        # \brief NUM_LOADED_PHARMACOPHORES.
+        #
+        NUM_LOADED_PHARMACOPHORES = 2
+
+        ##
+        # \brief NUM_LOADED_MOLECULES.
+        #
+        NUM_LOADED_MOLECULES = 3
+
+        ##
+        # \brief NUM_BYTES_READ.
+        #
+        NUM_BYTES_READ = 4
+
+        ##
+        # \brief NUM_HITS.
+        #
+        NUM_HITS = 5
+
+    ##
+    # \brief 
+    #
+    NUM_STAGES = 6
+
+    ##
+    # \brief 
+    #
+    NUM_COUNTERS = 6
+
+    ##
+    # \brief Initializes the \e %ScreeningProcessorStatistics instance.
+    # 
+    def __init__() -> None: pass
+
+    ##
+    # \brief Initializes a copy of the \e %ScreeningProcessorStatistics instance \a stats.
+    # \param stats The \e %ScreeningProcessorStatistics instance to copy.
+    # 
+    def __init__(stats: ScreeningProcessorStatistics) -> None: pass
+
+    ##
+    # \brief Returns the numeric identifier (ID) of the wrapped C++ class instance.
+    # 
+    # Different Python \e %ScreeningProcessorStatistics instances may reference the same underlying C++ class instance. The commonly used Python expression
+    # <tt>a is not b</tt> thus cannot tell reliably whether the two \e %ScreeningProcessorStatistics instances \e a and \e b reference different C++ objects. 
+    # The numeric identifier returned by this method allows to correctly implement such an identity test via the simple expression
+    # <tt>a.getObjectID() != b.getObjectID()</tt>.
+    # 
+    # \return The numeric ID of the internally referenced C++ class instance.
+    # 
+    def getObjectID() -> int: pass
+
+    ##
+    # \brief Replaces the current state of \a self with a copy of the state of the \e %ScreeningProcessorStatistics instance \a stats.
+    # \param stats The \e %ScreeningProcessorStatistics instance to copy.
+    # \return \a self
+    # 
+    def assign(stats: ScreeningProcessorStatistics) -> ScreeningProcessorStatistics: pass
+
+    ##
+    # \brief 
+    #
+    def clear() -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getTotalTime() -> float: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def setTotalTime(time: float) -> None: pass
+
+    ##
+    # \brief Returns the number of candidates that were subjected to the specified stage.
+    # \param stage The stage.
+    # \return The number of tested candidates.
+    #
+    def getNumTested(stage: Stage) -> int: pass
+
+    ##
+    # \brief Returns the number of candidates that passed the specified stage.
+    # \param stage The stage.
+    # \return The number of passed candidates.
+    #
+    def getNumPassed(stage: Stage) -> int: pass
+
+    ##
+    # \brief Returns the fraction of tested candidates that passed the specified stage.
+    # \param stage The stage.
+    # \return The pass rate in the range [0, 1], or \e 0 if no candidates were tested.
+    #
+    def getPassRate(stage: Stage) -> float: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \param num_tested 
+    # \param num_passed 
+    #
+    def setStageCounts(stage: Stage, num_tested: int, num_passed: int) -> None: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \param num_tested 
+    # \param num_passed 
+    #
+    def addStageCounts(stage: Stage, num_tested: int, num_passed: int) -> None: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \return 
+    #
+    def getStageTime(stage: Stage) -> float: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \param time 
+    #
+    def setStageTime(stage: Stage, time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param stage 
+    # \param time 
+    #
+    def addStageTime(stage: Stage, time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param counter 
+    # \return 
+    #
+    def getCounter(counter: Counter) -> int: pass
+
+    ##
+    # \brief 
+    # \param counter 
+    # \param value 
+    #
+    def setCounter(counter: Counter, value: int) -> None: pass
+
+    ##
+    # \brief 
+    # \param counter 
+    # \param inc 
+    #
+    def increaseCounter(counter: Counter, inc: int = 1) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getPharmacophoreLoadTime() -> float: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def setPharmacophoreLoadTime(time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def addPharmacophoreLoadTime(time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getMoleculeLoadTime() -> float: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def setMoleculeLoadTime(time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def addMoleculeLoadTime(time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \return 
+    #
+    def getDataDecodingTime() -> float: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def setDataDecodingTime(time: float) -> None: pass
+
+    ##
+    # \brief 
+    # \param time 
+    #
+    def addDataDecodingTime(time: float) -> None: pass
+
+    ##
+    # \brief Performs the in-place addition operation <tt>self += stats</tt>.
+    # \param stats Specifies the second addend.
+    # \return The updated \e %ScreeningProcessorStatistics instance \a self.
+    # 
+    def __iadd__(stats: ScreeningProcessorStatistics) -> ScreeningProcessorStatistics: pass
+
+    ##
+    # \brief Returns a lower case identifier for the specified stage (e.g. \c "spatial_alignment").
+    # \param stage The stage.
+    # \return The stage identifier.
+    #
+    @staticmethod
+    def getStageName(stage: Stage) -> str: pass
+
+    ##
+    # \brief Returns a lower case identifier for the specified counter (e.g. \c "num_bytes_read").
+    # \param counter The counter.
+    # \return The counter identifier.
+    #
+    @staticmethod
+    def getCounterName(counter: Counter) -> str: pass
+
+    objectID = property(getObjectID)
+
+    totalTime = property(getTotalTime, setTotalTime)
+
+    pharmacophoreLoadTime = property(getPharmacophoreLoadTime, setPharmacophoreLoadTime)
+
+    moleculeLoadTime = property(getMoleculeLoadTime, setMoleculeLoadTime)
+
+    dataDecodingTime = property(getDataDecodingTime, setDataDecodingTime)
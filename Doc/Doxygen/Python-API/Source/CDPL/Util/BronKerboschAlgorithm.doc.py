@@ -37,9 +37,10 @@ class BronKerboschAlgorithm(Boost.Python.instance):
 
     ##
     # \brief Initializes the \e %BronKerboschAlgorithm instance.
-    # \param adj_mtx 
+    # \param adj_mtx The adjacency matrix of the graph.
+    # \param min_clique_size The minimum size of the cliques to report.
     # 
-    def __init__(adj_mtx: BitSetArray) -> None: pass
+    def __init__(adj_mtx: BitSetArray, min_clique_size: int = 0) -> None: pass
 
     ##
     # \brief Returns the numeric identifier (ID) of the wrapped C++ class instance.
@@ -54,10 +55,11 @@ class BronKerboschAlgorithm(Boost.Python.instance):
     def getObjectID() -> int: pass
 
     ##
-    # \brief 
-    # \param adj_mtx 
+    # \brief Initializes the algorithm for the enumeration of the maximal cliques of the specified graph.
+    # \param adj_mtx The adjacency matrix of the graph.
+    # \param min_clique_size The minimum size of the cliques to report.
     #
-    def init(adj_mtx: BitSetArray) -> None: pass
+    def init(adj_mtx: BitSetArray, min_clique_size: int = 0) -> None: pass
 
     ##
     # \brief 
@@ -66,6 +68,24 @@ class BronKerboschAlgorithm(Boost.Python.instance):
     #
     def nextClique(clique: BitSet) -> bool: pass
 
+    ##
+    # \brief Returns the minimum size of the cliques that get reported.
+    # \return The minimum reported clique size.
+    #
+    def getMinCliqueSize() -> int: pass
+
+    ##
+    # \brief Returns the number of cliques that have been reported since the last call to init().
+    # \return The number of reported cliques.
+    #
+    def getNumEmittedCliques() -> int: pass
+
+    ##
+    # \brief Returns the number of search tree branches that have been pruned since the last call to init().
+    # \return The number of pruned search tree branches.
+    #
+    def getNumPrunedBranches() -> int: pass
+
     ##
     # \brief Replaces the current state of \a self with a copy of the state of the \e %BronKerboschAlgorithm instance \a bka.
     # \param bka The \e %BronKerboschAlgorithm instance to copy.
@@ -74,3 +94,9 @@ class BronKerboschAlgorithm(Boost.Python.instance):
     def assign(bka: BronKerboschAlgorithm) -> BronKerboschAlgorithm: pass
 
     objectID = property(getObjectID)
+
+    minCliqueSize = property(getMinCliqueSize)
+
+    numEmittedCliques = property(getNumEmittedCliques)
+
+    numPrunedBranches = property(getNumPrunedBranches)
@@ -0,0 +1,106 @@
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+#
+
+##
+# \brief Branch-and-bound search for a maximum clique of an undirected graph.
+# 
+# The implementation follows the MCQ algorithm of Tomita et al. [\ref TOMI] which uses a greedy coloring of the candidate nodes
+# to obtain an upper bound for the size of the cliques that can be reached from a given search tree node. For graphs with up to 256 nodes
+# the search operates on fixed-width bitsets.
+# 
+class MaxCliqueAlgorithm(Boost.Python.instance):
+
+    ##
+    # \brief Initializes the \e %MaxCliqueAlgorithm instance.
+    # 
+    def __init__() -> None: pass
+
+    ##
+    # \brief Initializes a copy of the \e %MaxCliqueAlgorithm instance \a mca.
+    # \param mca The \e %MaxCliqueAlgorithm instance to copy.
+    # 
+    def __init__(mca: MaxCliqueAlgorithm) -> None: pass
+
+    ##
+    # \brief Initializes the \e %MaxCliqueAlgorithm instance.
+    # \param adj_mtx The adjacency matrix of the graph.
+    # \param min_clique_size The minimum size a clique must have to get reported.
+    # 
+    def __init__(adj_mtx: BitSetArray, min_clique_size: int = 0) -> None: pass
+
+    ##
+    # \brief Returns the numeric identifier (ID) of the wrapped C++ class instance.
+    # 
+    # Different Python \e %MaxCliqueAlgorithm instances may reference the same underlying C++ class instance. The commonly used Python expression
+    # <tt>a is not b</tt> thus cannot tell reliably whether the two \e %MaxCliqueAlgorithm instances \e a and \e b reference different C++ objects. 
+    # The numeric identifier returned by this method allows to correctly implement such an identity test via the simple expression
+    # <tt>a.getObjectID() != b.getObjectID()</tt>.
+    # 
+    # \return The numeric ID of the internally referenced C++ class instance.
+    # 
+    def getObjectID() -> int: pass
+
+    ##
+    # \brief Initializes the algorithm for the maximum clique search in the specified graph.
+    # \param adj_mtx The adjacency matrix of the graph.
+    # \param min_clique_size The minimum size a clique must have to get reported.
+    #
+    def init(adj_mtx: BitSetArray, min_clique_size: int = 0) -> None: pass
+
+    ##
+    # \brief Searches for a maximum clique of the graph specified in the last call to init().
+    # \param clique The bitset where the nodes of the found clique get stored.
+    # \return <tt>True</tt> if a clique of at least the specified minimum size could be found, and <tt>False</tt> otherwise.
+    #
+    def findMaxClique(clique: BitSet) -> bool: pass
+
+    ##
+    # \brief Returns the minimum size a clique must have to get reported.
+    # \return The minimum reported clique size.
+    #
+    def getMinCliqueSize() -> int: pass
+
+    ##
+    # \brief Returns the number of search tree nodes that have been visited in the last call to findMaxClique().
+    # \return The number of visited search tree nodes.
+    #
+    def getNumSearchNodes() -> int: pass
+
+    ##
+    # \brief Returns the number of search tree branches that have been pruned in the last call to findMaxClique().
+    # \return The number of pruned search tree branches.
+    #
+    def getNumPrunedBranches() -> int: pass
+
+    ##
+    # \brief Replaces the current state of \a self with a copy of the state of the \e %MaxCliqueAlgorithm instance \a mca.
+    # \param mca The \e %MaxCliqueAlgorithm instance to copy.
+    # \return \a self
+    # 
+    def assign(mca: MaxCliqueAlgorithm) -> MaxCliqueAlgorithm: pass
+
+    objectID = property(getObjectID)
+
+    minCliqueSize = property(getMinCliqueSize)
+
+    numSearchNodes = property(getNumSearchNodes)
+
+    numPrunedBranches = property(getNumPrunedBranches)
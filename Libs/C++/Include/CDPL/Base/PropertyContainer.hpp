@@ -31,6 +31,8 @@
 
 #include <utility>
 #include <unordered_map>
+#include <array>
+#include <memory>
 
 #include "CDPL/Base/APIPrefix.hpp"
 #include "CDPL/Base/LookupKey.hpp"
@@ -70,6 +72,11 @@ namespace CDPL
          * argument type. The non-template method returns the requested property value indirectly as a reference to the
          * Base::Any instance storing the actual value. If the requested property value does not exist, an additional
          * argument decides whether to throw an exception or to return an empty Base::Any instance.
+         *
+         * Frequently accessed properties (e.g. atom types or bond orders) can be registered as <em>fast access</em>
+         * properties by means of the static method registerFastAccessKey(). For the values of such properties each
+         * container maintains a fixed slot that refers to the stored value so that lookups of these properties do not
+         * require a hash table search.
          */
         class CDPL_BASE_API PropertyContainer
         {
@@ -87,6 +94,12 @@ namespace CDPL
              */
             typedef PropertyMap::const_iterator ConstPropertyIterator;
 
+            /**
+             * \brief The maximum number of property keys that can be registered for fast value access.
+             * \since 1.2
+             */
+            static constexpr std::size_t MAX_NUM_FAST_ACCESS_KEYS = 24;
+
             /**
              * \brief Returns the number of property entries.
              * \return The number of property entries.
@@ -220,6 +233,30 @@ namespace CDPL
              */
             inline const PropertyContainer& getProperties() const;
 
+            /**
+             * \brief Registers the property specified by \a key as fast access property.
+             *
+             * The values of registered properties get looked up in a fixed slot of the container instead of the
+             * hash table that stores the property entries. Registration has to take place before any container
+             * stores a value for the property (i.e. right after the creation of the key during initialization)
+             * and must not happen concurrently with property accesses.
+             *
+             * \param key The key of the property to register.
+             * \return \c true if the key was registered, and \c false if the key is already registered or
+             *         cannot be registered because the maximum number of fast access keys (see MAX_NUM_FAST_ACCESS_KEYS)
+             *         has been reached.
+             * \since 1.2
+             */
+            static bool registerFastAccessKey(const LookupKey& key);
+
+            /**
+             * \brief Tells whether the property specified by \a key has been registered as fast access property.
+             * \param key The property key.
+             * \return \c true if the key has been registered, and \c false otherwise.
+             * \since 1.2
+             */
+            static bool isFastAccessKey(const LookupKey& key);
+
           protected:
             /**
              * \brief Constructs an empty \c %PropertyContainer instance.
@@ -248,12 +285,26 @@ namespace CDPL
             PropertyContainer& operator=(const PropertyContainer& cntnr);
 
           private:
+            typedef std::array<const Any*, MAX_NUM_FAST_ACCESS_KEYS> FastAccessSlotArray;
+
+            static constexpr std::size_t MAX_FAST_ACCESS_KEY_ID = 4096;
+
             inline bool isEmptyAny(const Any& val) const;
 
             template <typename T>
             bool isEmptyAny(const T& val) const;
 
-            PropertyMap properties;
+            inline static std::size_t getFastAccessSlot(const LookupKey& key);
+
+            void setFastAccessSlot(std::size_t slot, const Any* val);
+
+            void updateFastAccessSlots();
+
+            static unsigned char fastAccessKeySlots[MAX_FAST_ACCESS_KEY_ID];
+            static std::size_t   numFastAccessKeys;
+
+            PropertyMap                          properties;
+            std::unique_ptr<FastAccessSlotArray> fastAccessSlots;
         };
     } // namespace Base
 } // namespace CDPL
@@ -279,10 +330,18 @@ const CDPL::Base::Any& CDPL::Base::PropertyContainer::getProperty(const LookupKe
 {
     static const Any NOT_FOUND;
 
-    ConstPropertyIterator it = properties.find(key);
+    if (std::size_t slot = getFastAccessSlot(key)) {
+        if (fastAccessSlots) {
+            if (const Any* val = (*fastAccessSlots)[slot - 1])
+                return *val;
+        }
+
+    } else {
+        ConstPropertyIterator it = properties.find(key);
 
-    if (it != properties.end())
-        return it->second;
+        if (it != properties.end())
+            return it->second;
+    }
 
     if (throw_ex)
         throw ItemNotFound("PropertyContainer: property " + key.getName() + " not found");
@@ -294,15 +353,23 @@ template <typename T>
 void CDPL::Base::PropertyContainer::setProperty(const LookupKey& key, T&& val)
 {
     if (isEmptyAny(val)) {
-        properties.erase(key);
+        removeProperty(key);
         return;
     }
 
-    properties[key] = std::forward<T>(val);
+    Any& entry_val = properties[key];
+
+    entry_val = std::forward<T>(val);
+
+    if (std::size_t slot = getFastAccessSlot(key))
+        setFastAccessSlot(slot - 1, &entry_val);
 }
 
 bool CDPL::Base::PropertyContainer::isPropertySet(const LookupKey& key) const
 {
+    if (std::size_t slot = getFastAccessSlot(key))
+        return (fastAccessSlots && (*fastAccessSlots)[slot - 1]);
+
     return (properties.find(key) != properties.end());
 }
 
@@ -322,4 +389,9 @@ const CDPL::Base::PropertyContainer& CDPL::Base::PropertyContainer::getPropertie
     return *this;
 }
 
+std::size_t CDPL::Base::PropertyContainer::getFastAccessSlot(const LookupKey& key)
+{
+    return (key.getID() < MAX_FAST_ACCESS_KEY_ID ? fastAccessKeySlots[key.getID()] : 0);
+}
+
 #endif // CDPL_BASE_PROPERTYCONTAINER_HPP
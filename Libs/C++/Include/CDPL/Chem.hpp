@@ -42,6 +42,7 @@
 #include "CDPL/Chem/BasicMolecule.hpp"
 #include "CDPL/Chem/BasicAtom.hpp"
 #include "CDPL/Chem/BasicBond.hpp"
+#include "CDPL/Chem/FrozenMolecule.hpp"
 #include "CDPL/Chem/Fragment.hpp"
 #include "CDPL/Chem/ElectronSystem.hpp"
 #include "CDPL/Chem/AtomDictionary.hpp"
@@ -90,6 +91,7 @@
 #include "CDPL/Chem/ReactionPropertyDefault.hpp"
 #include "CDPL/Chem/AtomPropertyFlag.hpp"
 #include "CDPL/Chem/BondPropertyFlag.hpp"
+#include "CDPL/Chem/PerceptionFlag.hpp"
 #include "CDPL/Chem/ControlParameter.hpp"
 #include "CDPL/Chem/ControlParameterDefault.hpp"
 #include "CDPL/Chem/ControlParameterFunctions.hpp"
@@ -240,6 +242,7 @@
 #include "CDPL/Chem/XYZMoleculeReader.hpp"
 #include "CDPL/Chem/XYZMolecularGraphWriter.hpp"
 #include "CDPL/Chem/MoleculeReader.hpp"
+#include "CDPL/Chem/ParallelMoleculeReader.hpp"
 #include "CDPL/Chem/MolecularGraphWriter.hpp"
 #include "CDPL/Chem/ReactionReader.hpp"
 #include "CDPL/Chem/ReactionWriter.hpp"
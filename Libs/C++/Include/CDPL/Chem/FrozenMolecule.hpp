@@ -0,0 +1,299 @@
+/*
+ * FrozenMolecule.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Chem::FrozenMolecule.
+ */
+
+#ifndef CDPL_CHEM_FROZENMOLECULE_HPP
+#define CDPL_CHEM_FROZENMOLECULE_HPP
+
+#include <vector>
+#include <memory>
+
+#include "CDPL/Chem/APIPrefix.hpp"
+#include "CDPL/Chem/Molecule.hpp"
+#include "CDPL/Util/Array.hpp"
+#include "CDPL/Util/BitSet.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Chem
+    {
+
+        /**
+         * \brief A compact Chem::Molecule implementation with a fixed set of atoms and bonds.
+         *
+         * The atoms and bonds of a \c %FrozenMolecule are stored contiguously and the atom connectivity is
+         * represented in compressed sparse row (CSR) format, i.e. the bonded neighbors of atom \e i are given by the entries
+         * <em>[getNeighborOffsets()[i], getNeighborOffsets()[i + 1])</em> of the arrays returned by getNeighborAtomIndices()
+         * and getNeighborBondIndices().
+         *
+         * The molecular graph can only be (re-)built as a whole by copying another Chem::MolecularGraph instance.
+         * All methods that add or remove individual atoms and bonds (or change their order) throw an exception of
+         * type Base::OperationFailed. Atom, bond and molecule properties remain modifiable.
+         *
+         * For fast sequential access, the values of frequently used atom and bond properties (element, formal charge,
+         * implicit hydrogen count, aromaticity and ring membership flags, 3D coordinates and bond orders) are additionally
+         * stored in typed arrays that get filled when the molecular graph is built. Later property modifications
+         * are not reflected by these arrays until updatePropertyArrays() gets called.
+         *
+         * \since 1.2
+         */
+        class CDPL_CHEM_API FrozenMolecule : public Molecule
+        {
+
+            class AtomImpl;
+            class BondImpl;
+
+            typedef std::vector<AtomImpl> AtomList;
+            typedef std::vector<BondImpl> BondList;
+
+          public:
+            /**
+             * \brief A reference-counted smart pointer [\ref SHPTR] for dynamically allocated \c %FrozenMolecule instances.
+             */
+            typedef std::shared_ptr<FrozenMolecule> SharedPointer;
+
+            /**
+             * \brief Constructs an empty \c %FrozenMolecule instance.
+             */
+            FrozenMolecule();
+
+            /**
+             * \brief Constructs a copy of the \c %FrozenMolecule instance \a mol.
+             * \param mol The other \c %FrozenMolecule instance to copy.
+             */
+            FrozenMolecule(const FrozenMolecule& mol);
+
+            /**
+             * \brief Constructs a \c %FrozenMolecule instance with copies of the atoms and bonds
+             *        of the Chem::MolecularGraph instance \a molgraph.
+             * \param molgraph The Chem::MolecularGraph instance providing the atoms and bonds to copy.
+             */
+            explicit FrozenMolecule(const MolecularGraph& molgraph);
+
+            /**
+             * \brief Destructor.
+             *
+             * Destroys the \c %FrozenMolecule instance and frees all allocated resources.
+             */
+            ~FrozenMolecule();
+
+            void clear();
+
+            std::size_t getNumAtoms() const;
+
+            std::size_t getNumBonds() const;
+
+            const Atom& getAtom(std::size_t idx) const;
+
+            Atom& getAtom(std::size_t idx);
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of atoms of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            Atom& addAtom();
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of atoms of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            void removeAtom(std::size_t idx);
+
+            const Bond& getBond(std::size_t idx) const;
+
+            Bond& getBond(std::size_t idx);
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of bonds of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            Bond& addBond(std::size_t atom1_idx, std::size_t atom2_idx);
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of bonds of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            void removeBond(std::size_t idx);
+
+            bool containsAtom(const Atom& atom) const;
+
+            bool containsBond(const Bond& bond) const;
+
+            std::size_t getAtomIndex(const Atom& atom) const;
+
+            std::size_t getBondIndex(const Bond& bond) const;
+
+            /**
+             * \brief Throws Base::OperationFailed (the atom order of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            void orderAtoms(const AtomCompareFunction& func);
+
+            /**
+             * \brief Throws Base::OperationFailed (the bond order of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            void orderBonds(const BondCompareFunction& func);
+
+            FrozenMolecule& operator=(const FrozenMolecule& mol);
+
+            using Molecule::operator=;
+
+            MolecularGraph::SharedPointer clone() const;
+
+            void copy(const FrozenMolecule& mol);
+
+            void copy(const Molecule& mol);
+
+            void copy(const MolecularGraph& molgraph);
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of atoms and bonds of a \c %FrozenMolecule cannot be extended).
+             * \throw Base::OperationFailed.
+             */
+            void append(const Molecule& mol);
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of atoms and bonds of a \c %FrozenMolecule cannot be extended).
+             * \throw Base::OperationFailed.
+             */
+            void append(const MolecularGraph& molgraph);
+
+            /**
+             * \brief Throws Base::OperationFailed (the set of atoms and bonds of a \c %FrozenMolecule cannot be changed).
+             * \throw Base::OperationFailed.
+             */
+            void remove(const MolecularGraph& molgraph);
+
+            /**
+             * \brief Returns the offsets of the bonded neighbor lists of the atoms.
+             * \return An array of size getNumAtoms() + 1 where the element at index \e i specifies the start index of
+             *         the neighbors of atom \e i in the arrays returned by getNeighborAtomIndices() and getNeighborBondIndices().
+             */
+            const Util::STArray& getNeighborOffsets() const;
+
+            /**
+             * \brief Returns the concatenated indices of the bonded neighbor atoms of all atoms.
+             * \return The neighbor atom index array.
+             * \see getNeighborOffsets()
+             */
+            const Util::STArray& getNeighborAtomIndices() const;
+
+            /**
+             * \brief Returns the concatenated indices of the incident bonds of all atoms.
+             * \return The neighbor bond index array.
+             * \see getNeighborOffsets()
+             */
+            const Util::STArray& getNeighborBondIndices() const;
+
+            /**
+             * \brief Returns the types (see namespace Chem::AtomType) of the atoms.
+             * \return An array holding the type of each atom.
+             */
+            const Util::UIArray& getAtomTypes() const;
+
+            /**
+             * \brief Returns the formal charges of the atoms.
+             * \return An array holding the formal charge of each atom.
+             */
+            const Util::LArray& getAtomFormalCharges() const;
+
+            /**
+             * \brief Returns the implicit hydrogen counts of the atoms.
+             * \return An array holding the implicit hydrogen count of each atom (\e 0 if not set).
+             */
+            const Util::STArray& getAtomImplicitHydrogenCounts() const;
+
+            /**
+             * \brief Returns a bitmask where the bits of aromatic atoms are set.
+             * \return The aromatic atom mask.
+             */
+            const Util::BitSet& getAromaticAtomMask() const;
+
+            /**
+             * \brief Returns a bitmask where the bits of ring atoms are set.
+             * \return The ring atom mask.
+             */
+            const Util::BitSet& getRingAtomMask() const;
+
+            /**
+             * \brief Returns the 3D coordinates of the atoms.
+             * \return An array holding the 3D coordinates of each atom or an empty array if not all atoms have
+             *         3D coordinates.
+             */
+            const Math::Vector3DArray& getAtom3DCoordinates() const;
+
+            /**
+             * \brief Returns the orders of the bonds.
+             * \return An array holding the order of each bond.
+             */
+            const Util::STArray& getBondOrders() const;
+
+            /**
+             * \brief Returns a bitmask where the bits of aromatic bonds are set.
+             * \return The aromatic bond mask.
+             */
+            const Util::BitSet& getAromaticBondMask() const;
+
+            /**
+             * \brief Returns a bitmask where the bits of ring bonds are set.
+             * \return The ring bond mask.
+             */
+            const Util::BitSet& getRingBondMask() const;
+
+            /**
+             * \brief Updates the typed property arrays with the current property values of the atoms and bonds.
+             */
+            void updatePropertyArrays();
+
+          private:
+            void build(const MolecularGraph& molgraph);
+
+            void clearAtomsAndBonds();
+
+            AtomList            atoms;
+            BondList            bonds;
+            Util::STArray       nbrOffsets;
+            Util::STArray       nbrAtomIndices;
+            Util::STArray       nbrBondIndices;
+            Util::UIArray       atomTypes;
+            Util::LArray        atomCharges;
+            Util::STArray       atomImplHCounts;
+            Util::BitSet        aromAtomMask;
+            Util::BitSet        ringAtomMask;
+            Math::Vector3DArray atomCoords;
+            Util::STArray       bondOrders;
+            Util::BitSet        aromBondMask;
+            Util::BitSet        ringBondMask;
+        };
+    } // namespace Chem
+} // namespace CDPL
+
+#endif // CDPL_CHEM_FROZENMOLECULE_HPP
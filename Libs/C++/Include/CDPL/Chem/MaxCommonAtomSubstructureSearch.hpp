@@ -33,6 +33,7 @@
 #include <set>
 #include <cstddef>
 #include <memory>
+#include <functional>
 
 #include <boost/iterator/indirect_iterator.hpp>
 
@@ -52,6 +53,8 @@ namespace CDPL
         class MolecularGraph;
         class Atom;
         class Bond;
+        class MaxCommonSubstructureSearchControl;
+        class MaxCommonSubstructureSizeBound;
 
         /**
          * \brief MaxCommonAtomSubstructureSearch.
@@ -65,6 +68,12 @@ namespace CDPL
           public:
             typedef std::shared_ptr<MaxCommonAtomSubstructureSearch> SharedPointer;
 
+            /**
+             * \brief Type of the generic functor class used to store user-defined abort callback functions.
+             * \since 1.2
+             */
+            typedef std::function<bool()> CallbackFunction;
+
             /**
              * \brief A mutable random access iterator used to iterate over the stored atom/bond mapping objects.
              */
@@ -276,6 +285,103 @@ namespace CDPL
              */
             std::size_t getMinSubstructureSize() const;
 
+            /**
+             * \brief Specifies a function that gets periodically called during a common substructure search to check whether
+             *        the search shall be terminated prematurely.
+             *
+             * If the callback function returns \c true, the search will be stopped and all atom/bond mappings of the largest
+             * common substructures found so far are kept (see searchAborted()).
+             *
+             * \param func The abort callback function.
+             * \note The callback function is invoked only by the thread that called the search method.
+             * \since 1.2
+             */
+            void setAbortCallback(const CallbackFunction& func);
+
+            /**
+             * \brief Returns the function that gets called to check whether the search shall be terminated prematurely.
+             * \return A reference to the abort callback function.
+             * \since 1.2
+             */
+            const CallbackFunction& getAbortCallback() const;
+
+            /**
+             * \brief Allows to specify a time limit for the common substructure search.
+             *
+             * If the search takes longer than \a mil_secs milliseconds, it will be stopped and the atom/bond mappings of
+             * the largest common substructures found so far are kept (see searchAborted()).
+             *
+             * \param mil_secs The time limit in milliseconds.
+             * \note By default, no time limit is imposed (value zero).
+             * \since 1.2
+             */
+            void setTimeout(std::size_t mil_secs);
+
+            /**
+             * \brief Returns the specified time limit for the common substructure search.
+             * \return The time limit in milliseconds.
+             * \see setTimeout()
+             * \since 1.2
+             */
+            std::size_t getTimeout() const;
+
+            /**
+             * \brief Allows to specify a limit on the number of association graph search nodes that get visited in a
+             *        common substructure search.
+             *
+             * If the search visits more than (approximately) \a max_num_nodes search tree nodes, it will be stopped and the
+             * atom/bond mappings of the largest common substructures found so far are kept (see searchAborted()).
+             *
+             * \param max_num_nodes The maximum number of visited search tree nodes.
+             * \note By default, no limit is imposed (value zero). 
+             * \since 1.2
+             */
+            void setMaxNumSearchNodes(std::size_t max_num_nodes);
+
+            /**
+             * \brief Returns the specified limit on the number of visited search tree nodes.
+             * \return The maximum number of visited search tree nodes.
+             * \see setMaxNumSearchNodes()
+             * \since 1.2
+             */
+            std::size_t getMaxNumSearchNodes() const;
+
+            /**
+             * \brief Allows to specify the number of threads that are used for a common substructure search.
+             *
+             * If \a num_threads is greater than one, the top-level branches of the search tree get distributed among
+             * the specified number of threads. The size of the found common substructures does not depend on the number
+             * of threads but the order of the stored atom/bond mappings and, if the number of stored mappings is limited,
+             * the particular set of mappings may differ from a single-threaded search.
+             *
+             * \param num_threads The number of threads to use.
+             * \note By default, the search runs single-threaded (value zero). Queries with match expressions that require
+             *       an atom/bond mapping for their evaluation are always processed single-threaded.
+             * \since 1.2
+             */
+            void setNumThreads(std::size_t num_threads);
+
+            /**
+             * \brief Returns the number of threads that are used for a common substructure search.
+             * \return The number of search threads.
+             * \see setNumThreads()
+             * \since 1.2
+             */
+            std::size_t getNumThreads() const;
+
+            /**
+             * \brief Tells whether the last common substructure search was stopped prematurely.
+             *
+             * The search gets stopped prematurely if the abort callback function returned \c true, the time limit was
+             * exceeded or the maximum number of search tree nodes has been visited. In that case, the stored atom/bond
+             * mappings represent the largest common substructures found until the stop and do not necessarily have
+             * maximum size.
+             *
+             * \return \c true if the last search was stopped prematurely, and \c false otherwise.
+             * \since 1.2
+             */
+            bool searchAborted() const;
+
           private:
             class AGNode;
 
@@ -289,7 +395,16 @@ namespace CDPL
 
             bool buildAssocGraph();
 
+            bool startSearch();
+
+            void findAssocGraphCliquesParallel();
+            void processSearchTasks();
+
+            bool initWorker(MaxCommonAtomSubstructureSearch&);
+            void mergeWorkerMappings(MaxCommonAtomSubstructureSearch&);
+
             bool findAssocGraphCliques(std::size_t);
+            bool extendClique(AGNode*, std::size_t);
             bool isLegal(const AGNode*);
 
             bool mappingFound();
@@ -298,6 +413,7 @@ namespace CDPL
             bool foundMappingMatches(const AtomBondMapping*) const;
 
             bool foundMappingUnique();
+            bool mappingUnique(const AtomBondMapping&);
 
             void clearMappings();
 
@@ -324,6 +440,9 @@ namespace CDPL
                 void        setAssocAtom(const Atom*);
                 const Atom* getAssocAtom() const;
 
+                void        setAssocAtomIndex(std::size_t);
+                std::size_t getAssocAtomIndex() const;
+
                 void addEdge(const AGEdge*);
 
                 bool          isConnected(const AGNode*) const;
@@ -337,6 +456,7 @@ namespace CDPL
                 std::size_t    index;
                 const Atom*    queryAtom;
                 const Atom*    assocAtom;
+                std::size_t    assocAtomIndex;
                 Util::BitSet   connNodes;
                 AGraphEdgeList bondEdges;
             };
@@ -406,6 +526,9 @@ namespace CDPL
             typedef Util::ObjectStack<AGNode>                                         NodeCache;
             typedef Util::ObjectStack<AGEdge>                                         EdgeCache;
             typedef Util::ObjectStack<AtomBondMapping>                                MappingCache;
+            typedef std::unique_ptr<MaxCommonSubstructureSizeBound>                   SizeBoundPointer;
+            typedef MaxCommonSubstructureSearchControl*                               SearchControlPointer;
+            typedef std::vector<SharedPointer>                                        WorkerList;
 
             const MolecularGraph* query;
             const MolecularGraph* target;
@@ -423,11 +546,16 @@ namespace CDPL
             NodeCache             nodeCache;
             EdgeCache             edgeCache;
             MappingCache          mappingCache;
+            SizeBoundPointer      sizeBound;
+            CallbackFunction      abortCallback;
+            WorkerList            workers;
+            SearchControlPointer  searchCtrl;
             bool                  queryChanged;
             bool                  initQueryData;
             bool                  uniqueMatches;
             bool                  saveMappings;
             bool                  maxBondMappingsOnly;
+            bool                  aborted;
             std::size_t           numQueryAtoms;
             std::size_t           numQueryBonds;
             std::size_t           numTargetAtoms;
@@ -439,6 +567,10 @@ namespace CDPL
             std::size_t           maxNumMappings;
             std::size_t           minSubstructureSize;
             std::size_t           currNodeIdx;
+            std::size_t           timeout;
+            std::size_t           maxNumSearchNodes;
+            std::size_t           numThreads;
+            std::size_t           numUncheckedSearchNodes;
         };
     } // namespace Chem
 } // namespace CDPL
@@ -43,6 +43,7 @@
 #include "CDPL/Chem/StringDataBlock.hpp"
 #include "CDPL/Chem/AtomPropertyFlag.hpp"
 #include "CDPL/Chem/BondPropertyFlag.hpp"
+#include "CDPL/Chem/PerceptionFlag.hpp"
 #include "CDPL/Chem/ControlParameterDefault.hpp"
 #include "CDPL/Math/Matrix.hpp"
 #include "CDPL/Math/Vector.hpp"
@@ -514,6 +515,70 @@ namespace CDPL
          * \since 1.1
          */
         CDPL_CHEM_API void calcBasicProperties(MolecularGraph& molgraph, bool overwrite);
+
+        /**
+         * \brief Returns the perception steps (see namespace Chem::PerceptionFlag) that have been carried out
+         *        by prepareMolecularGraph() for the current structure of \a molgraph.
+         *
+         * The recorded perception state becomes invalid (and \e PerceptionFlag::NONE gets returned) as soon as atoms or bonds
+         * are added, removed or reordered, the type, isotope or formal charge of an atom or the order of a bond changes, or
+         * the state has been copied from another Chem::MolecularGraph instance.
+         *
+         * \param molgraph The molecular graph.
+         * \return The still valid perception steps.
+         * \since 1.2
+         */
+        CDPL_CHEM_API unsigned int getPerceptionState(const MolecularGraph& molgraph);
+
+        /**
+         * \brief Records the perception steps \a flags as carried out for the current structure of \a molgraph.
+         * \param molgraph The molecular graph.
+         * \param flags The carried out perception steps (see namespace Chem::PerceptionFlag).
+         * \since 1.2
+         */
+        CDPL_CHEM_API void setPerceptionState(MolecularGraph& molgraph, unsigned int flags);
+
+        /**
+         * \since 1.2
+         */
+        CDPL_CHEM_API void clearPerceptionState(MolecularGraph& molgraph);
+
+        /**
+         * \brief Carries out the perception steps specified by \a flags unless they are already recorded as valid
+         *        in the perception state of \a molgraph.
+         *
+         * Steps get carried out in a fixed order that respects their dependencies. A recorded step is only skipped if all of
+         * its results are still present, i.e. have not been cleared in the meantime (e.g. by clearSSSR() or Chem::clearAromaticityFlag()).
+         * The carried out steps are added to the perception state afterwards so that subsequent calls for the unmodified
+         * structure can skip them. If \a overwrite is \c false, already present property values are kept (as done by the
+         * corresponding perception functions) and a step thus only gets recorded if none of its results were present before or
+         * these were recorded as valid. Steps that depend on present but unrecorded results are not recorded either.
+         *
+         * \param molgraph The molecular graph.
+         * \param flags The requested perception steps (see namespace Chem::PerceptionFlag).
+         * \param overwrite Specifies whether present property values shall be replaced by newly perceived ones.
+         * \since 1.2
+         */
+        CDPL_CHEM_API void prepareMolecularGraph(MolecularGraph& molgraph, unsigned int flags, bool overwrite);
+
+        /**
+         * \brief Returns the number of perception steps carried out by prepareMolecularGraph() since program start
+         *        or the last call to resetPerceptionCounters().
+         * \since 1.2
+         */
+        CDPL_CHEM_API std::size_t getNumPerformedPerceptions();
+
+        /**
+         * \brief Returns the number of requested perception steps that prepareMolecularGraph() skipped because
+         *        they were recorded as valid.
+         * \since 1.2
+         */
+        CDPL_CHEM_API std::size_t getNumSkippedPerceptions();
+
+        /**
+         * \since 1.2
+         */
+        CDPL_CHEM_API void resetPerceptionCounters();
         
     } // namespace Chem
 } // namespace CDPL
@@ -0,0 +1,101 @@
+/* 
+ * PerceptionFlag.hpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of constants in namespace CDPL::Chem::PerceptionFlag.
+ */
+
+#ifndef CDPL_CHEM_PERCEPTIONFLAG_HPP
+#define CDPL_CHEM_PERCEPTIONFLAG_HPP
+
+
+namespace CDPL
+{
+
+    namespace Chem
+    {
+
+        /**
+         * \brief Provides flags for the specification of structure perception steps carried out on Chem::MolecularGraph instances.
+         * \see Chem::prepareMolecularGraph()
+         * \since 1.2
+         */
+        namespace PerceptionFlag
+        {
+
+            /**
+             * \brief Represents an empty set of perception steps.
+             */
+            constexpr unsigned int NONE = 0x0;
+
+            /**
+             * \brief Specifies the perception of the connected components.
+             */
+            constexpr unsigned int COMPONENTS = 0x1;
+
+            /**
+             * \brief Specifies the perception of the smallest set of smallest rings.
+             */
+            constexpr unsigned int SSSR = 0x2;
+
+            /**
+             * \brief Specifies the perception of atom and bond ring membership flags.
+             */
+            constexpr unsigned int RING_FLAGS = 0x4;
+
+            /**
+             * \brief Specifies the calculation of implicit hydrogen counts.
+             */
+            constexpr unsigned int IMPLICIT_H_COUNTS = 0x8;
+
+            /**
+             * \brief Specifies the perception of atom hybridization states.
+             */
+            constexpr unsigned int HYBRIDIZATION_STATES = 0x10;
+
+            /**
+             * \brief Specifies the perception of atom and bond aromaticity flags.
+             */
+            constexpr unsigned int AROMATICITY_FLAGS = 0x20;
+
+            /**
+             * \brief Specifies the calculation of atom CIP priorities.
+             */
+            constexpr unsigned int CIP_PRIORITIES = 0x40;
+
+            /**
+             * \brief Specifies the calculation of the topological distance matrix.
+             */
+            constexpr unsigned int TOPOLOGICAL_DISTANCE_MATRIX = 0x80;
+
+            /**
+             * \brief Represents the set of perception steps carried out by Chem::calcBasicProperties().
+             */
+            constexpr unsigned int BASIC_PROPERTIES = COMPONENTS | SSSR | RING_FLAGS | IMPLICIT_H_COUNTS |
+                                                      HYBRIDIZATION_STATES | AROMATICITY_FLAGS;
+        } // namespace PerceptionFlag
+    } // namespace Chem
+} // namespace CDPL
+
+#endif // CDPL_CHEM_PERCEPTIONFLAG_HPP
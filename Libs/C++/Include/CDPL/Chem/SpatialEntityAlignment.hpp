@@ -120,6 +120,19 @@ namespace CDPL
              */
             std::size_t getMinTopologicalMappingSize();
 
+            /**
+             * \brief Returns the number of topological entity mappings that have been found in the last (re-)initialization.
+             * \return The number of found topological entity mappings.
+             */
+            std::size_t getNumEmittedCliques() const;
+
+            /**
+             * \brief Returns the number of topological mapping search tree branches that have been pruned in the last
+             *        (re-)initialization because they could not yield mappings of the required minimum size.
+             * \return The number of pruned search tree branches.
+             */
+            std::size_t getNumPrunedCliqueSearchBranches() const;
+
             /**
              * \brief Specifies a function for the retrieval of entity 3D-coordinates.
              * \param func The entity 3D-coordinates function.
@@ -338,6 +351,18 @@ std::size_t CDPL::Chem::SpatialEntityAlignment<T>::getMinTopologicalMappingSize(
     return minTopMappingSize;
 }
 
+template <typename T>
+std::size_t CDPL::Chem::SpatialEntityAlignment<T>::getNumEmittedCliques() const
+{
+    return topAlignment.getNumEmittedCliques();
+}
+
+template <typename T>
+std::size_t CDPL::Chem::SpatialEntityAlignment<T>::getNumPrunedCliqueSearchBranches() const
+{
+    return topAlignment.getNumPrunedCliqueSearchBranches();
+}
+
 template <typename T>
 void CDPL::Chem::SpatialEntityAlignment<T>::setEntity3DCoordinatesFunction(const Entity3DCoordinatesFunction& func)
 {
@@ -591,7 +616,7 @@ void CDPL::Chem::SpatialEntityAlignment<T>::init()
         }
     }
 
-    topAlignment.reset();
+    topAlignment.setMinMappingSize(minTopMappingSize);
     topMappingCache.putAll();
     seenTopMappings.clear();
     topMappings.clear();
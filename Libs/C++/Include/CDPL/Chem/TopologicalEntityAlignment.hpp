@@ -83,7 +83,7 @@ namespace CDPL
              * \brief Constructs the \c %TopologicalEntityAlignment instance.
              */
             TopologicalEntityAlignment():
-                changes(true) {}
+                minMappingSize(0), changes(true) {}
 
             /**
              * \brief Virtual destructor.
@@ -115,6 +115,35 @@ namespace CDPL
              */
             const EntityPairMatchFunction& getEntityPairMatchFunction() const;
 
+            /**
+             * \brief Specifies the minimum number of mapped entities an alignment solution must have to get reported.
+             *
+             * The specified size is used as a bound to prune the search for alignment solutions early.
+             *
+             * \param min_size The minimum required number of mapped entities.
+             */
+            void setMinMappingSize(std::size_t min_size);
+
+            /**
+             * \brief Returns the minimum number of mapped entities an alignment solution must have to get reported.
+             * \return The minimum required number of mapped entities.
+             */
+            std::size_t getMinMappingSize() const;
+
+            /**
+             * \brief Returns the number of entity compatibility graph cliques that have been reported as alignment solutions
+             *        since the last (re-)initialization.
+             * \return The number of reported cliques.
+             */
+            std::size_t getNumEmittedCliques() const;
+
+            /**
+             * \brief Returns the number of clique search tree branches that have been pruned since the last (re-)initialization
+             *        because they could not yield alignment solutions of the required minimum size.
+             * \return The number of pruned clique search tree branches.
+             */
+            std::size_t getNumPrunedCliqueSearchBranches() const;
+
             /**
              * \brief Adds an entity to the specified alignment entity set.
              * \param entity The entity object to add.
@@ -181,6 +210,7 @@ namespace CDPL
             Util::BitSet                clique;
             EntitySet                   firstEntities;
             EntitySet                   secondEntities;
+            std::size_t                 minMappingSize;
             bool                        changes;
         };
     } // namespace Chem
@@ -217,6 +247,31 @@ CDPL::Chem::TopologicalEntityAlignment<T>::getEntityPairMatchFunction() const
     return entityPairMatchFunc;
 }
 
+template <typename T>
+void CDPL::Chem::TopologicalEntityAlignment<T>::setMinMappingSize(std::size_t min_size)
+{
+    minMappingSize = min_size;
+    changes        = true;
+}
+
+template <typename T>
+std::size_t CDPL::Chem::TopologicalEntityAlignment<T>::getMinMappingSize() const
+{
+    return minMappingSize;
+}
+
+template <typename T>
+std::size_t CDPL::Chem::TopologicalEntityAlignment<T>::getNumEmittedCliques() const
+{
+    return bkAlgorithm.getNumEmittedCliques();
+}
+
+template <typename T>
+std::size_t CDPL::Chem::TopologicalEntityAlignment<T>::getNumPrunedCliqueSearchBranches() const
+{
+    return bkAlgorithm.getNumPrunedBranches();
+}
+
 template <typename T>
 std::size_t CDPL::Chem::TopologicalEntityAlignment<T>::getNumEntities(bool first_set) const
 {
@@ -315,7 +370,7 @@ void CDPL::Chem::TopologicalEntityAlignment<T>::init()
         }
     }
 
-    bkAlgorithm.init(adjMatrix);
+    bkAlgorithm.init(adjMatrix, minMappingSize);
 
     changes = false;
 }
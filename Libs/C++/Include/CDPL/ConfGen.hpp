@@ -63,6 +63,7 @@
 #include "CDPL/ConfGen/DGStructureGeneratorSettings.hpp"
 #include "CDPL/ConfGen/StructureGeneratorSettings.hpp"
 #include "CDPL/ConfGen/ConformerGeneratorSettings.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/ConfGen/FragmentConformerGeneratorSettings.hpp"
 #include "CDPL/ConfGen/FragmentAssemblerSettings.hpp"
 #include "CDPL/ConfGen/StructureGenerator.hpp"
@@ -38,6 +38,7 @@
 #include "CDPL/ConfGen/CallbackFunction.hpp"
 #include "CDPL/ConfGen/LogMessageCallbackFunction.hpp"
 #include "CDPL/ConfGen/ConformerGeneratorSettings.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/ConfGen/FragmentLibrary.hpp"
 #include "CDPL/ConfGen/TorsionLibrary.hpp"
 
@@ -128,6 +129,12 @@ namespace CDPL
 
             ConformerIterator end();
 
+            /*
+             * \brief Returns the timing and counter statistics of the last generate() call.
+             * \since 1.2
+             */
+            const ConformerGeneratorStatistics& getStatistics() const;
+
           private:
             ConformerGenerator(const ConformerGenerator&);
 
@@ -198,6 +198,16 @@ namespace CDPL
 
             std::size_t getConvergenceCheckCycleSize() const;
 
+            /*
+             * \since 1.2
+             */
+            void setNumSamplingThreads(std::size_t num_threads);
+
+            /*
+             * \since 1.2
+             */
+            std::size_t getNumSamplingThreads() const;
+
             void setMacrocycleRotorBondCountThreshold(std::size_t min_count);
 
             std::size_t getMacrocycleRotorBondCountThreshold() const;
@@ -240,6 +250,7 @@ namespace CDPL
             double                             refTolerance;
             std::size_t                        maxNumSampledConfs;
             std::size_t                        convCheckCycleSize;
+            std::size_t                        numSamplingThreads;
             std::size_t                        mcRotorBondCountThresh;
             FragmentConformerGeneratorSettings fragBuildSettings;
         };
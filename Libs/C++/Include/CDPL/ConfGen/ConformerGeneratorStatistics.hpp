@@ -0,0 +1,193 @@
+/* 
+ * ConformerGeneratorStatistics.hpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::ConfGen::ConformerGeneratorStatistics.
+ */
+
+#ifndef CDPL_CONFGEN_CONFORMERGENERATORSTATISTICS_HPP
+#define CDPL_CONFGEN_CONFORMERGENERATORSTATISTICS_HPP
+
+#include <cstddef>
+#include <array>
+
+#include "CDPL/ConfGen/APIPrefix.hpp"
+
+
+namespace CDPL
+{
+
+    namespace ConfGen
+    {
+
+        /**
+         * \brief Provides per-stage wall clock times and event counters recorded during a single
+         *        conformer or structure generation run.
+         *
+         * Stage times are specified in seconds. Times and counters of work performed by multiple sampling
+         * threads are summed up over all threads. Work that is not attributed to any of the listed stages
+         * (e.g. input preparation) only contributes to the total time.
+         *
+         * \since 1.2
+         */
+        class CDPL_CONFGEN_API ConformerGeneratorStatistics
+        {
+
+          public:
+            enum Stage
+            {
+
+                /**
+                 * \brief MMFF94 atom typing and interaction parameterization.
+                 */
+                FORCE_FIELD_SETUP,
+
+                /**
+                 * \brief Lookup of fragment conformers in the fragment libraries and the fragment conformer cache.
+                 */
+                FRAGMENT_LIBRARY_LOOKUP,
+
+                /**
+                 * \brief Generation of fragment conformers (e.g. ring system sampling) not found in a library or the cache.
+                 */
+                FRAGMENT_CONFORMER_GENERATION,
+
+                /**
+                 * \brief Setup of the fragment tree and assignment of torsion angles by torsion rule matching.
+                 */
+                TORSION_RULE_MATCHING,
+
+                /**
+                 * \brief Torsion driving of rotatable bonds within torsion fragments.
+                 */
+                TORSION_DRIVING,
+
+                /**
+                 * \brief Enumeration of torsion fragment conformer combinations and assembly of the full conformers.
+                 */
+                FRAGMENT_COMBINATION,
+
+                /**
+                 * \brief Distance geometry based generation of raw 3D structures (stochastic sampling mode).
+                 */
+                STRUCTURE_EMBEDDING,
+
+                /**
+                 * \brief Force field minimization of generated raw structures (stochastic sampling mode).
+                 */
+                ENERGY_MINIMIZATION,
+
+                /**
+                 * \brief Energy and RMSD based selection of the output conformers.
+                 */
+                OUTPUT_SELECTION
+            };
+
+            enum Counter
+            {
+
+                NUM_ROTATABLE_BONDS,
+                NUM_TORSION_FRAGMENTS,
+                NUM_FRAGMENT_LIBRARY_HITS,
+                NUM_FRAGMENT_CACHE_HITS,
+                NUM_GENERATED_FRAGMENTS,
+                NUM_FRAGMENT_CONFORMER_COMBINATIONS,
+                NUM_SAMPLED_CONFORMERS,
+                NUM_STRUCTURE_GENERATION_FAILURES,
+                NUM_MINIMIZATIONS,
+                NUM_MINIMIZATION_ITERATIONS,
+                NUM_REJECTED_CONFORMERS,
+                NUM_OUTPUT_CONFORMERS
+            };
+
+            static constexpr std::size_t NUM_STAGES   = OUTPUT_SELECTION + 1;
+            static constexpr std::size_t NUM_COUNTERS = NUM_OUTPUT_CONFORMERS + 1;
+
+            ConformerGeneratorStatistics();
+
+            void clear();
+
+            double getTotalTime() const;
+
+            void setTotalTime(double time);
+
+            double getStageTime(Stage stage) const;
+
+            void setStageTime(Stage stage, double time);
+
+            void addStageTime(Stage stage, double time);
+
+            std::size_t getCounter(Counter counter) const;
+
+            void setCounter(Counter counter, std::size_t value);
+
+            void increaseCounter(Counter counter, std::size_t inc = 1);
+
+            /**
+             * \brief Returns the fraction of fragments whose conformers were found in one of the fragment libraries.
+             * \return The fragment library hit rate in the range [0, 1], or \e 0 if no fragment lookups were performed.
+             */
+            double getFragmentLibraryHitRate() const;
+
+            /**
+             * \brief Returns the fraction of fragments not found in the fragment libraries whose conformers were
+             *        retrieved from the fragment conformer cache.
+             * \return The fragment conformer cache hit rate in the range [0, 1], or \e 0 if no cache lookups were performed.
+             */
+            double getFragmentCacheHitRate() const;
+
+            /**
+             * \brief Adds the times and counter values of \a stats to the corresponding values of this instance.
+             * \param stats The statistics to add.
+             * \return A reference to itself.
+             */
+            ConformerGeneratorStatistics& operator+=(const ConformerGeneratorStatistics& stats);
+
+            /**
+             * \brief Returns a lower case identifier for the specified stage (e.g. \c "torsion_driving").
+             * \param stage The stage.
+             * \return The stage identifier.
+             */
+            static const char* getStageName(Stage stage);
+
+            /**
+             * \brief Returns a lower case identifier for the specified counter (e.g. \c "num_sampled_conformers").
+             * \param counter The counter.
+             * \return The counter identifier.
+             */
+            static const char* getCounterName(Counter counter);
+
+          private:
+            typedef std::array<double, NUM_STAGES>        StageTimeArray;
+            typedef std::array<std::size_t, NUM_COUNTERS> CounterArray;
+
+            double         totalTime;
+            StageTimeArray stageTimes;
+            CounterArray   counters;
+        };
+    } // namespace ConfGen
+} // namespace CDPL
+
+#endif // CDPL_CONFGEN_CONFORMERGENERATORSTATISTICS_HPP
@@ -30,6 +30,7 @@
 #define CDPL_CONFGEN_DGSTRUCTUREGENERATOR_HPP
 
 #include <cstddef>
+#include <vector>
 
 #include <boost/random/mersenne_twister.hpp>
 
@@ -79,6 +80,11 @@ namespace CDPL
             void setup(const Chem::MolecularGraph& molgraph, const ForceField::MMFF94InteractionData& ia_data,
                        const Chem::FragmentList& fixed_substr_frags, const Math::Vector3DArray& fixed_substr_coords);
 
+            /*
+             * \since 1.2
+             */
+            void setRandomSeed(unsigned int seed);
+
             bool generate(Math::Vector3DArray& coords);
 
             bool checkAtomConfigurations(Math::Vector3DArray& coords) const;
@@ -93,8 +99,24 @@ namespace CDPL
             void setup(const Chem::MolecularGraph& molgraph, const ForceField::MMFF94InteractionData* ia_data,
                        const Chem::FragmentList* fixed_substr_frags, const Math::Vector3DArray* fixed_substr_coords);
 
+            void genStartCoordinates(Math::Vector3DArray& coords);
+            void genBatchCoordinates();
+
+            void initAtomConfigVolumes();
+            bool checkAtomConfigVolumes(const Math::Vector3DArray& coords) const;
+
             typedef boost::random::mt11213b RandNumEngine;
 
+            struct AtomConfigVolume
+            {
+
+                std::size_t pointIndices[4];
+                bool        negative;
+            };
+
+            typedef std::vector<AtomConfigVolume>    AtomConfigVolumeList;
+            typedef std::vector<Math::Vector3DArray> CoordsArrayList;
+
             const Chem::MolecularGraph*    molGraph;
             const Chem::FragmentList*      fixedSubstructFrags;
             const Math::Vector3DArray*     fixedSubstructCoords;
@@ -104,6 +126,9 @@ namespace CDPL
             Util::DG3DCoordinatesGenerator phase2CoordsGen;
             RandNumEngine                  randomEngine;
             DGStructureGeneratorSettings   settings;
+            AtomConfigVolumeList           atomConfigVolumes;
+            CoordsArrayList                batchCoords;
+            std::size_t                    nextBatchCoordsIdx;
         };
     } // namespace ConfGen
 } // namespace CDPL
@@ -29,6 +29,8 @@
 #ifndef CDPL_CONFGEN_DGSTRUCTUREGENERATORSETTINGS_HPP
 #define CDPL_CONFGEN_DGSTRUCTUREGENERATORSETTINGS_HPP
 
+#include <cstddef>
+
 #include "CDPL/ConfGen/APIPrefix.hpp"
 #include "CDPL/ConfGen/DGConstraintGeneratorSettings.hpp"
 
@@ -55,9 +57,26 @@ namespace CDPL
 
             bool enablePlanarityConstraints() const;
 
+            /*
+             * \brief Specifies the number of structures that get embedded together in a single batched run.
+             *
+             * A batch size > 1 lets the generator embed the start coordinates of multiple structures at once
+             * and hand out the results one by one on subsequent calls to DGStructureGenerator::generate().
+             *
+             * \param size The embedding batch size.
+             * \since 1.2
+             */
+            void setEmbeddingBatchSize(std::size_t size);
+
+            /*
+             * \since 1.2
+             */
+            std::size_t getEmbeddingBatchSize() const;
+
           private:
-            double boxSize;
-            bool   planarConstr;
+            double      boxSize;
+            bool        planarConstr;
+            std::size_t embBatchSize;
         };
     } // namespace ConfGen
 } // namespace CDPL
@@ -31,6 +31,7 @@
 
 #include <iosfwd>
 #include <cstddef>
+#include <string>
 #include <unordered_map>
 #include <mutex>
 #include <memory>
@@ -99,7 +100,42 @@ namespace CDPL
 
             void load(std::istream& is);
 
-            void save(std::ostream& os) const;
+            /**
+             * \brief Writes the entries held in memory to the output stream \a os.
+             * \param os The output stream.
+             * \param write_index If \c true, an additional record mapping the entry hash codes to the
+             *        file offsets of the entries gets written (required by mapFile()).
+             */
+            void save(std::ostream& os, bool write_index = false) const;
+
+            /**
+             * \brief Memory-maps the indexed fragment library file \a file_name for lazy entry lookup.
+             *
+             * The entries stored in the file are not loaded but get decoded on their first lookup by getEntry().
+             * Entries held in memory take precedence over mapped entries with the same hash code. Mapped
+             * entries are not visited by the entry iterators and are not counted by getNumEntries(). Since the
+             * mapped file pages are read-only, they can be shared between multiple processes.
+             * Any previously mapped file gets unmapped.
+             *
+             * \param file_name The path to a fragment library file written by save() with index output enabled.
+             * \return \c true if the file was mapped, and \c false if the file is empty or does not provide an index.
+             * \throw Base::IOError if the file cannot be mapped or the index is corrupt.
+             * \since 1.2
+             */
+            bool mapFile(const std::string& file_name);
+
+            /**
+             * \brief Releases the currently mapped fragment library file.
+             * \since 1.2
+             */
+            void unmapFile();
+
+            /**
+             * \brief Returns the number of entries provided by the currently mapped fragment library file.
+             * \return The number of mapped entries.
+             * \since 1.2
+             */
+            std::size_t getNumMappedEntries() const;
 
             void loadDefaults();
 
@@ -110,9 +146,16 @@ namespace CDPL
             static const SharedPointer& get();
 
           private:
+            struct MappedFileData;
+
+            typedef std::shared_ptr<MappedFileData> MappedFileDataPointer;
+
+            const FragmentLibraryEntry::SharedPointer& getMappedEntry(std::uint64_t hash_code) const;
+
             static SharedPointer   defaultLib;
             mutable HashToEntryMap hashToEntryMap;
             mutable std::mutex     mutex;
+            MappedFileDataPointer  mappedFileData;
         };
     } // namespace ConfGen
 } // namespace CDPL
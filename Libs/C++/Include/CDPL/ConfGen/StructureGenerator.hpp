@@ -35,6 +35,7 @@
 #include "CDPL/ConfGen/CallbackFunction.hpp"
 #include "CDPL/ConfGen/LogMessageCallbackFunction.hpp"
 #include "CDPL/ConfGen/StructureGeneratorSettings.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/ConfGen/ConformerData.hpp"
 #include "CDPL/ConfGen/FragmentLibrary.hpp"
 #include "CDPL/ConfGen/TorsionLibrary.hpp"
@@ -103,6 +104,12 @@ namespace CDPL
 
             const ConformerData& getCoordinates() const;
 
+            /*
+             * \brief Returns the timing and counter statistics of the last generate() call.
+             * \since 1.2
+             */
+            const ConformerGeneratorStatistics& getStatistics() const;
+
           private:
             StructureGenerator(const StructureGenerator&);
 
@@ -31,6 +31,7 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include <cstddef>
 
 #include "CDPL/ConfGen/APIPrefix.hpp"
@@ -44,6 +45,9 @@ namespace CDPL
     namespace ConfGen
     {
 
+        class LazyTorsionMatchPattern;
+        class TorsionLibraryDataReader;
+
         class CDPL_CONFGEN_API TorsionCategory
         {
 
@@ -129,6 +133,10 @@ namespace CDPL
             void clear();
 
           private:
+            friend class TorsionLibraryDataReader;
+
+            typedef std::shared_ptr<LazyTorsionMatchPattern> LazyMatchPatternPtr;
+
             void checkCategoryIndex(std::size_t idx, bool it) const;
 
             void checkRuleIndex(std::size_t idx, bool it) const;
@@ -136,6 +144,7 @@ namespace CDPL
             std::string                         name;
             std::string                         matchPatternStr;
             Chem::MolecularGraph::SharedPointer matchPattern;
+            LazyMatchPatternPtr                 lazyMatchPattern;
             unsigned int                        bondAtom1Type;
             unsigned int                        bondAtom2Type;
             RuleList                            rules;
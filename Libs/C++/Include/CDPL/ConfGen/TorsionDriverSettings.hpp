@@ -84,6 +84,16 @@ namespace CDPL
 
             double getDistanceExponent() const;
 
+            /*
+             * \since 1.2
+             */
+            void setNumThreads(std::size_t num_threads);
+
+            /*
+             * \since 1.2
+             */
+            std::size_t getNumThreads() const;
+
           private:
             bool         sampleHetAtomHs;
             bool         sampleTolRanges;
@@ -94,6 +104,7 @@ namespace CDPL
             bool         strictParam;
             double       dielectricConst;
             double       distExponent;
+            std::size_t  numThreads;
         };
     } // namespace ConfGen
 } // namespace CDPL
@@ -32,6 +32,7 @@
 #include <vector>
 #include <cstddef>
 #include <string>
+#include <memory>
 
 #include "CDPL/ConfGen/APIPrefix.hpp"
 #include "CDPL/Chem/MolecularGraph.hpp"
@@ -43,6 +44,9 @@ namespace CDPL
     namespace ConfGen
     {
 
+        class LazyTorsionMatchPattern;
+        class TorsionLibraryDataReader;
+
         class CDPL_CONFGEN_API TorsionRule
         {
 
@@ -131,10 +135,15 @@ namespace CDPL
             void clear();
 
           private:
+            friend class TorsionLibraryDataReader;
+
+            typedef std::shared_ptr<LazyTorsionMatchPattern> LazyMatchPatternPtr;
+
             void checkAngleIndex(std::size_t idx, bool it) const;
 
             std::string                         matchPatternStr;
             Chem::MolecularGraph::SharedPointer matchPattern;
+            LazyMatchPatternPtr                 lazyMatchPattern;
             AngleEntryList                      angles;
         };
     } // namespace ConfGen
@@ -68,6 +68,7 @@
 #include "CDPL/ForceField/MMFF94VanDerWaalsInteractionList.hpp"
 #include "CDPL/ForceField/MMFF94ElectrostaticInteractionList.hpp"
 #include "CDPL/ForceField/MMFF94InteractionData.hpp"
+#include "CDPL/ForceField/MMFF94InteractionDataCache.hpp"
 #include "CDPL/ForceField/MMFF94BondStretchingInteractionParameterizer.hpp"
 #include "CDPL/ForceField/MMFF94AngleBendingInteractionParameterizer.hpp"
 #include "CDPL/ForceField/MMFF94StretchBendInteractionParameterizer.hpp"
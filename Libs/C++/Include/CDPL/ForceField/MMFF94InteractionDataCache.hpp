@@ -0,0 +1,181 @@
+/*
+ * MMFF94InteractionDataCache.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::ForceField::MMFF94InteractionDataCache.
+ */
+
+#ifndef CDPL_FORCEFIELD_MMFF94INTERACTIONDATACACHE_HPP
+#define CDPL_FORCEFIELD_MMFF94INTERACTIONDATACACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <mutex>
+#include <memory>
+#include <iosfwd>
+
+#include "CDPL/ForceField/APIPrefix.hpp"
+#include "CDPL/ForceField/InteractionType.hpp"
+#include "CDPL/ForceField/MMFF94InteractionData.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Chem
+    {
+
+        class MolecularGraph;
+    }
+
+    namespace ForceField
+    {
+
+        /**
+         * \brief A size-limited cache for MMFF94 interaction parameters of previously parameterized molecular graphs.
+         *
+         * Cache entries are keyed by the connection table of the molecular graph (atom types, formal charges, implicit hydrogen
+         * counts, aromaticity and ring flags, bond orders and any preassigned MMFF94 atom types, charges and bond type indices)
+         * in combination with the parameterization settings (parameter set, interaction types, strict mode, dielectric constant and distance
+         * exponent). Preassigned MMFF94 aromatic ring sets and topological distance matrices are part of the key as well (for the latter, only
+         * whether a distance is 0, 1, 2, 3 or larger matters). Since the stored interactions reference atoms by index, the key depends on the
+         * atom and bond order of the molecular graph. All key data (including symbolic atom type strings) are stored verbatim and keys are
+         * compared in full, hash collisions therefore cannot lead to wrong results.
+         *
+         * If the maximum number of entries is reached, the least recently used entry gets discarded.
+         * All methods are thread-safe, i.e. a single cache instance can be shared between multiple parameterizers.
+         *
+         * \since 1.2
+         */
+        class CDPL_FORCEFIELD_API MMFF94InteractionDataCache
+        {
+
+          public:
+            typedef std::shared_ptr<MMFF94InteractionDataCache> SharedPointer;
+
+            static constexpr std::size_t DEF_MAX_SIZE = 200;
+
+            MMFF94InteractionDataCache(std::size_t max_size = DEF_MAX_SIZE);
+
+            MMFF94InteractionDataCache(const MMFF94InteractionDataCache& cache) = delete;
+
+            MMFF94InteractionDataCache& operator=(const MMFF94InteractionDataCache& cache) = delete;
+
+            /**
+             * \brief Specifies the maximum number of cached entries.
+             * \param max_size The maximum number of entries (\e 0 disables caching).
+             */
+            void setMaxSize(std::size_t max_size);
+
+            std::size_t getMaxSize() const;
+
+            std::size_t getSize() const;
+
+            void clear();
+
+            std::size_t getNumHits() const;
+
+            std::size_t getNumMisses() const;
+
+            void resetStatistics();
+
+            /**
+             * \brief Looks up the interaction data of the given molecular graph and parameterization settings.
+             * \param molgraph The parameterized molecular graph.
+             * \param param_set The used MMFF94 parameter set (see namespace ForceField::MMFF94ParameterSet).
+             * \param ia_types The parameterized interaction types (see namespace ForceField::InteractionType).
+             * \param strict The strict mode flag.
+             * \param de_const The dielectric constant used for electrostatic interactions.
+             * \param dist_expo The distance exponent used for electrostatic interactions.
+             * \param ia_data Receives a copy of the cached interaction data.
+             * \return \c true if an entry was found, and \c false otherwise.
+             */
+            bool getData(const Chem::MolecularGraph& molgraph, unsigned int param_set, unsigned int ia_types, bool strict,
+                         double de_const, double dist_expo, MMFF94InteractionData& ia_data);
+
+            /**
+             * \brief Stores a copy of the interaction data of the given molecular graph and parameterization settings.
+             * \param molgraph The parameterized molecular graph.
+             * \param param_set The used MMFF94 parameter set (see namespace ForceField::MMFF94ParameterSet).
+             * \param ia_types The parameterized interaction types (see namespace ForceField::InteractionType).
+             * \param strict The strict mode flag.
+             * \param de_const The dielectric constant used for electrostatic interactions.
+             * \param dist_expo The distance exponent used for electrostatic interactions.
+             * \param ia_data The interaction data to store.
+             */
+            void addData(const Chem::MolecularGraph& molgraph, unsigned int param_set, unsigned int ia_types, bool strict,
+                         double de_const, double dist_expo, const MMFF94InteractionData& ia_data);
+
+            /**
+             * \brief Writes the cache entries in a compact binary format to the output stream \a os.
+             * \param os The output stream.
+             * \throw Base::IOError if an I/O error occurred.
+             */
+            void write(std::ostream& os) const;
+
+            /**
+             * \brief Replaces the current cache entries by the entries read from the input stream \a is.
+             * \param is The input stream providing data in the format written by write().
+             * \throw Base::IOError if the data are invalid or an I/O error occurred.
+             */
+            void read(std::istream& is);
+
+          private:
+            typedef std::vector<std::uint64_t> Key;
+
+            struct KeyHashFunc
+            {
+
+                std::size_t operator()(const Key& key) const;
+            };
+
+            struct Entry
+            {
+
+                Key                   key;
+                MMFF94InteractionData data;
+            };
+
+            typedef std::list<Entry>                                          EntryList;
+            typedef std::unordered_map<Key, EntryList::iterator, KeyHashFunc> EntryMap;
+
+            void makeKey(const Chem::MolecularGraph& molgraph, unsigned int param_set, unsigned int ia_types, bool strict,
+                         double de_const, double dist_expo, Key& key) const;
+
+            void shrink();
+
+            mutable std::mutex mutex;
+            std::size_t        maxSize;
+            std::size_t        numHits;
+            std::size_t        numMisses;
+            EntryList          entries;
+            EntryMap           entryMap;
+        };
+    } // namespace ForceField
+} // namespace CDPL
+
+#endif // CDPL_FORCEFIELD_MMFF94INTERACTIONDATACACHE_HPP
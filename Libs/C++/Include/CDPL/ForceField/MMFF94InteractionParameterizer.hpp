@@ -65,6 +65,7 @@
 #include "CDPL/ForceField/MMFF94AtomTyper.hpp"
 #include "CDPL/ForceField/MMFF94BondTyper.hpp"
 #include "CDPL/ForceField/MMFF94ChargeCalculator.hpp"
+#include "CDPL/ForceField/MMFF94InteractionDataCache.hpp"
 #include "CDPL/Util/Array.hpp"
 #include "CDPL/Math/Matrix.hpp"
 
@@ -82,8 +83,6 @@ namespace CDPL
     namespace ForceField
     {
 
-        class MMFF94InteractionData;
-
         class CDPL_FORCEFIELD_API MMFF94InteractionParameterizer
         {
 
@@ -150,6 +149,24 @@ namespace CDPL
 
             void setParameterSet(unsigned int param_set);
 
+            /**
+             * \brief Specifies a cache for the lookup of previously calculated interaction data.
+             *
+             * The cache is only consulted if the builtin parameter tables of the current parameter set are in use and
+             * no interaction filter functions have been specified.
+             *
+             * \param cache The cache to use or an empty pointer if caching shall be disabled.
+             * \since 1.2
+             */
+            void setInteractionDataCache(const MMFF94InteractionDataCache::SharedPointer& cache);
+
+            /**
+             * \brief Returns the used interaction data cache.
+             * \return The used cache or an empty pointer if no cache has been specified.
+             * \since 1.2
+             */
+            const MMFF94InteractionDataCache::SharedPointer& getInteractionDataCache() const;
+
             MMFF94InteractionParameterizer& operator=(const MMFF94InteractionParameterizer& parameterizer);
 
             void parameterize(const Chem::MolecularGraph& molgraph, MMFF94InteractionData& ia_data,
@@ -179,6 +196,12 @@ namespace CDPL
             void setupAtomCharges(bool strict);
             void setupTopDistances();
 
+            void setFilterFunctionFlag(unsigned int ia_type, bool set);
+
+            bool cacheUsable() const;
+
+            static void copyData(const MMFF94InteractionData& src_data, MMFF94InteractionData& tgt_data, unsigned int ia_types);
+
             MMFF94BondStretchingInteractionParameterizer    bondStretchingParameterizer;
             MMFF94AngleBendingInteractionParameterizer      angleBendingParameterizer;
             MMFF94StretchBendInteractionParameterizer       stretchBendParameterizer;
@@ -198,6 +221,13 @@ namespace CDPL
             Util::UIArray                                   bondTypeIndices;
             Util::DArray                                    atomCharges;
             const Chem::MolecularGraph*                     molGraph;
+            MMFF94InteractionDataCache::SharedPointer       dataCache;
+            MMFF94InteractionData::SharedPointer            cachedData;
+            unsigned int                                    paramSet;
+            bool                                            customParams;
+            unsigned int                                    filterFuncMask;
+            double                                          deConst;
+            double                                          distExpo;
         };
     } // namespace ForceField
 } // namespace CDPL
@@ -99,6 +99,13 @@ namespace CDPL
                 rIJPow7 = std::pow(rIJ, 7.0);
             }
 
+            /**
+             * \brief Constructs an interaction from the already calculated well depth \a e_IJ and minimum-energy separation \a r_IJ.
+             * \since 1.2
+             */
+            MMFF94VanDerWaalsInteraction(std::size_t atom1_idx, std::size_t atom2_idx, double e_IJ, double r_IJ):
+                atom1Idx(atom1_idx), atom2Idx(atom2_idx), eIJ(e_IJ), rIJ(r_IJ), rIJPow7(std::pow(r_IJ, 7.0)) {}
+
             std::size_t getAtom1Index() const
             {
                 return atom1Idx;
@@ -72,6 +72,7 @@
 #include "CDPL/Pharm/HBondingInteractionConstraint.hpp"
 #include "CDPL/Pharm/XBondingInteractionConstraint.hpp"
 #include "CDPL/Pharm/InteractionPharmacophoreGenerator.hpp"
+#include "CDPL/Pharm/InteractionFingerprintGenerator.hpp"
 #include "CDPL/Pharm/FeatureInteractionScore.hpp"
 #include "CDPL/Pharm/FeatureInteractionScoreCombiner.hpp"
 #include "CDPL/Pharm/FeatureDistanceScore.hpp"
@@ -100,6 +101,7 @@
 #include "CDPL/Pharm/ScreeningDBCreator.hpp"
 #include "CDPL/Pharm/ScreeningDBAccessor.hpp"
 #include "CDPL/Pharm/ScreeningProcessor.hpp"
+#include "CDPL/Pharm/ScreeningProcessorStatistics.hpp"
 #include "CDPL/Pharm/PharmacophoreFitScreeningScore.hpp"
 #include "CDPL/Pharm/MoleculeFunctions.hpp"
 #include "CDPL/Pharm/PharmacophoreFunctions.hpp"
@@ -32,6 +32,8 @@
 #include <utility>
 #include <map>
 #include <functional>
+#include <memory>
+#include <limits>
 
 #include "CDPL/Pharm/APIPrefix.hpp"
 #include "CDPL/Pharm/FeatureMapping.hpp"
@@ -45,9 +47,17 @@ namespace CDPL
 
         class FeatureContainer;
         class Feature;
+        class InteractionFingerprintGenerator;
 
         /**
          * \brief InteractionAnalyzer.
+         *
+         * Constraint functions can be registered together with the maximum distance between the positions of two interacting
+         * features of the respective types. Feature pairs whose distance exceeds this limit are not passed to the constraint function.
+         * For the lookup of nearby features, the features of the second container get bucketed by type in a grid of cubic cells
+         * (cell list). If the second feature container does not change between subsequent analyses (e.g. a receptor pharmacophore that is
+         * tested against many ligand poses), the cell list can be built once by calling indexFeatures() and then be reused by the
+         * analyze() overload that takes only a single feature container as argument.
          */
         class CDPL_PHARM_API InteractionAnalyzer
         {
@@ -58,6 +68,12 @@ namespace CDPL
              */
             typedef std::function<bool(const Feature&, const Feature&)> ConstraintFunction;
 
+            /**
+             * \brief Value specifying that the interaction distance of a feature type pair is not limited.
+             * \since 1.2
+             */
+            static constexpr double NO_DISTANCE_LIMIT = std::numeric_limits<double>::max();
+
             /**
              * \brief Constructs the \c %InteractionAnalyzer instance.
              */
@@ -77,6 +93,17 @@ namespace CDPL
              */
             void setConstraintFunction(unsigned int type1, unsigned type2, const ConstraintFunction& func);
 
+            /**
+             * \brief Specifies a function that gets used for checking whether all constraints are actually
+             *        fulfilled for an interaction between a pair of features of the specified types.
+             * \param type1 An identifier for the type of the first feature.
+             * \param type2 An identifier for the type of the second feature.
+             * \param func The constraint check function.
+             * \param max_dist The maximum distance between the positions of two features that may fulfill the constraints.
+             * \since 1.2
+             */
+            void setConstraintFunction(unsigned int type1, unsigned type2, const ConstraintFunction& func, double max_dist);
+
             /**
              * \brief Removes the constraint check function that was registered for the specified pair of feature types.
              * \param type1 An identifier for the type of the first feature.
@@ -92,6 +119,16 @@ namespace CDPL
              */
             const ConstraintFunction& getConstraintFunction(unsigned int type1, unsigned type2) const;
 
+            /**
+             * \brief Returns the maximum interaction distance that was registered for the specified pair of feature types.
+             * \param type1 An identifier for the type of the first feature.
+             * \param type2 An identifier for the type of the second feature.
+             * \return The maximum interaction distance or InteractionAnalyzer::NO_DISTANCE_LIMIT if the distance is not limited
+             *         or no constraint function has been registered.
+             * \since 1.2
+             */
+            double getMaxInteractionDistance(unsigned int type1, unsigned type2) const;
+
             /**
              * \brief Analyzes possible interactions of the features in feature container \a cntnr1 and with features of \a cntnr2 according
              *        to the registered constraint functions.
@@ -114,11 +151,70 @@ namespace CDPL
              */
             void analyze(const FeatureContainer& cntnr1, const FeatureContainer& cntnr2, FeatureMapping& iactions, bool append = false) const;
 
+            /**
+             * \brief Builds the cell list of the features in \a cntnr2 that will be used by subsequent calls to
+             *        analyze(const FeatureContainer&, FeatureMapping&, bool) const.
+             *
+             * The feature positions are recorded at the time of the call. If the positions of the features in \a cntnr2 change or features
+             * get added or removed, the method has to be called again. Cell sizes are derived from the maximum interaction distances of
+             * the constraint functions registered at the time of the call.
+             *
+             * \param cntnr2 The feature container that will act as the second feature container of subsequent analyses.
+             * \since 1.2
+             */
+            void indexFeatures(const FeatureContainer& cntnr2);
+
+            /**
+             * \brief Releases the cell list built by the last call to indexFeatures().
+             * \since 1.2
+             */
+            void clearFeatureIndex();
+
+            /**
+             * \brief Tells whether a cell list has been built by a call to indexFeatures().
+             * \return \c true if a cell list is available, and \c false otherwise.
+             * \since 1.2
+             */
+            bool hasFeatureIndex() const;
+
+            /**
+             * \brief Analyzes possible interactions of the features in feature container \a cntnr1 with the features of the container
+             *        that was specified in the last call to indexFeatures().
+             *
+             * The reported interactions are the same as for analyze(const FeatureContainer&, const FeatureContainer&, FeatureMapping&, bool) const
+             * called with the indexed container as second argument. Since the cell list is not modified, the method may be called
+             * concurrently from multiple threads.
+             *
+             * \param cntnr1 The first feature container.
+             * \param iactions An output map that contains features of \a cntnr1 as keys and interacting indexed features as values.
+             * \param append If \c false, \a iactions gets cleared before adding any feature mappings.
+             * \throw Base::OperationFailed if no cell list has been built.
+             * \since 1.2
+             */
+            void analyze(const FeatureContainer& cntnr1, FeatureMapping& iactions, bool append = false) const;
+
           private:
-            typedef std::pair<unsigned int, unsigned int>         FeatureTypePair;
-            typedef std::map<FeatureTypePair, ConstraintFunction> ConstraintFunctionMap;
+            friend class InteractionFingerprintGenerator;
+
+            class FeatureIndex;
+
+            struct ConstraintData
+            {
+
+                ConstraintFunction function;
+                double             maxDistance;
+            };
+
+            typedef std::pair<unsigned int, unsigned int>     FeatureTypePair;
+            typedef std::map<FeatureTypePair, ConstraintData> ConstraintFunctionMap;
+            typedef std::shared_ptr<FeatureIndex>             FeatureIndexPointer;
+
+            FeatureIndexPointer createFeatureIndex(const FeatureContainer& cntnr2) const;
+
+            void analyze(const FeatureContainer& cntnr1, const FeatureIndex& index, FeatureMapping& iactions, bool append) const;
 
             ConstraintFunctionMap constraintFuncMap;
+            FeatureIndexPointer   featureIndex;
         };
     } // namespace Pharm
 } // namespace CDPL
@@ -0,0 +1,229 @@
+/*
+ * InteractionFingerprintGenerator.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Pharm::InteractionFingerprintGenerator.
+ */
+
+#ifndef CDPL_PHARM_INTERACTIONFINGERPRINTGENERATOR_HPP
+#define CDPL_PHARM_INTERACTIONFINGERPRINTGENERATOR_HPP
+
+#include <vector>
+#include <memory>
+
+#include "CDPL/Pharm/APIPrefix.hpp"
+#include "CDPL/Pharm/DefaultPharmacophoreGenerator.hpp"
+#include "CDPL/Pharm/DefaultInteractionAnalyzer.hpp"
+#include "CDPL/Pharm/BasicPharmacophore.hpp"
+#include "CDPL/Pharm/FeatureType.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+#include "CDPL/Math/Vector.hpp"
+#include "CDPL/Math/Matrix.hpp"
+#include "CDPL/Util/Array.hpp"
+#include "CDPL/Util/BitSet.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Chem
+    {
+
+        class MolecularGraph;
+    }
+
+    namespace Pharm
+    {
+
+        /**
+         * \brief Generates interaction fingerprints for series of ligand/environment coordinate sets (e.g. MD trajectory frames or docking poses).
+         *
+         * The pharmacophores of the ligand and its environment get generated only once by a call to setup(). For each processed frame,
+         * the positions and orientations of the features are then updated from the supplied atom coordinates by superimposing the
+         * reference coordinates of the feature atoms and their bonded neighbors onto the new coordinates. Feature interactions get
+         * detected by the interaction analyzer returned by getInteractionAnalyzer(). The analyzer does not get modified by the generation of
+         * fingerprints (a feature index built by InteractionAnalyzer::indexFeatures() is neither used nor released), which allows concurrent
+         * calls of generate() as long as the analyzer's constraint functions remain unchanged.
+         *
+         * The fingerprint of a frame comprises one bit (or counter) for every pair of an environment feature and a ligand feature type.
+         * The bit for the environment feature with index \e i and ligand features of type \e t (see namespace Pharm::FeatureType) has the
+         * index <em>i * NUM_LIGAND_FEATURE_TYPES + t</em>.
+         *
+         * Coordinates are passed as Math::Vector3DArray instances holding the atom coordinates in the atom order of the molecular graphs
+         * specified in the last call to setup(). Arrays that contain data for multiple frames store the coordinates of the frames
+         * consecutively. An empty array selects the coordinates the pharmacophores were generated from.
+         *
+         * \since 1.2
+         */
+        class CDPL_PHARM_API InteractionFingerprintGenerator
+        {
+
+          public:
+            typedef std::shared_ptr<InteractionFingerprintGenerator> SharedPointer;
+
+            static constexpr std::size_t NUM_LIGAND_FEATURE_TYPES = FeatureType::MAX_TYPE + 1;
+
+            /**
+             * \brief Constructs the \c %InteractionFingerprintGenerator instance.
+             */
+            InteractionFingerprintGenerator();
+
+            InteractionFingerprintGenerator(const InteractionFingerprintGenerator& gen) = delete;
+
+            InteractionFingerprintGenerator& operator=(const InteractionFingerprintGenerator& gen) = delete;
+
+            /**
+             * \brief Specifies the number of threads that are used for processing multiple frames.
+             * \param num_threads The number of threads to use.
+             * \note By default, frames get processed in the calling thread only (value zero).
+             */
+            void setNumThreads(std::size_t num_threads);
+
+            /**
+             * \brief Returns the number of threads that are used for processing multiple frames.
+             * \return The number of threads.
+             */
+            std::size_t getNumThreads() const;
+
+            PharmacophoreGenerator& getLigandPharmacophoreGenerator();
+
+            const PharmacophoreGenerator& getLigandPharmacophoreGenerator() const;
+
+            PharmacophoreGenerator& getEnvironmentPharmacophoreGenerator();
+
+            const PharmacophoreGenerator& getEnvironmentPharmacophoreGenerator() const;
+
+            InteractionAnalyzer& getInteractionAnalyzer();
+
+            const InteractionAnalyzer& getInteractionAnalyzer() const;
+
+            /**
+             * \brief Generates the ligand and environment pharmacophores that will be used for processing subsequent frames.
+             * \param ligand The ligand molecular graph.
+             * \param env The environment (e.g. receptor) molecular graph.
+             * \note The molecular graphs have to be prepared for pharmacophore generation and must not be modified or destroyed as long as frames
+             *       get processed. Generated features that lack a substructure with atoms of the respective molecular graph or 3D coordinates
+             *       cannot follow the atom movements and get removed from the pharmacophores.
+             */
+            void setup(const Chem::MolecularGraph& ligand, const Chem::MolecularGraph& env);
+
+            const Pharmacophore& getLigandPharmacophore() const;
+
+            const Pharmacophore& getEnvironmentPharmacophore() const;
+
+            /**
+             * \brief Returns the number of fingerprint bits.
+             * \return The number of environment features times \c NUM_LIGAND_FEATURE_TYPES.
+             */
+            std::size_t getNumBits() const;
+
+            /**
+             * \brief Generates the interaction fingerprint of a single frame.
+             * \param lig_coords The ligand atom coordinates.
+             * \param env_coords The environment atom coordinates.
+             * \param fp The output fingerprint.
+             * \throw Base::SizeError if the size of a coordinates array is neither zero nor the atom count of the respective molecular graph.
+             */
+            void generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, Util::BitSet& fp);
+
+            /**
+             * \brief Counts the interactions per fingerprint bit for a single frame.
+             * \param lig_coords The ligand atom coordinates.
+             * \param env_coords The environment atom coordinates.
+             * \param counts The output vector receiving the number of interactions per fingerprint bit.
+             * \throw Base::SizeError if the size of a coordinates array is neither zero nor the atom count of the respective molecular graph.
+             */
+            void generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, Math::ULVector& counts);
+
+            /**
+             * \brief Generates the interaction fingerprints of multiple frames.
+             *
+             * Each coordinates array has to provide the coordinates of all \a num_frames frames, of a single frame (used for all frames) or
+             * has to be empty. If the environment coordinates do not change between the frames, the cell list of the environment features
+             * gets built only once.
+             *
+             * \param lig_coords The ligand atom coordinates.
+             * \param env_coords The environment atom coordinates.
+             * \param num_frames The number of frames.
+             * \param fps The output array receiving the fingerprint of each frame.
+             * \throw Base::SizeError if the size of a coordinates array does not match.
+             */
+            void generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, std::size_t num_frames,
+                          Util::BitSetArray& fps);
+
+            /**
+             * \brief Counts the interactions per fingerprint bit for multiple frames.
+             * \param lig_coords The ligand atom coordinates.
+             * \param env_coords The environment atom coordinates.
+             * \param num_frames The number of frames.
+             * \param counts The output matrix whose rows receive the interaction counts of the frames.
+             * \throw Base::SizeError if the size of a coordinates array does not match.
+             * \see generate(const Math::Vector3DArray&, const Math::Vector3DArray&, std::size_t, Util::BitSetArray&)
+             */
+            void generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, std::size_t num_frames,
+                          Math::ULMatrix& counts);
+
+          private:
+            struct FeatureGeometryData
+            {
+
+                Util::STArray  atomIndices;
+                Math::DMatrix  refAtomCoords;
+                Math::Vector3D refPosition;
+                Math::Vector3D refOrientation;
+                bool           hasOrientation;
+            };
+
+            typedef std::vector<FeatureGeometryData> FeatureGeometryDataList;
+
+            class FrameProcessor;
+
+            typedef std::vector<std::size_t> BitIndexList;
+
+            void initGeometryData(const Chem::MolecularGraph& molgraph, Pharmacophore& pharm,
+                                  const Chem::Atom3DCoordinatesFunction& coords_func, FeatureGeometryDataList& geom_data) const;
+
+            std::size_t getNumCoordinateFrames(const Math::Vector3DArray& coords, std::size_t num_atoms, std::size_t num_frames) const;
+
+            template <typename ResultFunc>
+            void processFrames(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, std::size_t num_frames,
+                               const ResultFunc& func);
+
+            DefaultPharmacophoreGenerator ligPharmGen;
+            DefaultPharmacophoreGenerator envPharmGen;
+            DefaultInteractionAnalyzer    iaAnalyzer;
+            const Chem::MolecularGraph*   ligMolGraph;
+            const Chem::MolecularGraph*   envMolGraph;
+            std::size_t                   numLigAtoms;
+            std::size_t                   numEnvAtoms;
+            BasicPharmacophore            ligPharm;
+            BasicPharmacophore            envPharm;
+            FeatureGeometryDataList       ligGeomData;
+            FeatureGeometryDataList       envGeomData;
+            std::size_t                   numThreads;
+        };
+    } // namespace Pharm
+} // namespace CDPL
+
+#endif // CDPL_PHARM_INTERACTIONFINGERPRINTGENERATOR_HPP
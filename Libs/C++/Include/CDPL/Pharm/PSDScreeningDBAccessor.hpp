@@ -92,6 +92,42 @@ namespace CDPL
 
             const FeatureTypeHistogram& getFeatureCounts(std::size_t mol_idx, std::size_t mol_conf_idx) const;
 
+            /**
+             * \brief Starts loading the data of the specified pharmacophores with a single database query and decoding
+             *        them in a background thread.
+             *
+             * Subsequent calls to getPharmacophore(std::size_t, Pharmacophore&, bool) const for one of the
+             * specified pharmacophores will return the decoded data without accessing the database. Only
+             * the pharmacophores specified by the last two calls are held in memory. The query is most efficient
+             * if the pharmacophores belong to molecules with consecutive indices.
+             *
+             * \param pharm_indices The indices of the pharmacophores to prefetch.
+             * \since 1.2
+             */
+            void prefetchPharmacophores(const Util::STArray& pharm_indices) const;
+
+            /**
+             * \brief Retrieves the 3D coordinates and van der Waals radii of the atoms of the molecule conformation
+             *        the pharmacophore at index \a pharm_idx has been generated from.
+             *
+             * The data are stored per conformation in a separate table as single precision coordinates (the precision
+             * used for molecule records) and atom types. The radii are looked up in the atom dictionary and are thus
+             * identical to the radii obtained for the decoded molecule. Databases (or entries) created by older versions
+             * do not provide this table and the method returns \c false.
+             *
+             * \param pharm_idx The zero-based index of the pharmacophore.
+             * \param coords The array receiving the atom coordinates.
+             * \param radii The array receiving the atom van der Waals radii.
+             * \return \c true if the data are stored in the database, and \c false otherwise.
+             * \throw Base::IndexError if \a pharm_idx is out of bounds, Base::IOError if an error occurred.
+             * \since 1.2
+             */
+            bool getAtomCoordinatesAndRadii(std::size_t pharm_idx, Math::Vector3DArray& coords, Util::DArray& radii) const;
+
+            std::size_t getNumBytesRead() const;
+
+            double getDataDecodingTime() const;
+
           private:
             typedef std::unique_ptr<PSDScreeningDBAccessorImpl> ImplementationPointer;
 
@@ -72,6 +72,13 @@ namespace CDPL
 
             double getMaxAngle() const;
 
+            /**
+             * \brief Returns an upper bound for the distance between the positions of two features that fulfill the constraints.
+             * \return The maximum feature distance.
+             * \since 1.2
+             */
+            double getMaxFeatureDistance() const;
+
             bool operator()(const Feature& ftr1, const Feature& ftr2) const;
 
           private:
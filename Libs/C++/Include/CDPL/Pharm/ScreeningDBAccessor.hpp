@@ -34,6 +34,8 @@
 #include <memory>
 
 #include "CDPL/Pharm/APIPrefix.hpp"
+#include "CDPL/Util/Array.hpp"
+#include "CDPL/Math/VectorArray.hpp"
 
 
 namespace CDPL
@@ -91,6 +93,55 @@ namespace CDPL
 
             virtual const FeatureTypeHistogram& getFeatureCounts(std::size_t mol_idx, std::size_t mol_conf_idx) const = 0;
 
+            /**
+             * \brief Announces that the pharmacophores with the specified indices are going to be requested next.
+             *
+             * Implementations may use this hint to load and decode the corresponding data in advance (e.g. in a
+             * single database query and in a background thread). The default implementation does nothing.
+             *
+             * \param pharm_indices The indices of the pharmacophores that will be requested.
+             * \since 1.2
+             */
+            virtual void prefetchPharmacophores(const Util::STArray& pharm_indices) const {}
+
+            /**
+             * \brief Retrieves the 3D coordinates and van der Waals radii of the atoms of the molecule conformation
+             *        the pharmacophore at index \a pharm_idx has been generated from.
+             *
+             * Allows to check for exclusion volume clashes without loading and decoding the whole molecule. The
+             * default implementation does not provide such data and returns \c false.
+             *
+             * \param pharm_idx The zero-based index of the pharmacophore.
+             * \param coords The array receiving the atom coordinates (previous content gets overwritten).
+             * \param radii The array receiving the atom van der Waals radii (previous content gets overwritten).
+             * \return \c true if the data are available, and \c false otherwise.
+             * \since 1.2
+             */
+            virtual bool getAtomCoordinatesAndRadii(std::size_t pharm_idx, Math::Vector3DArray& coords, Util::DArray& radii) const
+            {
+                return false;
+            }
+
+            /**
+             * \brief Returns the total number of bytes of stored molecule and pharmacophore data read since the database was opened.
+             * \return The number of read bytes, or \e 0 if not tracked by the implementation.
+             * \since 1.2
+             */
+            virtual std::size_t getNumBytesRead() const
+            {
+                return 0;
+            }
+
+            /**
+             * \brief Returns the total time in seconds spent decoding stored molecule and pharmacophore data since the database was opened.
+             * \return The data decoding time, or \e 0 if not tracked by the implementation.
+             * \since 1.2
+             */
+            virtual double getDataDecodingTime() const
+            {
+                return 0.0;
+            }
+
           protected:
             ScreeningDBAccessor& operator=(const ScreeningDBAccessor&)
             {
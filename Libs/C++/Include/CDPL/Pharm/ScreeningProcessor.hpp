@@ -32,8 +32,10 @@
 #include <memory>
 #include <cstddef>
 #include <functional>
+#include <vector>
 
 #include "CDPL/Pharm/APIPrefix.hpp"
+#include "CDPL/Pharm/ScreeningProcessorStatistics.hpp"
 #include "CDPL/Math/Matrix.hpp"
 
 
@@ -75,7 +77,7 @@ namespace CDPL
                 SearchHit(const ScreeningProcessor& hit_prov, const FeatureContainer& qry_pharm,
                           const FeatureContainer& hit_pharm, const Chem::Molecule& mol,
                           const Math::Matrix4D& xform, std::size_t pharm_idx,
-                          std::size_t mol_idx, std::size_t conf_idx);
+                          std::size_t mol_idx, std::size_t conf_idx, std::size_t qry_pharm_idx = 0);
 
                 const ScreeningProcessor& getHitProvider() const;
 
@@ -93,6 +95,14 @@ namespace CDPL
 
                 std::size_t getHitConformationIndex() const;
 
+                /**
+                 * \brief Returns the index of the matched query pharmacophore in the query list passed to
+                 *        searchDB(const QueryPharmacophoreList&, std::size_t, std::size_t).
+                 * \return The index of the query pharmacophore (\e 0 for single query searches).
+                 * \since 1.2
+                 */
+                std::size_t getQueryPharmacophoreIndex() const;
+
               private:
                 const ScreeningProcessor* provider;
                 const FeatureContainer*   qryPharm;
@@ -102,6 +112,7 @@ namespace CDPL
                 std::size_t               pharmIndex;
                 std::size_t               molIndex;
                 std::size_t               confIndex;
+                std::size_t               qryPharmIndex;
             };
 
             typedef std::shared_ptr<ScreeningProcessor> SharedPointer;
@@ -110,6 +121,12 @@ namespace CDPL
             typedef std::function<double(const SearchHit&)>       ScoringFunction;
             typedef std::function<bool(std::size_t, std::size_t)> ProgressCallbackFunction;
 
+            /**
+             * \brief A list of query pharmacophores for multi-query searches.
+             * \since 1.2
+             */
+            typedef std::vector<const FeatureContainer*> QueryPharmacophoreList;
+
             /**
              * \brief Constructs the \c %ScreeningProcessor instance for the given
              *        screening database accessor \a db_acc.
@@ -156,6 +173,31 @@ namespace CDPL
 
             std::size_t searchDB(const FeatureContainer& query, std::size_t mol_start_idx = 0, std::size_t mol_end_idx = 0);
 
+            /**
+             * \brief Screens the database for matches of multiple query pharmacophores in a single pass.
+             *
+             * Each database pharmacophore gets loaded only once and is then subjected to the screening filters for
+             * every query. The hit report mode applies to each query separately, i.e. for the same molecule one hit
+             * per matching query gets reported in the modes ScreeningProcessor::FIRST_MATCHING_CONF and
+             * ScreeningProcessor::BEST_MATCHING_CONF. The query a reported hit belongs to is available via
+             * SearchHit::getQueryPharmacophoreIndex().
+             *
+             * \param queries The query pharmacophores.
+             * \param mol_start_idx The index of the first database molecule to screen.
+             * \param mol_end_idx The index of the database molecule where the screening stops (\e 0 screens up to the last molecule).
+             * \return The total number of reported hits.
+             * \throw Base::NullPointerException if \a queries contains a null pointer.
+             * \since 1.2
+             */
+            std::size_t searchDB(const QueryPharmacophoreList& queries, std::size_t mol_start_idx = 0, std::size_t mol_end_idx = 0);
+
+            /**
+             * \brief Returns the filter stage counts, timings and database I/O statistics of the last searchDB() call.
+             * \return The statistics of the last database search.
+             * \since 1.2
+             */
+            const ScreeningProcessorStatistics& getStatistics() const;
+
           private:
             typedef std::unique_ptr<ScreeningProcessorImpl> ImplementationPointer;
 
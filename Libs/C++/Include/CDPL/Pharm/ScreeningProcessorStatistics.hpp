@@ -0,0 +1,210 @@
+/* 
+ * ScreeningProcessorStatistics.hpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Pharm::ScreeningProcessorStatistics.
+ */
+
+#ifndef CDPL_PHARM_SCREENINGPROCESSORSTATISTICS_HPP
+#define CDPL_PHARM_SCREENINGPROCESSORSTATISTICS_HPP
+
+#include <cstddef>
+#include <array>
+
+#include "CDPL/Pharm/APIPrefix.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Pharm
+    {
+
+        /**
+         * \brief Provides the number of tested and passed database entries, and the time spent, for each filter
+         *        stage of a pharmacophore database search, together with database I/O related counters and times.
+         *
+         * The filter stages are listed in the order they get applied by Pharm::ScreeningProcessor. Times are
+         * specified in seconds.
+         *
+         * \since 1.2
+         */
+        class CDPL_PHARM_API ScreeningProcessorStatistics
+        {
+
+          public:
+            enum Stage
+            {
+
+                /**
+                 * \brief Comparison of query and database pharmacophore feature type counts.
+                 */
+                FEATURE_COUNT_FILTER,
+
+                /**
+                 * \brief Matching of query and database two-point pharmacophores.
+                 */
+                TWO_POINT_PHARMACOPHORE_FILTER,
+
+                /**
+                 * \brief Enumeration of topological query to database feature mappings (tested and passed counts refer
+                 *        to mappings, the time includes the calculation of the corresponding alignment transformations).
+                 */
+                TOPOLOGICAL_ALIGNMENT,
+
+                /**
+                 * \brief Check of the spatial feature positions and geometries for each generated alignment.
+                 */
+                SPATIAL_ALIGNMENT,
+
+                /**
+                 * \brief Check of the aligned database molecule for clashes with the query exclusion volumes.
+                 */
+                XVOLUME_CLASH_FILTER,
+
+                /**
+                 * \brief Score calculation for the alignments that passed all filters (no entries get rejected).
+                 */
+                SCORING
+            };
+
+            enum Counter
+            {
+
+                NUM_SCREENED_PHARMACOPHORES,
+                NUM_SKIPPED_PHARMACOPHORES,
+                NUM_LOADED_PHARMACOPHORES,
+                NUM_LOADED_MOLECULES,
+                NUM_BYTES_READ,
+                NUM_HITS
+            };
+
+            static constexpr std::size_t NUM_STAGES   = SCORING + 1;
+            static constexpr std::size_t NUM_COUNTERS = NUM_HITS + 1;
+
+            ScreeningProcessorStatistics();
+
+            void clear();
+
+            double getTotalTime() const;
+
+            void setTotalTime(double time);
+
+            std::size_t getNumTested(Stage stage) const;
+
+            std::size_t getNumPassed(Stage stage) const;
+
+            /**
+             * \brief Returns the fraction of entries tested by the specified stage that passed it.
+             * \param stage The stage.
+             * \return The pass rate in the range [0, 1], or \e 0 if no entries were tested.
+             */
+            double getPassRate(Stage stage) const;
+
+            void setStageCounts(Stage stage, std::size_t num_tested, std::size_t num_passed);
+
+            void addStageCounts(Stage stage, std::size_t num_tested, std::size_t num_passed);
+
+            double getStageTime(Stage stage) const;
+
+            void setStageTime(Stage stage, double time);
+
+            void addStageTime(Stage stage, double time);
+
+            std::size_t getCounter(Counter counter) const;
+
+            void setCounter(Counter counter, std::size_t value);
+
+            void increaseCounter(Counter counter, std::size_t inc = 1);
+
+            /**
+             * \brief Returns the time spent loading database pharmacophores (includes the data decoding time).
+             * \return The pharmacophore load time.
+             */
+            double getPharmacophoreLoadTime() const;
+
+            void setPharmacophoreLoadTime(double time);
+
+            void addPharmacophoreLoadTime(double time);
+
+            /**
+             * \brief Returns the time spent loading database molecules (includes the data decoding time).
+             * \return The molecule load time.
+             */
+            double getMoleculeLoadTime() const;
+
+            void setMoleculeLoadTime(double time);
+
+            void addMoleculeLoadTime(double time);
+
+            /**
+             * \brief Returns the time the database accessor spent decoding the stored molecule and pharmacophore data.
+             * \return The data decoding time, or \e 0 if not tracked by the used Pharm::ScreeningDBAccessor implementation.
+             */
+            double getDataDecodingTime() const;
+
+            void setDataDecodingTime(double time);
+
+            void addDataDecodingTime(double time);
+
+            /**
+             * \brief Adds the times and counts of \a stats to the corresponding values of this instance.
+             * \param stats The statistics to add.
+             * \return A reference to itself.
+             */
+            ScreeningProcessorStatistics& operator+=(const ScreeningProcessorStatistics& stats);
+
+            /**
+             * \brief Returns a lower case identifier for the specified stage (e.g. \c "feature_count_filter").
+             * \param stage The stage.
+             * \return The stage identifier.
+             */
+            static const char* getStageName(Stage stage);
+
+            /**
+             * \brief Returns a lower case identifier for the specified counter (e.g. \c "num_bytes_read").
+             * \param counter The counter.
+             * \return The counter identifier.
+             */
+            static const char* getCounterName(Counter counter);
+
+          private:
+            typedef std::array<std::size_t, NUM_STAGES>   StageCountArray;
+            typedef std::array<double, NUM_STAGES>        StageTimeArray;
+            typedef std::array<std::size_t, NUM_COUNTERS> CounterArray;
+
+            double          totalTime;
+            StageCountArray numTested;
+            StageCountArray numPassed;
+            StageTimeArray  stageTimes;
+            CounterArray    counters;
+            double          pharmLoadTime;
+            double          molLoadTime;
+            double          decodingTime;
+        };
+    } // namespace Pharm
+} // namespace CDPL
+
+#endif // CDPL_PHARM_SCREENINGPROCESSORSTATISTICS_HPP
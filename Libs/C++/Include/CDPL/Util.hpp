@@ -32,6 +32,7 @@
 #include "CDPL/Util/Array.hpp"
 #include "CDPL/Util/BitSet.hpp"
 #include "CDPL/Util/BronKerboschAlgorithm.hpp"
+#include "CDPL/Util/MaxCliqueAlgorithm.hpp"
 #include "CDPL/Util/DGCoordinatesGenerator.hpp"
 #include "CDPL/Util/Dereferencer.hpp"
 #include "CDPL/Util/IndexedElementIterator.hpp"
@@ -46,6 +47,7 @@
 #include "CDPL/Util/FileDataWriter.hpp"
 #include "CDPL/Util/MultiFormatDataReader.hpp"
 #include "CDPL/Util/MultiFormatDataWriter.hpp"
+#include "CDPL/Util/ParallelDataReader.hpp"
 #include "CDPL/Util/DefaultDataInputHandler.hpp"
 #include "CDPL/Util/ObjectPool.hpp"
 #include "CDPL/Util/ObjectStack.hpp"
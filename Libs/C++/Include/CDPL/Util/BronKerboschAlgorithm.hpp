@@ -44,21 +44,49 @@ namespace CDPL
 
         /**
          * \brief Implementation of the Bron-Kerbosch clique-detection algorithm [\ref BKA].
+         *
+         * If a minimum clique size is specified, search tree branches that cannot produce a maximal clique of at least
+         * this size are pruned by means of an upper bound on the clique size obtained by a greedy coloring of the candidate
+         * node set [\ref TOMI].
          */
         class CDPL_UTIL_API BronKerboschAlgorithm
         {
 
           public:
-            BronKerboschAlgorithm() {}
+            BronKerboschAlgorithm():
+                adjMatrix(0), minCliqueSize(0), numEmittedCliques(0), numPrunedBranches(0) {}
 
-            BronKerboschAlgorithm(const BitSetArray& adj_mtx);
+            BronKerboschAlgorithm(const BitSetArray& adj_mtx, std::size_t min_clique_size = 0);
 
             BronKerboschAlgorithm(const BronKerboschAlgorithm& bka);
 
-            void init(const BitSetArray& adj_mtx);
+            /**
+             * \brief Initializes the algorithm for the enumeration of the maximal cliques of the specified graph.
+             * \param adj_mtx The adjacency matrix of the graph.
+             * \param min_clique_size The minimum size of the cliques to report.
+             */
+            void init(const BitSetArray& adj_mtx, std::size_t min_clique_size = 0);
 
             bool nextClique(BitSet& clique);
 
+            /**
+             * \brief Returns the minimum size of the cliques that get reported.
+             * \return The minimum reported clique size.
+             */
+            std::size_t getMinCliqueSize() const;
+
+            /**
+             * \brief Returns the number of cliques that have been reported since the last call to init().
+             * \return The number of reported cliques.
+             */
+            std::size_t getNumEmittedCliques() const;
+
+            /**
+             * \brief Returns the number of search tree branches that have been pruned since the last call to init().
+             * \return The number of pruned search tree branches.
+             */
+            std::size_t getNumPrunedBranches() const;
+
             BronKerboschAlgorithm& operator=(const BronKerboschAlgorithm& bka);
 
           private:
@@ -76,11 +104,18 @@ namespace CDPL
             typedef std::vector<State*>      StateStack;
             typedef Util::ObjectStack<State> StateCache;
 
+            bool canReachMinCliqueSize(const State& state);
+
             const BitSetArray* adjMatrix;
+            std::size_t        minCliqueSize;
             StateCache         stateCache;
             NodeDegreeTable    nodeDegrees;
             StateStack         states;
             BitSet             pivotCandSet;
+            BitSet             uncolNodes;
+            BitSet             colorClassCands;
+            std::size_t        numEmittedCliques;
+            std::size_t        numPrunedBranches;
         };
     } // namespace Util
 } // namespace CDPL
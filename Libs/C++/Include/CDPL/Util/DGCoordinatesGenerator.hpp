@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <vector>
 #include <algorithm>
+#include <iterator>
 #include <cmath>
 
 #include <boost/random/mersenne_twister.hpp>
@@ -136,6 +137,23 @@ namespace CDPL
             template <typename CoordsArray>
             void generate(std::size_t num_points, CoordsArray& coords);
 
+            /**
+             * \brief Embeds the coordinates stored in multiple independent arrays (e.g. the start coordinates of
+             *        several structure generation trials) in a single run.
+             *
+             * The coordinates get copied into an interleaved buffer where the coordinates of the same point in the
+             * different arrays are adjacent. Each randomly selected constraint is then applied to all arrays at once
+             * by loops over the arrays that can be vectorized by the compiler. Compared to calling
+             * generate(std::size_t, CoordsArray&) for each array, all arrays see the same sequence of constraint selections.
+             *
+             * \param num_points The number of points per coordinates array.
+             * \param coords_arrays_beg An iterator pointing to the first coordinates array.
+             * \param coords_arrays_end An iterator pointing one past the last coordinates array.
+             * \since 1.2
+             */
+            template <typename CoordsArrayIter>
+            void generateBatch(std::size_t num_points, CoordsArrayIter coords_arrays_beg, CoordsArrayIter coords_arrays_end);
+
             template <typename CoordsArray>
             ValueType getDistanceError(const CoordsArray& coords) const;
 
@@ -165,10 +183,20 @@ namespace CDPL
             template <typename CoordsArray>
             void adjCoordsForVolumeConstraint(CoordsArray& coords, const ValueType& lambda, std::size_t constr_idx) const;
 
+            void initBatchDistanceConstraintData();
+
+            void embedBatchCoords(std::size_t num_lanes);
+
+            void adjBatchCoordsForDistanceConstraint(std::size_t num_lanes, const ValueType& lambda, std::size_t constr_idx);
+
+            void adjBatchCoordsForVolumeConstraint(std::size_t num_lanes, const ValueType& lambda, std::size_t constr_idx);
+
             template <typename Vec>
             static ValueType calcDiffVectorAndSquaredDist(const Vec& pt1_pos, const Vec& pt2_pos, ValueType diff[]);
 
             typedef boost::random::mt11213b RandNumEngine;
+            typedef std::vector<std::size_t> IndexArray;
+            typedef std::vector<ValueType>   ValueArray;
 
             std::size_t            numCycles;
             double                 cycleStepCountFactor;
@@ -176,6 +204,14 @@ namespace CDPL
             ValueType              learningRateDecr;
             DistanceConstraintList distConstraints;
             RandNumEngine          randomEngine;
+            IndexArray             batchDistConstrPt1Offsets;
+            IndexArray             batchDistConstrPt2Offsets;
+            ValueArray             batchDistConstrLowerBounds;
+            ValueArray             batchDistConstrUpperBounds;
+
+          protected:
+            ValueArray             batchCoords;
+            ValueArray             batchLaneValues;
         };
 
         template <std::size_t Dim, typename T, typename Derived>
@@ -290,6 +326,11 @@ namespace CDPL
             template <typename Vec>
             static void calcDiffVector(const Vec& pt1_pos, const Vec& pt2_pos, ValueType diff[]);
 
+            static bool calcPositionDeltas(const VolumeConstraint& constr, const ValueType v_41[], const ValueType v_42[],
+                                           const ValueType v_43[], const ValueType& lambda, ValueType g[][3]);
+
+            void adjBatchCoordsForVolumeConstraint(std::size_t num_lanes, const ValueType& lambda, std::size_t constr_idx);
+
             VolumeConstraintList volConstraints;
         };
 
@@ -572,6 +613,148 @@ void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::generate(std::size
     embedCoords(num_points, coords);
 }
 
+template <std::size_t Dim, typename T, typename Derived>
+template <typename CoordsArrayIter>
+void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::generateBatch(std::size_t num_points, CoordsArrayIter coords_arrays_beg,
+                                                                            CoordsArrayIter coords_arrays_end)
+{
+    std::size_t num_lanes = std::distance(coords_arrays_beg, coords_arrays_end);
+
+    if (num_lanes == 0)
+        return;
+
+    // interleaved layout: the value of coordinate d of point i in array l is stored at index (i * Dim + d) * num_lanes + l
+
+    batchCoords.resize(num_points * Dim * num_lanes);
+
+    std::size_t lane = 0;
+
+    for (CoordsArrayIter it = coords_arrays_beg; it != coords_arrays_end; ++it, lane++) {
+        for (std::size_t i = 0; i < num_points; i++) {
+            const auto& pos = (*it)[i];
+
+            for (std::size_t j = 0; j < Dim; j++)
+                batchCoords[(i * Dim + j) * num_lanes + lane] = pos[j];
+        }
+    }
+
+    initBatchDistanceConstraintData();
+    embedBatchCoords(num_lanes);
+
+    lane = 0;
+
+    for (CoordsArrayIter it = coords_arrays_beg; it != coords_arrays_end; ++it, lane++) {
+        for (std::size_t i = 0; i < num_points; i++) {
+            auto& pos = (*it)[i];
+
+            for (std::size_t j = 0; j < Dim; j++)
+                pos[j] = batchCoords[(i * Dim + j) * num_lanes + lane];
+        }
+    }
+}
+
+template <std::size_t Dim, typename T, typename Derived>
+void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::initBatchDistanceConstraintData()
+{
+    // the point indices are stored as offsets of the first point coordinate in the interleaved coordinates buffer
+    // (in units of num_lanes). The arrays keep the order of distConstraints, which orderDistanceConstraints() sorts
+    // by point indices, so that a constraint drawn by index is the same one generate() would apply
+
+    std::size_t num_constrs = distConstraints.size();
+
+    batchDistConstrPt1Offsets.resize(num_constrs);
+    batchDistConstrPt2Offsets.resize(num_constrs);
+    batchDistConstrLowerBounds.resize(num_constrs);
+    batchDistConstrUpperBounds.resize(num_constrs);
+
+    for (std::size_t i = 0; i < num_constrs; i++) {
+        const DistanceConstraint& constr = distConstraints[i];
+
+        batchDistConstrPt1Offsets[i]  = constr.getPoint1Index() * Dim;
+        batchDistConstrPt2Offsets[i]  = constr.getPoint2Index() * Dim;
+        batchDistConstrLowerBounds[i] = constr.getLowerBound();
+        batchDistConstrUpperBounds[i] = constr.getUpperBound();
+    }
+}
+
+template <std::size_t Dim, typename T, typename Derived>
+void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::embedBatchCoords(std::size_t num_lanes)
+{
+    std::size_t num_dist_constrs = distConstraints.size();
+    std::size_t num_vol_constrs  = static_cast<Derived&>(*this).getNumVolumeConstraints();
+
+    if ((num_dist_constrs + num_vol_constrs) == 0)
+        return;
+
+    batchLaneValues.resize(num_lanes);
+
+    std::size_t num_steps = std::size_t((num_dist_constrs + num_vol_constrs) * cycleStepCountFactor);
+    ValueType lambda    = startLearningRate;
+    boost::random::uniform_int_distribution<std::size_t> constr_sd(0, num_dist_constrs + num_vol_constrs - 1);
+
+    for (std::size_t i = 0; i < numCycles; i++, lambda -= learningRateDecr) {
+        for (std::size_t j = 0; j < num_steps; j++) {
+            std::size_t constr_idx = constr_sd(randomEngine);
+
+            if (constr_idx < num_dist_constrs)
+                adjBatchCoordsForDistanceConstraint(num_lanes, lambda, constr_idx);
+            else
+                static_cast<Derived&>(*this).adjBatchCoordsForVolumeConstraint(num_lanes, lambda, constr_idx - num_dist_constrs);
+        }
+    }
+}
+
+template <std::size_t Dim, typename T, typename Derived>
+void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::adjBatchCoordsForDistanceConstraint(std::size_t num_lanes, const ValueType& lambda,
+                                                                                                  std::size_t constr_idx)
+{
+    ValueType* pt1_coords = &batchCoords[batchDistConstrPt1Offsets[constr_idx] * num_lanes];
+    ValueType* pt2_coords = &batchCoords[batchDistConstrPt2Offsets[constr_idx] * num_lanes];
+    ValueType* factors    = &batchLaneValues[0];
+    ValueType  lb         = batchDistConstrLowerBounds[constr_idx];
+    ValueType  ub         = batchDistConstrUpperBounds[constr_idx];
+
+    for (std::size_t i = 0; i < num_lanes; i++)
+        factors[i] = ValueType();
+
+    for (std::size_t i = 0; i < Dim; i++) {
+        const ValueType* pt1_dim_coords = pt1_coords + i * num_lanes;
+        const ValueType* pt2_dim_coords = pt2_coords + i * num_lanes;
+
+        for (std::size_t j = 0; j < num_lanes; j++) {
+            ValueType diff = pt2_dim_coords[j] - pt1_dim_coords[j];
+
+            factors[j] += diff * diff;
+        }
+    }
+
+    // a factor of zero leaves the coordinates of arrays already fulfilling the constraint unchanged
+
+    for (std::size_t i = 0; i < num_lanes; i++) {
+        ValueType dist  = std::sqrt(factors[i]);
+        ValueType bound = (dist > ub ? ub : dist < lb ? lb : dist);
+
+        factors[i] = lambda / 2 * (bound - dist) / (0.000001 + dist);
+    }
+
+    for (std::size_t i = 0; i < Dim; i++) {
+        ValueType* pt1_dim_coords = pt1_coords + i * num_lanes;
+        ValueType* pt2_dim_coords = pt2_coords + i * num_lanes;
+
+        for (std::size_t j = 0; j < num_lanes; j++) {
+            ValueType pos_delta = (pt2_dim_coords[j] - pt1_dim_coords[j]) * factors[j];
+
+            pt1_dim_coords[j] -= pos_delta;
+            pt2_dim_coords[j] += pos_delta;
+        }
+    }
+}
+
+template <std::size_t Dim, typename T, typename Derived>
+void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::adjBatchCoordsForVolumeConstraint(std::size_t num_lanes, const ValueType& lambda,
+                                                                                                std::size_t constr_idx)
+{}
+
 template <std::size_t Dim, typename T, typename Derived>
 template <typename CoordsArray>
 void CDPL::Util::DGCoordinatesGeneratorBase<Dim, T, Derived>::embedCoords(std::size_t num_points, CoordsArray& coords)
@@ -866,7 +1049,58 @@ void CDPL::Util::DGCoordinatesGenerator<3, T>::adjCoordsForConstraint(const Volu
     calcDiffVector(*pt_pos[3], *pt_pos[1], v_42);
     calcDiffVector(*pt_pos[3], *pt_pos[2], v_43);
 
-    ValueType g[4][3];
+    ValueType deltas[4][3];
+
+    if (!calcPositionDeltas(constr, v_41, v_42, v_43, lambda, deltas))
+        return;
+
+    for (std::size_t i = 0; i < 4; i++)
+        for (std::size_t j = 0; j < 3; j++)
+            (*pt_pos[i])[j] += deltas[i][j];
+}
+
+template <typename T>
+void CDPL::Util::DGCoordinatesGenerator<3, T>::adjBatchCoordsForVolumeConstraint(std::size_t num_lanes, const ValueType& lambda, std::size_t constr_idx)
+{
+    const VolumeConstraint& constr = volConstraints[constr_idx];
+
+    ValueType* pt_coords[4] = {
+        &this->batchCoords[constr.getPoint1Index() * 3 * num_lanes],
+        &this->batchCoords[constr.getPoint2Index() * 3 * num_lanes],
+        &this->batchCoords[constr.getPoint3Index() * 3 * num_lanes],
+        &this->batchCoords[constr.getPoint4Index() * 3 * num_lanes]
+    };
+
+    for (std::size_t i = 0; i < num_lanes; i++) {
+        ValueType v_41[3];
+        ValueType v_42[3];
+        ValueType v_43[3];
+
+        for (std::size_t j = 0; j < 3; j++) {
+            ValueType pt4_coord = pt_coords[3][j * num_lanes + i];
+
+            v_41[j] = pt_coords[0][j * num_lanes + i] - pt4_coord;
+            v_42[j] = pt_coords[1][j * num_lanes + i] - pt4_coord;
+            v_43[j] = pt_coords[2][j * num_lanes + i] - pt4_coord;
+        }
+
+        ValueType deltas[4][3];
+
+        if (!calcPositionDeltas(constr, v_41, v_42, v_43, lambda, deltas))
+            continue;
+
+        for (std::size_t j = 0; j < 4; j++)
+            for (std::size_t k = 0; k < 3; k++)
+                pt_coords[j][k * num_lanes + i] += deltas[j][k];
+    }
+}
+
+template <typename T>
+bool CDPL::Util::DGCoordinatesGenerator<3, T>::calcPositionDeltas(const VolumeConstraint& constr, const ValueType v_41[], const ValueType v_42[],
+                                                                  const ValueType v_43[], const ValueType& lambda, ValueType g[][3])
+{
+    // v_4i: difference vectors of point i and point 4. If the volume is out of bounds, g receives the
+    // position deltas of the four points, otherwise false is returned
 
     g[0][0] = (v_42[1] * v_43[2] - v_42[2] * v_43[1]) / 6;
     g[0][1] = -(v_42[0] * v_43[2] - v_42[2] * v_43[0]) / 6;
@@ -877,7 +1111,7 @@ void CDPL::Util::DGCoordinatesGenerator<3, T>::adjCoordsForConstraint(const Volu
     ValueType lb  = constr.getLowerBound();
 
     if (vol >= lb && vol <= ub)
-        return;
+        return false;
 
     g[1][0] = (v_41[2] * v_43[1] - v_41[1] * v_43[2]) / 6;
     g[1][1] = (v_41[0] * v_43[2] - v_41[2] * v_43[0]) / 6;
@@ -901,7 +1135,9 @@ void CDPL::Util::DGCoordinatesGenerator<3, T>::adjCoordsForConstraint(const Volu
 
     for (std::size_t i = 0; i < 4; i++)
         for (std::size_t j = 0; j < 3; j++)
-            (*pt_pos[i])[j] += fact * g[i][j];
+            g[i][j] *= fact;
+
+    return true;
 }
 
 template <typename T>
@@ -0,0 +1,102 @@
+/* 
+ * MaxCliqueAlgorithm.hpp 
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Util::MaxCliqueAlgorithm.
+ */
+
+#ifndef CDPL_UTIL_MAXCLIQUEALGORITHM_HPP
+#define CDPL_UTIL_MAXCLIQUEALGORITHM_HPP
+
+#include <cstddef>
+
+#include "CDPL/Util/APIPrefix.hpp"
+#include "CDPL/Util/BitSet.hpp"
+#include "CDPL/Util/Array.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Util
+    {
+
+        /**
+         * \brief Branch-and-bound search for a maximum clique of an undirected graph.
+         *
+         * The implementation follows the MCQ algorithm of Tomita et al. [\ref TOMI] which uses a greedy coloring
+         * of the candidate nodes to obtain an upper bound for the size of the cliques that can be reached from a given
+         * search tree node. For graphs with up to 256 nodes the search operates on fixed-width bitsets.
+         */
+        class CDPL_UTIL_API MaxCliqueAlgorithm
+        {
+
+          public:
+            MaxCliqueAlgorithm();
+
+            MaxCliqueAlgorithm(const BitSetArray& adj_mtx, std::size_t min_clique_size = 0);
+
+            /**
+             * \brief Initializes the algorithm for the maximum clique search in the specified graph.
+             * \param adj_mtx The adjacency matrix of the graph.
+             * \param min_clique_size The minimum size a clique must have to get reported.
+             */
+            void init(const BitSetArray& adj_mtx, std::size_t min_clique_size = 0);
+
+            /**
+             * \brief Searches for a maximum clique of the graph specified in the last call to init().
+             * \param clique The bitset where the nodes of the found clique get stored.
+             * \return \c true if a clique of at least the specified minimum size could be found, and \c false otherwise.
+             */
+            bool findMaxClique(BitSet& clique);
+
+            /**
+             * \brief Returns the minimum size a clique must have to get reported.
+             * \return The minimum reported clique size.
+             */
+            std::size_t getMinCliqueSize() const;
+
+            /**
+             * \brief Returns the number of search tree nodes that have been visited in the last call to findMaxClique().
+             * \return The number of visited search tree nodes.
+             */
+            std::size_t getNumSearchNodes() const;
+
+            /**
+             * \brief Returns the number of search tree branches that have been pruned in the last call to findMaxClique().
+             * \return The number of pruned search tree branches.
+             */
+            std::size_t getNumPrunedBranches() const;
+
+          private:
+            template <typename BS>
+            bool doFindMaxClique(BitSet& clique);
+
+            const BitSetArray* adjMatrix;
+            std::size_t        minCliqueSize;
+            std::size_t        numSearchNodes;
+            std::size_t        numPrunedBranches;
+        };
+    } // namespace Util
+} // namespace CDPL
+
+#endif // CDPL_UTIL_MAXCLIQUEALGORITHM_HPP
@@ -0,0 +1,738 @@
+/* 
+ * ParallelDataReader.hpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Util::ParallelDataReader.
+ */
+
+#ifndef CDPL_UTIL_PARALLELDATAREADER_HPP
+#define CDPL_UTIL_PARALLELDATAREADER_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include <algorithm>
+
+#include "CDPL/Base/DataIOManager.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Util
+    {
+
+        /**
+         * \brief A file data reader that parses the data records of a multi-record file on a pool of worker threads.
+         *
+         * On first access, the input file gets scanned with a reader of the specified (or deduced) format to
+         * determine the byte ranges of the data records. The raw bytes of the records are then handed out to
+         * \a num_threads worker threads which decode them with private reader instances of the same format.
+         * Decoded data objects are buffered and delivered by read() strictly in the order and with the record
+         * indices of the input file. At most getMaxNumBufferedRecords() records are decoded ahead of the current
+         * record index.
+         *
+         * Control-parameters set on the \c %ParallelDataReader instance are visible to all internally used readers.
+         *
+         * Parallel decoding requires that the data records of the format can be decoded independently of each other
+         * and that the employed reader implementation is thread-safe. If \a num_threads is zero, or the reader created
+         * for the format does not read lazily from the input stream (e.g. for compressed formats), all operations are
+         * performed sequentially by a single reader instance.
+         *
+         * \tparam DataType The type of the objects holding the read data.
+         * \tparam ObjectType The type of the objects that are used for decoding the data records. Has to be
+         *         default constructible and derived from \a DataType.
+         */
+        template <typename DataType, typename ObjectType = DataType>
+        class ParallelDataReader : public Base::DataReader<DataType>
+        {
+
+          public:
+            typedef std::shared_ptr<ParallelDataReader> SharedPointer;
+
+            ParallelDataReader(const std::string& file_name, std::size_t num_threads,
+                               std::ios_base::openmode mode = std::ios_base::in | std::ios_base::binary);
+
+            ParallelDataReader(const std::string& file_name, const std::string& fmt, std::size_t num_threads,
+                               std::ios_base::openmode mode = std::ios_base::in | std::ios_base::binary);
+
+            ParallelDataReader(const std::string& file_name, const Base::DataFormat& fmt, std::size_t num_threads,
+                               std::ios_base::openmode mode = std::ios_base::in | std::ios_base::binary);
+
+            ParallelDataReader(const ParallelDataReader&) = delete;
+
+            ~ParallelDataReader();
+
+            ParallelDataReader& operator=(const ParallelDataReader&) = delete;
+
+            const Base::DataFormat& getDataFormat() const;
+
+            std::size_t getNumThreads() const;
+
+            /**
+             * \brief Tells whether the data records are decoded by worker threads.
+             * \return \c true if the data records are decoded in parallel, and \c false if the reader operates sequentially.
+             */
+            bool isParallel() const;
+
+            /**
+             * \brief Sets the maximum number of data records that may get decoded ahead of the current record index.
+             * \param max_num_recs The maximum number of buffered data records. Values smaller than the number of worker
+             *                     threads are raised to this number.
+             * \note The setting has no effect on readers operating sequentially.
+             */
+            void setMaxNumBufferedRecords(std::size_t max_num_recs);
+
+            std::size_t getMaxNumBufferedRecords() const;
+
+            ParallelDataReader& read(DataType& obj, bool overwrite = true);
+
+            ParallelDataReader& read(std::size_t idx, DataType& obj, bool overwrite = true);
+
+            ParallelDataReader& skip();
+
+            bool hasMoreData();
+
+            std::size_t getRecordIndex() const;
+
+            void setRecordIndex(std::size_t idx);
+
+            std::size_t getNumRecords();
+
+            operator const void*() const;
+
+            bool operator!() const;
+
+            void close();
+
+          private:
+            typedef typename Base::DataIOManager<DataType>::InputHandlerPointer InputHandlerPointer;
+            typedef typename Base::DataReader<DataType>::SharedPointer          ReaderPointer;
+            typedef std::unique_ptr<ObjectType>                                 ObjectPointer;
+            typedef std::vector<std::istream::pos_type>                         RecordStreamPosTable;
+
+            struct ParseResult
+            {
+
+                ObjectPointer object;
+                std::string   error;
+            };
+
+            struct Worker
+            {
+
+                std::istringstream stream;
+                std::string        recordData;
+                ReaderPointer      reader;
+                std::thread        thread;
+            };
+
+            typedef std::unordered_map<std::size_t, ParseResult> ParseResultMap;
+            typedef std::unique_ptr<Worker>                      WorkerPointer;
+            typedef std::vector<WorkerPointer>                   WorkerList;
+            typedef std::vector<ObjectPointer>                   ObjectList;
+
+            void init(const InputHandlerPointer& handler, std::size_t num_threads);
+
+            void scanRecords();
+
+            void startWorkers();
+            void stopWorkers();
+
+            void parseRecords(Worker& worker);
+
+            bool fetchRecord(std::size_t idx, std::string& data);
+
+            ObjectPointer allocObject();
+            void          freeObject(ObjectPointer&& obj);
+
+            void discardResults(std::size_t beg_idx, std::size_t end_idx);
+            void discardAllResults();
+
+            std::ifstream           stream;
+            std::string             fileName;
+            InputHandlerPointer     inputHandler;
+            Base::DataFormat        dataFormat;
+            ReaderPointer           readerPtr;
+            bool                    parallel;
+            bool                    state;
+            bool                    scanned;
+            bool                    stop;
+            std::size_t             numThreads;
+            std::size_t             maxNumBufferedRecs;
+            std::size_t             recordIdx;
+            std::size_t             nextParseIdx;
+            std::size_t             nextFetchIdx;
+            std::size_t             generation;
+            std::istream::pos_type  initStreamPos;
+            RecordStreamPosTable    recordPositions;
+            ParseResultMap          parseResults;
+            WorkerList              workers;
+            ObjectList              freeObjects;
+            std::mutex              mutex;
+            std::condition_variable workCondition;
+            std::condition_variable resultCondition;
+        };
+    } // namespace Util
+} // namespace CDPL
+
+
+// Implementation
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::ParallelDataReader(const std::string& file_name, std::size_t num_threads,
+                                                                         std::ios_base::openmode mode):
+    stream(file_name.c_str(), mode), fileName(file_name)
+{
+    InputHandlerPointer handler;
+
+    for (std::string::size_type i = file_name.find_first_of('.', 0); i != std::string::npos; i = file_name.find_first_of('.', i)) {
+        handler = Base::DataIOManager<DataType>::getInputHandlerByFileExtension(file_name.substr(++i));
+
+        if (handler)
+            break;
+    }
+
+    if (!handler)
+        throw Base::IOError("ParallelDataReader: could not deduce data format of '" + file_name + "'");
+
+    init(handler, num_threads);
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::ParallelDataReader(const std::string& file_name, const std::string& fmt,
+                                                                         std::size_t num_threads, std::ios_base::openmode mode):
+    stream(file_name.c_str(), mode), fileName(file_name)
+{
+    InputHandlerPointer handler = Base::DataIOManager<DataType>::getInputHandlerByFileExtension(fmt);
+
+    if (!handler)
+        throw Base::IOError("ParallelDataReader: could not find handler for format '" + fmt + "'");
+
+    init(handler, num_threads);
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::ParallelDataReader(const std::string& file_name, const Base::DataFormat& fmt,
+                                                                         std::size_t num_threads, std::ios_base::openmode mode):
+    stream(file_name.c_str(), mode), fileName(file_name)
+{
+    InputHandlerPointer handler = Base::DataIOManager<DataType>::getInputHandlerByFormat(fmt);
+
+    if (!handler)
+        throw Base::IOError("ParallelDataReader: could not find handler for format '" + fmt.getName() + "'");
+
+    init(handler, num_threads);
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::~ParallelDataReader()
+{
+    stopWorkers();
+}
+
+template <typename DataType, typename ObjectType>
+const CDPL::Base::DataFormat& CDPL::Util::ParallelDataReader<DataType, ObjectType>::getDataFormat() const
+{
+    return dataFormat;
+}
+
+template <typename DataType, typename ObjectType>
+std::size_t CDPL::Util::ParallelDataReader<DataType, ObjectType>::getNumThreads() const
+{
+    return numThreads;
+}
+
+template <typename DataType, typename ObjectType>
+bool CDPL::Util::ParallelDataReader<DataType, ObjectType>::isParallel() const
+{
+    return parallel;
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::setMaxNumBufferedRecords(std::size_t max_num_recs)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    maxNumBufferedRecs = std::max(max_num_recs, std::max(numThreads, std::size_t(1)));
+
+    workCondition.notify_all();
+}
+
+template <typename DataType, typename ObjectType>
+std::size_t CDPL::Util::ParallelDataReader<DataType, ObjectType>::getMaxNumBufferedRecords() const
+{
+    return maxNumBufferedRecs;
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>&
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::read(DataType& obj, bool overwrite)
+{
+    if (!parallel) {
+        try {
+            state = readerPtr->read(obj, overwrite);
+
+        } catch (const std::exception& e) {
+            state = false;
+            throw Base::IOError("ParallelDataReader: while reading file '" + fileName + "': " + e.what());
+        }
+
+        return *this;
+    }
+
+    state = false;
+
+    scanRecords();
+
+    if (recordIdx >= recordPositions.size() - 1)
+        return *this;
+
+    startWorkers();
+
+    ParseResult result;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        typename ParseResultMap::iterator it;
+
+        resultCondition.wait(lock, [&]() { return ((it = parseResults.find(recordIdx)) != parseResults.end()); });
+
+        if (!it->second.error.empty())
+            throw Base::IOError("ParallelDataReader: while reading record " + std::to_string(recordIdx) +
+                                " of file '" + fileName + "': " + it->second.error);
+
+        if (!it->second.object)
+            return *this;
+
+        result = std::move(it->second);
+
+        parseResults.erase(it);
+        recordIdx++;
+
+        workCondition.notify_all();
+    }
+
+    if (overwrite)
+        obj = static_cast<const DataType&>(*result.object);
+    else
+        obj += static_cast<const DataType&>(*result.object);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        freeObject(std::move(result.object));
+    }
+
+    state = true;
+
+    this->invokeIOCallbacks(1.0);
+
+    return *this;
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>&
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::read(std::size_t idx, DataType& obj, bool overwrite)
+{
+    setRecordIndex(idx);
+
+    return read(obj, overwrite);
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>&
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::skip()
+{
+    if (!parallel) {
+        try {
+            state = readerPtr->skip();
+
+        } catch (const std::exception& e) {
+            state = false;
+            throw Base::IOError("ParallelDataReader: while reading file '" + fileName + "': " + e.what());
+        }
+
+        return *this;
+    }
+
+    state = false;
+
+    scanRecords();
+
+    if (recordIdx >= recordPositions.size() - 1)
+        return *this;
+
+    setRecordIndex(recordIdx + 1);
+
+    state = true;
+
+    this->invokeIOCallbacks(1.0);
+
+    return *this;
+}
+
+template <typename DataType, typename ObjectType>
+bool CDPL::Util::ParallelDataReader<DataType, ObjectType>::hasMoreData()
+{
+    if (!parallel)
+        return readerPtr->hasMoreData();
+
+    scanRecords();
+
+    return (recordIdx < recordPositions.size() - 1);
+}
+
+template <typename DataType, typename ObjectType>
+std::size_t CDPL::Util::ParallelDataReader<DataType, ObjectType>::getRecordIndex() const
+{
+    if (!parallel)
+        return readerPtr->getRecordIndex();
+
+    return recordIdx;
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::setRecordIndex(std::size_t idx)
+{
+    if (!parallel) {
+        readerPtr->setRecordIndex(idx);
+        return;
+    }
+
+    scanRecords();
+
+    if (idx > recordPositions.size() - 1)
+        throw Base::IndexError("ParallelDataReader: record index out of bounds");
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (idx == recordIdx)
+        return;
+
+    if (idx > recordIdx && idx <= nextParseIdx) {
+        discardResults(recordIdx, idx);
+
+    } else {
+        discardAllResults();
+
+        generation++;
+        nextParseIdx = idx;
+    }
+
+    recordIdx = idx;
+
+    workCondition.notify_all();
+}
+
+template <typename DataType, typename ObjectType>
+std::size_t CDPL::Util::ParallelDataReader<DataType, ObjectType>::getNumRecords()
+{
+    if (!parallel)
+        return readerPtr->getNumRecords();
+
+    scanRecords();
+
+    return (recordPositions.size() - 1);
+}
+
+template <typename DataType, typename ObjectType>
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::operator const void*() const
+{
+    return (state ? this : 0);
+}
+
+template <typename DataType, typename ObjectType>
+bool CDPL::Util::ParallelDataReader<DataType, ObjectType>::operator!() const
+{
+    return !state;
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::close()
+{
+    stopWorkers();
+
+    readerPtr->close();
+    stream.close();
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::init(const InputHandlerPointer& handler, std::size_t num_threads)
+{
+    inputHandler       = handler;
+    dataFormat         = handler->getDataFormat();
+    state              = stream.good();
+    scanned            = false;
+    stop               = false;
+    numThreads         = num_threads;
+    maxNumBufferedRecs = num_threads * 16;
+    recordIdx          = 0;
+    nextParseIdx       = 0;
+    nextFetchIdx       = 0;
+    generation         = 0;
+    initStreamPos      = stream.tellg();
+
+    readerPtr = handler->createReader(stream);
+    readerPtr->setParent(this);
+
+    // readers that consume the input stream up-front (e.g. decompressing readers) do not allow to
+    // locate the data records in the file and are used sequentially
+
+    parallel = (num_threads > 0 && stream.good() && stream.tellg() == initStreamPos);
+
+    if (!parallel)
+        readerPtr->registerIOCallback(std::bind(&Base::DataIOBase::invokeIOCallbacks, this, std::placeholders::_2));
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::scanRecords()
+{
+    if (scanned)
+        return;
+
+    scanned = true;
+
+    stream.clear();
+    stream.seekg(0, std::ios_base::end);
+
+    std::istream::pos_type end_pos = stream.tellg();
+
+    stream.seekg(initStreamPos);
+
+    std::istream::pos_type record_end_pos = initStreamPos;
+
+    try {
+        while (readerPtr->hasMoreData()) {
+            std::istream::pos_type record_pos = stream.tellg();
+
+            if (!readerPtr->skip())
+                break;
+
+            recordPositions.push_back(record_pos);
+
+            stream.clear(stream.rdstate() & ~std::ios_base::eofbit);
+
+            record_end_pos = stream.tellg();
+
+            if (record_end_pos == std::istream::pos_type(-1))
+                record_end_pos = end_pos;
+
+            this->invokeIOCallbacks(record_pos / double(end_pos));
+        }
+
+    } catch (...) {
+        recordPositions.push_back(record_end_pos);
+        throw;
+    }
+
+    recordPositions.push_back(record_end_pos);
+
+    this->invokeIOCallbacks(1.0);
+
+    stream.clear();
+    stream.seekg(initStreamPos);
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::startWorkers()
+{
+    if (!workers.empty())
+        return;
+
+    try {
+        for (std::size_t i = 0; i < numThreads; i++) {
+            WorkerPointer worker(new Worker());
+
+            worker->reader = inputHandler->createReader(worker->stream);
+            worker->reader->setParent(this);
+
+            workers.push_back(std::move(worker));
+        }
+
+        for (auto& worker : workers)
+            worker->thread = std::thread(&ParallelDataReader::parseRecords, this, std::ref(*worker));
+
+    } catch (...) {
+        stopWorkers();
+        throw;
+    }
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        stop = true;
+        workCondition.notify_all();
+    }
+
+    for (auto& worker : workers)
+        if (worker->thread.joinable())
+            worker->thread.join();
+
+    for (auto& worker : workers)
+        worker->reader->setParent(0);
+
+    workers.clear();
+    stop = false;
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::parseRecords(Worker& worker)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+        workCondition.wait(lock, [this]() {
+            return (stop || (nextParseIdx < recordPositions.size() - 1 && nextParseIdx < recordIdx + maxNumBufferedRecs));
+        });
+
+        if (stop)
+            return;
+
+        std::size_t idx = nextParseIdx++;
+        std::size_t gen = generation;
+        ParseResult result;
+        bool        have_data = false;
+
+        try {
+            if (!fetchRecord(idx, worker.recordData))
+                throw Base::IOError("could not read record data");
+
+            result.object = allocObject();
+
+            lock.unlock();
+
+            worker.stream.clear();
+            worker.stream.str(worker.recordData);
+
+            have_data = worker.reader->read(*result.object);
+
+        } catch (const std::exception& e) {
+            result.error = e.what();
+
+        } catch (...) {
+            result.error = "unspecified error";
+        }
+
+        if (!lock.owns_lock())
+            lock.lock();
+
+        if (result.object && !have_data)
+            freeObject(std::move(result.object));
+
+        if (gen != generation || idx < recordIdx) {
+            if (result.object)
+                freeObject(std::move(result.object));
+
+            continue;
+        }
+
+        parseResults[idx] = std::move(result);
+        resultCondition.notify_all();
+    }
+}
+
+template <typename DataType, typename ObjectType>
+bool CDPL::Util::ParallelDataReader<DataType, ObjectType>::fetchRecord(std::size_t idx, std::string& data)
+{
+    if (idx != nextFetchIdx) {
+        stream.clear();
+        stream.seekg(recordPositions[idx]);
+    }
+
+    nextFetchIdx = idx + 1;
+
+    data.resize(std::size_t(recordPositions[idx + 1] - recordPositions[idx]));
+
+    if (data.empty())
+        return true;
+
+    if (!stream.read(&data[0], data.size())) {
+        nextFetchIdx = recordPositions.size();
+        return false;
+    }
+
+    return true;
+}
+
+template <typename DataType, typename ObjectType>
+typename CDPL::Util::ParallelDataReader<DataType, ObjectType>::ObjectPointer
+CDPL::Util::ParallelDataReader<DataType, ObjectType>::allocObject()
+{
+    if (freeObjects.empty())
+        return ObjectPointer(new ObjectType());
+
+    ObjectPointer obj = std::move(freeObjects.back());
+
+    freeObjects.pop_back();
+
+    return obj;
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::freeObject(ObjectPointer&& obj)
+{
+    freeObjects.push_back(std::move(obj));
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::discardResults(std::size_t beg_idx, std::size_t end_idx)
+{
+    for ( ; beg_idx < end_idx; beg_idx++) {
+        typename ParseResultMap::iterator it = parseResults.find(beg_idx);
+
+        if (it == parseResults.end())
+            continue;
+
+        if (it->second.object)
+            freeObject(std::move(it->second.object));
+
+        parseResults.erase(it);
+    }
+}
+
+template <typename DataType, typename ObjectType>
+void CDPL::Util::ParallelDataReader<DataType, ObjectType>::discardAllResults()
+{
+    for (auto& entry : parseResults)
+        if (entry.second.object)
+            freeObject(std::move(entry.second.object));
+
+    parseResults.clear();
+}
+
+#endif // CDPL_UTIL_PARALLELDATAREADER_HPP
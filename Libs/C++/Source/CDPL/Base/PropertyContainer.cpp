@@ -30,7 +30,14 @@
 using namespace CDPL;
 
 
-Base::PropertyContainer::PropertyContainer(const PropertyContainer& cntnr): properties(cntnr.properties) {}
+unsigned char Base::PropertyContainer::fastAccessKeySlots[MAX_FAST_ACCESS_KEY_ID] = {};
+std::size_t   Base::PropertyContainer::numFastAccessKeys                          = 0;
+
+
+Base::PropertyContainer::PropertyContainer(const PropertyContainer& cntnr): properties(cntnr.properties)
+{
+    updateFastAccessSlots();
+}
 
 Base::PropertyContainer::~PropertyContainer() {}
 
@@ -61,12 +68,24 @@ Base::PropertyContainer::ConstPropertyIterator Base::PropertyContainer::end() co
 
 bool Base::PropertyContainer::removeProperty(const LookupKey& key)
 {
-    return (properties.erase(key) > 0);
+    if (properties.erase(key) == 0)
+        return false;
+
+    if (!fastAccessSlots)
+        return true;
+
+    if (std::size_t slot = getFastAccessSlot(key))
+        (*fastAccessSlots)[slot - 1] = 0;
+
+    return true;
 }
 
 void Base::PropertyContainer::clearProperties()
 {
     properties.clear();
+
+    if (fastAccessSlots)
+        fastAccessSlots->fill(0);
 }
 
 void Base::PropertyContainer::addProperties(const PropertyContainer& cntnr)
@@ -79,8 +98,12 @@ void Base::PropertyContainer::addProperties(const PropertyContainer& cntnr)
     for (PropertyMap::const_iterator it = cntnr.properties.begin(); it != cntnr_props_end; ++it) {
         const Any& val = it->second;
         const LookupKey& key = it->first;
+        Any& entry_val = properties[key];
 
-        properties[key] = val;
+        entry_val = val;
+
+        if (std::size_t slot = getFastAccessSlot(key))
+            setFastAccessSlot(slot - 1, &entry_val);
     }
 }
 
@@ -90,11 +113,14 @@ void Base::PropertyContainer::copyProperties(const PropertyContainer& cntnr)
         return;
 
     properties = cntnr.properties;
+
+    updateFastAccessSlots();
 }
 
 void Base::PropertyContainer::swap(PropertyContainer& cntnr)
 {
     properties.swap(cntnr.properties);
+    fastAccessSlots.swap(cntnr.fastAccessSlots);
 }
 
 Base::PropertyContainer& Base::PropertyContainer::operator=(const PropertyContainer& cntnr)
@@ -106,3 +132,42 @@ Base::PropertyContainer& Base::PropertyContainer::operator=(const PropertyContai
 
     return *this;
 }
+
+bool Base::PropertyContainer::registerFastAccessKey(const LookupKey& key)
+{
+    if (key.getID() >= MAX_FAST_ACCESS_KEY_ID || numFastAccessKeys >= MAX_NUM_FAST_ACCESS_KEYS)
+        return false;
+
+    if (fastAccessKeySlots[key.getID()] != 0)
+        return false;
+
+    fastAccessKeySlots[key.getID()] = ++numFastAccessKeys;
+
+    return true;
+}
+
+bool Base::PropertyContainer::isFastAccessKey(const LookupKey& key)
+{
+    return (getFastAccessSlot(key) != 0);
+}
+
+void Base::PropertyContainer::setFastAccessSlot(std::size_t slot, const Any* val)
+{
+    if (!fastAccessSlots)
+        fastAccessSlots.reset(new FastAccessSlotArray());
+
+    (*fastAccessSlots)[slot] = val;
+}
+
+void Base::PropertyContainer::updateFastAccessSlots()
+{
+    if (fastAccessSlots)
+        fastAccessSlots->fill(0);
+
+    if (numFastAccessKeys == 0)
+        return;
+
+    for (PropertyMap::const_iterator it = properties.begin(), end = properties.end(); it != end; ++it)
+        if (std::size_t slot = getFastAccessSlot(it->first))
+            setFastAccessSlot(slot - 1, &it->second);
+}
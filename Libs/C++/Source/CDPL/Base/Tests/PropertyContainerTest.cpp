@@ -896,3 +896,112 @@ BOOST_AUTO_TEST_CASE(PropertyContainerTest)
     BOOST_CHECK(prop_cntnr3.getProperty(key7).getData<char>() == '7');
 }
 
+
+BOOST_AUTO_TEST_CASE(PropertyContainerFastAccessKeyTest)
+{
+    using namespace CDPL;
+    using namespace Base;
+
+    LookupKey fa_key1 = LookupKey::create("fa_key1");
+    LookupKey fa_key2 = LookupKey::create("fa_key2");
+    LookupKey key3 = LookupKey::create("key3");
+    LookupKey fa_key4 = LookupKey::create("fa_key4");
+
+    BOOST_CHECK(!PropertyContainer::isFastAccessKey(fa_key1));
+
+    TestPropertyContainer prop_cntnr0;
+
+    prop_cntnr0.setProperty(fa_key4, 4);
+
+    BOOST_CHECK(PropertyContainer::registerFastAccessKey(fa_key4));
+
+    BOOST_CHECK(prop_cntnr0.getNumProperties() == 1);
+    BOOST_CHECK(prop_cntnr0.removeProperty(fa_key4));
+    BOOST_CHECK(!prop_cntnr0.isPropertySet(fa_key4));
+    BOOST_CHECK(prop_cntnr0.getNumProperties() == 0);
+
+    BOOST_CHECK(PropertyContainer::registerFastAccessKey(fa_key1));
+    BOOST_CHECK(PropertyContainer::registerFastAccessKey(fa_key2));
+    BOOST_CHECK(!PropertyContainer::registerFastAccessKey(fa_key1));
+
+    BOOST_CHECK(PropertyContainer::isFastAccessKey(fa_key1));
+    BOOST_CHECK(PropertyContainer::isFastAccessKey(fa_key2));
+    BOOST_CHECK(!PropertyContainer::isFastAccessKey(key3));
+
+//-----
+
+    TestPropertyContainer prop_cntnr1;
+
+    BOOST_CHECK(!prop_cntnr1.isPropertySet(fa_key1));
+    BOOST_CHECK(prop_cntnr1.getProperty(fa_key1, false).isEmpty());
+    BOOST_CHECK_THROW(prop_cntnr1.getProperty(fa_key1, true), ItemNotFound);
+
+    prop_cntnr1.setProperty(fa_key1, 1);
+    prop_cntnr1.setProperty(fa_key2, std::string("value2"));
+    prop_cntnr1.setProperty(key3, 3.0);
+
+    BOOST_CHECK(prop_cntnr1.getNumProperties() == 3);
+    BOOST_CHECK(std::distance(prop_cntnr1.getPropertiesBegin(), prop_cntnr1.getPropertiesEnd()) == 3);
+
+    BOOST_CHECK(prop_cntnr1.isPropertySet(fa_key1));
+    BOOST_CHECK(prop_cntnr1.getProperty<int>(fa_key1) == 1);
+    BOOST_CHECK(prop_cntnr1.getProperty<std::string>(fa_key2) == "value2");
+    BOOST_CHECK(prop_cntnr1.getProperty<double>(key3) == 3.0);
+
+    prop_cntnr1.setProperty(fa_key1, 2);
+
+    BOOST_CHECK(prop_cntnr1.getProperty<int>(fa_key1) == 2);
+    BOOST_CHECK(prop_cntnr1.getNumProperties() == 3);
+
+//-----
+
+    TestPropertyContainer prop_cntnr2(prop_cntnr1);
+
+    prop_cntnr1.setProperty(fa_key1, 3);
+
+    BOOST_CHECK(prop_cntnr2.getProperty<int>(fa_key1) == 2);
+    BOOST_CHECK(prop_cntnr1.getProperty<int>(fa_key1) == 3);
+
+    BOOST_CHECK(prop_cntnr1.removeProperty(fa_key1));
+    BOOST_CHECK(!prop_cntnr1.removeProperty(fa_key1));
+
+    BOOST_CHECK(!prop_cntnr1.isPropertySet(fa_key1));
+    BOOST_CHECK(prop_cntnr1.getPropertyOrDefault<int>(fa_key1, -1) == -1);
+    BOOST_CHECK(prop_cntnr2.isPropertySet(fa_key1));
+
+    prop_cntnr1.setProperty(fa_key2, Any());
+
+    BOOST_CHECK(!prop_cntnr1.isPropertySet(fa_key2));
+    BOOST_CHECK(prop_cntnr1.getNumProperties() == 1);
+
+//-----
+
+    prop_cntnr2 = prop_cntnr1;
+
+    BOOST_CHECK(!prop_cntnr2.isPropertySet(fa_key1));
+    BOOST_CHECK(!prop_cntnr2.isPropertySet(fa_key2));
+    BOOST_CHECK(prop_cntnr2.getProperty<double>(key3) == 3.0);
+
+    prop_cntnr1.setProperty(fa_key1, 4);
+
+    for (std::size_t i = 0; i < 500; i++)
+        prop_cntnr1.setProperty(LookupKey::create("key"), i);
+
+    BOOST_CHECK(prop_cntnr1.getProperty<int>(fa_key1) == 4);
+
+    prop_cntnr1.swap(prop_cntnr2);
+
+    BOOST_CHECK(!prop_cntnr1.isPropertySet(fa_key1));
+    BOOST_CHECK(prop_cntnr2.getProperty<int>(fa_key1) == 4);
+
+    prop_cntnr1.addProperties(prop_cntnr2);
+
+    BOOST_CHECK(prop_cntnr1.getProperty<int>(fa_key1) == 4);
+    BOOST_CHECK(prop_cntnr1.getNumProperties() == 502);
+
+    prop_cntnr1.clearProperties();
+
+    BOOST_CHECK(!prop_cntnr1.isPropertySet(fa_key1));
+    BOOST_CHECK(prop_cntnr1.getNumProperties() == 0);
+    BOOST_CHECK(prop_cntnr2.getProperty<int>(fa_key1) == 4);
+}
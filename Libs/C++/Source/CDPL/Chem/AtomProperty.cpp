@@ -26,6 +26,7 @@
 
 #include "CDPL/Chem/AtomProperty.hpp"
 #include "CDPL/Base/LookupKeyDefinition.hpp"
+#include "CDPL/Base/PropertyContainer.hpp"
 
 
 namespace CDPL 
@@ -88,3 +89,30 @@ namespace CDPL
         void initAtomProperties() {}
     }
 }
+
+
+namespace
+{
+
+    struct FastAccessKeyRegistration
+    {
+
+        FastAccessKeyRegistration()
+        {
+            using namespace CDPL;
+
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::SYMBOL);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::TYPE);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::FORMAL_CHARGE);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::ISOTOPE);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::HYBRIDIZATION);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::RING_FLAG);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::AROMATICITY_FLAG);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::UNPAIRED_ELECTRON_COUNT);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::IMPLICIT_HYDROGEN_COUNT);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::STEREO_DESCRIPTOR);
+            Base::PropertyContainer::registerFastAccessKey(Chem::AtomProperty::MATCH_CONSTRAINTS);
+        }
+
+    } fastAccessKeyRegistration;
+}
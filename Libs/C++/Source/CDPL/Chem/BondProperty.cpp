@@ -26,6 +26,7 @@
 
 #include "CDPL/Chem/BondProperty.hpp"
 #include "CDPL/Base/LookupKeyDefinition.hpp"
+#include "CDPL/Base/PropertyContainer.hpp"
 
 
 namespace CDPL 
@@ -59,3 +60,24 @@ namespace CDPL
         void initBondProperties() {}
     }
 }
+
+
+namespace
+{
+
+    struct FastAccessKeyRegistration
+    {
+
+        FastAccessKeyRegistration()
+        {
+            using namespace CDPL;
+
+            Base::PropertyContainer::registerFastAccessKey(Chem::BondProperty::ORDER);
+            Base::PropertyContainer::registerFastAccessKey(Chem::BondProperty::RING_FLAG);
+            Base::PropertyContainer::registerFastAccessKey(Chem::BondProperty::AROMATICITY_FLAG);
+            Base::PropertyContainer::registerFastAccessKey(Chem::BondProperty::STEREO_DESCRIPTOR);
+            Base::PropertyContainer::registerFastAccessKey(Chem::BondProperty::MATCH_CONSTRAINTS);
+        }
+
+    } fastAccessKeyRegistration;
+}
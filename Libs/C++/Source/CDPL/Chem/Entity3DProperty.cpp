@@ -26,6 +26,7 @@
 
 #include "CDPL/Chem/Entity3DProperty.hpp"
 #include "CDPL/Base/LookupKeyDefinition.hpp"
+#include "CDPL/Base/PropertyContainer.hpp"
 
 
 namespace CDPL 
@@ -43,3 +44,20 @@ namespace CDPL
         void initEntity3DProperties() {}
     }
 }
+
+
+namespace
+{
+
+    struct FastAccessKeyRegistration
+    {
+
+        FastAccessKeyRegistration()
+        {
+            using namespace CDPL;
+
+            Base::PropertyContainer::registerFastAccessKey(Chem::Entity3DProperty::COORDINATES_3D);
+        }
+
+    } fastAccessKeyRegistration;
+}
@@ -0,0 +1,749 @@
+/*
+ * FrozenMolecule.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "StaticInit.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "CDPL/Chem/FrozenMolecule.hpp"
+#include "CDPL/Chem/Atom.hpp"
+#include "CDPL/Chem/Bond.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/BondFunctions.hpp"
+#include "CDPL/Chem/Entity3DFunctions.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+using namespace CDPL;
+
+
+class Chem::FrozenMolecule::AtomImpl : public Atom
+{
+
+  public:
+    AtomImpl(FrozenMolecule* mol, std::size_t idx):
+        molecule(mol), index(idx) {}
+
+    ~AtomImpl() {}
+
+    const Molecule& getMolecule() const
+    {
+        return *molecule;
+    }
+
+    Molecule& getMolecule()
+    {
+        return *molecule;
+    }
+
+    const Bond& getBondToAtom(const Atom& atom) const
+    {
+        const Bond* bond = findBondToAtom(atom);
+
+        if (!bond)
+            throw Base::ItemNotFound("FrozenMolecule: argument atom is not a bonded neighbor");
+
+        return *bond;
+    }
+
+    Bond& getBondToAtom(const Atom& atom)
+    {
+        Bond* bond = findBondToAtom(atom);
+
+        if (!bond)
+            throw Base::ItemNotFound("FrozenMolecule: argument atom is not a bonded neighbor");
+
+        return *bond;
+    }
+
+    const Bond* findBondToAtom(const Atom& atom) const;
+
+    Bond* findBondToAtom(const Atom& atom);
+
+    std::size_t getIndex() const
+    {
+        return index;
+    }
+
+    std::size_t getNumAtoms() const
+    {
+        return (getListEnd() - getListBegin());
+    }
+
+    std::size_t getNumBonds() const
+    {
+        return (getListEnd() - getListBegin());
+    }
+
+    const Bond& getBond(std::size_t idx) const;
+
+    Bond& getBond(std::size_t idx);
+
+    const Atom& getAtom(std::size_t idx) const
+    {
+        return molecule->atoms[molecule->nbrAtomIndices.getData()[getListIndex(idx, "FrozenMolecule: atom index out of bounds")]];
+    }
+
+    Atom& getAtom(std::size_t idx)
+    {
+        return molecule->atoms[molecule->nbrAtomIndices.getData()[getListIndex(idx, "FrozenMolecule: atom index out of bounds")]];
+    }
+
+    bool containsAtom(const Atom& atom) const
+    {
+        return (findNeighbor(atom) != NOT_FOUND);
+    }
+
+    bool containsBond(const Bond& bond) const
+    {
+        return (findBond(bond) != NOT_FOUND);
+    }
+
+    std::size_t getAtomIndex(const Atom& atom) const
+    {
+        std::size_t list_idx = findNeighbor(atom);
+
+        if (list_idx == NOT_FOUND)
+            throw Base::ItemNotFound("FrozenMolecule: argument atom not found");
+
+        return (list_idx - getListBegin());
+    }
+
+    std::size_t getBondIndex(const Bond& bond) const
+    {
+        std::size_t list_idx = findBond(bond);
+
+        if (list_idx == NOT_FOUND)
+            throw Base::ItemNotFound("FrozenMolecule: argument bond not found");
+
+        return (list_idx - getListBegin());
+    }
+
+    void orderAtoms(const AtomCompareFunction& func)
+    {
+        orderNeighbors([&](const NeighborEntry& entry1, const NeighborEntry& entry2) -> bool {
+            return func(molecule->atoms[entry1.first], molecule->atoms[entry2.first]);
+        });
+    }
+
+    void orderBonds(const BondCompareFunction& func);
+
+    using Atom::operator=;
+
+  private:
+    typedef std::pair<std::size_t, std::size_t> NeighborEntry;
+
+    static constexpr std::size_t NOT_FOUND = ~std::size_t(0);
+
+    std::size_t getListBegin() const
+    {
+        return molecule->nbrOffsets.getData()[index];
+    }
+
+    std::size_t getListEnd() const
+    {
+        return molecule->nbrOffsets.getData()[index + 1];
+    }
+
+    std::size_t getListIndex(std::size_t idx, const char* err_msg) const
+    {
+        std::size_t list_idx = getListBegin() + idx;
+
+        if (list_idx >= getListEnd())
+            throw Base::IndexError(err_msg);
+
+        return list_idx;
+    }
+
+    std::size_t findNeighbor(const Atom& atom) const
+    {
+        if (&atom.getMolecule() != molecule)
+            return NOT_FOUND;
+
+        const Util::STArray::StorageType& nbr_atoms = molecule->nbrAtomIndices.getData();
+        std::size_t atom_idx = atom.getIndex();
+
+        for (std::size_t i = getListBegin(), end = getListEnd(); i < end; i++)
+            if (nbr_atoms[i] == atom_idx)
+                return i;
+
+        return NOT_FOUND;
+    }
+
+    std::size_t findBond(const Bond& bond) const
+    {
+        if (&bond.getMolecule() != molecule)
+            return NOT_FOUND;
+
+        const Util::STArray::StorageType& nbr_bonds = molecule->nbrBondIndices.getData();
+        std::size_t bond_idx = bond.getIndex();
+
+        for (std::size_t i = getListBegin(), end = getListEnd(); i < end; i++)
+            if (nbr_bonds[i] == bond_idx)
+                return i;
+
+        return NOT_FOUND;
+    }
+
+    template <typename Comp>
+    void orderNeighbors(const Comp& comp)
+    {
+        Util::STArray::StorageType& nbr_atoms = molecule->nbrAtomIndices.getData();
+        Util::STArray::StorageType& nbr_bonds = molecule->nbrBondIndices.getData();
+        std::size_t                 list_beg = getListBegin();
+        std::size_t                 list_end = getListEnd();
+
+        std::vector<NeighborEntry> entries;
+
+        entries.reserve(list_end - list_beg);
+
+        for (std::size_t i = list_beg; i < list_end; i++)
+            entries.emplace_back(nbr_atoms[i], nbr_bonds[i]);
+
+        std::stable_sort(entries.begin(), entries.end(), comp);
+
+        for (std::size_t i = list_beg; i < list_end; i++) {
+            nbr_atoms[i] = entries[i - list_beg].first;
+            nbr_bonds[i] = entries[i - list_beg].second;
+        }
+    }
+
+    FrozenMolecule* molecule;
+    std::size_t     index;
+};
+
+
+class Chem::FrozenMolecule::BondImpl : public Bond
+{
+
+  public:
+    BondImpl(FrozenMolecule* mol, std::size_t idx, std::size_t beg_atom_idx, std::size_t end_atom_idx):
+        molecule(mol), index(idx), atomIndices{beg_atom_idx, end_atom_idx} {}
+
+    ~BondImpl() {}
+
+    const Molecule& getMolecule() const
+    {
+        return *molecule;
+    }
+
+    Molecule& getMolecule()
+    {
+        return *molecule;
+    }
+
+    const Atom& getBegin() const
+    {
+        return molecule->atoms[atomIndices[0]];
+    }
+
+    Atom& getBegin()
+    {
+        return molecule->atoms[atomIndices[0]];
+    }
+
+    const Atom& getEnd() const
+    {
+        return molecule->atoms[atomIndices[1]];
+    }
+
+    Atom& getEnd()
+    {
+        return molecule->atoms[atomIndices[1]];
+    }
+
+    const Atom& getNeighbor(const Atom& atom) const
+    {
+        return molecule->atoms[atomIndices[1 - getAtomIndex(atom)]];
+    }
+
+    Atom& getNeighbor(const Atom& atom)
+    {
+        return molecule->atoms[atomIndices[1 - getAtomIndex(atom)]];
+    }
+
+    std::size_t getIndex() const
+    {
+        return index;
+    }
+
+    std::size_t getNumAtoms() const
+    {
+        return 2;
+    }
+
+    const Atom& getAtom(std::size_t idx) const
+    {
+        if (idx > 1)
+            throw Base::IndexError("FrozenMolecule: atom index out of bounds");
+
+        return molecule->atoms[atomIndices[idx]];
+    }
+
+    Atom& getAtom(std::size_t idx)
+    {
+        if (idx > 1)
+            throw Base::IndexError("FrozenMolecule: atom index out of bounds");
+
+        return molecule->atoms[atomIndices[idx]];
+    }
+
+    bool containsAtom(const Atom& atom) const
+    {
+        if (&atom.getMolecule() != molecule)
+            return false;
+
+        return (atom.getIndex() == atomIndices[0] || atom.getIndex() == atomIndices[1]);
+    }
+
+    std::size_t getAtomIndex(const Atom& atom) const
+    {
+        if (&atom.getMolecule() == molecule) {
+            if (atom.getIndex() == atomIndices[0])
+                return 0;
+
+            if (atom.getIndex() == atomIndices[1])
+                return 1;
+        }
+
+        throw Base::ItemNotFound("FrozenMolecule: argument atom not a member");
+    }
+
+    void orderAtoms(const AtomCompareFunction& func)
+    {
+        if (func(getBegin(), getEnd()))
+            return;
+
+        std::swap(atomIndices[0], atomIndices[1]);
+    }
+
+    using Bond::operator=;
+
+  private:
+    FrozenMolecule* molecule;
+    std::size_t     index;
+    std::size_t     atomIndices[2];
+};
+
+
+const Chem::Bond* Chem::FrozenMolecule::AtomImpl::findBondToAtom(const Atom& atom) const
+{
+    std::size_t list_idx = findNeighbor(atom);
+
+    if (list_idx == NOT_FOUND)
+        return 0;
+
+    return &molecule->bonds[molecule->nbrBondIndices.getData()[list_idx]];
+}
+
+Chem::Bond* Chem::FrozenMolecule::AtomImpl::findBondToAtom(const Atom& atom)
+{
+    std::size_t list_idx = findNeighbor(atom);
+
+    if (list_idx == NOT_FOUND)
+        return 0;
+
+    return &molecule->bonds[molecule->nbrBondIndices.getData()[list_idx]];
+}
+
+const Chem::Bond& Chem::FrozenMolecule::AtomImpl::getBond(std::size_t idx) const
+{
+    return molecule->bonds[molecule->nbrBondIndices.getData()[getListIndex(idx, "FrozenMolecule: bond index out of bounds")]];
+}
+
+Chem::Bond& Chem::FrozenMolecule::AtomImpl::getBond(std::size_t idx)
+{
+    return molecule->bonds[molecule->nbrBondIndices.getData()[getListIndex(idx, "FrozenMolecule: bond index out of bounds")]];
+}
+
+void Chem::FrozenMolecule::AtomImpl::orderBonds(const BondCompareFunction& func)
+{
+    orderNeighbors([&](const NeighborEntry& entry1, const NeighborEntry& entry2) -> bool {
+        return func(molecule->bonds[entry1.second], molecule->bonds[entry2.second]);
+    });
+}
+
+
+Chem::FrozenMolecule::FrozenMolecule()
+{
+    clearAtomsAndBonds();
+}
+
+Chem::FrozenMolecule::FrozenMolecule(const FrozenMolecule& mol):
+    Molecule(mol)
+{
+    build(mol);
+    invokeCopyPostprocessingFunctions(mol);
+}
+
+Chem::FrozenMolecule::FrozenMolecule(const MolecularGraph& molgraph)
+{
+    build(molgraph);
+    copyProperties(molgraph);
+    invokeCopyPostprocessingFunctions(molgraph);
+}
+
+Chem::FrozenMolecule::~FrozenMolecule() {}
+
+void Chem::FrozenMolecule::clear()
+{
+    clearAtomsAndBonds();
+    clearProperties();
+}
+
+std::size_t Chem::FrozenMolecule::getNumAtoms() const
+{
+    return atoms.size();
+}
+
+std::size_t Chem::FrozenMolecule::getNumBonds() const
+{
+    return bonds.size();
+}
+
+const Chem::Atom& Chem::FrozenMolecule::getAtom(std::size_t idx) const
+{
+    if (idx >= atoms.size())
+        throw Base::IndexError("FrozenMolecule: atom index out of bounds");
+
+    return atoms[idx];
+}
+
+Chem::Atom& Chem::FrozenMolecule::getAtom(std::size_t idx)
+{
+    if (idx >= atoms.size())
+        throw Base::IndexError("FrozenMolecule: atom index out of bounds");
+
+    return atoms[idx];
+}
+
+Chem::Atom& Chem::FrozenMolecule::addAtom()
+{
+    throw Base::OperationFailed("FrozenMolecule: atoms cannot be added");
+}
+
+void Chem::FrozenMolecule::removeAtom(std::size_t idx)
+{
+    throw Base::OperationFailed("FrozenMolecule: atoms cannot be removed");
+}
+
+const Chem::Bond& Chem::FrozenMolecule::getBond(std::size_t idx) const
+{
+    if (idx >= bonds.size())
+        throw Base::IndexError("FrozenMolecule: bond index out of bounds");
+
+    return bonds[idx];
+}
+
+Chem::Bond& Chem::FrozenMolecule::getBond(std::size_t idx)
+{
+    if (idx >= bonds.size())
+        throw Base::IndexError("FrozenMolecule: bond index out of bounds");
+
+    return bonds[idx];
+}
+
+Chem::Bond& Chem::FrozenMolecule::addBond(std::size_t atom1_idx, std::size_t atom2_idx)
+{
+    throw Base::OperationFailed("FrozenMolecule: bonds cannot be added");
+}
+
+void Chem::FrozenMolecule::removeBond(std::size_t idx)
+{
+    throw Base::OperationFailed("FrozenMolecule: bonds cannot be removed");
+}
+
+bool Chem::FrozenMolecule::containsAtom(const Atom& atom) const
+{
+    if (this != &atom.getMolecule())
+        return false;
+
+    return (atom.getIndex() < atoms.size());
+}
+
+bool Chem::FrozenMolecule::containsBond(const Bond& bond) const
+{
+    if (this != &bond.getMolecule())
+        return false;
+
+    return (bond.getIndex() < bonds.size());
+}
+
+std::size_t Chem::FrozenMolecule::getAtomIndex(const Atom& atom) const
+{
+    if (this != &atom.getMolecule() || atom.getIndex() >= atoms.size())
+        throw Base::ItemNotFound("FrozenMolecule: argument atom not part of the molecule");
+
+    return atom.getIndex();
+}
+
+std::size_t Chem::FrozenMolecule::getBondIndex(const Bond& bond) const
+{
+    if (this != &bond.getMolecule() || bond.getIndex() >= bonds.size())
+        throw Base::ItemNotFound("FrozenMolecule: argument bond not part of the molecule");
+
+    return bond.getIndex();
+}
+
+void Chem::FrozenMolecule::orderAtoms(const AtomCompareFunction& func)
+{
+    throw Base::OperationFailed("FrozenMolecule: atoms cannot be reordered");
+}
+
+void Chem::FrozenMolecule::orderBonds(const BondCompareFunction& func)
+{
+    throw Base::OperationFailed("FrozenMolecule: bonds cannot be reordered");
+}
+
+Chem::FrozenMolecule& Chem::FrozenMolecule::operator=(const FrozenMolecule& mol)
+{
+    if (this == &mol)
+        return *this;
+
+    copy(mol);
+
+    return *this;
+}
+
+Chem::MolecularGraph::SharedPointer Chem::FrozenMolecule::clone() const
+{
+    return MolecularGraph::SharedPointer(new FrozenMolecule(*this));
+}
+
+void Chem::FrozenMolecule::copy(const FrozenMolecule& mol)
+{
+    copy(static_cast<const MolecularGraph&>(mol));
+}
+
+void Chem::FrozenMolecule::copy(const Molecule& mol)
+{
+    copy(static_cast<const MolecularGraph&>(mol));
+}
+
+void Chem::FrozenMolecule::copy(const MolecularGraph& molgraph)
+{
+    if (this == &molgraph)
+        return;
+
+    build(molgraph);
+    copyProperties(molgraph);
+    invokeCopyPostprocessingFunctions(molgraph);
+}
+
+void Chem::FrozenMolecule::append(const Molecule& mol)
+{
+    throw Base::OperationFailed("FrozenMolecule: atoms and bonds cannot be appended");
+}
+
+void Chem::FrozenMolecule::append(const MolecularGraph& molgraph)
+{
+    throw Base::OperationFailed("FrozenMolecule: atoms and bonds cannot be appended");
+}
+
+void Chem::FrozenMolecule::remove(const MolecularGraph& molgraph)
+{
+    throw Base::OperationFailed("FrozenMolecule: atoms and bonds cannot be removed");
+}
+
+const Util::STArray& Chem::FrozenMolecule::getNeighborOffsets() const
+{
+    return nbrOffsets;
+}
+
+const Util::STArray& Chem::FrozenMolecule::getNeighborAtomIndices() const
+{
+    return nbrAtomIndices;
+}
+
+const Util::STArray& Chem::FrozenMolecule::getNeighborBondIndices() const
+{
+    return nbrBondIndices;
+}
+
+const Util::UIArray& Chem::FrozenMolecule::getAtomTypes() const
+{
+    return atomTypes;
+}
+
+const Util::LArray& Chem::FrozenMolecule::getAtomFormalCharges() const
+{
+    return atomCharges;
+}
+
+const Util::STArray& Chem::FrozenMolecule::getAtomImplicitHydrogenCounts() const
+{
+    return atomImplHCounts;
+}
+
+const Util::BitSet& Chem::FrozenMolecule::getAromaticAtomMask() const
+{
+    return aromAtomMask;
+}
+
+const Util::BitSet& Chem::FrozenMolecule::getRingAtomMask() const
+{
+    return ringAtomMask;
+}
+
+const Math::Vector3DArray& Chem::FrozenMolecule::getAtom3DCoordinates() const
+{
+    return atomCoords;
+}
+
+const Util::STArray& Chem::FrozenMolecule::getBondOrders() const
+{
+    return bondOrders;
+}
+
+const Util::BitSet& Chem::FrozenMolecule::getAromaticBondMask() const
+{
+    return aromBondMask;
+}
+
+const Util::BitSet& Chem::FrozenMolecule::getRingBondMask() const
+{
+    return ringBondMask;
+}
+
+void Chem::FrozenMolecule::updatePropertyArrays()
+{
+    std::size_t num_atoms = atoms.size();
+    std::size_t num_bonds = bonds.size();
+    bool has_coords = (num_atoms > 0);
+
+    atomTypes.resize(num_atoms);
+    atomCharges.resize(num_atoms);
+    atomImplHCounts.resize(num_atoms);
+    aromAtomMask.resize(num_atoms);
+    ringAtomMask.resize(num_atoms);
+    atomCoords.resize(num_atoms);
+
+    for (std::size_t i = 0; i < num_atoms; i++) {
+        const Atom& atom = atoms[i];
+
+        atomTypes.getData()[i] = getType(atom);
+        atomCharges.getData()[i] = getFormalCharge(atom);
+        atomImplHCounts.getData()[i] = (hasImplicitHydrogenCount(atom) ? getImplicitHydrogenCount(atom) : 0);
+
+        aromAtomMask.set(i, hasAromaticityFlag(atom) && getAromaticityFlag(atom));
+        ringAtomMask.set(i, hasRingFlag(atom) && getRingFlag(atom));
+
+        if (!has_coords)
+            continue;
+
+        if (!has3DCoordinates(atom)) {
+            has_coords = false;
+            continue;
+        }
+
+        atomCoords.getData()[i] = get3DCoordinates(atom);
+    }
+
+    if (!has_coords)
+        atomCoords.clear();
+
+    bondOrders.resize(num_bonds);
+    aromBondMask.resize(num_bonds);
+    ringBondMask.resize(num_bonds);
+
+    for (std::size_t i = 0; i < num_bonds; i++) {
+        const Bond& bond = bonds[i];
+
+        bondOrders.getData()[i] = getOrder(bond);
+
+        aromBondMask.set(i, hasAromaticityFlag(bond) && getAromaticityFlag(bond));
+        ringBondMask.set(i, hasRingFlag(bond) && getRingFlag(bond));
+    }
+}
+
+void Chem::FrozenMolecule::build(const MolecularGraph& molgraph)
+{
+    clearAtomsAndBonds();
+
+    std::size_t num_atoms = molgraph.getNumAtoms();
+    std::size_t num_bonds = molgraph.getNumBonds();
+
+    atoms.reserve(num_atoms);
+    bonds.reserve(num_bonds);
+
+    for (std::size_t i = 0; i < num_atoms; i++) {
+        atoms.emplace_back(this, i);
+        atoms.back().copyProperties(molgraph.getAtom(i));
+    }
+
+    Util::STArray::StorageType& offsets = nbrOffsets.getData();
+
+    offsets.assign(num_atoms + 1, 0);
+
+    for (std::size_t i = 0; i < num_bonds; i++) {
+        const Bond& bond = molgraph.getBond(i);
+        std::size_t atom1_idx = molgraph.getAtomIndex(bond.getBegin());
+        std::size_t atom2_idx = molgraph.getAtomIndex(bond.getEnd());
+
+        bonds.emplace_back(this, i, atom1_idx, atom2_idx);
+        bonds.back().copyProperties(bond);
+
+        offsets[atom1_idx + 1]++;
+        offsets[atom2_idx + 1]++;
+    }
+
+    for (std::size_t i = 0; i < num_atoms; i++)
+        offsets[i + 1] += offsets[i];
+
+    Util::STArray::StorageType& nbr_atoms = nbrAtomIndices.getData();
+    Util::STArray::StorageType& nbr_bonds = nbrBondIndices.getData();
+    Util::STArray::StorageType  list_ends(offsets.begin(), offsets.end() - 1);
+
+    nbr_atoms.resize(num_bonds * 2);
+    nbr_bonds.resize(num_bonds * 2);
+
+    for (std::size_t i = 0; i < num_bonds; i++) {
+        std::size_t atom1_idx = bonds[i].getBegin().getIndex();
+        std::size_t atom2_idx = bonds[i].getEnd().getIndex();
+        std::size_t list_idx = list_ends[atom1_idx]++;
+
+        nbr_atoms[list_idx] = atom2_idx;
+        nbr_bonds[list_idx] = i;
+
+        list_idx = list_ends[atom2_idx]++;
+
+        nbr_atoms[list_idx] = atom1_idx;
+        nbr_bonds[list_idx] = i;
+    }
+
+    updatePropertyArrays();
+}
+
+void Chem::FrozenMolecule::clearAtomsAndBonds()
+{
+    atoms.clear();
+    bonds.clear();
+
+    nbrOffsets.assign(1, 0);
+    nbrAtomIndices.clear();
+    nbrBondIndices.clear();
+
+    updatePropertyArrays();
+}
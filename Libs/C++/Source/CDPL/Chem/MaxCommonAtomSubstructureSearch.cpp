@@ -26,6 +26,7 @@
 
 #include <cassert>
 #include <functional>
+#include <algorithm>
 
 #include "CDPL/Chem/MaxCommonAtomSubstructureSearch.hpp"
 #include "CDPL/Chem/MolecularGraph.hpp"
@@ -36,10 +37,13 @@
 #include "CDPL/Chem/MolecularGraphFunctions.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
+#include "MaxCommonSubstructureSearchControl.hpp"
+#include "MaxCommonSubstructureSizeBound.hpp"
+
 
 namespace
 {
-    
+
     constexpr std::size_t MAX_NODE_CACHE_SIZE    = 10000;
     constexpr std::size_t MAX_EDGE_CACHE_SIZE    = 10000;
     constexpr std::size_t MAX_MAPPING_CACHE_SIZE = 1000;
@@ -49,17 +53,21 @@ namespace
 using namespace CDPL;
 
 
-Chem::MaxCommonAtomSubstructureSearch::MaxCommonAtomSubstructureSearch(): 
-    query(0), nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE), 
-    mappingCache(MAX_MAPPING_CACHE_SIZE), queryChanged(true), initQueryData(true), 
-    uniqueMatches(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0) 
+Chem::MaxCommonAtomSubstructureSearch::MaxCommonAtomSubstructureSearch():
+    query(0), nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE),
+    mappingCache(MAX_MAPPING_CACHE_SIZE), sizeBound(new MaxCommonSubstructureSizeBound()), searchCtrl(0),
+    queryChanged(true), initQueryData(true), uniqueMatches(false), saveMappings(false), maxBondMappingsOnly(false),
+    aborted(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0), timeout(0), maxNumSearchNodes(0),
+    numThreads(0), numUncheckedSearchNodes(0)
 {
     mappingCache.setCleanupFunction(&AtomBondMapping::clear);
 }
 
-Chem::MaxCommonAtomSubstructureSearch::MaxCommonAtomSubstructureSearch(const MolecularGraph& query): 
-    nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE), mappingCache(MAX_MAPPING_CACHE_SIZE), 
-    uniqueMatches(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0)
+Chem::MaxCommonAtomSubstructureSearch::MaxCommonAtomSubstructureSearch(const MolecularGraph& query):
+    nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE), mappingCache(MAX_MAPPING_CACHE_SIZE),
+    sizeBound(new MaxCommonSubstructureSizeBound()), searchCtrl(0), uniqueMatches(false), saveMappings(false),
+    maxBondMappingsOnly(false), aborted(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0),
+    timeout(0), maxNumSearchNodes(0), numThreads(0), numUncheckedSearchNodes(0)
 {
     mappingCache.setCleanupFunction(&AtomBondMapping::clear);
 
@@ -77,7 +85,7 @@ bool Chem::MaxCommonAtomSubstructureSearch::mappingExists(const MolecularGraph&
 
     clearMappings();
 
-    return findAssocGraphCliques(0);
+    return startSearch();
 }
 
 bool Chem::MaxCommonAtomSubstructureSearch::findAllMappings(const MolecularGraph& target)
@@ -89,7 +97,7 @@ bool Chem::MaxCommonAtomSubstructureSearch::findAllMappings(const MolecularGraph
     maxBondMappingsOnly = false;
 
     clearMappings();
-    findAssocGraphCliques(0);
+    startSearch();
 
     return !foundMappings.empty();
 }
@@ -103,7 +111,7 @@ bool Chem::MaxCommonAtomSubstructureSearch::findMaxBondMappings(const MolecularG
     maxBondMappingsOnly = true;
 
     clearMappings();
-    findAssocGraphCliques(0);
+    startSearch();
 
     return !foundMappings.empty();
 }
@@ -199,6 +207,51 @@ std::size_t Chem::MaxCommonAtomSubstructureSearch::getMinSubstructureSize() cons
     return minSubstructureSize;
 }
 
+void Chem::MaxCommonAtomSubstructureSearch::setAbortCallback(const CallbackFunction& func)
+{
+    abortCallback = func;
+}
+
+const Chem::MaxCommonAtomSubstructureSearch::CallbackFunction& Chem::MaxCommonAtomSubstructureSearch::getAbortCallback() const
+{
+    return abortCallback;
+}
+
+void Chem::MaxCommonAtomSubstructureSearch::setTimeout(std::size_t mil_secs)
+{
+    timeout = mil_secs;
+}
+
+std::size_t Chem::MaxCommonAtomSubstructureSearch::getTimeout() const
+{
+    return timeout;
+}
+
+void Chem::MaxCommonAtomSubstructureSearch::setMaxNumSearchNodes(std::size_t max_num_nodes)
+{
+    maxNumSearchNodes = max_num_nodes;
+}
+
+std::size_t Chem::MaxCommonAtomSubstructureSearch::getMaxNumSearchNodes() const
+{
+    return maxNumSearchNodes;
+}
+
+void Chem::MaxCommonAtomSubstructureSearch::setNumThreads(std::size_t num_threads)
+{
+    numThreads = num_threads;
+}
+
+std::size_t Chem::MaxCommonAtomSubstructureSearch::getNumThreads() const
+{
+    return numThreads;
+}
+
+bool Chem::MaxCommonAtomSubstructureSearch::searchAborted() const
+{
+    return aborted;
+}
+
 void Chem::MaxCommonAtomSubstructureSearch::setQuery(const MolecularGraph& query)
 {
     this->query = &query;
@@ -314,12 +367,15 @@ bool Chem::MaxCommonAtomSubstructureSearch::buildAssocGraph()
 
         node_list.clear();
 
-        for (MolecularGraph::ConstAtomIterator ta_it = target_atoms_beg; ta_it != target_atoms_end; ++ta_it) {
+        std::size_t target_atom_idx = 0;
+
+        for (MolecularGraph::ConstAtomIterator ta_it = target_atoms_beg; ta_it != target_atoms_end; ++ta_it, target_atom_idx++) {
             const Atom& target_atom = *ta_it;
 
             if (expr(query_atom, *query, target_atom, *target, Base::Any())) {
                 AGNode* node = allocAGNode(&query_atom, &target_atom);
 
+                node->setAssocAtomIndex(target_atom_idx);
                 node_list.push_back(node);
                 equiv_atoms_found = true;
             }
@@ -329,6 +385,8 @@ bool Chem::MaxCommonAtomSubstructureSearch::buildAssocGraph()
     if (!equiv_atoms_found)
         return false;
 
+    sizeBound->init(nodeMatrix, numQueryAtoms, numTargetAtoms, [](const AGNode* node) { return node->getAssocAtomIndex(); });
+
     nl_it = nodeMatrix.begin();
 
     for (MolecularGraph::ConstAtomIterator pa_it1 = query->getAtomsBegin(); pa_it1 != query_atoms_end; ) {
@@ -392,6 +450,143 @@ bool Chem::MaxCommonAtomSubstructureSearch::buildAssocGraph()
     return true;
 }
 
+bool Chem::MaxCommonAtomSubstructureSearch::startSearch()
+{
+    MaxCommonSubstructureSearchControl search_ctrl(minNumNullNodes, timeout, maxNumSearchNodes);
+
+    searchCtrl = &search_ctrl;
+    numUncheckedSearchNodes = 0;
+
+    if (numThreads > 1 && numQueryAtoms > 1 && !hasPostMappingMatchExprs())
+        findAssocGraphCliquesParallel();
+    else
+        findAssocGraphCliques(0);
+
+    searchCtrl = 0;
+    aborted = search_ctrl.searchAborted();
+
+    return search_ctrl.searchExited();
+}
+
+void Chem::MaxCommonAtomSubstructureSearch::findAssocGraphCliquesParallel()
+{
+    MaxCommonSubstructureSearchControl& search_ctrl = *searchCtrl;
+
+    for (std::size_t i = 0; i < numQueryAtoms; i++)
+        for (std::size_t j = 0, num_nodes = nodeMatrix[i].size(); j < num_nodes; j++)
+            search_ctrl.addSearchTask(i, j);
+
+    std::size_t num_workers = std::min(numThreads, search_ctrl.getNumSearchTasks()) - 1;
+
+    if (workers.size() < num_workers)
+        workers.resize(num_workers);
+
+    for (std::size_t i = 0; i < num_workers; i++) {
+        if (!workers[i])
+            workers[i].reset(new MaxCommonAtomSubstructureSearch());
+
+        if (!initWorker(*workers[i])) {
+            num_workers = i;
+            break;
+        }
+    }
+
+    search_ctrl.runWorkers(num_workers,
+                           [this](std::size_t i) { workers[i]->processSearchTasks(); },
+                           [this]() { processSearchTasks(); });
+
+    minNumNullNodes = std::min(minNumNullNodes, search_ctrl.getMinNumNullNodes());
+
+    if (!search_ctrl.searchStopped() && minNumNullNodes == numQueryAtoms) { // nothing found - visit the all-null leaf like the sequential search
+        currNumNullNodes = numQueryAtoms;
+
+        findAssocGraphCliques(numQueryAtoms);
+
+        currNumNullNodes = 0;
+    }
+
+    for (std::size_t i = 0; i < num_workers; i++)
+        mergeWorkerMappings(*workers[i]);
+}
+
+void Chem::MaxCommonAtomSubstructureSearch::processSearchTasks()
+{
+    MaxCommonSubstructureSearchControl::SearchTask task;
+
+    while (searchCtrl->getNextSearchTask(minNumNullNodes, task)) {
+        currNumNullNodes = task.first;
+
+        bool exit = extendClique(nodeMatrix[task.first][task.second], task.first);
+
+        currNumNullNodes = 0;
+
+        if (exit)
+            return;
+    }
+}
+
+bool Chem::MaxCommonAtomSubstructureSearch::initWorker(MaxCommonAtomSubstructureSearch& worker)
+{
+    worker.setQuery(*query);
+
+    worker.uniqueMatches = uniqueMatches;
+    worker.maxNumMappings = maxNumMappings;
+    worker.minSubstructureSize = minSubstructureSize;
+
+    if (!worker.init(*target))
+        return false;
+
+    worker.saveMappings = saveMappings;
+    worker.maxBondMappingsOnly = maxBondMappingsOnly;
+    worker.searchCtrl = searchCtrl;
+    worker.numUncheckedSearchNodes = 0;
+
+    worker.clearMappings();
+
+    return true;
+}
+
+void Chem::MaxCommonAtomSubstructureSearch::mergeWorkerMappings(MaxCommonAtomSubstructureSearch& worker)
+{
+    worker.searchCtrl = 0;
+
+    if (worker.foundMappings.empty())
+        return;
+
+    if (worker.maxAtomSubstructureSize < maxAtomSubstructureSize || 
+        (maxBondMappingsOnly && worker.maxAtomSubstructureSize == maxAtomSubstructureSize && 
+         worker.maxBondSubstructureSize < maxBondSubstructureSize)) {
+
+        worker.freeAtomBondMappings();
+        return;
+    }
+
+    if (worker.maxAtomSubstructureSize > maxAtomSubstructureSize || 
+        (maxBondMappingsOnly && worker.maxBondSubstructureSize > maxBondSubstructureSize)) {
+
+        maxAtomSubstructureSize = worker.maxAtomSubstructureSize;
+        maxBondSubstructureSize = worker.maxBondSubstructureSize;
+
+        freeAtomBondMappings();
+    }
+
+    for (ABMappingList::const_iterator it = worker.foundMappings.begin(), end = worker.foundMappings.end(); it != end; ++it) {
+        if (maxNumMappings > 0 && foundMappings.size() >= maxNumMappings)
+            break;
+
+        if (uniqueMatches && !mappingUnique(**it))
+            continue;
+
+        AtomBondMapping* mapping = mappingCache.get();
+
+        *mapping = **it;
+
+        foundMappings.push_back(mapping);
+    }
+
+    worker.freeAtomBondMappings();
+}
+
 // Durand-Pasari Algorithm
 
 bool Chem::MaxCommonAtomSubstructureSearch::findAssocGraphCliques(std::size_t level)
@@ -399,39 +594,56 @@ bool Chem::MaxCommonAtomSubstructureSearch::findAssocGraphCliques(std::size_t le
     if (currNumNullNodes > minNumNullNodes)
         return false;
 
+    if (searchCtrl->budgetExhausted(numUncheckedSearchNodes, minNumNullNodes, abortCallback))
+        return true;
+
     if (level == numQueryAtoms) {
         minNumNullNodes = currNumNullNodes;
 
-        return mappingFound();
+        searchCtrl->updateMinNumNullNodes(currNumNullNodes);
+
+        if (!mappingFound())
+            return false;
+
+        searchCtrl->exitSearch();
+
+        return true;
     }
 
+    if (!sizeBound->sizeReachable(level, cliqueNodes.size(), std::max(numQueryAtoms - minNumNullNodes, minSubstructureSize)))
+        return false;
+
     const AGraphNodeList& level_nodes = nodeMatrix[level];
     AGraphNodeList::const_iterator nodes_end = level_nodes.end();
 
-    for (AGraphNodeList::const_iterator it = level_nodes.begin(); it != nodes_end; ++it) {
-        AGNode* node = *it;
+    for (AGraphNodeList::const_iterator it = level_nodes.begin(); it != nodes_end; ++it)
+        if (extendClique(*it, level))
+            return true;
 
-        std::size_t old_num_edges = cliqueEdges.size();
+    currNumNullNodes++;
 
-        if (!isLegal(node))
-            continue;
+    bool exit = findAssocGraphCliques(level + 1);
 
-        cliqueNodes.push_back(node);
+    currNumNullNodes--;
 
-        bool exit = findAssocGraphCliques(level + 1);
+    return exit;
+}
 
-        cliqueNodes.pop_back();
-        cliqueEdges.erase(cliqueEdges.begin() + old_num_edges, cliqueEdges.end());
+bool Chem::MaxCommonAtomSubstructureSearch::extendClique(AGNode* node, std::size_t level)
+{
+    std::size_t old_num_edges = cliqueEdges.size();
 
-        if (exit)
-            return true;
-    }
+    if (!isLegal(node))
+        return false;
 
-    currNumNullNodes++;
+    cliqueNodes.push_back(node);
+    sizeBound->setTargetMapped(node->getAssocAtomIndex());
 
     bool exit = findAssocGraphCliques(level + 1);
 
-    currNumNullNodes--;
+    sizeBound->resetTargetMapped(node->getAssocAtomIndex());
+    cliqueNodes.pop_back();
+    cliqueEdges.erase(cliqueEdges.begin() + old_num_edges, cliqueEdges.end());
 
     return exit;
 }
@@ -603,6 +815,27 @@ bool Chem::MaxCommonAtomSubstructureSearch::foundMappingUnique()
     return uniqueMappings.insert(mappingMask).second;
 }
 
+bool Chem::MaxCommonAtomSubstructureSearch::mappingUnique(const AtomBondMapping& mapping)
+{
+    mappingMask.reset();
+
+    const AtomMapping& atom_mapping = mapping.getAtomMapping();
+
+    for (AtomMapping::ConstEntryIterator it = atom_mapping.getEntriesBegin(), end = atom_mapping.getEntriesEnd(); it != end; ++it) {
+        mappingMask.setQueryAtomBit(query->getAtomIndex(*it->first));
+        mappingMask.setTargetAtomBit(target->getAtomIndex(*it->second));
+    }
+
+    const BondMapping& bond_mapping = mapping.getBondMapping();
+
+    for (BondMapping::ConstEntryIterator it = bond_mapping.getEntriesBegin(), end = bond_mapping.getEntriesEnd(); it != end; ++it) {
+        mappingMask.setQueryBondBit(query->getBondIndex(*it->first));
+        mappingMask.setTargetBondBit(target->getBondIndex(*it->second));
+    }
+
+    return uniqueMappings.insert(mappingMask).second;
+}
+
 void Chem::MaxCommonAtomSubstructureSearch::clearMappings()
 {
     freeAtomBondMappings();
@@ -705,6 +938,16 @@ const Chem::Atom* Chem::MaxCommonAtomSubstructureSearch::AGNode::getAssocAtom()
     return assocAtom;
 }
                 
+void Chem::MaxCommonAtomSubstructureSearch::AGNode::setAssocAtomIndex(std::size_t idx)
+{
+    assocAtomIndex = idx;
+}
+
+std::size_t Chem::MaxCommonAtomSubstructureSearch::AGNode::getAssocAtomIndex() const
+{
+    return assocAtomIndex;
+}
+
 void Chem::MaxCommonAtomSubstructureSearch::AGNode::addEdge(const AGEdge* edge)
 {
     if (edge->getQueryBond())
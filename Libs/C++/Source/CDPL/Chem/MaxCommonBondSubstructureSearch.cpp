@@ -26,6 +26,7 @@
 
 #include <cassert>
 #include <functional>
+#include <algorithm>
 
 #include "CDPL/Chem/MaxCommonBondSubstructureSearch.hpp"
 #include "CDPL/Chem/MolecularGraph.hpp"
@@ -37,10 +38,13 @@
 #include "CDPL/Chem/MolecularGraphFunctions.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
+#include "MaxCommonSubstructureSearchControl.hpp"
+#include "MaxCommonSubstructureSizeBound.hpp"
+
 
 namespace
 {
-    
+
     constexpr std::size_t MAX_NODE_CACHE_SIZE    = 10000;
     constexpr std::size_t MAX_EDGE_CACHE_SIZE    = 10000;
     constexpr std::size_t MAX_MAPPING_CACHE_SIZE = 1000;
@@ -50,17 +54,21 @@ namespace
 using namespace CDPL;
 
 
-Chem::MaxCommonBondSubstructureSearch::MaxCommonBondSubstructureSearch(): 
-    query(0), nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE), 
-    mappingCache(MAX_MAPPING_CACHE_SIZE), queryChanged(true), initQueryData(true),
-    uniqueMatches(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0) 
+Chem::MaxCommonBondSubstructureSearch::MaxCommonBondSubstructureSearch():
+    query(0), nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE),
+    mappingCache(MAX_MAPPING_CACHE_SIZE), sizeBound(new MaxCommonSubstructureSizeBound()), searchCtrl(0),
+    queryChanged(true), initQueryData(true), uniqueMatches(false), saveMappings(false), aborted(false),
+    currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0), timeout(0), maxNumSearchNodes(0),
+    numThreads(0), numUncheckedSearchNodes(0)
 {
     mappingCache.setCleanupFunction(&AtomBondMapping::clear);
 }
 
-Chem::MaxCommonBondSubstructureSearch::MaxCommonBondSubstructureSearch(const MolecularGraph& query): 
-    nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE), mappingCache(MAX_MAPPING_CACHE_SIZE), 
-    uniqueMatches(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0) 
+Chem::MaxCommonBondSubstructureSearch::MaxCommonBondSubstructureSearch(const MolecularGraph& query):
+    nodeCache(MAX_NODE_CACHE_SIZE), edgeCache(MAX_EDGE_CACHE_SIZE), mappingCache(MAX_MAPPING_CACHE_SIZE),
+    sizeBound(new MaxCommonSubstructureSizeBound()), searchCtrl(0), uniqueMatches(false), saveMappings(false),
+    aborted(false), currNumNullNodes(0), maxNumMappings(0), minSubstructureSize(0), timeout(0),
+    maxNumSearchNodes(0), numThreads(0), numUncheckedSearchNodes(0)
 {
     mappingCache.setCleanupFunction(&AtomBondMapping::clear);
 
@@ -77,8 +85,8 @@ bool Chem::MaxCommonBondSubstructureSearch::mappingExists(const MolecularGraph&
     saveMappings = false;
 
     clearMappings();
-    
-    return findAssocGraphCliques(0);
+
+    return startSearch();
 }
 
 bool Chem::MaxCommonBondSubstructureSearch::findMappings(const MolecularGraph& target)
@@ -89,7 +97,7 @@ bool Chem::MaxCommonBondSubstructureSearch::findMappings(const MolecularGraph& t
     saveMappings = true;
 
     clearMappings();
-    findAssocGraphCliques(0);
+    startSearch();
 
     return !foundMappings.empty();
 }
@@ -185,6 +193,51 @@ std::size_t Chem::MaxCommonBondSubstructureSearch::getMinSubstructureSize() cons
     return minSubstructureSize;
 }
 
+void Chem::MaxCommonBondSubstructureSearch::setAbortCallback(const CallbackFunction& func)
+{
+    abortCallback = func;
+}
+
+const Chem::MaxCommonBondSubstructureSearch::CallbackFunction& Chem::MaxCommonBondSubstructureSearch::getAbortCallback() const
+{
+    return abortCallback;
+}
+
+void Chem::MaxCommonBondSubstructureSearch::setTimeout(std::size_t mil_secs)
+{
+    timeout = mil_secs;
+}
+
+std::size_t Chem::MaxCommonBondSubstructureSearch::getTimeout() const
+{
+    return timeout;
+}
+
+void Chem::MaxCommonBondSubstructureSearch::setMaxNumSearchNodes(std::size_t max_num_nodes)
+{
+    maxNumSearchNodes = max_num_nodes;
+}
+
+std::size_t Chem::MaxCommonBondSubstructureSearch::getMaxNumSearchNodes() const
+{
+    return maxNumSearchNodes;
+}
+
+void Chem::MaxCommonBondSubstructureSearch::setNumThreads(std::size_t num_threads)
+{
+    numThreads = num_threads;
+}
+
+std::size_t Chem::MaxCommonBondSubstructureSearch::getNumThreads() const
+{
+    return numThreads;
+}
+
+bool Chem::MaxCommonBondSubstructureSearch::searchAborted() const
+{
+    return aborted;
+}
+
 void Chem::MaxCommonBondSubstructureSearch::setQuery(const MolecularGraph& query)
 {
     this->query = &query;
@@ -378,8 +431,9 @@ bool Chem::MaxCommonBondSubstructureSearch::buildAssocGraph()
             continue;
 
         const Bond& query_bond = *pb_it;
+        std::size_t target_bond_idx = 0;
 
-        for (MolecularGraph::ConstBondIterator tb_it = target_bonds_beg; tb_it != target_bonds_end; ++tb_it) {
+        for (MolecularGraph::ConstBondIterator tb_it = target_bonds_beg; tb_it != target_bonds_end; ++tb_it, target_bond_idx++) {
             const Bond& target_bond = *tb_it;
 
             if (!target->containsAtom(target_bond.getBegin()) || !target->containsAtom(target_bond.getEnd()))
@@ -389,6 +443,7 @@ bool Chem::MaxCommonBondSubstructureSearch::buildAssocGraph()
                 atomsCompatible(query_bond, target_bond)) {
                 AGNode* node = allocAGNode(&query_bond, &target_bond);
 
+                node->setAssocBondIndex(target_bond_idx);
                 node_list.push_back(node);
                 equiv_bonds_found = true;
             }
@@ -398,6 +453,8 @@ bool Chem::MaxCommonBondSubstructureSearch::buildAssocGraph()
     if (!equiv_bonds_found)
         return false;
 
+    sizeBound->init(nodeMatrix, numQueryBonds, numTargetBonds, [](const AGNode* node) { return node->getAssocBondIndex(); });
+
     nl_it = nodeMatrix.begin();
 
     for (MolecularGraph::ConstBondIterator pb_it1 = query->getBondsBegin(); pb_it1 != query_bonds_end; ) {
@@ -456,6 +513,143 @@ bool Chem::MaxCommonBondSubstructureSearch::buildAssocGraph()
     return true;
 }
 
+bool Chem::MaxCommonBondSubstructureSearch::startSearch()
+{
+    MaxCommonSubstructureSearchControl search_ctrl(minNumNullNodes, timeout, maxNumSearchNodes);
+
+    searchCtrl = &search_ctrl;
+    numUncheckedSearchNodes = 0;
+
+    if (numThreads > 1 && numQueryBonds > 1 && !hasPostMappingMatchExprs())
+        findAssocGraphCliquesParallel();
+    else
+        findAssocGraphCliques(0);
+
+    searchCtrl = 0;
+    aborted = search_ctrl.searchAborted();
+
+    return search_ctrl.searchExited();
+}
+
+void Chem::MaxCommonBondSubstructureSearch::findAssocGraphCliquesParallel()
+{
+    MaxCommonSubstructureSearchControl& search_ctrl = *searchCtrl;
+
+    for (std::size_t i = 0; i < numQueryBonds; i++)
+        for (std::size_t j = 0, num_nodes = nodeMatrix[i].size(); j < num_nodes; j++)
+            search_ctrl.addSearchTask(i, j);
+
+    std::size_t num_workers = std::min(numThreads, search_ctrl.getNumSearchTasks()) - 1;
+
+    if (workers.size() < num_workers)
+        workers.resize(num_workers);
+
+    for (std::size_t i = 0; i < num_workers; i++) {
+        if (!workers[i])
+            workers[i].reset(new MaxCommonBondSubstructureSearch());
+
+        if (!initWorker(*workers[i])) {
+            num_workers = i;
+            break;
+        }
+    }
+
+    search_ctrl.runWorkers(num_workers,
+                           [this](std::size_t i) { workers[i]->processSearchTasks(); },
+                           [this]() { processSearchTasks(); });
+
+    minNumNullNodes = std::min(minNumNullNodes, search_ctrl.getMinNumNullNodes());
+
+    if (!search_ctrl.searchStopped() && minNumNullNodes == numQueryBonds) { // nothing found - visit the all-null leaf like the sequential search
+        currNumNullNodes = numQueryBonds;
+
+        findAssocGraphCliques(numQueryBonds);
+
+        currNumNullNodes = 0;
+    }
+
+    if (uniqueMatches) { // switch to masks derived from the mapping objects for the duplicate checks of merged mappings
+        uniqueMappings.clear();
+
+        for (ABMappingList::const_iterator it = foundMappings.begin(), end = foundMappings.end(); it != end; ++it)
+            mappingUnique(**it);
+    }
+
+    for (std::size_t i = 0; i < num_workers; i++)
+        mergeWorkerMappings(*workers[i]);
+}
+
+void Chem::MaxCommonBondSubstructureSearch::processSearchTasks()
+{
+    MaxCommonSubstructureSearchControl::SearchTask task;
+
+    while (searchCtrl->getNextSearchTask(minNumNullNodes, task)) {
+        currNumNullNodes = task.first;
+
+        bool exit = extendClique(nodeMatrix[task.first][task.second], task.first);
+
+        currNumNullNodes = 0;
+
+        if (exit)
+            return;
+    }
+}
+
+bool Chem::MaxCommonBondSubstructureSearch::initWorker(MaxCommonBondSubstructureSearch& worker)
+{
+    worker.setQuery(*query);
+
+    worker.uniqueMatches = uniqueMatches;
+    worker.maxNumMappings = maxNumMappings;
+    worker.minSubstructureSize = minSubstructureSize;
+
+    if (!worker.init(*target))
+        return false;
+
+    worker.saveMappings = saveMappings;
+    worker.searchCtrl = searchCtrl;
+    worker.numUncheckedSearchNodes = 0;
+
+    worker.clearMappings();
+
+    return true;
+}
+
+void Chem::MaxCommonBondSubstructureSearch::mergeWorkerMappings(MaxCommonBondSubstructureSearch& worker)
+{
+    worker.searchCtrl = 0;
+
+    if (worker.foundMappings.empty())
+        return;
+
+    if (worker.maxBondSubstructureSize < maxBondSubstructureSize) {
+        worker.freeAtomBondMappings();
+        return;
+    }
+
+    if (worker.maxBondSubstructureSize > maxBondSubstructureSize) {
+        maxBondSubstructureSize = worker.maxBondSubstructureSize;
+
+        freeAtomBondMappings();
+    }
+
+    for (ABMappingList::const_iterator it = worker.foundMappings.begin(), end = worker.foundMappings.end(); it != end; ++it) {
+        if (maxNumMappings > 0 && foundMappings.size() >= maxNumMappings)
+            break;
+
+        if (uniqueMatches && !mappingUnique(**it))
+            continue;
+
+        AtomBondMapping* mapping = mappingCache.get();
+
+        *mapping = **it;
+
+        foundMappings.push_back(mapping);
+    }
+
+    worker.freeAtomBondMappings();
+}
+
 // Durand-Pasari Algorithm
 
 bool Chem::MaxCommonBondSubstructureSearch::findAssocGraphCliques(std::size_t level)
@@ -463,40 +657,57 @@ bool Chem::MaxCommonBondSubstructureSearch::findAssocGraphCliques(std::size_t le
     if (currNumNullNodes > minNumNullNodes)
         return false;
 
+    if (searchCtrl->budgetExhausted(numUncheckedSearchNodes, minNumNullNodes, abortCallback))
+        return true;
+
     if (level == numQueryBonds) {
         minNumNullNodes = currNumNullNodes;
 
-        return mappingFound();
+        searchCtrl->updateMinNumNullNodes(currNumNullNodes);
+
+        if (!mappingFound())
+            return false;
+
+        searchCtrl->exitSearch();
+
+        return true;
     }
 
+    if (!sizeBound->sizeReachable(level, cliqueNodes.size(), std::max(numQueryBonds - minNumNullNodes, minSubstructureSize)))
+        return false;
+
     const AGraphNodeList& level_nodes = nodeMatrix[level];
     AGraphNodeList::const_iterator nodes_end = level_nodes.end();
 
-    std::size_t old_num_edges = cliqueEdges.size();
+    for (AGraphNodeList::const_iterator it = level_nodes.begin(); it != nodes_end; ++it)
+        if (extendClique(*it, level))
+            return true;
 
-    for (AGraphNodeList::const_iterator it = level_nodes.begin(); it != nodes_end; ++it) {
-        AGNode* node = *it;
+    currNumNullNodes++;
 
-        if (!isLegal(node))
-            continue;
+    bool exit = findAssocGraphCliques(level + 1);
 
-        cliqueNodes.push_back(node);
+    currNumNullNodes--;
 
-        bool exit = findAssocGraphCliques(level + 1);
+    return exit;
+}
 
-        cliqueNodes.pop_back();
-        
-        undoAtomMapping(cliqueEdges.size() - old_num_edges);
+bool Chem::MaxCommonBondSubstructureSearch::extendClique(AGNode* node, std::size_t level)
+{
+    std::size_t old_num_edges = cliqueEdges.size();
 
-        if (exit)
-            return true;
-    }
+    if (!isLegal(node))
+        return false;
 
-    currNumNullNodes++;
+    cliqueNodes.push_back(node);
+    sizeBound->setTargetMapped(node->getAssocBondIndex());
 
     bool exit = findAssocGraphCliques(level + 1);
 
-    currNumNullNodes--;
+    sizeBound->resetTargetMapped(node->getAssocBondIndex());
+    cliqueNodes.pop_back();
+
+    undoAtomMapping(cliqueEdges.size() - old_num_edges);
 
     return exit;
 }
@@ -687,6 +898,30 @@ bool Chem::MaxCommonBondSubstructureSearch::foundMappingUnique(bool init_query_a
     return uniqueMappings.insert(mappingMask).second;
 }
 
+bool Chem::MaxCommonBondSubstructureSearch::mappingUnique(const AtomBondMapping& mapping)
+{
+    mappingMask.resetQueryAtomBits();
+    mappingMask.resetTargetAtomBits();
+
+    const AtomMapping& atom_mapping = mapping.getAtomMapping();
+
+    for (AtomMapping::ConstEntryIterator it = atom_mapping.getEntriesBegin(), end = atom_mapping.getEntriesEnd(); it != end; ++it) {
+        mappingMask.setQueryAtomBit(query->getAtomIndex(*it->first));
+        mappingMask.setTargetAtomBit(target->getAtomIndex(*it->second));
+    }
+
+    mappingMask.resetBondBits();
+
+    const BondMapping& bond_mapping = mapping.getBondMapping();
+
+    for (BondMapping::ConstEntryIterator it = bond_mapping.getEntriesBegin(), end = bond_mapping.getEntriesEnd(); it != end; ++it) {
+        mappingMask.setQueryBondBit(query->getBondIndex(*it->first));
+        mappingMask.setTargetBondBit(target->getBondIndex(*it->second));
+    }
+
+    return uniqueMappings.insert(mappingMask).second;
+}
+
 void Chem::MaxCommonBondSubstructureSearch::clearMappings()
 {
     freeAtomBondMappings();
@@ -826,6 +1061,16 @@ const Chem::Bond* Chem::MaxCommonBondSubstructureSearch::AGNode::getAssocBond()
     return assocBond;
 }
                 
+void Chem::MaxCommonBondSubstructureSearch::AGNode::setAssocBondIndex(std::size_t idx)
+{
+    assocBondIndex = idx;
+}
+
+std::size_t Chem::MaxCommonBondSubstructureSearch::AGNode::getAssocBondIndex() const
+{
+    return assocBondIndex;
+}
+
 void Chem::MaxCommonBondSubstructureSearch::AGNode::addEdge(const AGEdge* edge)
 {
     if (edge->getQueryAtom())
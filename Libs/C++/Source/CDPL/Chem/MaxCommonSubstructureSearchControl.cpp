@@ -0,0 +1,176 @@
+/*
+ * MaxCommonSubstructureSearchControl.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "StaticInit.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <chrono>
+
+#include "MaxCommonSubstructureSearchControl.hpp"
+
+
+namespace
+{
+
+    constexpr std::size_t SEARCH_BUDGET_CHECK_INTERVAL = 64;
+}
+
+
+using namespace CDPL;
+
+
+Chem::MaxCommonSubstructureSearchControl::MaxCommonSubstructureSearchControl(std::size_t min_num_null_nodes, std::size_t timeout,
+                                                                             std::size_t max_num_nodes):
+    minNumNullNodes(min_num_null_nodes), numSearchNodes(0), nextTask(0), stop(false), exit(false),
+    aborted(false), timeout(timeout), maxNumSearchNodes(max_num_nodes)
+{}
+
+bool Chem::MaxCommonSubstructureSearchControl::budgetExhausted(std::size_t& num_unchecked_nodes, std::size_t& min_num_null_nodes,
+                                                               const CallbackFunction& abort_func)
+{
+    if (stop.load(std::memory_order_relaxed))
+        return true;
+
+    if (++num_unchecked_nodes < SEARCH_BUDGET_CHECK_INTERVAL)
+        return false;
+
+    num_unchecked_nodes = 0;
+    min_num_null_nodes = std::min(min_num_null_nodes, minNumNullNodes.load(std::memory_order_relaxed));
+
+    std::size_t num_nodes = (numSearchNodes += SEARCH_BUDGET_CHECK_INTERVAL);
+
+    if ((maxNumSearchNodes > 0 && num_nodes >= maxNumSearchNodes) ||
+        (timeout > 0 && std::size_t(std::chrono::duration_cast<std::chrono::milliseconds>(timer.elapsed()).count()) >= timeout) ||
+        (abort_func && abort_func())) {
+
+        aborted = true;
+        stop = true;
+
+        return true;
+    }
+
+    return false;
+}
+
+void Chem::MaxCommonSubstructureSearchControl::updateMinNumNullNodes(std::size_t num_null_nodes)
+{
+    std::size_t curr_value = minNumNullNodes.load(std::memory_order_relaxed);
+
+    while (num_null_nodes < curr_value && !minNumNullNodes.compare_exchange_weak(curr_value, num_null_nodes, std::memory_order_relaxed));
+}
+
+std::size_t Chem::MaxCommonSubstructureSearchControl::getMinNumNullNodes() const
+{
+    return minNumNullNodes.load();
+}
+
+void Chem::MaxCommonSubstructureSearchControl::exitSearch()
+{
+    exit = true;
+    stop = true;
+}
+
+bool Chem::MaxCommonSubstructureSearchControl::searchExited() const
+{
+    return exit;
+}
+
+bool Chem::MaxCommonSubstructureSearchControl::searchAborted() const
+{
+    return aborted;
+}
+
+bool Chem::MaxCommonSubstructureSearchControl::searchStopped() const
+{
+    return stop;
+}
+
+void Chem::MaxCommonSubstructureSearchControl::addSearchTask(std::size_t level, std::size_t node_idx)
+{
+    tasks.push_back(SearchTask(level, node_idx));
+}
+
+std::size_t Chem::MaxCommonSubstructureSearchControl::getNumSearchTasks() const
+{
+    return tasks.size();
+}
+
+bool Chem::MaxCommonSubstructureSearchControl::getNextSearchTask(std::size_t& min_num_null_nodes, SearchTask& task)
+{
+    if (stop)
+        return false;
+
+    std::size_t task_idx = nextTask++;
+
+    if (task_idx >= tasks.size())
+        return false;
+
+    min_num_null_nodes = std::min(min_num_null_nodes, minNumNullNodes.load(std::memory_order_relaxed));
+    task = tasks[task_idx];
+
+    return (task.first <= min_num_null_nodes);
+}
+
+void Chem::MaxCommonSubstructureSearchControl::runWorkers(std::size_t num_workers, const std::function<void(std::size_t)>& worker_func,
+                                                          const std::function<void()>& main_func)
+{
+    std::vector<std::thread> threads;
+
+    try {
+        threads.reserve(num_workers);
+
+        for (std::size_t i = 0; i < num_workers; i++) {
+            threads.emplace_back([this, &worker_func, i]() {
+                try {
+                    worker_func(i);
+
+                } catch (...) {
+                    setError(std::current_exception());
+                }
+            });
+        }
+
+        main_func();
+
+    } catch (...) {
+        setError(std::current_exception());
+    }
+
+    for (std::vector<std::thread>::iterator it = threads.begin(), end = threads.end(); it != end; ++it)
+        it->join();
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void Chem::MaxCommonSubstructureSearchControl::setError(std::exception_ptr ex_ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!error)
+        error = ex_ptr;
+
+    stop = true;
+}
@@ -0,0 +1,127 @@
+/*
+ * MaxCommonSubstructureSearchControl.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Chem::MaxCommonSubstructureSearchControl.
+ */
+
+#ifndef CDPL_CHEM_MAXCOMMONSUBSTRUCTURESEARCHCONTROL_HPP
+#define CDPL_CHEM_MAXCOMMONSUBSTRUCTURESEARCHCONTROL_HPP
+
+#include <cstddef>
+#include <vector>
+#include <utility>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+
+#include "CDPL/Internal/Timer.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Chem
+    {
+
+        /*
+         * Search state shared by the threads of a maximum common atom/bond substructure search: best null-node
+         * count found so far, search budget (time, number of visited nodes, abort callback) and the top-level
+         * search tasks of a multi-threaded search.
+         */
+        class MaxCommonSubstructureSearchControl
+        {
+
+          public:
+            typedef std::function<bool()> CallbackFunction;
+
+            /*
+             * A search task is the subtree in which the query atom/bond at search level first is the first
+             * mapped one and gets mapped to the association graph node with index second at this level.
+             */
+            typedef std::pair<std::size_t, std::size_t> SearchTask;
+
+            MaxCommonSubstructureSearchControl(std::size_t min_num_null_nodes, std::size_t timeout, std::size_t max_num_nodes);
+
+            /*
+             * Counts a visited search node and checks the search budget every SEARCH_BUDGET_CHECK_INTERVAL nodes.
+             * On a check, min_num_null_nodes gets tightened to the shared value. The abort callback (if any) is
+             * only passed by the searches running in the calling thread.
+             */
+            bool budgetExhausted(std::size_t& num_unchecked_nodes, std::size_t& min_num_null_nodes, const CallbackFunction& abort_func);
+
+            void updateMinNumNullNodes(std::size_t num_null_nodes);
+
+            std::size_t getMinNumNullNodes() const;
+
+            void exitSearch();
+
+            bool searchExited() const;
+
+            bool searchAborted() const;
+
+            bool searchStopped() const;
+
+            void addSearchTask(std::size_t level, std::size_t node_idx);
+
+            std::size_t getNumSearchTasks() const;
+
+            /*
+             * Fetches the next task to process. Returns false if all tasks have been processed, the search has
+             * been stopped or the remaining tasks cannot yield a mapping with at most min_num_null_nodes null
+             * nodes (tasks are added in level order).
+             */
+            bool getNextSearchTask(std::size_t& min_num_null_nodes, SearchTask& task);
+
+            /*
+             * Runs worker_func(i) for i in [0, num_workers) in separate threads and main_func in the calling
+             * thread. The first exception thrown by any of the functions stops the search and gets rethrown
+             * after all threads have finished.
+             */
+            void runWorkers(std::size_t num_workers, const std::function<void(std::size_t)>& worker_func,
+                            const std::function<void()>& main_func);
+
+          private:
+            void setError(std::exception_ptr ex_ptr);
+
+            typedef std::vector<SearchTask> SearchTaskList;
+
+            Internal::Timer          timer;
+            std::atomic<std::size_t> minNumNullNodes;
+            std::atomic<std::size_t> numSearchNodes;
+            std::atomic<std::size_t> nextTask;
+            std::atomic<bool>        stop;
+            std::atomic<bool>        exit;
+            std::atomic<bool>        aborted;
+            const std::size_t        timeout;
+            const std::size_t        maxNumSearchNodes;
+            SearchTaskList           tasks;
+            std::mutex               mutex;
+            std::exception_ptr       error;
+        };
+    } // namespace Chem
+} // namespace CDPL
+
+#endif // CDPL_CHEM_MAXCOMMONSUBSTRUCTURESEARCHCONTROL_HPP
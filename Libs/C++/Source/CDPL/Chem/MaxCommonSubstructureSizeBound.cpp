@@ -0,0 +1,98 @@
+/*
+ * MaxCommonSubstructureSizeBound.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "StaticInit.hpp"
+
+#include <algorithm>
+
+#include "MaxCommonSubstructureSizeBound.hpp"
+
+
+using namespace CDPL;
+
+
+void Chem::MaxCommonSubstructureSizeBound::setTargetMapped(std::size_t target_idx)
+{
+    mappedTargets.set(target_idx);
+}
+
+void Chem::MaxCommonSubstructureSizeBound::resetTargetMapped(std::size_t target_idx)
+{
+    mappedTargets.reset(target_idx);
+}
+
+bool Chem::MaxCommonSubstructureSizeBound::sizeReachable(std::size_t level, std::size_t curr_size, std::size_t min_size)
+{
+    std::size_t max_size = curr_size;
+
+    if (max_size >= min_size)
+        return true;
+
+    const std::size_t* rem_lc_sizes = &remLabelClassSizes[level * numLabelClasses];
+
+    for (std::size_t i = 0; i < numLabelClasses; i++) {
+        if (rem_lc_sizes[i] == 0)
+            continue;
+
+        tmpTargetMask = labelClassTargetMasks[i];
+        tmpTargetMask -= mappedTargets;
+
+        max_size += std::min(rem_lc_sizes[i], tmpTargetMask.count());
+
+        if (max_size >= min_size)
+            return true;
+    }
+
+    return false;
+}
+
+void Chem::MaxCommonSubstructureSizeBound::addQueryItem(std::size_t query_idx)
+{
+    std::pair<LabelClassMap::iterator, bool> lc_entry = labelClassMap.insert(LabelClassMap::value_type(tmpTargetMask, numLabelClasses));
+
+    if (lc_entry.second) {
+        if (labelClassTargetMasks.size() <= numLabelClasses)
+            labelClassTargetMasks.push_back(tmpTargetMask);
+        else
+            labelClassTargetMasks[numLabelClasses] = tmpTargetMask;
+
+        numLabelClasses++;
+    }
+
+    labelClassIndices[query_idx] = lc_entry.first->second;
+}
+
+void Chem::MaxCommonSubstructureSizeBound::initRemainingClassSizes(std::size_t num_query_items)
+{
+    // remLabelClassSizes[level * numLabelClasses + i]: number of query atoms/bonds of label class i at search levels >= level
+
+    remLabelClassSizes.assign((num_query_items + 1) * numLabelClasses, 0);
+
+    for (std::size_t i = num_query_items; i > 0; i--) {
+        std::copy(remLabelClassSizes.begin() + i * numLabelClasses, remLabelClassSizes.begin() + (i + 1) * numLabelClasses,
+                  remLabelClassSizes.begin() + (i - 1) * numLabelClasses);
+
+        remLabelClassSizes[(i - 1) * numLabelClasses + labelClassIndices[i - 1]]++;
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ * MaxCommonSubstructureSizeBound.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::Chem::MaxCommonSubstructureSizeBound.
+ */
+
+#ifndef CDPL_CHEM_MAXCOMMONSUBSTRUCTURESIZEBOUND_HPP
+#define CDPL_CHEM_MAXCOMMONSUBSTRUCTURESIZEBOUND_HPP
+
+#include <cstddef>
+#include <vector>
+#include <map>
+
+#include "CDPL/Util/BitSet.hpp"
+
+
+namespace CDPL
+{
+
+    namespace Chem
+    {
+
+        /*
+         * Label-class upper bound on the size of the common substructures that can be reached from a node of
+         * the search tree of a maximum common atom/bond substructure search.
+         *
+         * Query atoms (bonds) with identical sets of matching target atoms (bonds) form a label class. Each class
+         * can contribute at most the number of its remaining query members or the number of still unmapped
+         * target atoms (bonds) matching them, whatever is smaller.
+         */
+        class MaxCommonSubstructureSizeBound
+        {
+
+          public:
+            MaxCommonSubstructureSizeBound():
+                numLabelClasses(0) {}
+
+            /*
+             * node_matrix[i] lists the association graph nodes of the query atom/bond at search level i,
+             * target_idx_func(node) returns the index of the target atom/bond of a node.
+             */
+            template <typename NodeMatrix, typename TargetIndexFunc>
+            void init(const NodeMatrix& node_matrix, std::size_t num_query_items, std::size_t num_target_items,
+                      const TargetIndexFunc& target_idx_func);
+
+            void setTargetMapped(std::size_t target_idx);
+
+            void resetTargetMapped(std::size_t target_idx);
+
+            bool sizeReachable(std::size_t level, std::size_t curr_size, std::size_t min_size);
+
+          private:
+            void addQueryItem(std::size_t query_idx);
+
+            void initRemainingClassSizes(std::size_t num_query_items);
+
+            typedef std::vector<Util::BitSet>           BitSetList;
+            typedef std::vector<std::size_t>            SizeTypeArray;
+            typedef std::map<Util::BitSet, std::size_t> LabelClassMap;
+
+            BitSetList    labelClassTargetMasks;
+            SizeTypeArray labelClassIndices;
+            SizeTypeArray remLabelClassSizes;
+            LabelClassMap labelClassMap;
+            Util::BitSet  mappedTargets;
+            Util::BitSet  tmpTargetMask;
+            std::size_t   numLabelClasses;
+        };
+    } // namespace Chem
+} // namespace CDPL
+
+
+// Implementation
+
+template <typename NodeMatrix, typename TargetIndexFunc>
+void CDPL::Chem::MaxCommonSubstructureSizeBound::init(const NodeMatrix& node_matrix, std::size_t num_query_items, std::size_t num_target_items,
+                                                      const TargetIndexFunc& target_idx_func)
+{
+    labelClassIndices.resize(num_query_items);
+    labelClassMap.clear();
+    tmpTargetMask.resize(num_target_items);
+    numLabelClasses = 0;
+
+    for (std::size_t i = 0; i < num_query_items; i++) {
+        tmpTargetMask.reset();
+
+        for (typename NodeMatrix::value_type::const_iterator it = node_matrix[i].begin(), end = node_matrix[i].end(); it != end; ++it)
+            tmpTargetMask.set(target_idx_func(*it));
+
+        addQueryItem(i);
+    }
+
+    initRemainingClassSizes(num_query_items);
+
+    mappedTargets.resize(num_target_items);
+    mappedTargets.reset();
+}
+
+#endif // CDPL_CHEM_MAXCOMMONSUBSTRUCTURESIZEBOUND_HPP
@@ -32,14 +32,7 @@ using namespace CDPL;
 
 void Chem::calcBasicProperties(MolecularGraph& molgraph, bool overwrite)
 {
-    perceiveComponents(molgraph, overwrite);
-    perceiveSSSR(molgraph, overwrite);
-    setRingFlags(molgraph, overwrite);
-
-    calcImplicitHydrogenCounts(molgraph, overwrite);
-    perceiveHybridizationStates(molgraph, overwrite);
-
-    setAromaticityFlags(molgraph, overwrite);
+    prepareMolecularGraph(molgraph, PerceptionFlag::BASIC_PROPERTIES, overwrite);
 }
 
 void Chem::initSubstructureSearchQuery(MolecularGraph& molgraph, bool overwrite)
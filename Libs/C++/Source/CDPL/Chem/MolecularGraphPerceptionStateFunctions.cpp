@@ -0,0 +1,328 @@
+/* 
+ * MolecularGraphPerceptionStateFunctions.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "StaticInit.hpp"
+
+#include <atomic>
+
+#include <boost/functional/hash.hpp>
+
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/MolecularGraphProperty.hpp"
+#include "CDPL/Chem/Atom.hpp"
+#include "CDPL/Chem/Bond.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/BondFunctions.hpp"
+
+
+using namespace CDPL; 
+
+
+namespace
+{
+
+    struct PerceptionStateData
+    {
+
+        const Chem::MolecularGraph* molGraph;
+        std::size_t                 numAtoms;
+        std::size_t                 numBonds;
+        std::size_t                 structHash;
+        unsigned int                flags;
+    };
+
+    std::atomic<std::size_t> numPerformedPerceptions(0);
+    std::atomic<std::size_t> numSkippedPerceptions(0);
+
+    // covers all atom and bond properties that are read by the recorded perception steps
+
+    std::size_t calcStructureHash(const Chem::MolecularGraph& molgraph)
+    {
+        using namespace Chem;
+
+        std::size_t hash = 0;
+
+        for (MolecularGraph::ConstAtomIterator it = molgraph.getAtomsBegin(), end = molgraph.getAtomsEnd(); it != end; ++it) {
+            const Atom& atom = *it;
+
+            boost::hash_combine(hash, getType(atom));
+            boost::hash_combine(hash, getIsotope(atom));
+            boost::hash_combine(hash, getFormalCharge(atom));
+            boost::hash_combine(hash, getUnpairedElectronCount(atom));
+        }
+
+        for (MolecularGraph::ConstBondIterator it = molgraph.getBondsBegin(), end = molgraph.getBondsEnd(); it != end; ++it) {
+            const Bond& bond = *it;
+
+            boost::hash_combine(hash, molgraph.getAtomIndex(bond.getBegin()));
+            boost::hash_combine(hash, molgraph.getAtomIndex(bond.getEnd()));
+            boost::hash_combine(hash, getOrder(bond));
+        }
+
+        return hash;
+    }
+
+    const PerceptionStateData* getValidStateData(const Chem::MolecularGraph& molgraph, std::size_t struct_hash)
+    {
+        const Base::Any& val = molgraph.getProperty(Chem::MolecularGraphProperty::PERCEPTION_STATE, false);
+
+        if (val.isEmpty())
+            return 0;
+
+        const PerceptionStateData& data = val.getData<PerceptionStateData>();
+
+        // states copied from other molecular graphs refer to foreign atoms and bonds and thus are never valid
+
+        if (data.molGraph != &molgraph || data.numAtoms != molgraph.getNumAtoms() || data.numBonds != molgraph.getNumBonds())
+            return 0;
+
+        if (data.structHash != struct_hash)
+            return 0;
+
+        return &data;
+    }
+
+    void setStateData(Chem::MolecularGraph& molgraph, std::size_t struct_hash, unsigned int flags)
+    {
+        PerceptionStateData data;
+
+        data.molGraph = &molgraph;
+        data.numAtoms = molgraph.getNumAtoms();
+        data.numBonds = molgraph.getNumBonds();
+        data.structHash = struct_hash;
+        data.flags = flags;
+
+        molgraph.setProperty(Chem::MolecularGraphProperty::PERCEPTION_STATE, data);
+    }
+
+    struct ResultStatus
+    {
+
+        bool anyPresent;
+        bool allPresent;
+    };
+
+    template <typename T, typename Iter>
+    void updateResultStatus(Iter beg, Iter end, bool (*has_prop_func)(const T&), ResultStatus& status)
+    {
+        for ( ; beg != end; ++beg) {
+            if (has_prop_func(*beg))
+                status.anyPresent = true;
+            else
+                status.allPresent = false;
+        }
+    }
+
+    ResultStatus getResultStatus(const Chem::MolecularGraph& molgraph, unsigned int step)
+    {
+        using namespace Chem;
+
+        ResultStatus status = { false, true };
+
+        switch (step) {
+
+            case PerceptionFlag::COMPONENTS:
+                status.anyPresent = status.allPresent = hasComponents(molgraph);
+                break;
+
+            case PerceptionFlag::SSSR:
+                status.anyPresent = status.allPresent = hasSSSR(molgraph);
+                break;
+
+            case PerceptionFlag::RING_FLAGS:
+                updateResultStatus<Atom>(molgraph.getAtomsBegin(), molgraph.getAtomsEnd(), &hasRingFlag, status);
+                updateResultStatus<Bond>(molgraph.getBondsBegin(), molgraph.getBondsEnd(), &hasRingFlag, status);
+                break;
+
+            case PerceptionFlag::IMPLICIT_H_COUNTS:
+                updateResultStatus<Atom>(molgraph.getAtomsBegin(), molgraph.getAtomsEnd(), &hasImplicitHydrogenCount, status);
+                break;
+
+            case PerceptionFlag::HYBRIDIZATION_STATES:
+                updateResultStatus<Atom>(molgraph.getAtomsBegin(), molgraph.getAtomsEnd(), &hasHybridizationState, status);
+                break;
+
+            case PerceptionFlag::AROMATICITY_FLAGS:
+                updateResultStatus<Atom>(molgraph.getAtomsBegin(), molgraph.getAtomsEnd(), &hasAromaticityFlag, status);
+                updateResultStatus<Bond>(molgraph.getBondsBegin(), molgraph.getBondsEnd(), &hasAromaticityFlag, status);
+                break;
+
+            case PerceptionFlag::CIP_PRIORITIES:
+                updateResultStatus<Atom>(molgraph.getAtomsBegin(), molgraph.getAtomsEnd(), &hasCIPPriority, status);
+                break;
+
+            case PerceptionFlag::TOPOLOGICAL_DISTANCE_MATRIX:
+                status.anyPresent = status.allPresent = hasTopologicalDistanceMatrix(molgraph);
+                break;
+        }
+
+        return status;
+    }
+
+    void performStep(Chem::MolecularGraph& molgraph, unsigned int step, bool overwrite)
+    {
+        using namespace Chem;
+
+        switch (step) {
+
+            case PerceptionFlag::COMPONENTS:
+                perceiveComponents(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::SSSR:
+                perceiveSSSR(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::RING_FLAGS:
+                setRingFlags(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::IMPLICIT_H_COUNTS:
+                calcImplicitHydrogenCounts(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::HYBRIDIZATION_STATES:
+                perceiveHybridizationStates(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::AROMATICITY_FLAGS:
+                setAromaticityFlags(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::CIP_PRIORITIES:
+                calcCIPPriorities(molgraph, overwrite);
+                return;
+
+            case PerceptionFlag::TOPOLOGICAL_DISTANCE_MATRIX:
+                calcTopologicalDistanceMatrix(molgraph, overwrite);
+                return;
+        }
+    }
+
+    // perception steps in an order that respects their dependencies (and in ascending flag value order)
+
+    const unsigned int PERCEPTION_STEPS[] = {
+        Chem::PerceptionFlag::COMPONENTS,
+        Chem::PerceptionFlag::SSSR,
+        Chem::PerceptionFlag::RING_FLAGS,
+        Chem::PerceptionFlag::IMPLICIT_H_COUNTS,
+        Chem::PerceptionFlag::HYBRIDIZATION_STATES,
+        Chem::PerceptionFlag::AROMATICITY_FLAGS,
+        Chem::PerceptionFlag::CIP_PRIORITIES,
+        Chem::PerceptionFlag::TOPOLOGICAL_DISTANCE_MATRIX
+    };
+}
+
+
+unsigned int Chem::getPerceptionState(const MolecularGraph& molgraph)
+{
+    const PerceptionStateData* data = getValidStateData(molgraph, calcStructureHash(molgraph));
+
+    return (data ? data->flags : PerceptionFlag::NONE);
+}
+
+void Chem::setPerceptionState(MolecularGraph& molgraph, unsigned int flags)
+{
+    setStateData(molgraph, calcStructureHash(molgraph), flags);
+}
+
+void Chem::clearPerceptionState(MolecularGraph& molgraph)
+{
+    molgraph.removeProperty(MolecularGraphProperty::PERCEPTION_STATE);
+}
+
+void Chem::prepareMolecularGraph(MolecularGraph& molgraph, unsigned int flags, bool overwrite)
+{
+    // the carried out perception steps do not modify any of the data the structure hash is based on
+
+    std::size_t struct_hash = calcStructureHash(molgraph);
+    const PerceptionStateData* data = getValidStateData(molgraph, struct_hash);
+    unsigned int done_flags = (data ? data->flags : PerceptionFlag::NONE);
+    unsigned int new_done_flags = done_flags;
+    std::size_t num_performed = 0;
+    std::size_t num_skipped = 0;
+
+    bool valid_inputs = true;
+
+    for (unsigned int step : PERCEPTION_STEPS) {
+        if ((flags & ~(step - 1)) == 0) // no more requested steps
+            break;
+
+        if (!(flags & step)) {
+            // present results of unrecorded steps might be outdated and get used as input by subsequent steps
+
+            if (valid_inputs && !(done_flags & step) && getResultStatus(molgraph, step).anyPresent)
+                valid_inputs = false;
+
+            continue;
+        }
+
+        // a recorded step only gets skipped if its results have not been cleared in the meantime
+
+        ResultStatus status = getResultStatus(molgraph, step);
+
+        if ((done_flags & step) && status.allPresent) {
+            num_skipped++;
+            continue;
+        }
+
+        performStep(molgraph, step, overwrite);
+        num_performed++;
+
+        // without overwrite, present property values are kept and thus must either be absent or recorded as valid
+
+        if (valid_inputs && (overwrite || !status.anyPresent || (done_flags & step))) {
+            new_done_flags |= step;
+            continue;
+        }
+
+        new_done_flags &= ~step;
+        valid_inputs = false;
+    }
+
+    if (num_skipped > 0)
+        numSkippedPerceptions.fetch_add(num_skipped, std::memory_order_relaxed);
+
+    if (num_performed > 0)
+        numPerformedPerceptions.fetch_add(num_performed, std::memory_order_relaxed);
+
+    if (new_done_flags != done_flags)
+        setStateData(molgraph, struct_hash, new_done_flags);
+}
+
+std::size_t Chem::getNumPerformedPerceptions()
+{
+    return numPerformedPerceptions.load(std::memory_order_relaxed);
+}
+
+std::size_t Chem::getNumSkippedPerceptions()
+{
+    return numSkippedPerceptions.load(std::memory_order_relaxed);
+}
+
+void Chem::resetPerceptionCounters()
+{
+    numPerformedPerceptions.store(0, std::memory_order_relaxed);
+    numSkippedPerceptions.store(0, std::memory_order_relaxed);
+}
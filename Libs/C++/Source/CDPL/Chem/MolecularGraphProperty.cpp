@@ -63,6 +63,8 @@ namespace CDPL
 
             CDPL_DEFINE_LOOKUP_KEY(HASH_CODE);
 
+            CDPL_DEFINE_LOOKUP_KEY(PERCEPTION_STATE);
+
             CDPL_DEFINE_LOOKUP_KEY(MDL_USER_INITIALS);
             CDPL_DEFINE_LOOKUP_KEY(MDL_PROGRAM_NAME);
             CDPL_DEFINE_LOOKUP_KEY(MDL_DIMENSIONALITY);
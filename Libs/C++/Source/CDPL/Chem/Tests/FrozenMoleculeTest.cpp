@@ -0,0 +1,293 @@
+/* 
+ * FrozenMoleculeTest.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <vector>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Chem/FrozenMolecule.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/Fragment.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/BondFunctions.hpp"
+#include "CDPL/Chem/Entity3DFunctions.hpp"
+#include "CDPL/Chem/AtomType.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+namespace
+{
+
+    void checkStructure(const CDPL::Chem::MolecularGraph& molgraph, const CDPL::Chem::FrozenMolecule& mol)
+    {
+        using namespace CDPL;
+        using namespace Chem;
+
+        BOOST_CHECK(mol.getNumAtoms() == molgraph.getNumAtoms());
+        BOOST_CHECK(mol.getNumBonds() == molgraph.getNumBonds());
+        BOOST_CHECK(mol.getNeighborOffsets().getSize() == mol.getNumAtoms() + 1);
+        BOOST_CHECK(mol.getNeighborAtomIndices().getSize() == mol.getNumBonds() * 2);
+        BOOST_CHECK(mol.getNeighborBondIndices().getSize() == mol.getNumBonds() * 2);
+
+        for (std::size_t i = 0; i < mol.getNumAtoms(); i++) {
+            const Atom& atom = mol.getAtom(i);
+            const Atom& src_atom = molgraph.getAtom(i);
+
+            BOOST_CHECK(mol.containsAtom(atom));
+            BOOST_CHECK(mol.getAtomIndex(atom) == i);
+            BOOST_CHECK(&atom.getMolecule() == &mol);
+            BOOST_CHECK(getType(atom) == getType(src_atom));
+
+            // only neighbors that are part of the source molecular graph are present
+
+            std::vector<std::size_t> src_nbr_atoms, src_nbr_bonds;
+
+            for (std::size_t j = 0; j < src_atom.getNumAtoms(); j++) {
+                if (!molgraph.containsAtom(src_atom.getAtom(j)) || !molgraph.containsBond(src_atom.getBond(j)))
+                    continue;
+
+                src_nbr_atoms.push_back(molgraph.getAtomIndex(src_atom.getAtom(j)));
+                src_nbr_bonds.push_back(molgraph.getBondIndex(src_atom.getBond(j)));
+            }
+
+            BOOST_CHECK(atom.getNumAtoms() == src_nbr_atoms.size());
+            BOOST_CHECK(atom.getNumBonds() == src_nbr_bonds.size());
+            BOOST_CHECK(mol.getNeighborOffsets()[i + 1] - mol.getNeighborOffsets()[i] == atom.getNumAtoms());
+
+            for (std::size_t j = 0; j < atom.getNumAtoms() && j < src_nbr_atoms.size(); j++) {
+                const Atom& nbr_atom = atom.getAtom(j);
+                const Bond& nbr_bond = atom.getBond(j);
+
+                BOOST_CHECK(nbr_atom.getIndex() == src_nbr_atoms[j]);
+                BOOST_CHECK(nbr_bond.getIndex() == src_nbr_bonds[j]);
+                BOOST_CHECK(mol.getNeighborAtomIndices()[mol.getNeighborOffsets()[i] + j] == nbr_atom.getIndex());
+                BOOST_CHECK(mol.getNeighborBondIndices()[mol.getNeighborOffsets()[i] + j] == nbr_bond.getIndex());
+
+                BOOST_CHECK(atom.containsAtom(nbr_atom));
+                BOOST_CHECK(atom.containsBond(nbr_bond));
+                BOOST_CHECK(atom.getAtomIndex(nbr_atom) == j);
+                BOOST_CHECK(atom.getBondIndex(nbr_bond) == j);
+                BOOST_CHECK(&atom.getBondToAtom(nbr_atom) == &nbr_bond);
+                BOOST_CHECK(atom.findBondToAtom(nbr_atom) == &nbr_bond);
+                BOOST_CHECK(&nbr_bond.getNeighbor(atom) == &nbr_atom);
+                BOOST_CHECK(&nbr_bond.getNeighbor(nbr_atom) == &atom);
+            }
+
+            BOOST_CHECK(!atom.containsAtom(atom));
+            BOOST_CHECK(!atom.findBondToAtom(atom));
+            BOOST_CHECK_THROW(atom.getBondToAtom(atom), Base::ItemNotFound);
+            BOOST_CHECK_THROW(atom.getAtomIndex(atom), Base::ItemNotFound);
+            BOOST_CHECK_THROW(atom.getAtom(atom.getNumAtoms()), Base::IndexError);
+            BOOST_CHECK_THROW(atom.getBond(atom.getNumBonds()), Base::IndexError);
+        }
+
+        for (std::size_t i = 0; i < mol.getNumBonds(); i++) {
+            const Bond& bond = mol.getBond(i);
+            const Bond& src_bond = molgraph.getBond(i);
+
+            BOOST_CHECK(mol.containsBond(bond));
+            BOOST_CHECK(mol.getBondIndex(bond) == i);
+            BOOST_CHECK(&bond.getMolecule() == &mol);
+            BOOST_CHECK(getOrder(bond) == getOrder(src_bond));
+            BOOST_CHECK(bond.getBegin().getIndex() == molgraph.getAtomIndex(src_bond.getBegin()));
+            BOOST_CHECK(bond.getEnd().getIndex() == molgraph.getAtomIndex(src_bond.getEnd()));
+            BOOST_CHECK(&bond.getAtom(0) == &bond.getBegin());
+            BOOST_CHECK(&bond.getAtom(1) == &bond.getEnd());
+            BOOST_CHECK(bond.getAtomIndex(bond.getBegin()) == 0);
+            BOOST_CHECK(bond.getAtomIndex(bond.getEnd()) == 1);
+            BOOST_CHECK_THROW(bond.getAtom(2), Base::IndexError);
+        }
+
+        BOOST_CHECK_THROW(mol.getAtom(mol.getNumAtoms()), Base::IndexError);
+        BOOST_CHECK_THROW(mol.getBond(mol.getNumBonds()), Base::IndexError);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(FrozenMoleculeTest)
+{
+    using namespace CDPL;
+    using namespace Chem;
+    using namespace Base;
+
+    FrozenMolecule mol1;
+
+    BOOST_CHECK(mol1.getNumAtoms() == 0);
+    BOOST_CHECK(mol1.getNumBonds() == 0);
+    BOOST_CHECK(mol1.getNeighborOffsets().getSize() == 1);
+    BOOST_CHECK(mol1.getAtomTypes().isEmpty());
+    BOOST_CHECK(mol1.getAtom3DCoordinates().isEmpty());
+
+    BOOST_CHECK_THROW(mol1.getAtom(0), IndexError);
+    BOOST_CHECK_THROW(mol1.getBond(0), IndexError);
+
+//-----
+
+    BasicMolecule src_mol;
+
+    for (std::size_t i = 0; i < 6; i++) {
+        Atom& atom = src_mol.addAtom();
+
+        setType(atom, i == 5 ? AtomType::N : AtomType::C);
+        setFormalCharge(atom, i == 5 ? 1 : 0);
+        setImplicitHydrogenCount(atom, i == 5 ? 0 : 1);
+        setAromaticityFlag(atom, true);
+        setRingFlag(atom, true);
+        set3DCoordinates(atom, Math::vec(double(i), 1.0, 2.0));
+    }
+
+    for (std::size_t i = 0; i < 6; i++) {
+        Bond& bond = src_mol.addBond(i, (i + 1) % 6);
+
+        setOrder(bond, i % 2 + 1);
+        setAromaticityFlag(bond, true);
+        setRingFlag(bond, true);
+    }
+
+    Atom& methyl_atom = src_mol.addAtom();
+
+    setType(methyl_atom, AtomType::C);
+    setImplicitHydrogenCount(methyl_atom, 3);
+    setAromaticityFlag(methyl_atom, false);
+    setRingFlag(methyl_atom, false);
+    set3DCoordinates(methyl_atom, Math::vec(6.0, 1.0, 2.0));
+
+    Bond& methyl_bond = src_mol.addBond(0, 6);
+
+    setOrder(methyl_bond, 1);
+    setAromaticityFlag(methyl_bond, false);
+    setRingFlag(methyl_bond, false);
+
+    FrozenMolecule mol2(src_mol);
+
+    checkStructure(src_mol, mol2);
+
+    BOOST_CHECK(mol2.getAtom(0).getNumAtoms() == 3);
+    BOOST_CHECK(mol2.getAtom(6).getNumAtoms() == 1);
+
+    BOOST_CHECK(mol2.getAtomTypes()[5] == AtomType::N);
+    BOOST_CHECK(mol2.getAtomTypes()[6] == AtomType::C);
+    BOOST_CHECK(mol2.getAtomFormalCharges()[5] == 1);
+    BOOST_CHECK(mol2.getAtomFormalCharges()[0] == 0);
+    BOOST_CHECK(mol2.getAtomImplicitHydrogenCounts()[5] == 0);
+    BOOST_CHECK(mol2.getAtomImplicitHydrogenCounts()[6] == 3);
+    BOOST_CHECK(mol2.getAromaticAtomMask().count() == 6);
+    BOOST_CHECK(!mol2.getAromaticAtomMask().test(6));
+    BOOST_CHECK(mol2.getRingAtomMask().count() == 6);
+    BOOST_CHECK(mol2.getAtom3DCoordinates().getSize() == 7);
+    BOOST_CHECK(mol2.getAtom3DCoordinates()[6](0) == 6.0);
+    BOOST_CHECK(mol2.getBondOrders()[1] == 2);
+    BOOST_CHECK(mol2.getBondOrders()[6] == 1);
+    BOOST_CHECK(mol2.getAromaticBondMask().count() == 6);
+    BOOST_CHECK(mol2.getRingBondMask().count() == 6);
+    BOOST_CHECK(!mol2.getRingBondMask().test(6));
+
+//-----
+
+    setFormalCharge(mol2.getAtom(0), -1);
+
+    BOOST_CHECK(mol2.getAtomFormalCharges()[0] == 0);
+
+    mol2.updatePropertyArrays();
+
+    BOOST_CHECK(mol2.getAtomFormalCharges()[0] == -1);
+
+    clear3DCoordinates(mol2.getAtom(3));
+    mol2.updatePropertyArrays();
+
+    BOOST_CHECK(mol2.getAtom3DCoordinates().isEmpty());
+
+//-----
+
+    BOOST_CHECK_THROW(mol2.addAtom(), OperationFailed);
+    BOOST_CHECK_THROW(mol2.removeAtom(0), OperationFailed);
+    BOOST_CHECK_THROW(mol2.addBond(0, 2), OperationFailed);
+    BOOST_CHECK_THROW(mol2.removeBond(0), OperationFailed);
+    BOOST_CHECK_THROW(mol2.append(src_mol), OperationFailed);
+    BOOST_CHECK_THROW(mol2.remove(src_mol), OperationFailed);
+
+    BOOST_CHECK(mol2.getNumAtoms() == 7);
+    BOOST_CHECK(mol2.getNumBonds() == 7);
+
+    BOOST_CHECK(!mol2.containsAtom(src_mol.getAtom(0)));
+    BOOST_CHECK(!mol2.containsBond(src_mol.getBond(0)));
+    BOOST_CHECK(!mol2.getAtom(0).containsAtom(src_mol.getAtom(1)));
+    BOOST_CHECK_THROW(mol2.getAtomIndex(src_mol.getAtom(0)), ItemNotFound);
+    BOOST_CHECK_THROW(mol2.getBondIndex(src_mol.getBond(0)), ItemNotFound);
+
+//-----
+
+    Atom& atom0 = mol2.getAtom(0);
+
+    atom0.orderAtoms([](const Atom& atom1, const Atom& atom2) { return (atom1.getIndex() > atom2.getIndex()); });
+
+    BOOST_CHECK(atom0.getAtom(0).getIndex() == 6);
+    BOOST_CHECK(atom0.getAtom(2).getIndex() == 1);
+    BOOST_CHECK(atom0.getBond(0).getIndex() == 6);
+    BOOST_CHECK(atom0.getBond(2).getIndex() == 0);
+    BOOST_CHECK(atom0.getAtomIndex(mol2.getAtom(6)) == 0);
+
+    atom0.orderBonds([](const Bond& bond1, const Bond& bond2) { return (bond1.getIndex() < bond2.getIndex()); });
+
+    BOOST_CHECK(atom0.getAtom(0).getIndex() == 1);
+    BOOST_CHECK(atom0.getBond(0).getIndex() == 0);
+
+//-----
+
+    Fragment frag;
+
+    frag.addBond(src_mol.getBond(3));
+    frag.addBond(src_mol.getBond(4));
+
+    FrozenMolecule mol3(frag);
+
+    checkStructure(frag, mol3);
+
+    BOOST_CHECK(mol3.getNumAtoms() == 3);
+    BOOST_CHECK(mol3.getNumBonds() == 2);
+    BOOST_CHECK(mol3.getAtomTypes()[2] == AtomType::N);
+
+//-----
+
+    FrozenMolecule mol4(mol3);
+
+    checkStructure(mol3, mol4);
+
+    mol4 = src_mol;
+
+    checkStructure(src_mol, mol4);
+
+    MolecularGraph::SharedPointer mol5 = mol4.clone();
+
+    BOOST_CHECK(dynamic_cast<FrozenMolecule*>(mol5.get()) != 0);
+
+    checkStructure(src_mol, static_cast<const FrozenMolecule&>(*mol5));
+
+    mol4.clear();
+
+    BOOST_CHECK(mol4.getNumAtoms() == 0);
+    BOOST_CHECK(mol4.getNumBonds() == 0);
+    BOOST_CHECK(mol4.getNeighborOffsets().getSize() == 1);
+    BOOST_CHECK(mol4.getBondOrders().isEmpty());
+}
@@ -0,0 +1,166 @@
+/*
+ * MaxCommonBondSubstructureSearchTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <thread>
+#include <chrono>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Chem/MaxCommonBondSubstructureSearch.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/UtilityFunctions.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+
+#include "MaxCommonSubstructureSearchTestUtils.hpp"
+
+
+BOOST_AUTO_TEST_CASE(MaxCommonBondSubstructureSearchResultTest)
+{
+    using namespace CDPL;
+    using namespace Chem;
+
+    BasicMolecule query, target;
+
+    for (const auto& smiles : MCS_TEST_PAIRS) {
+        BOOST_CHECK(parseSMILES(smiles[0], query));
+        BOOST_CHECK(parseSMILES(smiles[1], target));
+
+        initSubstructureSearchQuery(query, false);
+        initSubstructureSearchTarget(target, false);
+
+        MaxCommonSubstructures exp_result;
+
+        MaxCommonSubstructureEnumerator(query, target, exp_result);
+
+        BOOST_CHECK(exp_result.maxNumBonds > 0);
+
+        // the label-class pruned searches (single- and multi-threaded) have to find exactly the mappings
+        // of the exhaustive enumeration
+
+        for (std::size_t num_threads : { 0, 4 }) {
+            MaxCommonBondSubstructureSearch mcss(query);
+
+            mcss.setNumThreads(num_threads);
+
+            BOOST_CHECK(mcss.mappingExists(target));
+            BOOST_CHECK(!mcss.searchAborted());
+
+            BOOST_CHECK(mcss.findMappings(target));
+            BOOST_CHECK(!mcss.searchAborted());
+            BOOST_CHECK_EQUAL(mcss.getNumMappings(), exp_result.bondMappings.size());
+            BOOST_CHECK(getMappingKeys(mcss, query, target, &getBondMappingKey) == exp_result.bondMappings);
+
+            mcss.uniqueMappingsOnly(true);
+
+            BOOST_CHECK(mcss.findMappings(target));
+            BOOST_CHECK_EQUAL(mcss.getNumMappings(), exp_result.bondSubstructures.size());
+            BOOST_CHECK(getMappingKeys(mcss, query, target, &getSubstructureKey) == exp_result.bondSubstructures);
+
+            mcss.setMinSubstructureSize(exp_result.maxNumBonds);
+
+            BOOST_CHECK(mcss.mappingExists(target));
+
+            mcss.setMinSubstructureSize(exp_result.maxNumBonds + 1);
+
+            BOOST_CHECK(!mcss.mappingExists(target));
+            BOOST_CHECK(!mcss.findMappings(target));
+            BOOST_CHECK(mcss.getNumMappings() == 0);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MaxCommonBondSubstructureSearchBudgetTest)
+{
+    using namespace CDPL;
+    using namespace Chem;
+
+    BasicMolecule query, target;
+
+    BOOST_CHECK(parseSMILES(MCS_HARD_PAIR[0], query));
+    BOOST_CHECK(parseSMILES(MCS_HARD_PAIR[1], target));
+
+    initSubstructureSearchQuery(query, false);
+    initSubstructureSearchTarget(target, false);
+
+    MaxCommonBondSubstructureSearch mcss(query);
+
+    for (std::size_t num_threads : { 0, 4 }) {
+        mcss.setNumThreads(num_threads);
+
+        // node limit
+
+        mcss.setMaxNumSearchNodes(1000);
+
+        mcss.findMappings(target);
+
+        BOOST_CHECK(mcss.searchAborted());
+
+        for (std::size_t i = 1; i < mcss.getNumMappings(); i++)
+            BOOST_CHECK_EQUAL(mcss.getMapping(i).getBondMapping().getSize(), mcss.getMapping(0).getBondMapping().getSize());
+
+        mcss.setMaxNumSearchNodes(0);
+
+        // abort callback
+
+        std::size_t num_calls = 0;
+
+        mcss.setAbortCallback([&num_calls]() { return (++num_calls == 3); });
+
+        mcss.findMappings(target);
+
+        BOOST_CHECK(mcss.searchAborted());
+        BOOST_CHECK_EQUAL(num_calls, 3);
+
+        // timeout - the callback ensures that the time limit gets exceeded
+
+        mcss.setTimeout(1);
+        mcss.setAbortCallback([]() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); return false; });
+
+        mcss.findMappings(target);
+
+        BOOST_CHECK(mcss.searchAborted());
+
+        mcss.setTimeout(0);
+        mcss.setAbortCallback(MaxCommonBondSubstructureSearch::CallbackFunction());
+    }
+
+    // searches that complete within the budget are not reported as aborted
+
+    BOOST_CHECK(parseSMILES(MCS_TEST_PAIRS[0][0], query));
+    BOOST_CHECK(parseSMILES(MCS_TEST_PAIRS[0][1], target));
+
+    initSubstructureSearchQuery(query, false);
+    initSubstructureSearchTarget(target, false);
+
+    mcss.setQuery(query);
+    mcss.setMaxNumSearchNodes(1000000);
+    mcss.setTimeout(1000000);
+
+    for (std::size_t num_threads : { 0, 4 }) {
+        mcss.setNumThreads(num_threads);
+
+        BOOST_CHECK(mcss.findMappings(target));
+        BOOST_CHECK(!mcss.searchAborted());
+    }
+}
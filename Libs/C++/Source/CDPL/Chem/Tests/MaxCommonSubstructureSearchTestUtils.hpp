@@ -0,0 +1,307 @@
+/*
+ * MaxCommonSubstructureSearchTestUtils.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cstddef>
+
+#include "CDPL/Chem/MolecularGraph.hpp"
+#include "CDPL/Chem/Atom.hpp"
+#include "CDPL/Chem/Bond.hpp"
+#include "CDPL/Chem/AtomBondMapping.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/BondFunctions.hpp"
+#include "CDPL/Base/Any.hpp"
+
+
+namespace
+{
+
+    typedef std::vector<std::size_t> IndexArray;
+    typedef std::set<IndexArray>     MappingSet;
+
+    const std::size_t KEY_SEPARATOR = std::size_t(-1);
+
+    /*
+     * Results of an exhaustive enumeration of all partial atom mappings (no pruning) which serve as reference for
+     * the maximum common substructure searches.
+     */
+    struct MaxCommonSubstructures
+    {
+
+        MaxCommonSubstructures():
+            maxNumAtoms(0), maxNumBondsAtMaxAtoms(0), maxNumBonds(0) {}
+
+        std::size_t maxNumAtoms;
+        std::size_t maxNumBondsAtMaxAtoms;
+        std::size_t maxNumBonds;
+        MappingSet  atomMappings;            // atom mappings of maximum size
+        MappingSet  atomSubstructures;       // substructure keys of the atom mappings of maximum size
+        MappingSet  maxBondAtomMappings;     // atom mappings of maximum size with the maximum number of mapped bonds
+        MappingSet  maxBondAtomSubstructures;
+        MappingSet  bondMappings;            // bond mappings of maximum size
+        MappingSet  bondSubstructures;
+    };
+
+    // key of the mapped query and target atoms and bonds (as used for the uniqueness check of found mappings)
+
+    inline IndexArray makeSubstructureKey(IndexArray& qry_atoms, IndexArray& tgt_atoms, IndexArray& qry_bonds, IndexArray& tgt_bonds)
+    {
+        IndexArray key;
+
+        for (IndexArray* indices : { &qry_atoms, &tgt_atoms, &qry_bonds, &tgt_bonds }) {
+            std::sort(indices->begin(), indices->end());
+
+            indices->erase(std::unique(indices->begin(), indices->end()), indices->end());
+
+            key.insert(key.end(), indices->begin(), indices->end());
+            key.push_back(KEY_SEPARATOR);
+        }
+
+        return key;
+    }
+
+    inline IndexArray getAtomMappingKey(const CDPL::Chem::AtomBondMapping& mapping, const CDPL::Chem::MolecularGraph& query,
+                                        const CDPL::Chem::MolecularGraph& target)
+    {
+        using namespace CDPL;
+        using namespace Chem;
+
+        IndexArray key(query.getNumAtoms(), KEY_SEPARATOR);
+
+        for (AtomMapping::ConstEntryIterator it = mapping.getAtomMapping().getEntriesBegin(), end = mapping.getAtomMapping().getEntriesEnd(); it != end; ++it)
+            key[query.getAtomIndex(*it->first)] = target.getAtomIndex(*it->second);
+
+        return key;
+    }
+
+    inline IndexArray getBondMappingKey(const CDPL::Chem::AtomBondMapping& mapping, const CDPL::Chem::MolecularGraph& query,
+                                        const CDPL::Chem::MolecularGraph& target)
+    {
+        using namespace CDPL;
+        using namespace Chem;
+
+        IndexArray key(query.getNumBonds(), KEY_SEPARATOR);
+
+        for (BondMapping::ConstEntryIterator it = mapping.getBondMapping().getEntriesBegin(), end = mapping.getBondMapping().getEntriesEnd(); it != end; ++it)
+            key[query.getBondIndex(*it->first)] = target.getBondIndex(*it->second);
+
+        return key;
+    }
+
+    inline IndexArray getSubstructureKey(const CDPL::Chem::AtomBondMapping& mapping, const CDPL::Chem::MolecularGraph& query,
+                                         const CDPL::Chem::MolecularGraph& target)
+    {
+        using namespace CDPL;
+        using namespace Chem;
+
+        IndexArray qry_atoms, tgt_atoms, qry_bonds, tgt_bonds;
+
+        for (AtomMapping::ConstEntryIterator it = mapping.getAtomMapping().getEntriesBegin(), end = mapping.getAtomMapping().getEntriesEnd(); it != end; ++it) {
+            qry_atoms.push_back(query.getAtomIndex(*it->first));
+            tgt_atoms.push_back(target.getAtomIndex(*it->second));
+        }
+
+        for (BondMapping::ConstEntryIterator it = mapping.getBondMapping().getEntriesBegin(), end = mapping.getBondMapping().getEntriesEnd(); it != end; ++it) {
+            qry_bonds.push_back(query.getBondIndex(*it->first));
+            tgt_bonds.push_back(target.getBondIndex(*it->second));
+        }
+
+        return makeSubstructureKey(qry_atoms, tgt_atoms, qry_bonds, tgt_bonds);
+    }
+
+    template <typename SearchType, typename KeyFunc>
+    MappingSet getMappingKeys(const SearchType& search, const CDPL::Chem::MolecularGraph& query, const CDPL::Chem::MolecularGraph& target,
+                              KeyFunc key_func)
+    {
+        MappingSet keys;
+
+        for (typename SearchType::ConstMappingIterator it = search.getMappingsBegin(), end = search.getMappingsEnd(); it != end; ++it)
+            keys.insert(key_func(*it, query, target));
+
+        return keys;
+    }
+
+    class MaxCommonSubstructureEnumerator
+    {
+
+      public:
+        MaxCommonSubstructureEnumerator(const CDPL::Chem::MolecularGraph& query, const CDPL::Chem::MolecularGraph& target,
+                                        MaxCommonSubstructures& result):
+            query(query), target(target), result(result), atomMapping(query.getNumAtoms(), KEY_SEPARATOR),
+            mappedTargetAtoms(target.getNumAtoms(), false)
+        {
+            enumerate(0);
+        }
+
+      private:
+        void enumerate(std::size_t qry_atom_idx)
+        {
+            using namespace CDPL;
+            using namespace Chem;
+
+            if (qry_atom_idx == query.getNumAtoms()) {
+                processMapping();
+                return;
+            }
+
+            const Atom& qry_atom = query.getAtom(qry_atom_idx);
+            const MatchExpression<Atom, MolecularGraph>& expr = *getMatchExpression(qry_atom);
+
+            for (std::size_t i = 0; i < target.getNumAtoms(); i++) {
+                if (mappedTargetAtoms[i] || !expr(qry_atom, query, target.getAtom(i), target, Base::Any()))
+                    continue;
+
+                atomMapping[qry_atom_idx] = i;
+                mappedTargetAtoms[i] = true;
+
+                enumerate(qry_atom_idx + 1);
+
+                mappedTargetAtoms[i] = false;
+                atomMapping[qry_atom_idx] = KEY_SEPARATOR;
+            }
+
+            enumerate(qry_atom_idx + 1);
+        }
+
+        void processMapping()
+        {
+            using namespace CDPL;
+            using namespace Chem;
+
+            IndexArray qry_atoms, tgt_atoms, qry_bonds, tgt_bonds;
+            IndexArray bond_mapping(query.getNumBonds(), KEY_SEPARATOR);
+
+            for (std::size_t i = 0; i < query.getNumAtoms(); i++) {
+                if (atomMapping[i] == KEY_SEPARATOR)
+                    continue;
+
+                qry_atoms.push_back(i);
+                tgt_atoms.push_back(atomMapping[i]);
+            }
+
+            for (std::size_t i = 0; i < query.getNumBonds(); i++) {
+                const Bond& qry_bond = query.getBond(i);
+                std::size_t tgt_atom1_idx = atomMapping[query.getAtomIndex(qry_bond.getBegin())];
+                std::size_t tgt_atom2_idx = atomMapping[query.getAtomIndex(qry_bond.getEnd())];
+
+                if (tgt_atom1_idx == KEY_SEPARATOR || tgt_atom2_idx == KEY_SEPARATOR)
+                    continue;
+
+                const Bond* tgt_bond = target.getAtom(tgt_atom1_idx).findBondToAtom(target.getAtom(tgt_atom2_idx));
+
+                if (!tgt_bond || !target.containsBond(*tgt_bond))
+                    continue;
+
+                if (!(*getMatchExpression(qry_bond))(qry_bond, query, *tgt_bond, target, Base::Any()))
+                    continue;
+
+                bond_mapping[i] = target.getBondIndex(*tgt_bond);
+
+                qry_bonds.push_back(i);
+                tgt_bonds.push_back(bond_mapping[i]);
+            }
+
+            std::size_t num_atoms = qry_atoms.size();
+            std::size_t num_bonds = qry_bonds.size();
+
+            if (num_atoms > result.maxNumAtoms) {
+                result.maxNumAtoms = num_atoms;
+                result.maxNumBondsAtMaxAtoms = 0;
+                result.atomMappings.clear();
+                result.atomSubstructures.clear();
+                result.maxBondAtomMappings.clear();
+                result.maxBondAtomSubstructures.clear();
+            }
+
+            if (num_atoms == result.maxNumAtoms) {
+                IndexArray key = makeSubstructureKey(qry_atoms, tgt_atoms, qry_bonds, tgt_bonds);
+
+                result.atomMappings.insert(atomMapping);
+                result.atomSubstructures.insert(key);
+
+                if (num_bonds > result.maxNumBondsAtMaxAtoms) {
+                    result.maxNumBondsAtMaxAtoms = num_bonds;
+                    result.maxBondAtomMappings.clear();
+                    result.maxBondAtomSubstructures.clear();
+                }
+
+                if (num_bonds == result.maxNumBondsAtMaxAtoms) {
+                    result.maxBondAtomMappings.insert(atomMapping);
+                    result.maxBondAtomSubstructures.insert(key);
+                }
+            }
+
+            if (num_bonds == 0 || num_bonds < result.maxNumBonds)
+                return;
+
+            if (num_bonds > result.maxNumBonds) {
+                result.maxNumBonds = num_bonds;
+                result.bondMappings.clear();
+                result.bondSubstructures.clear();
+            }
+
+            // the atoms of a bond mapping are the atoms of the mapped bonds
+
+            qry_atoms.clear();
+            tgt_atoms.clear();
+
+            for (std::size_t i = 0; i < num_bonds; i++) {
+                const Bond& qry_bond = query.getBond(qry_bonds[i]);
+                const Bond& tgt_bond = target.getBond(tgt_bonds[i]);
+
+                qry_atoms.push_back(query.getAtomIndex(qry_bond.getBegin()));
+                qry_atoms.push_back(query.getAtomIndex(qry_bond.getEnd()));
+                tgt_atoms.push_back(target.getAtomIndex(tgt_bond.getBegin()));
+                tgt_atoms.push_back(target.getAtomIndex(tgt_bond.getEnd()));
+            }
+
+            result.bondMappings.insert(bond_mapping);
+            result.bondSubstructures.insert(makeSubstructureKey(qry_atoms, tgt_atoms, qry_bonds, tgt_bonds));
+        }
+
+        const CDPL::Chem::MolecularGraph& query;
+        const CDPL::Chem::MolecularGraph& target;
+        MaxCommonSubstructures&           result;
+        IndexArray                        atomMapping;
+        std::vector<bool>                 mappedTargetAtoms;
+    };
+
+    // pairs of small molecules for the comparison with the exhaustive enumeration
+
+    const char* const MCS_TEST_PAIRS[][2] = {
+        { "CC(=O)NC", "CNC(C)=O" },
+        { "OCC(N)C=O", "NC(CO)C(O)=O" },
+        { "C1CCOC1", "CCCCO" },
+        { "CC=CC(C)Cl", "ClCC=CC" },
+        { "c1ccncc1", "Nc1ccccc1" },
+        { "CC(C)(C)O", "OCC(C)C" },
+        { "C1CC1CN", "NCC1CCC1" }
+    };
+
+    // a pair of molecules that requires a long search for all maximum common substructures
+
+    const char* const MCS_HARD_PAIR[2] = { "c1ccc2c(c1)ccc1ccccc12", "c1ccc2cc3ccccc3cc2c1" };
+}
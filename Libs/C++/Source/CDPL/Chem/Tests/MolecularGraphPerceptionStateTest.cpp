@@ -0,0 +1,243 @@
+/* 
+ * MolecularGraphPerceptionStateTest.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/BondFunctions.hpp"
+#include "CDPL/Chem/AtomType.hpp"
+#include "CDPL/Chem/HybridizationState.hpp"
+#include "CDPL/Chem/Fragment.hpp"
+
+
+BOOST_AUTO_TEST_CASE(MolecularGraphPerceptionStateTest)
+{
+    using namespace CDPL;
+    using namespace Chem;
+
+    BasicMolecule mol;
+
+    for (std::size_t i = 0; i < 6; i++)
+        setType(mol.addAtom(), AtomType::C);
+
+    for (std::size_t i = 0; i < 6; i++)
+        setOrder(mol.addBond(i, (i + 1) % 6), i % 2 + 1);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+
+    resetPerceptionCounters();
+
+    prepareMolecularGraph(mol, PerceptionFlag::BASIC_PROPERTIES, false);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 6);
+    BOOST_CHECK(getNumSkippedPerceptions() == 0);
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::BASIC_PROPERTIES);
+    BOOST_CHECK(getAromaticityFlag(mol.getAtom(0)));
+
+//-----
+
+    resetPerceptionCounters();
+
+    calcBasicProperties(mol, true);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 0);
+    BOOST_CHECK(getNumSkippedPerceptions() == 6);
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::BASIC_PROPERTIES);
+
+    prepareMolecularGraph(mol, PerceptionFlag::SSSR | PerceptionFlag::CIP_PRIORITIES, true);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 1);
+    BOOST_CHECK(getNumSkippedPerceptions() == 7);
+    BOOST_CHECK(getPerceptionState(mol) == (PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES));
+
+//-----
+
+    BasicMolecule mol_copy(mol);
+
+    BOOST_CHECK(getPerceptionState(mol_copy) == PerceptionFlag::NONE);
+
+//-----
+
+    setOrder(mol.getBond(0), 2);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+
+    setPerceptionState(mol, PerceptionFlag::SSSR);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::SSSR);
+
+    mol.addBond(0, 3);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+
+    setPerceptionState(mol, PerceptionFlag::SSSR);
+    clearPerceptionState(mol);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+}
+
+BOOST_AUTO_TEST_CASE(MolecularGraphPerceptionStateClearTest)
+{
+    using namespace CDPL;
+    using namespace Chem;
+
+    BasicMolecule mol;
+
+    for (std::size_t i = 0; i < 6; i++)
+        setType(mol.addAtom(), AtomType::C);
+
+    for (std::size_t i = 0; i < 6; i++)
+        setOrder(mol.addBond(i, (i + 1) % 6), i % 2 + 1);
+
+    prepareMolecularGraph(mol, PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES, true);
+
+    BOOST_CHECK(getPerceptionState(mol) == (PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES));
+
+//-----
+
+    clearSSSR(mol);
+
+    BOOST_CHECK(!hasSSSR(mol));
+
+    resetPerceptionCounters();
+
+    calcBasicProperties(mol, true);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 1);
+    BOOST_CHECK(getNumSkippedPerceptions() == 5);
+    BOOST_CHECK(hasSSSR(mol));
+    BOOST_CHECK(getSSSR(mol)->getSize() == 1);
+    BOOST_CHECK(getPerceptionState(mol) == (PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES));
+
+//-----
+
+    clearHybridizationState(mol.getAtom(3));
+    clearAromaticityFlag(mol.getAtom(2));
+    clearComponents(mol);
+
+    resetPerceptionCounters();
+
+    calcBasicProperties(mol, false);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 3);
+    BOOST_CHECK(getNumSkippedPerceptions() == 3);
+    BOOST_CHECK(hasComponents(mol));
+    BOOST_CHECK(getHybridizationState(mol.getAtom(3)) == HybridizationState::SP2);
+    BOOST_CHECK(getAromaticityFlag(mol.getAtom(2)));
+    BOOST_CHECK(getPerceptionState(mol) == (PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES));
+
+//-----
+
+    setIsotope(mol.getAtom(0), 13);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+
+    resetPerceptionCounters();
+
+    prepareMolecularGraph(mol, PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES, true);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 7);
+    BOOST_CHECK(getNumSkippedPerceptions() == 0);
+    BOOST_CHECK(getPerceptionState(mol) == (PerceptionFlag::BASIC_PROPERTIES | PerceptionFlag::CIP_PRIORITIES));
+
+//-----
+
+    BasicMolecule mol2;
+
+    for (std::size_t i = 0; i < 6; i++)
+        setType(mol2.addAtom(), AtomType::C);
+
+    for (std::size_t i = 0; i < 6; i++)
+        setOrder(mol2.addBond(i, (i + 1) % 6), i % 2 + 1);
+
+    // a present but unrecorded value is kept without overwrite and prevents recording of the step and all subsequent ones
+
+    setHybridizationState(mol2.getAtom(0), HybridizationState::SP3);
+
+    resetPerceptionCounters();
+
+    calcBasicProperties(mol2, false);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 6);
+    BOOST_CHECK(getHybridizationState(mol2.getAtom(0)) == HybridizationState::SP3);
+    BOOST_CHECK(getPerceptionState(mol2) == (PerceptionFlag::COMPONENTS | PerceptionFlag::SSSR | PerceptionFlag::RING_FLAGS |
+                                             PerceptionFlag::IMPLICIT_H_COUNTS));
+
+    resetPerceptionCounters();
+
+    calcBasicProperties(mol2, true);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 2);
+    BOOST_CHECK(getNumSkippedPerceptions() == 4);
+    BOOST_CHECK(getHybridizationState(mol2.getAtom(0)) == HybridizationState::SP2);
+    BOOST_CHECK(getPerceptionState(mol2) == PerceptionFlag::BASIC_PROPERTIES);
+}
+
+BOOST_AUTO_TEST_CASE(MolecularGraphPerceptionStateAtomPropertyTest)
+{
+    using namespace CDPL;
+    using namespace Chem;
+
+    BasicMolecule mol;
+
+    setType(mol.addAtom(), AtomType::C);
+    setType(mol.addAtom(), AtomType::C);
+    setOrder(mol.addBond(0, 1), 1);
+
+    calcBasicProperties(mol, true);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::BASIC_PROPERTIES);
+    BOOST_CHECK(getImplicitHydrogenCount(mol.getAtom(0)) == 3);
+
+//-----
+
+    // the implicit hydrogen count depends on the number of unpaired electrons
+
+    setUnpairedElectronCount(mol.getAtom(0), 1);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+
+    resetPerceptionCounters();
+
+    calcBasicProperties(mol, true);
+
+    BOOST_CHECK(getNumPerformedPerceptions() == 6);
+    BOOST_CHECK(getNumSkippedPerceptions() == 0);
+    BOOST_CHECK(getImplicitHydrogenCount(mol.getAtom(0)) == 2);
+    BOOST_CHECK(getImplicitHydrogenCount(mol.getAtom(1)) == 3);
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::BASIC_PROPERTIES);
+
+//-----
+
+    setFormalCharge(mol.getAtom(1), -1);
+
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::NONE);
+
+    calcBasicProperties(mol, true);
+
+    BOOST_CHECK(getImplicitHydrogenCount(mol.getAtom(1)) == 2);
+    BOOST_CHECK(getPerceptionState(mol) == PerceptionFlag::BASIC_PROPERTIES);
+}
@@ -0,0 +1,107 @@
+/*
+ * ParallelMoleculeReaderTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Chem/ParallelMoleculeReader.hpp"
+#include "CDPL/Chem/MoleculeReader.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+
+
+namespace
+{
+
+    std::string getMoleculeSignature(const CDPL::Chem::Molecule& mol)
+    {
+        using namespace CDPL;
+        using namespace Chem;
+
+        return (getName(mol) + ':' + std::to_string(mol.getNumAtoms()) + ':' + std::to_string(mol.getNumBonds()));
+    }
+
+    void checkReader(const std::string& file_name, std::size_t num_threads, bool parallel)
+    {
+        using namespace CDPL;
+        using namespace Chem;
+
+        std::string file_path = std::string(std::getenv("CDPKIT_TEST_DATA_DIR")) + '/' + file_name;
+        std::vector<std::string> exp_sigs;
+        BasicMolecule mol;
+
+        for (MoleculeReader reader(file_path); reader.read(mol); )
+            exp_sigs.push_back(getMoleculeSignature(mol));
+
+        BOOST_CHECK(!exp_sigs.empty());
+
+        ParallelMoleculeReader reader(file_path, num_threads);
+
+        BOOST_CHECK(reader.isParallel() == parallel);
+        BOOST_CHECK(reader.getNumThreads() == num_threads);
+        BOOST_CHECK(reader.getNumRecords() == exp_sigs.size());
+
+        reader.setMaxNumBufferedRecords(3);
+
+        for (std::size_t i = 0; i < exp_sigs.size(); i++) {
+            BOOST_CHECK(reader.hasMoreData());
+            BOOST_CHECK(reader.getRecordIndex() == i);
+            BOOST_CHECK(reader.read(mol));
+            BOOST_CHECK(getMoleculeSignature(mol) == exp_sigs[i]);
+        }
+
+        BOOST_CHECK(!reader.hasMoreData());
+        BOOST_CHECK(!reader.read(mol));
+        BOOST_CHECK(reader.getRecordIndex() == exp_sigs.size());
+
+        // random access
+
+        for (std::size_t i = exp_sigs.size(); i > 0; i -= 7) {
+            BOOST_CHECK(reader.read(i - 1, mol));
+            BOOST_CHECK(getMoleculeSignature(mol) == exp_sigs[i - 1]);
+
+            if (i <= 7)
+                break;
+        }
+
+        reader.setRecordIndex(1);
+
+        BOOST_CHECK(reader.skip());
+        BOOST_CHECK(reader.getRecordIndex() == 2);
+        BOOST_CHECK(reader.read(mol));
+        BOOST_CHECK(getMoleculeSignature(mol) == exp_sigs[2]);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(ParallelMoleculeReaderTest)
+{
+    checkReader("ChEMBLStandardizerTestData.sdf", 4, true);
+    checkReader("ChEMBLStandardizerTestData.sdf", 0, false);
+    checkReader("ChEMBLStandardizerTestData.sdf.gz", 4, false);
+    checkReader("CIPConfigLabelingTestSet.smi", 3, true);
+}
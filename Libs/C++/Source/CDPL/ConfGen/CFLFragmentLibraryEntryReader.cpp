@@ -27,6 +27,7 @@
 #include <cstddef>
 
 #include "CDPL/ConfGen/FragmentLibraryEntry.hpp"
+#include "CDPL/Base/Exceptions.hpp"
 
 #include "CFLFragmentLibraryEntryReader.hpp"
 #include "CDFFormatData.hpp"
@@ -60,7 +61,112 @@ bool ConfGen::CFLFragmentLibraryEntryReader::read(std::istream& is, FragmentLibr
         return false;
 
     readData(is, header.recordDataLength, entryBuffer);
+    getEntry(entry);
 
+    return true;
+}
+
+void ConfGen::CFLFragmentLibraryEntryReader::read(const char* data, std::size_t size, std::uint64_t entry_offs, FragmentLibraryEntry& entry)
+{
+    CDF::Header header;
+
+    if (entry_offs > size || (size - entry_offs) < CDF::HEADER_SIZE)
+        throw Base::IOError("CFLFragmentLibraryEntryReader: entry offset out of range");
+
+    entryBuffer.resize(0);
+    entryBuffer.setIOPointer(0);
+    entryBuffer.putBytes(data + entry_offs, CDF::HEADER_SIZE);
+    entryBuffer.setIOPointer(0);
+
+    if (!getHeader(header, entryBuffer) || header.recordTypeID != CDF::FRAGLIB_DATA_RECORD_ID)
+        throw Base::IOError("CFLFragmentLibraryEntryReader: invalid entry record header");
+
+    if (header.recordDataLength > (size - entry_offs - CDF::HEADER_SIZE))
+        throw Base::IOError("CFLFragmentLibraryEntryReader: entry record data length out of range");
+
+    entryBuffer.resize(0);
+    entryBuffer.setIOPointer(0);
+    entryBuffer.putBytes(data + entry_offs + CDF::HEADER_SIZE, header.recordDataLength);
+
+    getEntry(entry);
+}
+
+bool ConfGen::CFLFragmentLibraryEntryReader::readIndex(const char* data, std::size_t size, std::uint64_t& index_offs, std::uint64_t& num_entries)
+{
+    // index record layout: header, number of entries, (hash code, distance to entry record) pairs
+    // sorted by hash code, total record size
+
+    if (size < CDF::HEADER_SIZE + 2 * sizeof(std::uint64_t))
+        return false;
+
+    std::uint64_t rec_size = getUInt64(data + size - sizeof(std::uint64_t));
+
+    if (rec_size > size || rec_size < CDF::HEADER_SIZE + 2 * sizeof(std::uint64_t))
+        return false;
+
+    CDF::Header header;
+
+    index_offs = size - rec_size;
+
+    entryBuffer.resize(0);
+    entryBuffer.setIOPointer(0);
+    entryBuffer.putBytes(data + index_offs, CDF::HEADER_SIZE);
+    entryBuffer.setIOPointer(0);
+
+    entryBuffer.getInt(header.formatID);
+    entryBuffer.getInt(header.recordTypeID);
+    entryBuffer.getInt(header.recordFormatVersion);
+    entryBuffer.getInt(header.recordDataLength);
+
+    if (header.formatID != CDF::FORMAT_ID || header.recordTypeID != CDF::FRAGLIB_INDEX_RECORD_ID)
+        return false;
+
+    num_entries = getUInt64(data + index_offs + CDF::HEADER_SIZE);
+
+    if (header.recordDataLength != rec_size - CDF::HEADER_SIZE ||
+        num_entries > (rec_size - CDF::HEADER_SIZE - 2 * sizeof(std::uint64_t)) / (2 * sizeof(std::uint64_t)) ||
+        rec_size != CDF::HEADER_SIZE + (num_entries + 1) * 2 * sizeof(std::uint64_t))
+        throw Base::IOError("CFLFragmentLibraryEntryReader: corrupt fragment library index");
+
+    return true;
+}
+
+bool ConfGen::CFLFragmentLibraryEntryReader::findIndexedEntry(const char* data, std::uint64_t index_offs, std::uint64_t num_entries,
+                                                              std::uint64_t hash_code, std::uint64_t& entry_offs)
+{
+    const char* index_entries = data + index_offs + CDF::HEADER_SIZE + sizeof(std::uint64_t);
+    std::uint64_t lower = 0;
+    std::uint64_t upper = num_entries;
+
+    while (lower < upper) {
+        std::uint64_t mid = lower + (upper - lower) / 2;
+        const char* idx_entry = index_entries + mid * 2 * sizeof(std::uint64_t);
+        std::uint64_t mid_hash = getUInt64(idx_entry);
+
+        if (mid_hash < hash_code) {
+            lower = mid + 1;
+            continue;
+        }
+
+        if (mid_hash > hash_code) {
+            upper = mid;
+            continue;
+        }
+
+        std::uint64_t dist = getUInt64(idx_entry + sizeof(std::uint64_t));
+
+        if (dist > index_offs)
+            throw Base::IOError("CFLFragmentLibraryEntryReader: corrupt fragment library index");
+
+        entry_offs = index_offs - dist;
+        return true;
+    }
+
+    return false;
+}
+
+void ConfGen::CFLFragmentLibraryEntryReader::getEntry(FragmentLibraryEntry& entry)
+{
     std::uint64_t hash_code;
     CDF::SizeType num_confs;
     std::string smiles;
@@ -95,6 +201,14 @@ bool ConfGen::CFLFragmentLibraryEntryReader::read(std::istream& is, FragmentLibr
 
         entry.addConformer(conf_data);
     }
+}
 
-    return true;
+std::uint64_t ConfGen::CFLFragmentLibraryEntryReader::getUInt64(const char* data)
+{
+    std::uint64_t value = 0;
+
+    for (std::size_t i = 0; i < sizeof(std::uint64_t); i++)
+        value |= std::uint64_t(std::uint8_t(data[i])) << (i * 8);
+
+    return value;
 }
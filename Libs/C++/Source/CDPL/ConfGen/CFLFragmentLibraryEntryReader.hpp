@@ -26,6 +26,8 @@
 #define CDPL_CONFGEN_CFLFRAGMENTLIBRARYENTRYREADER_HPP
 
 #include <iosfwd>
+#include <cstddef>
+#include <cstdint>
 
 #include "CDPL/Internal/CDFDataReaderBase.hpp"
 #include "CDPL/Internal/ByteBuffer.hpp"
@@ -51,7 +53,25 @@ namespace CDPL
 
             bool read(std::istream& is, FragmentLibraryEntry& entry);
 
+            /*
+             * Decodes the entry record starting at offset entry_offs of the in-memory CFL data.
+             */
+            void read(const char* data, std::size_t size, std::uint64_t entry_offs, FragmentLibraryEntry& entry);
+
+            /*
+             * Locates the hash code to entry offset index record that terminates the in-memory CFL data
+             * (returns false if there is no index).
+             */
+            bool readIndex(const char* data, std::size_t size, std::uint64_t& index_offs, std::uint64_t& num_entries);
+
+            static bool findIndexedEntry(const char* data, std::uint64_t index_offs, std::uint64_t num_entries,
+                                         std::uint64_t hash_code, std::uint64_t& entry_offs);
+
           private:
+            void getEntry(FragmentLibraryEntry& entry);
+
+            static std::uint64_t getUInt64(const char* data);
+
             Internal::ByteBuffer entryBuffer;
         };
     } // namespace ConfGen
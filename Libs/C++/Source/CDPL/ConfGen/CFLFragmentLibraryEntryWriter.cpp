@@ -26,6 +26,7 @@
 
 #include <ostream>
 #include <cstddef>
+#include <algorithm>
 
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -38,6 +39,10 @@
 using namespace CDPL;
 
 
+ConfGen::CFLFragmentLibraryEntryWriter::CFLFragmentLibraryEntryWriter():
+    outputLength(0)
+{}
+
 bool ConfGen::CFLFragmentLibraryEntryWriter::write(std::ostream& os, const FragmentLibraryEntry& entry)
 {
     entryBuffer.setIOPointer(CDF::HEADER_SIZE);
@@ -71,5 +76,43 @@ bool ConfGen::CFLFragmentLibraryEntryWriter::write(std::ostream& os, const Fragm
 
     entryBuffer.writeBuffer(os);
 
+    index.emplace_back(entry.getHashCode(), outputLength);
+    outputLength += entryBuffer.getSize();
+
+    return os.good();
+}
+
+bool ConfGen::CFLFragmentLibraryEntryWriter::writeIndex(std::ostream& os)
+{
+    std::sort(index.begin(), index.end());
+
+    // entry offsets are stored as distances to the start of the index record and the record ends with its
+    // total size which allows to locate the index from the end of the data
+
+    entryBuffer.setIOPointer(CDF::HEADER_SIZE);
+    entryBuffer.putInt(std::uint64_t(index.size()), false);
+
+    for (IndexEntryList::const_iterator it = index.begin(), end = index.end(); it != end; ++it) {
+        entryBuffer.putInt(it->first, false);
+        entryBuffer.putInt(std::uint64_t(outputLength - it->second), false);
+    }
+
+    entryBuffer.putInt(std::uint64_t(entryBuffer.getIOPointer() + sizeof(std::uint64_t)), false);
+
+    entryBuffer.resize(entryBuffer.getIOPointer());
+    entryBuffer.setIOPointer(0);
+
+    CDF::Header cdf_header;
+
+    cdf_header.recordDataLength = boost::numeric_cast<std::uint64_t>(entryBuffer.getSize() - CDF::HEADER_SIZE);
+    cdf_header.recordTypeID = CDF::FRAGLIB_INDEX_RECORD_ID;
+    cdf_header.recordFormatVersion = CDF::CURR_FORMAT_VERSION;
+
+    putHeader(cdf_header, entryBuffer);
+
+    entryBuffer.writeBuffer(os);
+
+    outputLength += entryBuffer.getSize();
+
     return os.good();
 }
@@ -26,6 +26,9 @@
 #define CDPL_CONFGEN_CFLFRAGMENTLIBRARYENTRYWRITER_HPP
 
 #include <iosfwd>
+#include <cstdint>
+#include <vector>
+#include <utility>
 
 #include "CDPL/Internal/CDFDataWriterBase.hpp"
 #include "CDPL/Internal/ByteBuffer.hpp"
@@ -43,10 +46,22 @@ namespace CDPL
         {
 
           public:
+            CFLFragmentLibraryEntryWriter();
+
             bool write(std::ostream& os, const FragmentLibraryEntry& entry);
 
+            /*
+             * Writes a record mapping the hash codes of all entries written so far to their record offsets.
+             */
+            bool writeIndex(std::ostream& os);
+
           private:
+            typedef std::pair<std::uint64_t, std::uint64_t> IndexEntry;
+            typedef std::vector<IndexEntry>                 IndexEntryList;
+
             Internal::ByteBuffer entryBuffer;
+            IndexEntryList       index;
+            std::uint64_t        outputLength;
         };
     } // namespace ConfGen
 } // namespace CDPL
@@ -182,3 +182,8 @@ ConfGen::ConformerGenerator::ConformerIterator ConfGen::ConformerGenerator::end(
 {
     return impl->getConformersEnd();
 }
+
+const ConfGen::ConformerGeneratorStatistics& ConfGen::ConformerGenerator::getStatistics() const
+{
+    return impl->getStatistics();
+}
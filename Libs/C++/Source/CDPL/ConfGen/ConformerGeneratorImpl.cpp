@@ -28,6 +28,10 @@
 #include <algorithm>
 #include <iterator>
 #include <functional>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <exception>
 
 #include <boost/format.hpp>
 
@@ -47,6 +51,7 @@
 
 #include "ConformerGeneratorImpl.hpp"
 #include "FragmentTreeNode.hpp"
+#include "StageTimer.hpp"
 #include "UtilityFunctions.hpp"
 
 
@@ -86,6 +91,7 @@ namespace
     constexpr std::size_t MAX_CONF_DATA_CACHE_SIZE               = 1000;
     constexpr std::size_t MAX_FRAG_CONF_DATA_CACHE_SIZE          = 100;
     constexpr std::size_t MAX_FRAG_CONF_COMBINATION_CACHE_SIZE   = 2000;
+    constexpr std::size_t MAX_MMFF94_DATA_CACHE_SIZE             = 8;
     constexpr double      COMP_CONFORMER_SPACING                 = 4.0;
     constexpr std::size_t MAX_NUM_STRUCTURE_GEN_TRIALS           = 10;
     constexpr std::size_t MAX_NUM_STRUCTURE_GEN_FAILS            = 100;
@@ -94,14 +100,210 @@ namespace
     constexpr double      FRAG_CONF_COMBINATIONS_E_WINDOW_FACTOR = 1.5;
     constexpr double      CONF_DUPLICATE_ENERGY_TOLERANCE        = 0.01;
     constexpr double      ELASTIC_POTENTIAL_FORCE_CONST          = 500.0;
+    constexpr unsigned int DG_STRUCTURE_GEN_RANDOM_SEED          = 170375;
+}
+
+
+struct ConfGen::ConformerGeneratorImpl::StochasticSamplingState
+{
+
+    StochasticSamplingState():
+        numStartedSamples(0), numSamples(0), numStructGenFails(0), numNewUniqueConfs(0),
+        lastUniqueConfCount(0), minEnergy(0.0), retCode(ReturnCode::SUCCESS), structGenFailed(false), done(false) {}
+
+    std::mutex         mutex;
+    std::size_t        numStartedSamples;
+    std::size_t        numSamples;
+    std::size_t        numStructGenFails;
+    std::size_t        numNewUniqueConfs;
+    std::size_t        lastUniqueConfCount;
+    double             minEnergy;
+    unsigned int       retCode;
+    bool               structGenFailed;
+    bool               done;
+    std::exception_ptr error;
+};
+
+
+class ConfGen::ConformerGeneratorImpl::StochasticSamplingWorker
+{
+
+  public:
+    StochasticSamplingWorker(ConformerGeneratorImpl& parent, StochasticSamplingState& state, std::size_t worker_idx):
+        parent(parent), state(state), invokeCallbacks(worker_idx == 0), dgStructureGen(parent.dgStructureGen), hCoordsCalc(parent.hCoordsCalc),
+        mmff94GradientCalc(parent.mmff94GradientCalc),
+        energyMinimizer(std::bind(&ConformerGeneratorImpl::calcEnergy, &parent, std::ref(mmff94GradientCalc), std::placeholders::_1),
+                        std::bind(&ConformerGeneratorImpl::calcGradient, &parent, std::ref(mmff94GradientCalc),
+                                  std::placeholders::_1, std::placeholders::_2)),
+        energyGradient(parent.energyGradient.size()), embeddingTime(0.0), minimizationTime(0.0), numMinimizations(0),
+        numMinimizationIters(0), numStructGenFails(0)
+    {
+        // the first worker continues the random number sequence of the sequential implementation
+        
+        if (worker_idx > 0)
+            dgStructureGen.setRandomSeed(DG_STRUCTURE_GEN_RANDOM_SEED + worker_idx);
+    }
+
+    void operator()();
+
+  private:
+    bool generateConformer(ConformerData& conf_data);
+
+    ConformerGeneratorImpl&               parent;
+    StochasticSamplingState&              state;
+    bool                                  invokeCallbacks;
+    DGStructureGenerator                  dgStructureGen;
+    Chem::Hydrogen3DCoordinatesCalculator hCoordsCalc;
+    MMFF94GradientCalculator              mmff94GradientCalc;
+    BFGSMinimizer                         energyMinimizer;
+    Math::Vector3DArray::StorageType      energyGradient;
+    double                                embeddingTime;
+    double                                minimizationTime;
+    std::size_t                           numMinimizations;
+    std::size_t                           numMinimizationIters;
+    std::size_t                           numStructGenFails;
+};
+
+
+void ConfGen::ConformerGeneratorImpl::StochasticSamplingWorker::operator()()
+{
+    std::size_t num_atoms = parent.molGraph->getNumAtoms();
+    std::size_t conv_cycle_size = parent.settings.getConvergenceCheckCycleSize();
+    std::size_t max_num_conf_samples = parent.settings.getMaxNumSampledConformers();
+    ConformerData::SharedPointer conf_data_ptr;
+    std::unique_lock<std::mutex> lock(state.mutex);
+
+    try {
+        while (!state.done) {
+            // user callbacks only get invoked by the worker running in the calling thread
+            
+            if (invokeCallbacks && (state.retCode = parent.invokeCallbacks()) != ReturnCode::SUCCESS) {
+                state.done = true;
+                break;
+            }
+
+            if (max_num_conf_samples > 0 && state.numStartedSamples >= max_num_conf_samples)
+                break;
+
+            state.numStartedSamples++;
+
+            if (!conf_data_ptr) {
+                conf_data_ptr = parent.confDataCache.get();
+                conf_data_ptr->resize(num_atoms);
+            }
+
+            lock.unlock();
+
+            bool success = generateConformer(*conf_data_ptr);
+
+            lock.lock();
+
+            if (state.done)
+                break;
+
+            if (!success) {
+                state.numStartedSamples--;
+
+                if (++state.numStructGenFails == MAX_NUM_STRUCTURE_GEN_FAILS) {
+                    state.structGenFailed = true;
+                    state.done = true;
+                }
+
+                continue;
+            }
+
+            state.numStructGenFails = 0;
+            state.numSamples++;
+
+            double energy = conf_data_ptr->getEnergy();
+
+            if (parent.workingConfs.empty() || energy < state.minEnergy)
+                state.minEnergy = energy;
+
+            if (energy <= state.minEnergy + parent.eWindow) {
+                parent.workingConfs.push_back(conf_data_ptr);
+                conf_data_ptr.reset();
+
+            } else
+                parent.statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
+
+            if (state.numSamples % conv_cycle_size == 0) {
+                parent.removeWorkingConfDuplicates();
+
+                state.numNewUniqueConfs = parent.workingConfs.size() - state.lastUniqueConfCount;
+                state.lastUniqueConfCount = parent.workingConfs.size();
+
+                if (state.numNewUniqueConfs == 0)
+                    state.done = true;
+            }
+        }
+
+    } catch (...) {
+        if (!lock.owns_lock())
+            lock.lock();
+
+        if (!state.error)
+            state.error = std::current_exception();
+
+        state.done = true;
+    }
+
+    // conformer data objects must be returned to the cache and statistics updated while holding the lock
+    
+    conf_data_ptr.reset();
+
+    parent.statistics.addStageTime(ConformerGeneratorStatistics::STRUCTURE_EMBEDDING, embeddingTime);
+    parent.statistics.addStageTime(ConformerGeneratorStatistics::ENERGY_MINIMIZATION, minimizationTime);
+    parent.statistics.increaseCounter(ConformerGeneratorStatistics::NUM_MINIMIZATIONS, numMinimizations);
+    parent.statistics.increaseCounter(ConformerGeneratorStatistics::NUM_MINIMIZATION_ITERATIONS, numMinimizationIters);
+    parent.statistics.increaseCounter(ConformerGeneratorStatistics::NUM_STRUCTURE_GENERATION_FAILURES, numStructGenFails);
+}
+
+bool ConfGen::ConformerGeneratorImpl::StochasticSamplingWorker::generateConformer(ConformerData& conf_data)
+{
+    for (std::size_t i = 0; i < MAX_NUM_STRUCTURE_GEN_TRIALS; i++) {
+        Internal::Timer stage_timer;
+        bool success = dgStructureGen.generate(conf_data);
+
+        embeddingTime += StageTimer::getElapsedSeconds(stage_timer);
+
+        if (!success) {
+            numStructGenFails++;
+            continue;
+        }
+
+        std::size_t num_iter = 0;
+
+        stage_timer.reset();
+        success = parent.generateHydrogenCoordsAndMinimize(conf_data, hCoordsCalc, energyMinimizer, mmff94GradientCalc, energyGradient, num_iter);
+
+        minimizationTime += StageTimer::getElapsedSeconds(stage_timer);
+        numMinimizations++;
+        numMinimizationIters += num_iter;
+
+        if (!success) {
+            numStructGenFails++;
+            continue;
+        }
+
+        if (!dgStructureGen.checkAtomConfigurations(conf_data) || !dgStructureGen.checkBondConfigurations(conf_data)) {
+            numStructGenFails++;
+            continue;
+        }
+
+        return true;
+    }
+
+    return false;
 }
 
 
 ConfGen::ConformerGeneratorImpl::ConformerGeneratorImpl():
     confDataCache(MAX_CONF_DATA_CACHE_SIZE), fragConfDataCache(MAX_FRAG_CONF_DATA_CACHE_SIZE),
     confCombDataCache(MAX_FRAG_CONF_COMBINATION_CACHE_SIZE), settings(ConformerGeneratorSettings::DEFAULT),
-    energyMinimizer(std::bind(&ConformerGeneratorImpl::calcEnergy, this, std::placeholders::_1),
-                    std::bind(&ConformerGeneratorImpl::calcGradient, this, std::placeholders::_1, std::placeholders::_2)) 
+    energyMinimizer(std::bind(&ConformerGeneratorImpl::calcEnergy, this, std::ref(mmff94GradientCalc), std::placeholders::_1),
+                    std::bind(&ConformerGeneratorImpl::calcGradient, this, std::ref(mmff94GradientCalc),
+                              std::placeholders::_1, std::placeholders::_2)) 
 {
     using namespace std::placeholders;
     
@@ -110,6 +312,8 @@ ConfGen::ConformerGeneratorImpl::ConformerGeneratorImpl():
 
     torDriver.setTimeoutCallback(std::bind(&ConformerGeneratorImpl::timedout, this));
 
+    fragAssembler.setStatistics(&statistics);
+
     confSelector.setAbortCallback(std::bind(&ConformerGeneratorImpl::rmsdConfSelectorAbortCallback, this));
     confSelector.setMaxNumSymmetryMappings(MAX_NUM_SYMMETRY_MAPPINGS + 1);
     
@@ -129,6 +333,10 @@ ConfGen::ConformerGeneratorImpl::ConformerGeneratorImpl():
     dg_settings.regardAtomConfiguration(true);
     dg_settings.regardBondConfiguration(true);
     dg_settings.enablePlanarityConstraints(true);
+    dg_settings.setEmbeddingBatchSize(4);
+
+    mmff94Parameterizer.setInteractionDataCache(
+        ForceField::MMFF94InteractionDataCache::SharedPointer(new ForceField::MMFF94InteractionDataCache(MAX_MMFF94_DATA_CACHE_SIZE)));
 } 
 
 ConfGen::ConformerGeneratorImpl::~ConformerGeneratorImpl() {}
@@ -200,9 +408,12 @@ unsigned int ConfGen::ConformerGeneratorImpl::generate(const Chem::MolecularGrap
 {
     using namespace Chem;
 
+    Internal::Timer total_timer;
     const FragmentList& comps = *getComponents(molgraph);
     unsigned int ret_code = ReturnCode::SUCCESS;
 
+    statistics.clear();
+
     if (molgraph.getNumAtoms() == 0 || comps.isEmpty()) {
         outputConfs.clear();
 
@@ -253,6 +464,9 @@ unsigned int ConfGen::ConformerGeneratorImpl::generate(const Chem::MolecularGrap
         }
     }
 
+    statistics.setCounter(ConformerGeneratorStatistics::NUM_OUTPUT_CONFORMERS, outputConfs.size());
+    statistics.setTotalTime(StageTimer::getElapsedSeconds(total_timer));
+
     if (logCallback) {
         logCallback(std::string(struct_gen_only ? "Structure" : "Conformer") + " generation finished with return code " + returnCodeToString(ret_code) + '\n');
         logCallback("Processing time: " + timer.format<3>() + "s\n");
@@ -292,6 +506,11 @@ ConfGen::ConformerGeneratorImpl::ConstConformerIterator ConfGen::ConformerGenera
     return outputConfs.end();
 }
 
+const ConfGen::ConformerGeneratorStatistics& ConfGen::ConformerGeneratorImpl::getStatistics() const
+{
+    return statistics;
+}
+
 unsigned int ConfGen::ConformerGeneratorImpl::generateConformers(const Chem::MolecularGraph& molgraph, const Chem::FragmentList& comps, bool struct_gen_only)
 {
     using namespace Chem;
@@ -533,6 +752,7 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateConformersSystematic(bool
 
     td_settings.setMaxPoolSize(settings.getMaxPoolSize());
     td_settings.setEnergyWindow(eWindow);
+    td_settings.setNumThreads(settings.getNumSamplingThreads());
 
     splitIntoTorsionFragments();
 
@@ -552,6 +772,8 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateConformersStochastic(bool
     std::size_t num_atoms = molGraph->getNumAtoms();
 
     elasticPotentials.clear();
+
+    StageTimer setup_timer(statistics, ConformerGeneratorStatistics::STRUCTURE_EMBEDDING);
     
     if (fixedSubstruct) {
         if (fixedSubstructFrags.isEmpty())
@@ -577,87 +799,77 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateConformersStochastic(bool
 
     energyGradient.resize(num_atoms);
 
-    double min_energy = 0.0;
-    ConformerData::SharedPointer conf_data_ptr;
-    unsigned int ret_code = ReturnCode::SUCCESS;
+    setup_timer.stop();
+
     std::size_t conv_cycle_size = settings.getConvergenceCheckCycleSize();
-    std::size_t max_num_conf_samples = settings.getMaxNumSampledConformers();
-    std::size_t i = 0;
-    std::size_t num_new_unique_confs = 0;
-    std::size_t last_unique_conf_count = 0;
-    std::size_t num_struct_gen_fails = 0;
+    std::size_t num_threads = settings.getNumSamplingThreads();
+    StochasticSamplingState sampling_state;
             
     if (logCallback) 
         logCallback(struct_gen_only ? "Performing distance geometry based structure generation...\n" : "Performing stochastic conformer sampling...\n");
 
-    while (max_num_conf_samples == 0 || i < max_num_conf_samples) {
-        if ((ret_code = invokeCallbacks()) != ReturnCode::SUCCESS)
-            return ret_code;
+    if (num_threads > 1) {
+        typedef std::unique_ptr<StochasticSamplingWorker> StochasticSamplingWorkerPtr;
 
-        if (!conf_data_ptr) {
-            conf_data_ptr = confDataCache.get();
-            conf_data_ptr->resize(num_atoms);
-        }
+        std::vector<StochasticSamplingWorkerPtr> workers;
+        std::vector<std::thread> threads;
 
-        ConformerData& conf_data = *conf_data_ptr;
-        std::size_t j = 0;
+        for (std::size_t i = 0; i < num_threads; i++)
+            workers.emplace_back(new StochasticSamplingWorker(*this, sampling_state, i));
 
-        for ( ; j < MAX_NUM_STRUCTURE_GEN_TRIALS; j++) {
-            if (!dgStructureGen.generate(conf_data)) 
-                continue;
+        try {
+            for (std::size_t i = 1; i < num_threads; i++)
+                threads.emplace_back(std::ref(*workers[i]));
 
-            if (!generateHydrogenCoordsAndMinimize(conf_data))
-                continue;
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(sampling_state.mutex);
 
-            if (!dgStructureGen.checkAtomConfigurations(conf_data)) 
-                continue;
+                sampling_state.done = true;
+            }
 
-            if (!dgStructureGen.checkBondConfigurations(conf_data)) 
-                continue;
+            for (auto& thread : threads)
+                thread.join();
 
-            break;
+            throw;
         }
 
-        if (j == MAX_NUM_STRUCTURE_GEN_TRIALS) {
-            if (++num_struct_gen_fails == MAX_NUM_STRUCTURE_GEN_FAILS) {
-                if (logCallback) 
-                    logCallback("Could not generate any valid structure after " + std::to_string(num_struct_gen_fails) + 
-                                " consecutive trials - giving up!\n");
-                break;
-            }
+        (*workers[0])();
 
-            continue;
-        }
+        for (auto& thread : threads)
+            thread.join();
 
-        num_struct_gen_fails = 0;
-        i++;
-        
-        double energy = conf_data.getEnergy();
+    } else {
+        StochasticSamplingWorker worker(*this, sampling_state, 0);
 
-        if (workingConfs.empty() || energy < min_energy)
-            min_energy = energy;
+        worker();
+    }
 
-        if (energy <= min_energy + eWindow) {
-            workingConfs.push_back(conf_data_ptr);
-            conf_data_ptr.reset();
-        }
-        
-        if (i % conv_cycle_size == 0) {
-            removeWorkingConfDuplicates();
+    if (sampling_state.error)
+        std::rethrow_exception(sampling_state.error);
+
+    unsigned int ret_code = sampling_state.retCode;
+
+    if (ret_code != ReturnCode::SUCCESS)
+        return ret_code;
+
+    double min_energy = sampling_state.minEnergy;
+    std::size_t num_new_unique_confs = sampling_state.numNewUniqueConfs;
+    std::size_t i = sampling_state.numSamples;
+
+    statistics.increaseCounter(ConformerGeneratorStatistics::NUM_SAMPLED_CONFORMERS, i);
+
+    if (sampling_state.structGenFailed && logCallback)
+        logCallback("Could not generate any valid structure after " + std::to_string(MAX_NUM_STRUCTURE_GEN_FAILS) + 
+                    " consecutive trials - giving up!\n");
 
-            num_new_unique_confs = workingConfs.size() - last_unique_conf_count;
-            last_unique_conf_count = workingConfs.size();
-            
-            if (num_new_unique_confs == 0)
-                break;
-        }
-    }
-    
     for (ConformerDataArray::const_iterator it = workingConfs.begin(), end = workingConfs.end(); it != end; ++it) {
         const ConformerData::SharedPointer& conf = *it;
 
-        if (conf->getEnergy() > (min_energy + eWindow))
+        if (conf->getEnergy() > (min_energy + eWindow)) {
+            statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
             continue;
+        }
 
         tmpWorkingConfs.push_back(conf);
     }
@@ -691,8 +903,10 @@ void ConfGen::ConformerGeneratorImpl::removeWorkingConfDuplicates()
     for (ConformerDataArray::const_iterator it = workingConfs.begin(), end = workingConfs.end(); it != end; ++it) {
         const ConformerData::SharedPointer& conf = *it;
 
-        if (!tmpWorkingConfs.empty() && ((conf->getEnergy() - last_energy) <= CONF_DUPLICATE_ENERGY_TOLERANCE))
+        if (!tmpWorkingConfs.empty() && ((conf->getEnergy() - last_energy) <= CONF_DUPLICATE_ENERGY_TOLERANCE)) {
+            statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
             continue;
+        }
 
         last_energy = conf->getEnergy();
         tmpWorkingConfs.push_back(conf);
@@ -761,6 +975,8 @@ unsigned int ConfGen::ConformerGeneratorImpl::perceiveRotBonds()
         numRotBonds++;
     }
 
+    statistics.increaseCounter(ConformerGeneratorStatistics::NUM_ROTATABLE_BONDS, numRotBonds);
+
     if (logCallback)
         logCallback("Detected " + std::to_string(numRotBonds) + " rotatable bonds\n");
     
@@ -770,19 +986,21 @@ unsigned int ConfGen::ConformerGeneratorImpl::perceiveRotBonds()
     return ReturnCode::SUCCESS;
 }
 
-bool ConfGen::ConformerGeneratorImpl::generateHydrogenCoordsAndMinimize(ConformerData& conf_data)
+bool ConfGen::ConformerGeneratorImpl::generateHydrogenCoordsAndMinimize(ConformerData& conf_data, Chem::Hydrogen3DCoordinatesCalculator& h_coords_calc,
+                                                                        BFGSMinimizer& minimizer, MMFF94GradientCalculator& ff_grad_calc,
+                                                                        Math::Vector3DArray::StorageType& grad, std::size_t& num_iter) const
 {
-    hCoordsCalc.calculate(conf_data, false);
+    h_coords_calc.calculate(conf_data, false);
 
     Math::Vector3DArray::StorageType& conf_coords_data = conf_data.getData();
     std::size_t max_ref_iters = settings.getMaxNumRefinementIterations();
     double ref_tol = settings.getRefinementTolerance();
     double energy = 0.0;
 
-    energyMinimizer.setup(conf_coords_data, energyGradient, 0.001, 0.25);
+    minimizer.setup(conf_coords_data, grad, 0.001, 0.25);
 
-    for (std::size_t j = 0; max_ref_iters == 0 || j < max_ref_iters; j++) {
-        if (energyMinimizer.iterate(energy, conf_coords_data, energyGradient) != BFGSMinimizer::SUCCESS) {
+    for (num_iter = 0; max_ref_iters == 0 || num_iter < max_ref_iters; num_iter++) {
+        if (minimizer.iterate(energy, conf_coords_data, grad) != BFGSMinimizer::SUCCESS) {
             if (std::isnan(energy)) 
                 return false;
 
@@ -792,34 +1010,35 @@ bool ConfGen::ConformerGeneratorImpl::generateHydrogenCoordsAndMinimize(Conforme
         if (std::isnan(energy)) 
             return false;
         
-        if (energyMinimizer.getFunctionDelta() < ref_tol)
+        if (minimizer.getFunctionDelta() < ref_tol)
             break;
     }
 
     if (!elasticPotentials.isEmpty())
-        conf_data.setEnergy(mmff94GradientCalc(conf_coords_data));
+        conf_data.setEnergy(ff_grad_calc(conf_coords_data));
     else
         conf_data.setEnergy(energy);
 
     return true;
 }
 
-double ConfGen::ConformerGeneratorImpl::calcEnergy(const Math::Vector3DArray::StorageType& coords)
+double ConfGen::ConformerGeneratorImpl::calcEnergy(MMFF94GradientCalculator& ff_grad_calc, const Math::Vector3DArray::StorageType& coords) const
 {
     if (elasticPotentials.isEmpty())
-        return mmff94GradientCalc(coords);
+        return ff_grad_calc(coords);
                 
-    return (mmff94GradientCalc(coords) +
+    return (ff_grad_calc(coords) +
             ForceField::calcElasticPotentialEnergy<double>(elasticPotentials.getElementsBegin(),
                                                            elasticPotentials.getElementsEnd(), coords));
 }
 
-double ConfGen::ConformerGeneratorImpl::calcGradient(const Math::Vector3DArray::StorageType& coords, Math::Vector3DArray::StorageType& grad)
+double ConfGen::ConformerGeneratorImpl::calcGradient(MMFF94GradientCalculator& ff_grad_calc, const Math::Vector3DArray::StorageType& coords,
+                                                     Math::Vector3DArray::StorageType& grad) const
 {
      if (elasticPotentials.isEmpty())
-         return mmff94GradientCalc(coords, grad);
+         return ff_grad_calc(coords, grad);
 
-     return (mmff94GradientCalc(coords, grad) +
+     return (ff_grad_calc(coords, grad) +
             ForceField::calcElasticPotentialGradient<double>(elasticPotentials.getElementsBegin(),
                                                              elasticPotentials.getElementsEnd(), coords, grad));
 }
@@ -887,7 +1106,13 @@ ConfGen::ConformerData::SharedPointer ConfGen::ConformerGeneratorImpl::getInputC
         if (logCallback)
             logCallback("Using provided input coordinates, generating missing hydrogen coordinates\n");
 
-        if (!generateHydrogenCoordsAndMinimize(*ipt_coords)) {
+        std::size_t num_iter = 0;
+        bool success = generateHydrogenCoordsAndMinimize(*ipt_coords, hCoordsCalc, energyMinimizer, mmff94GradientCalc, energyGradient, num_iter);
+
+        statistics.increaseCounter(ConformerGeneratorStatistics::NUM_MINIMIZATIONS);
+        statistics.increaseCounter(ConformerGeneratorStatistics::NUM_MINIMIZATION_ITERATIONS, num_iter);
+
+        if (!success) {
             if (logCallback)
                 logCallback("Generation of hydrogen coordinates failed!\n");
 
@@ -965,12 +1190,16 @@ void ConfGen::ConformerGeneratorImpl::splitIntoTorsionFragments()
                   });
     }
     
+    statistics.increaseCounter(ConformerGeneratorStatistics::NUM_TORSION_FRAGMENTS, torFragConfData.size());
+
     if (logCallback)
         logCallback("Structure decomposed into " + std::to_string(torFragConfData.size()) + " torsion fragment(s)\n");
 }
 
 bool ConfGen::ConformerGeneratorImpl::setupMMFF94Parameters(unsigned int ff_type)
 {
+    StageTimer stage_timer(statistics, ConformerGeneratorStatistics::FORCE_FIELD_SETUP);
+
     try {
         if (parameterizeMMFF94Interactions(*molGraph, mmff94Parameterizer, mmff94Data, ff_type, 
                                            settings.strictForceFieldParameterization(), settings.getDielectricConstant(),
@@ -1047,8 +1276,12 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateFragmentConformers(bool st
         if (logCallback && !fragSplitBonds.empty())
             logCallback("Found " + std::to_string(fragSplitBonds.size()) + " rotatable fragment bond(s), performing torsion driving...\n");
 
-        torDriver.setup(fragments, *molGraph, fragSplitBonds.begin(), fragSplitBonds.end());
-        torDriver.setMMFF94Parameters(mmff94Data, mmff94InteractionMask);
+        {
+            StageTimer stage_timer(statistics, ConformerGeneratorStatistics::TORSION_RULE_MATCHING);
+
+            torDriver.setup(fragments, *molGraph, fragSplitBonds.begin(), fragSplitBonds.end());
+            torDriver.setMMFF94Parameters(mmff94Data, mmff94InteractionMask);
+        }
 
         if (fragSplitBonds.empty()) {
             FragmentTreeNode& frag_node = torDriver.getFragmentNode(0);
@@ -1076,7 +1309,11 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateFragmentConformers(bool st
 
                 torDriver.setInputCoordinates(fa_conf_data);
 
-                ret_code = torDriver.generateConformers();
+                {
+                    StageTimer stage_timer(statistics, ConformerGeneratorStatistics::TORSION_DRIVING);
+
+                    ret_code = torDriver.generateConformers();
+                }
 
                 if (ret_code != ReturnCode::SUCCESS)
                     return ret_code;
@@ -1111,8 +1348,10 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateFragmentConformers(bool st
                         if (frag_conf_data.conformers.empty() || energy < min_energy)
                             min_energy = energy;
 
-                        else if (energy > (min_energy + eWindow))
+                        else if (energy > (min_energy + eWindow)) {
+                            statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
                             continue;
+                        }
 
                         ConformerData::SharedPointer final_conf_data = confDataCache.get();
 
@@ -1153,12 +1392,16 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateFragmentConformers(bool st
             
 unsigned int ConfGen::ConformerGeneratorImpl::generateFragmentConformerCombinations()
 {
+    StageTimer stage_timer(statistics, ConformerGeneratorStatistics::FRAGMENT_COMBINATION);
+
     currConfComb.clear();
 
     generateFragmentConformerCombinations(0, 0.0);
 
     std::sort(torFragConfCombData.begin(), torFragConfCombData.end(), &compareConfCombinationEnergy);
 
+    statistics.increaseCounter(ConformerGeneratorStatistics::NUM_FRAGMENT_CONFORMER_COMBINATIONS, torFragConfCombData.size());
+
     unsigned int ret_code = invokeCallbacks();
 
     if (ret_code != ReturnCode::SUCCESS)
@@ -1215,8 +1458,15 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateOutputConformers(bool stru
         fragments.addElement((*it)->fragment);
     
     torDriver.getSettings().sampleAngleToleranceRanges(settings.sampleAngleToleranceRanges());
-    torDriver.setup(fragments, *molGraph, torDriveBonds.begin(), torDriveBonds.end());
-    torDriver.setMMFF94Parameters(mmff94Data, mmff94InteractionMask);
+
+    {
+        StageTimer stage_timer(statistics, ConformerGeneratorStatistics::TORSION_RULE_MATCHING);
+
+        torDriver.setup(fragments, *molGraph, torDriveBonds.begin(), torDriveBonds.end());
+        torDriver.setMMFF94Parameters(mmff94Data, mmff94InteractionMask);
+    }
+
+    StageTimer stage_timer(statistics, ConformerGeneratorStatistics::FRAGMENT_COMBINATION);
 
     std::size_t num_frags = torFragConfData.size();
     double min_energy = 0.0;
@@ -1253,6 +1503,8 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateOutputConformers(bool stru
     
         bool new_min_energy = false;
 
+        statistics.increaseCounter(ConformerGeneratorStatistics::NUM_SAMPLED_CONFORMERS, torDriver.getNumConformers());
+
         for (TorsionDriverImpl::ConstConformerIterator conf_it = torDriver.getConformersBegin(), confs_end = torDriver.getConformersEnd();
              conf_it != confs_end; ++conf_it) {
             
@@ -1263,10 +1515,11 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateOutputConformers(bool stru
                 min_energy = energy;
                 min_comb_energy = comb.energy;
 
-            } else if (energy > (min_energy + eWindow))
+            } else if (energy > (min_energy + eWindow)) {
+                statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
                 continue;
 
-            else if (energy < min_energy) {
+            } else if (energy < min_energy) {
                 min_energy = energy;
                 min_comb_energy = comb.energy;
                 new_min_energy = true;
@@ -1282,8 +1535,10 @@ unsigned int ConfGen::ConformerGeneratorImpl::generateOutputConformers(bool stru
             for (ConformerDataArray::const_iterator it = workingConfs.begin(), end = workingConfs.end(); it != end; ++it) {
                 const ConformerData::SharedPointer& conf_data = *it;
 
-                if (conf_data->getEnergy() > (min_energy + eWindow))
+                if (conf_data->getEnergy() > (min_energy + eWindow)) {
+                    statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
                     continue;
+                }
 
                 tmpWorkingConfs.push_back(conf_data);
             } 
@@ -1310,6 +1565,8 @@ unsigned int ConfGen::ConformerGeneratorImpl::selectOutputConformers(bool struct
     using namespace Chem;
     using namespace MolProp;
 
+    StageTimer stage_timer(statistics, ConformerGeneratorStatistics::OUTPUT_SELECTION);
+
     have_ipt_coords = false;
     
     if (struct_gen_only) {
@@ -1453,8 +1710,10 @@ unsigned int ConfGen::ConformerGeneratorImpl::selectOutputConformers(bool struct
                 if (outputConfs.empty() && confSelector.getNumSymmetryMappings() > MAX_NUM_SYMMETRY_MAPPINGS)
                     too_much_sym = true;
 
-                if (!selected)
+                if (!selected) {
+                    statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
                     continue;
+                }
             }
 
             outputConfs.push_back(conf_data);
@@ -1492,8 +1751,10 @@ unsigned int ConfGen::ConformerGeneratorImpl::selectOutputConformers(bool struct
                         if (outputConfs.empty() && confSelector.getNumSymmetryMappings() > MAX_NUM_SYMMETRY_MAPPINGS)
                             too_much_sym = true;
 
-                        if (!selected)
+                        if (!selected) {
+                            statistics.increaseCounter(ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS);
                             continue;
+                        }
                     }
 
                     outputConfs.push_back(conf_data);
@@ -34,6 +34,7 @@
 #include <utility>
 
 #include "CDPL/ConfGen/ConformerGeneratorSettings.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/ConfGen/ConformerDataArray.hpp"
 #include "CDPL/ConfGen/CallbackFunction.hpp"
 #include "CDPL/ConfGen/RMSDConformerSelector.hpp"
@@ -109,9 +110,13 @@ namespace CDPL
 
             ConstConformerIterator getConformersEnd() const;
 
+            const ConformerGeneratorStatistics& getStatistics() const;
+
           private:
             struct FragmentConfData;
             struct ConfCombinationData;
+            struct StochasticSamplingState;
+            class StochasticSamplingWorker;
 
             typedef Util::ObjectPool<FragmentConfData>         FragmentConfDataCache;
             typedef FragmentConfDataCache::SharedObjectPointer FragmentConfDataPtr;
@@ -140,11 +145,16 @@ namespace CDPL
 
             unsigned int perceiveRotBonds();
             
-            bool generateHydrogenCoordsAndMinimize(ConformerData& conf_data);
+            typedef ForceField::MMFF94GradientCalculator<double>                  MMFF94GradientCalculator;
+            typedef Math::BFGSMinimizer<Math::Vector3DArray::StorageType, double> BFGSMinimizer;
 
-            double calcEnergy(const Math::Vector3DArray::StorageType& coords);
-            double calcGradient(const Math::Vector3DArray::StorageType& coords,
-                                Math::Vector3DArray::StorageType& grad);
+            bool generateHydrogenCoordsAndMinimize(ConformerData& conf_data, Chem::Hydrogen3DCoordinatesCalculator& h_coords_calc,
+                                                   BFGSMinimizer& minimizer, MMFF94GradientCalculator& ff_grad_calc,
+                                                   Math::Vector3DArray::StorageType& grad, std::size_t& num_iter) const;
+
+            double calcEnergy(MMFF94GradientCalculator& ff_grad_calc, const Math::Vector3DArray::StorageType& coords) const;
+            double calcGradient(MMFF94GradientCalculator& ff_grad_calc, const Math::Vector3DArray::StorageType& coords,
+                                Math::Vector3DArray::StorageType& grad) const;
             
             ConformerData::SharedPointer getInputCoordinatesForFixedSubstruct(const Chem::MolecularGraph& molgraph);
             ConformerData::SharedPointer getInputCoordinates();
@@ -207,16 +217,15 @@ namespace CDPL
             typedef std::vector<FragmentConfDataPtr>                              FragmentConfDataList;
             typedef ForceField::MMFF94InteractionData                             MMFF94InteractionData;
             typedef ForceField::MMFF94InteractionParameterizer                    MMFF94Parameterizer;
-            typedef ForceField::MMFF94GradientCalculator<double>                  MMFF94GradientCalculator;
             typedef ForceField::ElasticPotentialList                              ElasticPotentialList;
             typedef std::vector<const Chem::Bond*>                                BondList;
             typedef std::vector<ConfCombinationData*>                             ConfCombinationDataList;
-            typedef Math::BFGSMinimizer<Math::Vector3DArray::StorageType, double> BFGSMinimizer;
 
             ConformerDataCache                    confDataCache;
             FragmentConfDataCache                 fragConfDataCache;
             ConfCombinationDataCache              confCombDataCache;
             ConformerGeneratorSettings            settings;
+            ConformerGeneratorStatistics          statistics;
             const Chem::MolecularGraph*           molGraph;
             Chem::ComponentSet                    fixedSubstructFrags;
             const Chem::MolecularGraph*           fixedSubstruct;
@@ -42,7 +42,7 @@ ConfGen::ConformerGeneratorSettings::ConformerGeneratorSettings():
     dielectricConst(ForceField::MMFF94ElectrostaticInteractionParameterizer::DIELECTRIC_CONSTANT_WATER),
     distExponent(ForceField::MMFF94ElectrostaticInteractionParameterizer::DEF_DISTANCE_EXPONENT),
     maxNumOutputConfs(100), minRMSD(0.5), maxNumRefIters(0), refTolerance(0.001), maxNumSampledConfs(2000),
-    convCheckCycleSize(100), mcRotorBondCountThresh(10)
+    convCheckCycleSize(100), numSamplingThreads(0), mcRotorBondCountThresh(10)
 {}
 
 void ConfGen::ConformerGeneratorSettings::setSamplingMode(unsigned int mode)
@@ -319,6 +319,16 @@ std::size_t ConfGen::ConformerGeneratorSettings::getConvergenceCheckCycleSize()
     return convCheckCycleSize;
 }
 
+void ConfGen::ConformerGeneratorSettings::setNumSamplingThreads(std::size_t num_threads)
+{
+    numSamplingThreads = num_threads;
+}
+
+std::size_t ConfGen::ConformerGeneratorSettings::getNumSamplingThreads() const
+{
+    return numSamplingThreads;
+}
+
 void ConfGen::ConformerGeneratorSettings::setMacrocycleRotorBondCountThreshold(std::size_t min_count)
 {
     mcRotorBondCountThresh = min_count;
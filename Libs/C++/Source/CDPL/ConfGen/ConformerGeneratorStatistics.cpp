@@ -0,0 +1,190 @@
+/* 
+ * ConformerGeneratorStatistics.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+
+#include "StaticInit.hpp"
+
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+using namespace CDPL;
+
+
+namespace
+{
+
+    const char* STAGE_NAMES[] = {
+        "force_field_setup",
+        "fragment_library_lookup",
+        "fragment_conformer_generation",
+        "torsion_rule_matching",
+        "torsion_driving",
+        "fragment_combination",
+        "structure_embedding",
+        "energy_minimization",
+        "output_selection"
+    };
+
+    const char* COUNTER_NAMES[] = {
+        "num_rotatable_bonds",
+        "num_torsion_fragments",
+        "num_fragment_library_hits",
+        "num_fragment_cache_hits",
+        "num_generated_fragments",
+        "num_fragment_conformer_combinations",
+        "num_sampled_conformers",
+        "num_structure_generation_failures",
+        "num_minimizations",
+        "num_minimization_iterations",
+        "num_rejected_conformers",
+        "num_output_conformers"
+    };
+
+    static_assert(sizeof(STAGE_NAMES) / sizeof(const char*) == ConfGen::ConformerGeneratorStatistics::NUM_STAGES,
+                  "stage name table size mismatch");
+    static_assert(sizeof(COUNTER_NAMES) / sizeof(const char*) == ConfGen::ConformerGeneratorStatistics::NUM_COUNTERS,
+                  "counter name table size mismatch");
+}
+
+
+ConfGen::ConformerGeneratorStatistics::ConformerGeneratorStatistics()
+{
+    clear();
+}
+
+void ConfGen::ConformerGeneratorStatistics::clear()
+{
+    totalTime = 0.0;
+
+    stageTimes.fill(0.0);
+    counters.fill(0);
+}
+
+double ConfGen::ConformerGeneratorStatistics::getTotalTime() const
+{
+    return totalTime;
+}
+
+void ConfGen::ConformerGeneratorStatistics::setTotalTime(double time)
+{
+    totalTime = time;
+}
+
+double ConfGen::ConformerGeneratorStatistics::getStageTime(Stage stage) const
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ConformerGeneratorStatistics: stage out of bounds");
+
+    return stageTimes[stage];
+}
+
+void ConfGen::ConformerGeneratorStatistics::setStageTime(Stage stage, double time)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ConformerGeneratorStatistics: stage out of bounds");
+
+    stageTimes[stage] = time;
+}
+
+void ConfGen::ConformerGeneratorStatistics::addStageTime(Stage stage, double time)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ConformerGeneratorStatistics: stage out of bounds");
+
+    stageTimes[stage] += time;
+}
+
+std::size_t ConfGen::ConformerGeneratorStatistics::getCounter(Counter counter) const
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ConformerGeneratorStatistics: counter out of bounds");
+
+    return counters[counter];
+}
+
+void ConfGen::ConformerGeneratorStatistics::setCounter(Counter counter, std::size_t value)
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ConformerGeneratorStatistics: counter out of bounds");
+
+    counters[counter] = value;
+}
+
+void ConfGen::ConformerGeneratorStatistics::increaseCounter(Counter counter, std::size_t inc)
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ConformerGeneratorStatistics: counter out of bounds");
+
+    counters[counter] += inc;
+}
+
+double ConfGen::ConformerGeneratorStatistics::getFragmentLibraryHitRate() const
+{
+    std::size_t num_lookups = counters[NUM_FRAGMENT_LIBRARY_HITS] + counters[NUM_FRAGMENT_CACHE_HITS] + counters[NUM_GENERATED_FRAGMENTS];
+
+    if (num_lookups == 0)
+        return 0.0;
+
+    return (double(counters[NUM_FRAGMENT_LIBRARY_HITS]) / num_lookups);
+}
+
+double ConfGen::ConformerGeneratorStatistics::getFragmentCacheHitRate() const
+{
+    std::size_t num_lookups = counters[NUM_FRAGMENT_CACHE_HITS] + counters[NUM_GENERATED_FRAGMENTS];
+
+    if (num_lookups == 0)
+        return 0.0;
+
+    return (double(counters[NUM_FRAGMENT_CACHE_HITS]) / num_lookups);
+}
+
+ConfGen::ConformerGeneratorStatistics& ConfGen::ConformerGeneratorStatistics::operator+=(const ConformerGeneratorStatistics& stats)
+{
+    totalTime += stats.totalTime;
+
+    for (std::size_t i = 0; i < NUM_STAGES; i++)
+        stageTimes[i] += stats.stageTimes[i];
+
+    for (std::size_t i = 0; i < NUM_COUNTERS; i++)
+        counters[i] += stats.counters[i];
+
+    return *this;
+}
+
+const char* ConfGen::ConformerGeneratorStatistics::getStageName(Stage stage)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ConformerGeneratorStatistics: stage out of bounds");
+
+    return STAGE_NAMES[stage];
+}
+
+const char* ConfGen::ConformerGeneratorStatistics::getCounterName(Counter counter)
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ConformerGeneratorStatistics: counter out of bounds");
+
+    return COUNTER_NAMES[counter];
+}
@@ -32,13 +32,14 @@
 #include "CDPL/Chem/FragmentList.hpp"
 #include "CDPL/Chem/AtomFunctions.hpp"
 #include "CDPL/Chem/BondFunctions.hpp"
+#include "CDPL/Chem/AtomConfiguration.hpp"
 
 
 using namespace CDPL;
 
 
 ConfGen::DGStructureGenerator::DGStructureGenerator(): 
-    molGraph(0), settings(DGStructureGeneratorSettings::DEFAULT)
+    molGraph(0), settings(DGStructureGeneratorSettings::DEFAULT), nextBatchCoordsIdx(0)
 {
     phase1CoordsGen.setNumCycles(70);
     phase1CoordsGen.setCycleStepCountFactor(1.3);
@@ -99,6 +100,47 @@ bool ConfGen::DGStructureGenerator::generate(Math::Vector3DArray& coords)
     if (!molGraph)
         return false;
 
+    if (settings.getEmbeddingBatchSize() > 1) {
+        if (nextBatchCoordsIdx >= batchCoords.size())
+            genBatchCoordinates();
+
+        coords.swap(batchCoords[nextBatchCoordsIdx++]);
+
+    } else {
+        genStartCoordinates(coords);
+
+        phase1CoordsGen.generate(molGraph->getNumAtoms(), coords.getData());
+
+        if (settings.enablePlanarityConstraints()) 
+            phase2CoordsGen.generate(molGraph->getNumAtoms(), coords.getData());
+    }
+
+    if (settings.regardAtomConfiguration() && (!checkAtomConfigVolumes(coords) || !checkAtomConfigurations(coords)))
+        return false;
+
+    if (settings.regardBondConfiguration() && !checkBondConfigurations(coords))
+        return false;
+
+    return true;
+}
+
+void ConfGen::DGStructureGenerator::genBatchCoordinates()
+{
+    batchCoords.resize(settings.getEmbeddingBatchSize());
+
+    for (auto& coords : batchCoords)
+        genStartCoordinates(coords);
+
+    phase1CoordsGen.generateBatch(molGraph->getNumAtoms(), batchCoords.begin(), batchCoords.end());
+
+    if (settings.enablePlanarityConstraints()) 
+        phase2CoordsGen.generateBatch(molGraph->getNumAtoms(), batchCoords.begin(), batchCoords.end());
+
+    nextBatchCoordsIdx = 0;
+}
+
+void ConfGen::DGStructureGenerator::genStartCoordinates(Math::Vector3DArray& coords)
+{
     auto num_atoms = molGraph->getNumAtoms();
     auto& x_h_mask = dgConstraintsGen.getExcludedHydrogenMask();
 
@@ -142,19 +184,6 @@ bool ConfGen::DGStructureGenerator::generate(Math::Vector3DArray& coords)
             }
         }
     }
-    
-    phase1CoordsGen.generate(molGraph->getNumAtoms(), coords.getData());
-
-    if (settings.enablePlanarityConstraints()) 
-        phase2CoordsGen.generate(molGraph->getNumAtoms(), coords.getData());
-    
-    if (settings.regardAtomConfiguration() && !checkAtomConfigurations(coords))
-        return false;
-
-    if (settings.regardBondConfiguration() && !checkBondConfigurations(coords))
-        return false;
-
-    return true;
 }
 
 void ConfGen::DGStructureGenerator::setup(const Chem::MolecularGraph& molgraph, const ForceField::MMFF94InteractionData* ia_data,
@@ -220,6 +249,22 @@ void ConfGen::DGStructureGenerator::setup(const Chem::MolecularGraph& molgraph,
     }
 
     randomEngine.seed(170375);
+
+    initAtomConfigVolumes();
+
+    batchCoords.clear();
+    nextBatchCoordsIdx = 0;
+}
+
+void ConfGen::DGStructureGenerator::setRandomSeed(unsigned int seed)
+{
+    randomEngine.seed(seed);
+
+    phase1CoordsGen.setRandomSeed(seed);
+    phase2CoordsGen.setRandomSeed(seed);
+
+    batchCoords.clear();
+    nextBatchCoordsIdx = 0;
 }
 
 bool ConfGen::DGStructureGenerator::checkAtomConfigurations(Math::Vector3DArray& coords) const
@@ -238,6 +283,55 @@ bool ConfGen::DGStructureGenerator::checkAtomConfigurations(Math::Vector3DArray&
     return true;
 }
 
+void ConfGen::DGStructureGenerator::initAtomConfigVolumes()
+{
+    using namespace Chem;
+
+    atomConfigVolumes.clear();
+
+    // same point order and sign convention as in DGConstraintGenerator::addAtomConfigurationConstraints()
+
+    for (DGConstraintGenerator::ConstStereoCenterDataIterator it = dgConstraintsGen.getAtomStereoCenterDataBegin(),
+             end = dgConstraintsGen.getAtomStereoCenterDataEnd(); it != end; ++it) {
+
+        const Chem::StereoDescriptor& descr = it->second;
+        AtomConfigVolume vol;
+
+        vol.pointIndices[0] = molGraph->getAtomIndex(*descr.getReferenceAtoms()[0]);
+        vol.pointIndices[1] = molGraph->getAtomIndex(*descr.getReferenceAtoms()[1]);
+        vol.pointIndices[2] = molGraph->getAtomIndex(*descr.getReferenceAtoms()[2]);
+        vol.pointIndices[3] = (descr.getNumReferenceAtoms() == 3 ? it->first : molGraph->getAtomIndex(*descr.getReferenceAtoms()[3]));
+        vol.negative = (descr.getConfiguration() == AtomConfiguration::R);
+
+        atomConfigVolumes.push_back(vol);
+    }
+}
+
+bool ConfGen::DGStructureGenerator::checkAtomConfigVolumes(const Math::Vector3DArray& coords) const
+{
+    // cheap pre-check that rejects structures with an inverted stereocenter before the more expensive
+    // configuration perception gets invoked
+
+    for (const auto& vol : atomConfigVolumes) {
+        auto pt4_pos = coords[vol.pointIndices[3]].getData();
+        double v_41[3], v_42[3], v_43[3];
+
+        for (std::size_t i = 0; i < 3; i++) {
+            v_41[i] = coords[vol.pointIndices[0]][i] - pt4_pos[i];
+            v_42[i] = coords[vol.pointIndices[1]][i] - pt4_pos[i];
+            v_43[i] = coords[vol.pointIndices[2]][i] - pt4_pos[i];
+        }
+
+        double vol_x6 = v_41[0] * (v_42[1] * v_43[2] - v_42[2] * v_43[1]) - v_41[1] * (v_42[0] * v_43[2] - v_42[2] * v_43[0]) +
+            v_41[2] * (v_42[0] * v_43[1] - v_42[1] * v_43[0]);
+
+        if (vol.negative ? (vol_x6 > 0.0) : (vol_x6 < 0.0))
+            return false;
+    }
+
+    return true;
+}
+
 bool ConfGen::DGStructureGenerator::checkBondConfigurations(Math::Vector3DArray& coords) const
 {
     for (DGConstraintGenerator::ConstStereoCenterDataIterator it = dgConstraintsGen.getBondStereoCenterDataBegin(),
@@ -31,7 +31,7 @@ using namespace CDPL;
 
 
 ConfGen::DGStructureGeneratorSettings::DGStructureGeneratorSettings(): 
-    boxSize(50.0), planarConstr(true)
+    boxSize(50.0), planarConstr(true), embBatchSize(1)
 {}
 
 void ConfGen::DGStructureGeneratorSettings::setBoxSize(double size)
@@ -53,3 +53,13 @@ bool ConfGen::DGStructureGeneratorSettings::enablePlanarityConstraints() const
 {
     return planarConstr;
 }
+
+void ConfGen::DGStructureGeneratorSettings::setEmbeddingBatchSize(std::size_t size)
+{
+    embBatchSize = size;
+}
+
+std::size_t ConfGen::DGStructureGeneratorSettings::getEmbeddingBatchSize() const
+{
+    return embBatchSize;
+}
@@ -53,6 +53,7 @@
 #include "TorsionLibraryDataReader.hpp"
 #include "FallbackTorsionLibrary.hpp"
 #include "FragmentConformerCache.hpp"
+#include "StageTimer.hpp"
 #include "UtilityFunctions.hpp"
 
 
@@ -101,7 +102,7 @@ namespace
 
 ConfGen::FragmentAssemblerImpl::FragmentAssemblerImpl():
     confDataCache(MAX_CONF_DATA_CACHE_SIZE), settings(FragmentAssemblerSettings::DEFAULT),
-    fragTree(MAX_TREE_CONF_DATA_CACHE_SIZE)
+    statistics(0), fragTree(MAX_TREE_CONF_DATA_CACHE_SIZE)
 {
     fragLibs.push_back(FragmentLibrary::get());
 
@@ -173,6 +174,11 @@ const ConfGen::FragmentAssemblerImpl::BondLengthFunction& ConfGen::FragmentAssem
     return bondLengthFunc;
 }
 
+void ConfGen::FragmentAssemblerImpl::setStatistics(ConformerGeneratorStatistics* stats)
+{
+    statistics = stats;
+}
+
 std::size_t ConfGen::FragmentAssemblerImpl::getNumConformers() const
 {
     return fragTree.getRoot()->getNumConformers();
@@ -403,7 +409,15 @@ unsigned int ConfGen::FragmentAssemblerImpl::getFragmentConformers()
                 logCallback(" Hash Code: " + std::to_string(canonFrag.getHashCode()) + "\n");
             }
      
-            if (!fetchConformersFromFragmentLibrary(frag_type, frag, frag_node) && !fetchConformersFromFragmentCache(frag_type, frag, frag_node)) {
+            bool have_confs = false;
+
+            {
+                StageTimer stage_timer(statistics, ConformerGeneratorStatistics::FRAGMENT_LIBRARY_LOOKUP);
+
+                have_confs = (fetchConformersFromFragmentLibrary(frag_type, frag, frag_node) || fetchConformersFromFragmentCache(frag_type, frag, frag_node));
+            }
+
+            if (!have_confs) {
                 unsigned int ret_code = generateFragmentConformers(frag_type, frag, frag_node);
 
                 if (ret_code != ReturnCode::SUCCESS) {
@@ -519,6 +533,9 @@ bool ConfGen::FragmentAssemblerImpl::fetchConformersFromFragmentLibrary(unsigned
         if (!setNodeConformers(frag_type, frag, node, entry_ptr->getData()))
             continue;
 
+        if (statistics)
+            statistics->increaseCounter(ConformerGeneratorStatistics::NUM_FRAGMENT_LIBRARY_HITS);
+
         if (logCallback)
             logCallback(" Coordinates source: library\n");
 
@@ -540,6 +557,9 @@ bool ConfGen::FragmentAssemblerImpl::fetchConformersFromFragmentCache(unsigned i
     if (!setNodeConformers(frag_type, frag, node, *cache_confs))
         return false;
 
+    if (statistics)
+        statistics->increaseCounter(ConformerGeneratorStatistics::NUM_FRAGMENT_CACHE_HITS);
+
     if (logCallback)
         logCallback(" Coordinates source: cache\n");
 
@@ -627,6 +647,11 @@ unsigned int ConfGen::FragmentAssemblerImpl::generateFragmentConformers(unsigned
     
     canonFrag.perceiveSSSR();
 
+    StageTimer stage_timer(statistics, ConformerGeneratorStatistics::FRAGMENT_CONFORMER_GENERATION);
+
+    if (statistics)
+        statistics->increaseCounter(ConformerGeneratorStatistics::NUM_GENERATED_FRAGMENTS);
+
     auto ret_code = fragConfGen.generate(canonFrag, frag_type, fixedCanonFragSubstruct.getNumBonds() == 0 ?
                                          nullptr : &fixedCanonFragSubstruct, &fixedCanonFragSubstructCoords);
 
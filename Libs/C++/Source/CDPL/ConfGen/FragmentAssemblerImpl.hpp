@@ -40,6 +40,7 @@
 #include "CDPL/ConfGen/CanonicalFragment.hpp"
 #include "CDPL/ConfGen/FragmentLibrary.hpp"
 #include "CDPL/ConfGen/ConformerDataArray.hpp"
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
 #include "CDPL/Chem/FragmentList.hpp"
 #include "CDPL/Util/ObjectPool.hpp"
 #include "CDPL/Util/BitSet.hpp"
@@ -91,6 +92,8 @@ namespace CDPL
 
             const BondLengthFunction& getBondLengthFunction() const;
 
+            void setStatistics(ConformerGeneratorStatistics* stats);
+
             unsigned int assemble(const Chem::MolecularGraph& molgraph,
                                   const Chem::MolecularGraph& parent_molgraph,
                                   const Chem::MolecularGraph* fixed_substr,
@@ -188,6 +191,7 @@ namespace CDPL
             CallbackFunction               timeoutCallback;
             LogMessageCallbackFunction     logCallback;
             BondLengthFunction             bondLengthFunc;
+            ConformerGeneratorStatistics*  statistics;
             BondList                       fragSplitBonds;
             Chem::FragmentList             fragments;
             FragmentTree                   fragTree;
@@ -67,6 +67,7 @@ namespace
     } 
 
     constexpr std::size_t MAX_CONF_DATA_CACHE_SIZE            = 500;
+    constexpr std::size_t MAX_MMFF94_DATA_CACHE_SIZE          = 32;
     constexpr std::size_t MAX_NUM_STRUCTURE_GEN_TRIALS        = 10;
     constexpr std::size_t MAX_NUM_SYM_MAPPINGS                = 64;
     constexpr double      ELASTIC_POTENTIAL_FORCE_CONST       = 500.0;
@@ -96,6 +97,9 @@ ConfGen::FragmentConformerGeneratorImpl::FragmentConformerGeneratorImpl():
     symMappingSearch.setAtomPropertyFlags(AtomPropertyFlag::TYPE | AtomPropertyFlag::FORMAL_CHARGE | 
                                           AtomPropertyFlag::CONFIGURATION | AtomPropertyFlag::AROMATICITY |
                                           AtomPropertyFlag::EXPLICIT_BOND_COUNT | AtomPropertyFlag::HYBRIDIZATION_STATE);
+
+    mmff94Parameterizer.setInteractionDataCache(
+        ForceField::MMFF94InteractionDataCache::SharedPointer(new ForceField::MMFF94InteractionDataCache(MAX_MMFF94_DATA_CACHE_SIZE)));
 }
 
 ConfGen::FragmentConformerGeneratorSettings& ConfGen::FragmentConformerGeneratorImpl::getSettings()
@@ -25,8 +25,13 @@
 #include "StaticInit.hpp"
 
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <ios>
+#include <fstream>
 
 #include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 #include <boost/iostreams/stream.hpp>
 
 #include "CDPL/ConfGen/FragmentLibrary.hpp"
@@ -59,10 +64,22 @@ namespace
 ConfGen::FragmentLibrary::SharedPointer ConfGen::FragmentLibrary::defaultLib = builtinFragLib;
 
 
+struct ConfGen::FragmentLibrary::MappedFileData
+{
+
+    boost::iostreams::mapped_file_source file;
+    std::uint64_t                        indexOffset;
+    std::uint64_t                        numEntries;
+    CFLFragmentLibraryEntryReader        entryReader;
+    HashToEntryMap                       decodedEntries;
+    std::mutex                           mutex;
+};
+
+
 ConfGen::FragmentLibrary::FragmentLibrary() {}
 
 ConfGen::FragmentLibrary::FragmentLibrary(const FragmentLibrary& lib):
-    hashToEntryMap(lib.hashToEntryMap)
+    hashToEntryMap(lib.hashToEntryMap), mappedFileData(lib.mappedFileData)
 {}
 
 ConfGen::FragmentLibrary::~FragmentLibrary() {}
@@ -73,6 +90,7 @@ ConfGen::FragmentLibrary& ConfGen::FragmentLibrary::operator=(const FragmentLibr
         return *this;
 
     hashToEntryMap = lib.hashToEntryMap;
+    mappedFileData = lib.mappedFileData;
 
     return *this;
 }
@@ -97,15 +115,25 @@ ConfGen::FragmentLibrary::getEntry(std::uint64_t hash_code) const
 {
     HashToEntryMap::iterator it = hashToEntryMap.find(hash_code);
 
-    if (it == hashToEntryMap.end())
+    if (it == hashToEntryMap.end()) {
+        if (mappedFileData)
+            return getMappedEntry(hash_code);
+
         return NO_ENTRY;
+    }
 
     return it->second;
 }
 
 bool ConfGen::FragmentLibrary::containsEntry(std::uint64_t hash_code) const
 {
-    return (hashToEntryMap.find(hash_code) != hashToEntryMap.end());
+    if (hashToEntryMap.find(hash_code) != hashToEntryMap.end())
+        return true;
+
+    std::uint64_t entry_offs;
+
+    return (mappedFileData && CFLFragmentLibraryEntryReader::findIndexedEntry(mappedFileData->file.data(), mappedFileData->indexOffset,
+                                                                              mappedFileData->numEntries, hash_code, entry_offs));
 }
 
 std::size_t ConfGen::FragmentLibrary::getNumEntries() const
@@ -116,6 +144,7 @@ std::size_t ConfGen::FragmentLibrary::getNumEntries() const
 void ConfGen::FragmentLibrary::clear()
 {
     hashToEntryMap.clear();
+    mappedFileData.reset();
 }
 
 bool ConfGen::FragmentLibrary::removeEntry(std::uint64_t hash_code)
@@ -194,14 +223,26 @@ void ConfGen::FragmentLibrary::load(std::istream& is)
     }
 }
 
-void ConfGen::FragmentLibrary::save(std::ostream& os) const
+void ConfGen::FragmentLibrary::save(std::ostream& os, bool write_index) const
 {
+    typedef std::vector<const Entry*> EntryList;
+
     CFLFragmentLibraryEntryWriter writer;
+    EntryList                     entries;
+
+    // entries are written in the order of their hash codes to get reproducible output files
+
+    entries.reserve(hashToEntryMap.size());
+
+    for (HashToEntryMap::const_iterator it = hashToEntryMap.begin(), end = hashToEntryMap.end(); it != end; ++it)
+        entries.push_back(&*it);
+
+    std::sort(entries.begin(), entries.end(),
+              [](const Entry* entry1, const Entry* entry2) { return (entry1->first < entry2->first); });
 
-    for (HashToEntryMap::const_iterator it = hashToEntryMap.begin(), end = hashToEntryMap.end();
-         it != end; ++it) {
+    for (EntryList::const_iterator it = entries.begin(), end = entries.end(); it != end; ++it) {
         try {
-            if (!writer.write(os, *it->second))
+            if (!writer.write(os, *(*it)->second))
                 throw Base::IOError(
                     "FragmentLibrary: unspecified error while saving fragment library");
 
@@ -210,6 +251,82 @@ void ConfGen::FragmentLibrary::save(std::ostream& os) const
                                 std::string(e.what()));
         }
     }
+
+    if (write_index && !writer.writeIndex(os))
+        throw Base::IOError("FragmentLibrary: error while saving fragment library index");
+}
+
+bool ConfGen::FragmentLibrary::mapFile(const std::string& file_name)
+{
+    mappedFileData.reset();
+
+    // empty files cannot be mapped but are valid (index-less) fragment library files
+
+    std::ifstream is(file_name, std::ios_base::in | std::ios_base::binary | std::ios_base::ate);
+
+    if (!is)
+        throw Base::IOError("FragmentLibrary: could not open fragment library file '" + file_name + "'");
+
+    if (is.tellg() == std::streampos(0))
+        return false;
+
+    is.close();
+
+    MappedFileDataPointer file_data(new MappedFileData());
+
+    try {
+        file_data->file.open(file_name);
+
+    } catch (const std::ios_base::failure& e) {
+        throw Base::IOError("FragmentLibrary: mapping of fragment library file '" + file_name + "' failed: " +
+                            std::string(e.what()));
+    }
+
+    if (!file_data->entryReader.readIndex(file_data->file.data(), file_data->file.size(),
+                                          file_data->indexOffset, file_data->numEntries))
+        return false;
+
+    mappedFileData = file_data;
+    return true;
+}
+
+void ConfGen::FragmentLibrary::unmapFile()
+{
+    mappedFileData.reset();
+}
+
+std::size_t ConfGen::FragmentLibrary::getNumMappedEntries() const
+{
+    return (mappedFileData ? mappedFileData->numEntries : 0);
+}
+
+const ConfGen::FragmentLibraryEntry::SharedPointer&
+ConfGen::FragmentLibrary::getMappedEntry(std::uint64_t hash_code) const
+{
+    std::lock_guard<std::mutex> lock(mappedFileData->mutex);
+
+    HashToEntryMap::iterator it = mappedFileData->decodedEntries.find(hash_code);
+
+    if (it != mappedFileData->decodedEntries.end())
+        return it->second;
+
+    std::uint64_t entry_offs;
+
+    if (!CFLFragmentLibraryEntryReader::findIndexedEntry(mappedFileData->file.data(), mappedFileData->indexOffset,
+                                                         mappedFileData->numEntries, hash_code, entry_offs))
+        return NO_ENTRY;
+
+    FragmentLibraryEntry::SharedPointer entry(new FragmentLibraryEntry());
+
+    try {
+        mappedFileData->entryReader.read(mappedFileData->file.data(), mappedFileData->indexOffset, entry_offs, *entry);
+
+    } catch (const std::exception& e) {
+        throw Base::IOError("FragmentLibrary: error while reading mapped fragment library entry: " +
+                            std::string(e.what()));
+    }
+
+    return mappedFileData->decodedEntries.emplace(hash_code, entry).first->second;
 }
 
 void ConfGen::FragmentLibrary::loadDefaults()
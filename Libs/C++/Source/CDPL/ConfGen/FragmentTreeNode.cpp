@@ -26,6 +26,10 @@
 
 #include <cmath>
 #include <algorithm>
+#include <limits>
+#include <thread>
+#include <mutex>
+#include <exception>
 
 #include "CDPL/ConfGen/ReturnCode.hpp"
 #include "CDPL/Chem/MolecularGraph.hpp"
@@ -34,6 +38,8 @@
 #include "CDPL/Chem/AtomFunctions.hpp"
 #include "CDPL/Chem/UtilityFunctions.hpp"
 #include "CDPL/ForceField/UtilityFunctions.hpp"
+#include "CDPL/ForceField/MMFF94EnergyFunctions.hpp"
+#include "CDPL/ForceField/InteractionType.hpp"
 #include "CDPL/MolProp/AtomFunctions.hpp"
 
 #include "FragmentTreeNode.hpp"
@@ -62,11 +68,30 @@ namespace
     constexpr double CONFORMER_LINEUP_SPACING       = 4.0;
     const double MAX_TORSION_REF_BOND_ANGLE_COS = std::cos(2.5 / 180.0 * M_PI);
     constexpr double MAX_PLANAR_ATOM_GEOM_OOP_ANGLE = 10.0 / 180.0 * M_PI;
+    constexpr double CLASH_PRESCREEN_DIST_FACTOR    = 0.6;
+    constexpr std::size_t MIN_PARALLEL_CONF_COMBINATIONS = 5000;
 }
 
 
+struct ConfGen::FragmentTreeNode::ConfCombinationState
+{
+
+    ConfCombinationState(std::size_t num_left_confs, std::size_t left_atom_idx, std::size_t right_atom_idx):
+        leftConfCombinations(num_left_confs), leftAtomIndex(left_atom_idx), rightAtomIndex(right_atom_idx),
+        minEnergy(std::numeric_limits<double>::infinity()), minRigidEnergy(0.0) {}
+
+    std::vector<ConformerDataArray> leftConfCombinations;
+    std::size_t                     leftAtomIndex;
+    std::size_t                     rightAtomIndex;
+    double                          minEnergy;
+    double                          minRigidEnergy;
+    std::mutex                      mutex;
+    std::exception_ptr              error;
+};
+
+
 ConfGen::FragmentTreeNode::FragmentTreeNode(ConfGen::FragmentTree& owner): 
-    owner(owner), parent(0), splitBond(0), changed(true)
+    owner(owner), parent(0), splitBond(0), minRotEnergy(0.0), changed(true)
 {
     splitBondAtoms[0] = 0;
     splitBondAtoms[1] = 0;
@@ -215,6 +240,14 @@ void ConfGen::FragmentTreeNode::distMMFF94Parameters(const ForceField::MMFF94Int
                                             ia_mask.torsion, atomMask);
 
     mmff94EnergyCalc.setup(mmff94Data);
+    mmff94RigidEnergyCalc.setup(mmff94Data);
+    mmff94RigidEnergyCalc.setEnabledInteractionTypes(ForceField::InteractionType::BOND_STRETCHING | ForceField::InteractionType::ANGLE_BENDING |
+                                                     ForceField::InteractionType::STRETCH_BEND | ForceField::InteractionType::OUT_OF_PLANE_BENDING);
+    mmff94RotEnergyCalc.setup(mmff94Data);
+    mmff94RotEnergyCalc.setEnabledInteractionTypes(ForceField::InteractionType::TORSION | ForceField::InteractionType::ELECTROSTATIC |
+                                                   ForceField::InteractionType::VAN_DER_WAALS);
+
+    calcMinRotationalEnergy();
 }
 
 const ConfGen::ConformerDataArray& ConfGen::FragmentTreeNode::getConformers() const
@@ -296,7 +329,7 @@ void ConfGen::FragmentTreeNode::addConformer(const ConformerData::SharedPointer&
     changed = true;
 }
 
-unsigned int ConfGen::FragmentTreeNode::generateConformers(double e_window, std::size_t max_pool_size)
+unsigned int ConfGen::FragmentTreeNode::generateConformers(double e_window, std::size_t max_pool_size, std::size_t num_threads)
 {
     if (!conformers.empty())
         return ReturnCode::SUCCESS;
@@ -308,12 +341,12 @@ unsigned int ConfGen::FragmentTreeNode::generateConformers(double e_window, std:
         return ReturnCode::TORSION_DRIVING_FAILED;
     }
 
-    unsigned int ret_code = leftChild->generateConformers(e_window, max_pool_size);
+    unsigned int ret_code = leftChild->generateConformers(e_window, max_pool_size, num_threads);
 
     if (ret_code != ReturnCode::SUCCESS)
         return ret_code;
 
-    ret_code = rightChild->generateConformers(e_window, max_pool_size);
+    ret_code = rightChild->generateConformers(e_window, max_pool_size, num_threads);
 
     if (ret_code != ReturnCode::SUCCESS)
         return ret_code;
@@ -323,7 +356,7 @@ unsigned int ConfGen::FragmentTreeNode::generateConformers(double e_window, std:
     if (!splitBondAtoms[0] || !splitBondAtoms[1])
         lineupChildConformers(e_window);
     else
-        alignAndRotateChildConformers(e_window);
+        alignAndRotateChildConformers(e_window, num_threads);
 
     changed = true;
 
@@ -401,7 +434,7 @@ void ConfGen::FragmentTreeNode::lineupChildConformers(double e_window)
     }
 }
 
-void ConfGen::FragmentTreeNode::alignAndRotateChildConformers(double e_window)
+void ConfGen::FragmentTreeNode::alignAndRotateChildConformers(double e_window, std::size_t num_threads)
 {
     initTorsionAngleData();
 
@@ -481,22 +514,19 @@ void ConfGen::FragmentTreeNode::alignAndRotateChildConformers(double e_window)
         rightChild->changed = false;
     }
 
-    ConformerData::SharedPointer new_conf;
-    double min_energy = 0.0;
     std::size_t num_tor_angles = torsionAngles.size();
 
-    for (std::size_t i = 0; i < num_left_chld_confs; i++) {
-        const ConformerData& left_conf = *leftChild->conformers[i];
-        double left_conf_energy = left_conf.getEnergy();
+    if (num_tor_angles == 0) {
+        double min_energy = 0.0;
 
-        if (num_tor_angles > 0 && new_conf) 
-            copyCoordinates(left_conf, leftChild->atomIndices, *new_conf, right_atom_idx);
+        for (std::size_t i = 0; i < num_left_chld_confs; i++) {
+            const ConformerData& left_conf = *leftChild->conformers[i];
+            double left_conf_energy = left_conf.getEnergy();
 
-        for (std::size_t j = 0; j < num_right_chld_confs; j++) {
-            const ConformerData& right_conf = *rightChild->conformers[j];
-            double conf_energy_sum = left_conf_energy + right_conf.getEnergy();
+            for (std::size_t j = 0; j < num_right_chld_confs; j++) {
+                const ConformerData& right_conf = *rightChild->conformers[j];
+                double conf_energy_sum = left_conf_energy + right_conf.getEnergy();
 
-            if (num_tor_angles == 0) {
                 if (e_window > 0.0) {
                     if (conformers.empty() || conf_energy_sum < min_energy) 
                         min_energy = conf_energy_sum;
@@ -512,22 +542,139 @@ void ConfGen::FragmentTreeNode::alignAndRotateChildConformers(double e_window)
 
                 new_conf->setEnergy(conf_energy_sum);
                 conformers.push_back(new_conf);
+            }
+        }
+
+        if (e_window > 0.0)
+            removeOutOfWindowConformers(min_energy + e_window);
+
+        return;
+    }
+
+    // child conformers get processed in the order of increasing energy which allows to skip whole
+    // blocks of combinations whose energy lower bound already exceeds the energy window
+
+    ConfCombinationState state(num_left_chld_confs, left_atom_idx, right_atom_idx);
+
+    if (e_window > 0.0) {
+        leftChild->orderConformersByEnergy();
+        rightChild->orderConformersByEnergy();
+
+        state.minRigidEnergy = calcMinRigidEnergy();
+    }
+    std::size_t num_combs = num_left_chld_confs * num_right_chld_confs * num_tor_angles;
+
+    if (num_threads > 1 && num_left_chld_confs > 1 && num_combs >= MIN_PARALLEL_CONF_COMBINATIONS) {
+        std::size_t num_workers = std::min(num_threads, num_left_chld_confs);
+        std::vector<std::thread> threads;
+
+        try {
+            for (std::size_t i = 1; i < num_workers; i++)
+                threads.emplace_back(&FragmentTreeNode::combineChildConformers, this, e_window, std::ref(state), i, num_workers);
+
+        } catch (...) {
+            for (auto& thread : threads)
+                thread.join();
+
+            throw;
+        }
+
+        combineChildConformers(e_window, state, 0, num_workers);
+
+        for (auto& thread : threads)
+            thread.join();
+
+    } else
+        combineChildConformers(e_window, state, 0, 1);
+
+    if (state.error)
+        std::rethrow_exception(state.error);
+
+    for (auto& confs : state.leftConfCombinations)
+        conformers.insert(conformers.end(), confs.begin(), confs.end());
+
+    if (e_window > 0.0)
+        removeOutOfWindowConformers(state.minEnergy + e_window);
+}
+
+void ConfGen::FragmentTreeNode::combineChildConformers(double e_window, ConfCombinationState& state, std::size_t worker_idx, std::size_t num_workers) const
+{
+    std::size_t num_left_chld_confs = leftChild->conformers.size();
+    std::size_t num_right_chld_confs = rightChild->conformers.size();
+    std::size_t num_tor_angles = torsionAngles.size();
+    std::size_t left_atom_idx = state.leftAtomIndex;
+    std::size_t right_atom_idx = state.rightAtomIndex;
+    double min_right_conf_energy = rightChild->conformers.front()->getEnergy();
+    double min_rigid_rot_energy = state.minRigidEnergy + minRotEnergy;
+    MMFF94EnergyCalculator rigid_energy_calc(mmff94RigidEnergyCalc);
+    MMFF94EnergyCalculator rot_energy_calc(mmff94RotEnergyCalc);
+    ConformerData::SharedPointer new_conf;
+    std::unique_lock<std::mutex> lock(state.mutex, std::defer_lock);
+
+    try {
+        for (std::size_t i = worker_idx; i < num_left_chld_confs; i += num_workers) {
+            const ConformerData& left_conf = *leftChild->conformers[i];
+            double left_conf_energy = left_conf.getEnergy();
+            ConformerDataArray& left_conf_combs = state.leftConfCombinations[i];
+
+            lock.lock();
+
+            double min_energy = state.minEnergy;
+
+            lock.unlock();
+
+            // remaining left child conformers have higher energies
+            
+            if (e_window > 0.0 && (left_conf_energy + min_right_conf_energy + min_rigid_rot_energy) > (min_energy + e_window))
+                break;
+
+            if (new_conf) 
+                copyCoordinates(left_conf, leftChild->atomIndices, *new_conf, right_atom_idx);
+
+            for (std::size_t j = 0; j < num_right_chld_confs; j++) {
+                const ConformerData& right_conf = *rightChild->conformers[j];
+                double conf_energy_sum = left_conf_energy + right_conf.getEnergy();
+
+                // remaining right child conformers have higher energies
+            
+                if (e_window > 0.0 && (conf_energy_sum + min_rigid_rot_energy) > (min_energy + e_window))
+                    break;
+
+                double rigid_energy = 0.0;
 
-            } else {
                 for (std::size_t k = 0; k < num_tor_angles; k++) {
                     if (!new_conf) {
+                        lock.lock();
+
                         new_conf = owner.allocConformerData();
-                        
+
+                        lock.unlock();
+
                         copyCoordinates(left_conf, leftChild->atomIndices, *new_conf, right_atom_idx);
                     }
 
                     rotateCoordinates(right_conf, rightChild->atomIndices, *new_conf, 
-                                          torsionAngleSines[k], torsionAngleCosines[k], left_atom_idx);
+                                      torsionAngleSines[k], torsionAngleCosines[k], left_atom_idx);
+
+                    if (k == 0) {
+                        // the energy of all interactions not affected by a rotation about the split bond
+                        // has to be calculated only once per pair of child conformers
+
+                        rigid_energy = rigid_energy_calc(new_conf->getData());
+
+                        if (e_window > 0.0 && (conf_energy_sum + rigid_energy + minRotEnergy) > (min_energy + e_window))
+                            break;
+                    }
 
-                    double energy = conf_energy_sum + calcMMFF94Energy(*new_conf);
+                    double energy = conf_energy_sum + rigid_energy;
+
+                    if (e_window > 0.0 && hasClashes(*new_conf, energy + minRotEnergy, min_energy + e_window))
+                        continue;
+
+                    energy += rot_energy_calc(new_conf->getData());
 
                     if (e_window > 0.0) {
-                        if (conformers.empty() || energy < min_energy)
+                        if (energy < min_energy)
                             min_energy = energy;
 
                         else if (energy > (min_energy + e_window)) 
@@ -535,16 +682,179 @@ void ConfGen::FragmentTreeNode::alignAndRotateChildConformers(double e_window)
                     }
 
                     new_conf->setEnergy(energy);
-                    conformers.push_back(new_conf);
+                    left_conf_combs.push_back(new_conf);
 
                     new_conf.reset();
                 }
             }
+
+            lock.lock();
+
+            if (min_energy < state.minEnergy)
+                state.minEnergy = min_energy;
+
+            lock.unlock();
         }
+
+    } catch (...) {
+        if (!lock.owns_lock())
+            lock.lock();
+
+        if (!state.error)
+            state.error = std::current_exception();
     }
 
-    if (e_window > 0.0)
-        removeOutOfWindowConformers(min_energy + e_window);
+    // conformer data objects must be returned to the cache while holding the lock
+
+    if (!lock.owns_lock())
+        lock.lock();
+
+    new_conf.reset();
+}
+
+bool ConfGen::FragmentTreeNode::hasClashes(const Math::Vector3DArray& coords, double energy_bound, double max_energy) const
+{
+    if (!std::isfinite(minRotEnergy))
+        return false;
+
+    const Math::Vector3DArray::StorageType& coords_data = coords.getData();
+
+    for (const auto& iaction : mmff94Data.getVanDerWaalsInteractions()) {
+        double max_dist = CLASH_PRESCREEN_DIST_FACTOR * iaction.getRIJ();
+
+        if (ForceField::calcSquaredDistance<double>(coords_data[iaction.getAtom1Index()], coords_data[iaction.getAtom2Index()]) >= max_dist * max_dist)
+            continue;
+
+        // replace the minimum vdW energy of the atom pair (-e_IJ) by its actual value
+
+        energy_bound += ForceField::calcMMFF94VanDerWaalsEnergy<double>(iaction, coords_data) + iaction.getEIJ();
+
+        if (energy_bound > max_energy)
+            return true;
+    }
+
+    return false;
+}
+
+void ConfGen::FragmentTreeNode::calcMinRotationalEnergy()
+{
+    // lower bound of the energy of all interactions that are affected by a rotation about the split bond
+
+    minRotEnergy = 0.0;
+
+    for (const auto& iaction : mmff94Data.getElectrostaticInteractions())
+        if ((iaction.getAtom1Charge() * iaction.getAtom2Charge() * iaction.getScalingFactor()) < 0.0) {
+            minRotEnergy = -std::numeric_limits<double>::infinity();
+            return;
+        }
+
+    for (const auto& iaction : mmff94Data.getVanDerWaalsInteractions())
+        minRotEnergy -= iaction.getEIJ();
+
+    for (const auto& iaction : mmff94Data.getTorsionInteractions())
+        minRotEnergy += std::min(0.0, iaction.getTorsionParameter1()) + std::min(0.0, iaction.getTorsionParameter2()) +
+            std::min(0.0, iaction.getTorsionParameter3());
+}
+
+double ConfGen::FragmentTreeNode::calcMinRigidEnergy() const
+{
+    // lower bound of the energy of all interactions that involve the split bond but are not affected by a rotation
+    // about it - bond stretching and out-of-plane bending energies are never negative, angle bending and stretch-bend
+    // energies get bounded by means of the bond angle and length ranges found in the child conformers
+
+    double min_energy = 0.0;
+    double min_angle, max_angle;
+
+    for (const auto& iaction : mmff94Data.getAngleBendingInteractions()) {
+        if (iaction.isLinearAngle())
+            continue;
+
+        if (!getBondAngleRange(iaction.getTerminalAtom1Index(), iaction.getCenterAtomIndex(), iaction.getTerminalAtom2Index(), min_angle, max_angle))
+            return -std::numeric_limits<double>::infinity();
+
+        // the energy function has its local minimum at zero angle deviation and thus takes its minimum
+        // at zero or at one of the range limits
+
+        double min_da = min_angle - iaction.getReferenceAngle();
+        double max_da = max_angle - iaction.getReferenceAngle();
+        double min_term_energy = (min_da <= 0.0 && max_da >= 0.0 ? 0.0 : std::numeric_limits<double>::max());
+
+        for (double da : { min_da, max_da })
+            min_term_energy = std::min(min_term_energy, 0.043844 * 0.5 * iaction.getForceConstant() * da * da * (1.0 - 0.007 * da));
+
+        min_energy += min_term_energy;
+    }
+
+    double min_len1, max_len1, min_len2, max_len2;
+
+    for (const auto& iaction : mmff94Data.getStretchBendInteractions()) {
+        if (!getBondAngleRange(iaction.getTerminalAtom1Index(), iaction.getCenterAtomIndex(), iaction.getTerminalAtom2Index(), min_angle, max_angle) ||
+            !getBondLengthRange(iaction.getTerminalAtom1Index(), iaction.getCenterAtomIndex(), min_len1, max_len1) ||
+            !getBondLengthRange(iaction.getTerminalAtom2Index(), iaction.getCenterAtomIndex(), min_len2, max_len2))
+            return -std::numeric_limits<double>::infinity();
+
+        // the energy function is linear in each variable and thus takes its minimum at a corner of the range box
+
+        double min_term_energy = std::numeric_limits<double>::max();
+
+        for (double len1 : { min_len1, max_len1 })
+            for (double len2 : { min_len2, max_len2 })
+                for (double angle : { min_angle, max_angle })
+                    min_term_energy = std::min(min_term_energy, 2.51210 * (iaction.getIJKForceConstant() * (len1 - iaction.getReferenceLength1()) +
+                                                                           iaction.getKJIForceConstant() * (len2 - iaction.getReferenceLength2())) *
+                                                                (angle - iaction.getReferenceAngle()));
+        min_energy += min_term_energy;
+    }
+
+    return min_energy;
+}
+
+bool ConfGen::FragmentTreeNode::getBondAngleRange(std::size_t term_atom1_idx, std::size_t ctr_atom_idx, std::size_t term_atom2_idx,
+                                                  double& min_angle, double& max_angle) const
+{
+    // bond angles at the split bond atoms are fully determined by the conformers of the child containing all three atoms
+
+    min_angle = std::numeric_limits<double>::max();
+    max_angle = -std::numeric_limits<double>::max();
+
+    for (const FragmentTreeNode* child : { leftChild, rightChild }) {
+        if (!child->atomMask.test(term_atom1_idx) || !child->atomMask.test(ctr_atom_idx) || !child->atomMask.test(term_atom2_idx))
+            continue;
+
+        for (const auto& conf : child->conformers) {
+            const Math::Vector3DArray::StorageType& conf_data = conf->getData();
+            double angle = ForceField::calcBondAngle<double>(conf_data[term_atom1_idx], conf_data[ctr_atom_idx], conf_data[term_atom2_idx]) * 180.0 / M_PI;
+
+            min_angle = std::min(min_angle, angle);
+            max_angle = std::max(max_angle, angle);
+        }
+    }
+
+    return (min_angle <= max_angle);
+}
+
+bool ConfGen::FragmentTreeNode::getBondLengthRange(std::size_t atom1_idx, std::size_t atom2_idx, double& min_len, double& max_len) const
+{
+    // the length of the split bond is taken from the conformers of one of the children, which one does
+    // not matter here
+
+    min_len = std::numeric_limits<double>::max();
+    max_len = -std::numeric_limits<double>::max();
+
+    for (const FragmentTreeNode* child : { leftChild, rightChild }) {
+        if (!child->atomMask.test(atom1_idx) || !child->atomMask.test(atom2_idx))
+            continue;
+
+        for (const auto& conf : child->conformers) {
+            const Math::Vector3DArray::StorageType& conf_data = conf->getData();
+            double len = ForceField::calcDistance<double>(conf_data[atom1_idx], conf_data[atom2_idx]);
+
+            min_len = std::min(min_len, len);
+            max_len = std::max(max_len, len);
+        }
+    }
+
+    return (min_len <= max_len);
 }
 
 void ConfGen::FragmentTreeNode::initTorsionAngleData()
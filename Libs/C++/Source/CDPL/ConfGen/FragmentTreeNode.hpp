@@ -120,7 +120,7 @@ namespace CDPL
             void addConformer(const ConformerData& conf_data);
             void addConformer(const ConformerData::SharedPointer& conf_data);
 
-            unsigned int generateConformers(double e_window = 0.0, std::size_t max_pool_size = 0);
+            unsigned int generateConformers(double e_window = 0.0, std::size_t max_pool_size = 0, std::size_t num_threads = 0);
 
             double calcMMFF94Energy(const Math::Vector3DArray& coords);
 
@@ -130,8 +130,21 @@ namespace CDPL
 
             FragmentTreeNode& operator=(const FragmentTreeNode&);
 
+            struct ConfCombinationState;
+
             void lineupChildConformers(double e_window);
-            void alignAndRotateChildConformers(double e_window);
+            void alignAndRotateChildConformers(double e_window, std::size_t num_threads);
+            void combineChildConformers(double e_window, ConfCombinationState& state, std::size_t worker_idx, std::size_t num_workers) const;
+
+            bool hasClashes(const Math::Vector3DArray& coords, double energy_bound, double max_energy) const;
+
+            void calcMinRotationalEnergy();
+
+            double calcMinRigidEnergy() const;
+
+            bool getBondAngleRange(std::size_t term_atom1_idx, std::size_t ctr_atom_idx, std::size_t term_atom2_idx,
+                                   double& min_angle, double& max_angle) const;
+            bool getBondLengthRange(std::size_t atom1_idx, std::size_t atom2_idx, double& min_len, double& max_len) const;
 
             void initTorsionAngleData();
             void removeOutOfWindowConformers(double max_energy);
@@ -193,6 +206,9 @@ namespace CDPL
             DoubleArray            torsionAngleSines;
             MMFF94InteractionData  mmff94Data;
             MMFF94EnergyCalculator mmff94EnergyCalc;
+            MMFF94EnergyCalculator mmff94RigidEnergyCalc;
+            MMFF94EnergyCalculator mmff94RotEnergyCalc;
+            double                 minRotEnergy;
             bool                   changed;
         };
     } // namespace ConfGen
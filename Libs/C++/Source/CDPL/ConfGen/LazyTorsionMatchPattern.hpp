@@ -0,0 +1,79 @@
+/* 
+ * LazyTorsionMatchPattern.hpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef CDPL_CONFGEN_LAZYTORSIONMATCHPATTERN_HPP
+#define CDPL_CONFGEN_LAZYTORSIONMATCHPATTERN_HPP
+
+#include <string>
+#include <mutex>
+
+#include "CDPL/Chem/MolecularGraph.hpp"
+
+#include "TorsionLibraryDataReader.hpp"
+
+
+namespace CDPL
+{
+
+    namespace ConfGen
+    {
+
+        /*
+         * Holds the SMARTS string of a torsion rule or category match pattern and compiles it into a query
+         * molecular graph on first access. Used for the builtin torsion library where only a small fraction
+         * of all patterns is ever needed by a given process.
+         */
+        class LazyTorsionMatchPattern
+        {
+
+          public:
+            LazyTorsionMatchPattern(const std::string& ptn_str):
+                ptnString(ptn_str) {}
+
+            const Chem::MolecularGraph::SharedPointer& get()
+            {
+                std::call_once(initFlag, &LazyTorsionMatchPattern::compile, this);
+
+                return pattern;
+            }
+
+          private:
+            void compile()
+            {
+                try {
+                    pattern = TorsionLibraryDataReader::parseSMARTS(ptnString.c_str());
+
+                } catch (const std::exception&) {
+                    pattern.reset();
+                }
+            }
+
+            std::once_flag                      initFlag;
+            std::string                         ptnString;
+            Chem::MolecularGraph::SharedPointer pattern;
+        };
+    } // namespace ConfGen
+} // namespace CDPL
+
+#endif // CDPL_CONFGEN_LAZYTORSIONMATCHPATTERN_HPP
@@ -86,12 +86,10 @@ void ConfGen::prepareForConformerGeneration(Chem::Molecule& mol, bool canon)
 
     bool added_hs = makeHydrogenComplete(mol, true);
 
-    perceiveComponents(mol, added_hs);
-    perceiveHybridizationStates(mol, false);
-    perceiveSSSR(mol, false);
-    setRingFlags(mol, false);
-    setAromaticityFlags(mol, false);
-    calcCIPPriorities(mol, added_hs);
+    prepareMolecularGraph(mol, PerceptionFlag::COMPONENTS, added_hs);
+    prepareMolecularGraph(mol, PerceptionFlag::HYBRIDIZATION_STATES | PerceptionFlag::SSSR | PerceptionFlag::RING_FLAGS |
+                          PerceptionFlag::AROMATICITY_FLAGS, false);
+    prepareMolecularGraph(mol, PerceptionFlag::CIP_PRIORITIES, added_hs);
 
     for (Molecule::AtomIterator it = mol.getAtomsBegin(), end = mol.getAtomsEnd(); it != end; ++it) {
         Atom& atom = *it;
@@ -178,11 +176,10 @@ void ConfGen::prepareForConformerGeneration(Chem::Molecule& mol, bool canon)
         
         calcCanonicalNumbering(mol, false);
         canonicalize(mol, true, true, true, true);
-        perceiveSSSR(mol, true);
-        perceiveComponents(mol, true);
+        prepareMolecularGraph(mol, PerceptionFlag::SSSR | PerceptionFlag::COMPONENTS, true);
     }
 
-    calcTopologicalDistanceMatrix(mol, canon || added_hs);
+    prepareMolecularGraph(mol, PerceptionFlag::TOPOLOGICAL_DISTANCE_MATRIX, canon || added_hs);
 
     FragmentList& comps = *getComponents(mol);
 
@@ -0,0 +1,89 @@
+/* 
+ * StageTimer.hpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+/**
+ * \file
+ * \brief Definition of the class CDPL::ConfGen::StageTimer.
+ */
+
+#ifndef CDPL_CONFGEN_STAGETIMER_HPP
+#define CDPL_CONFGEN_STAGETIMER_HPP
+
+#include <chrono>
+
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
+#include "CDPL/Internal/Timer.hpp"
+
+
+namespace CDPL
+{
+
+    namespace ConfGen
+    {
+
+        /*
+         * Adds the wall clock time elapsed between construction and destruction (or an explicit stop()) to
+         * the time of the specified stage (does nothing if no statistics object has been specified).
+         */
+        class StageTimer
+        {
+
+          public:
+            StageTimer(ConformerGeneratorStatistics* stats, ConformerGeneratorStatistics::Stage stage):
+                stats(stats), stage(stage) {}
+
+            StageTimer(ConformerGeneratorStatistics& stats, ConformerGeneratorStatistics::Stage stage):
+                stats(&stats), stage(stage) {}
+
+            ~StageTimer()
+            {
+                stop();
+            }
+
+            void stop()
+            {
+                if (stats)
+                    stats->addStageTime(stage, getElapsedSeconds(timer));
+
+                stats = 0;
+            }
+
+            StageTimer(const StageTimer&) = delete;
+
+            StageTimer& operator=(const StageTimer&) = delete;
+
+            static double getElapsedSeconds(const Internal::Timer& timer)
+            {
+                return std::chrono::duration_cast<std::chrono::duration<double> >(timer.elapsed()).count();
+            }
+
+          private:
+            ConformerGeneratorStatistics*       stats;
+            ConformerGeneratorStatistics::Stage stage;
+            Internal::Timer                     timer;
+        };
+    } // namespace ConfGen
+} // namespace CDPL
+
+#endif // CDPL_CONFGEN_STAGETIMER_HPP
@@ -191,3 +191,8 @@ const ConfGen::ConformerData& ConfGen::StructureGenerator::getCoordinates() cons
 {
     return coordinates;
 }
+
+const ConfGen::ConformerGeneratorStatistics& ConfGen::StructureGenerator::getStatistics() const
+{
+    return impl->getStatistics();
+}
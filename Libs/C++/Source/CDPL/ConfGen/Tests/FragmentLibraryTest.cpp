@@ -0,0 +1,246 @@
+/*
+ * FragmentLibraryTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <cstdint>
+#include <string>
+#include <fstream>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/ConfGen/FragmentLibrary.hpp"
+#include "CDPL/Util/FileFunctions.hpp"
+#include "CDPL/Util/FileRemover.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+namespace
+{
+
+    const std::size_t NUM_TEST_ENTRIES = 50;
+
+    std::uint64_t getTestHashCode(std::size_t idx)
+    {
+        // spread over the whole value range and not in ascending order
+
+        return ((std::uint64_t(idx) * 0x9E3779B97F4A7C15ULL) ^ 0x5555555555555555ULL);
+    }
+
+    CDPL::ConfGen::FragmentLibraryEntry::SharedPointer createTestEntry(std::size_t idx)
+    {
+        using namespace CDPL;
+        using namespace ConfGen;
+
+        FragmentLibraryEntry::SharedPointer entry(new FragmentLibraryEntry());
+
+        entry->setHashCode(getTestHashCode(idx));
+        entry->setSMILES(std::string(idx % 7 + 1, 'C'));
+
+        // coordinates and energies are exactly representable as single precision values
+
+        for (std::size_t i = 0; i < idx % 3 + 1; i++) {
+            ConformerData::SharedPointer conf_data(new ConformerData());
+
+            conf_data->resize(idx % 7 + 1);
+            conf_data->setEnergy(idx * 0.5 + i);
+
+            for (std::size_t j = 0; j < conf_data->getSize(); j++)
+                for (std::size_t k = 0; k < 3; k++)
+                    (*conf_data)[j][k] = j * 1.5 - k * 0.25 + i;
+
+            entry->addConformer(conf_data);
+        }
+
+        return entry;
+    }
+
+    void checkEntry(const CDPL::ConfGen::FragmentLibraryEntry::SharedPointer& entry, std::size_t idx)
+    {
+        using namespace CDPL;
+        using namespace ConfGen;
+
+        FragmentLibraryEntry::SharedPointer exp_entry = createTestEntry(idx);
+
+        BOOST_REQUIRE(entry);
+        BOOST_CHECK_EQUAL(entry->getHashCode(), exp_entry->getHashCode());
+        BOOST_CHECK_EQUAL(entry->getSMILES(), exp_entry->getSMILES());
+        BOOST_REQUIRE_EQUAL(entry->getNumConformers(), exp_entry->getNumConformers());
+
+        for (std::size_t i = 0; i < entry->getNumConformers(); i++) {
+            const ConformerData& conf_data = entry->getConformer(i);
+            const ConformerData& exp_conf_data = exp_entry->getConformer(i);
+
+            BOOST_CHECK_EQUAL(conf_data.getEnergy(), exp_conf_data.getEnergy());
+            BOOST_REQUIRE_EQUAL(conf_data.getSize(), exp_conf_data.getSize());
+
+            for (std::size_t j = 0; j < conf_data.getSize(); j++)
+                for (std::size_t k = 0; k < 3; k++)
+                    BOOST_CHECK_EQUAL(conf_data[j][k], exp_conf_data[j][k]);
+        }
+    }
+
+    void saveTestLibrary(const std::string& file_name, bool write_index)
+    {
+        using namespace CDPL;
+        using namespace ConfGen;
+
+        FragmentLibrary lib;
+
+        for (std::size_t i = 0; i < NUM_TEST_ENTRIES; i++)
+            BOOST_CHECK(lib.addEntry(createTestEntry(i)));
+
+        std::ofstream os(file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+        lib.save(os, write_index);
+
+        BOOST_CHECK(os.good());
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(FragmentLibraryIndexTest)
+{
+    using namespace CDPL;
+    using namespace ConfGen;
+
+    Util::FileRemover file_rem(Util::genCheckedTempFilePath());
+    const std::string& file_name = file_rem.getPath();
+
+    saveTestLibrary(file_name, true);
+
+    // mapped lookup
+
+    FragmentLibrary mapped_lib;
+
+    BOOST_CHECK(mapped_lib.mapFile(file_name));
+    BOOST_CHECK_EQUAL(mapped_lib.getNumMappedEntries(), NUM_TEST_ENTRIES);
+    BOOST_CHECK_EQUAL(mapped_lib.getNumEntries(), 0);
+
+    for (std::size_t i = 0; i < NUM_TEST_ENTRIES; i++) {
+        BOOST_CHECK(mapped_lib.containsEntry(getTestHashCode(i)));
+
+        checkEntry(mapped_lib.getEntry(getTestHashCode(i)), i);
+
+        // decoded entries are cached
+
+        BOOST_CHECK(mapped_lib.getEntry(getTestHashCode(i)) == mapped_lib.getEntry(getTestHashCode(i)));
+    }
+
+    for (std::size_t i = NUM_TEST_ENTRIES; i < 2 * NUM_TEST_ENTRIES; i++) {
+        BOOST_CHECK(!mapped_lib.containsEntry(getTestHashCode(i)));
+        BOOST_CHECK(!mapped_lib.getEntry(getTestHashCode(i)));
+    }
+
+    BOOST_CHECK(!mapped_lib.containsEntry(0));
+    BOOST_CHECK(!mapped_lib.containsEntry(~std::uint64_t(0)));
+
+    // entries held in memory take precedence
+
+    FragmentLibraryEntry::SharedPointer mem_entry = createTestEntry(1);
+
+    mem_entry->setHashCode(getTestHashCode(0));
+    mapped_lib.addEntry(mem_entry);
+
+    BOOST_CHECK(mapped_lib.getEntry(getTestHashCode(0)) == mem_entry);
+    BOOST_CHECK_EQUAL(mapped_lib.getNumEntries(), 1);
+
+    mapped_lib.unmapFile();
+
+    BOOST_CHECK_EQUAL(mapped_lib.getNumMappedEntries(), 0);
+    BOOST_CHECK(!mapped_lib.containsEntry(getTestHashCode(1)));
+    BOOST_CHECK(!mapped_lib.getEntry(getTestHashCode(1)));
+    BOOST_CHECK(mapped_lib.getEntry(getTestHashCode(0)) == mem_entry);
+
+    // indexed files remain loadable
+
+    FragmentLibrary loaded_lib;
+    std::ifstream is(file_name, std::ios_base::in | std::ios_base::binary);
+
+    loaded_lib.load(is);
+
+    BOOST_CHECK_EQUAL(loaded_lib.getNumEntries(), NUM_TEST_ENTRIES);
+    BOOST_CHECK_EQUAL(loaded_lib.getNumMappedEntries(), 0);
+
+    for (std::size_t i = 0; i < NUM_TEST_ENTRIES; i++)
+        checkEntry(loaded_lib.getEntry(getTestHashCode(i)), i);
+}
+
+BOOST_AUTO_TEST_CASE(FragmentLibraryNoIndexTest)
+{
+    using namespace CDPL;
+    using namespace ConfGen;
+
+    Util::FileRemover file_rem(Util::genCheckedTempFilePath());
+    const std::string& file_name = file_rem.getPath();
+
+    // file without index
+
+    saveTestLibrary(file_name, false);
+
+    FragmentLibrary lib;
+
+    BOOST_CHECK(!lib.mapFile(file_name));
+    BOOST_CHECK_EQUAL(lib.getNumMappedEntries(), 0);
+    BOOST_CHECK(!lib.containsEntry(getTestHashCode(0)));
+
+    std::ifstream is(file_name, std::ios_base::in | std::ios_base::binary);
+
+    lib.load(is);
+
+    BOOST_CHECK_EQUAL(lib.getNumEntries(), NUM_TEST_ENTRIES);
+
+    // empty file
+
+    std::ofstream os(file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+    os.close();
+
+    BOOST_CHECK(!lib.mapFile(file_name));
+    BOOST_CHECK_EQUAL(lib.getNumMappedEntries(), 0);
+
+    // an empty library with index
+
+    FragmentLibrary empty_lib;
+
+    os.open(file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+    empty_lib.save(os, true);
+    os.close();
+
+    BOOST_CHECK(empty_lib.mapFile(file_name));
+    BOOST_CHECK_EQUAL(empty_lib.getNumMappedEntries(), 0);
+    BOOST_CHECK(!empty_lib.containsEntry(getTestHashCode(0)));
+    BOOST_CHECK(!empty_lib.getEntry(getTestHashCode(0)));
+
+    empty_lib.unmapFile();
+
+    // a failed mapping releases the previously mapped file
+
+    saveTestLibrary(file_name, true);
+
+    BOOST_CHECK(lib.mapFile(file_name));
+    BOOST_CHECK_EQUAL(lib.getNumMappedEntries(), NUM_TEST_ENTRIES);
+
+    BOOST_CHECK_THROW(lib.mapFile(file_name + ".missing"), Base::IOError);
+    BOOST_CHECK_EQUAL(lib.getNumMappedEntries(), 0);
+}
@@ -0,0 +1,134 @@
+/*
+ * TorsionDriverTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/ConfGen/TorsionDriver.hpp"
+#include "CDPL/ConfGen/ConformerGenerator.hpp"
+#include "CDPL/ConfGen/MoleculeFunctions.hpp"
+#include "CDPL/ConfGen/ReturnCode.hpp"
+#include "CDPL/Chem/Molecule.hpp"
+#include "CDPL/Chem/UtilityFunctions.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+
+
+namespace
+{
+
+    typedef std::vector<double> EnergyArray;
+
+    void driveTorsions(const CDPL::Chem::Molecule& mol, const std::vector<CDPL::Math::Vector3DArray>& input_coords, double e_window,
+                       std::size_t num_threads, EnergyArray& energies)
+    {
+        using namespace CDPL;
+        using namespace ConfGen;
+
+        TorsionDriver driver;
+
+        driver.getSettings().setEnergyWindow(e_window);
+        driver.getSettings().setMaxPoolSize(0);
+        driver.getSettings().setNumThreads(num_threads);
+
+        BOOST_CHECK(driver.setup(mol) == ReturnCode::SUCCESS);
+        BOOST_CHECK(driver.getNumFragments() == 2);
+
+        for (const auto& coords : input_coords)
+            driver.addInputCoordinates(coords);
+
+        BOOST_CHECK(driver.generateConformers() == ReturnCode::SUCCESS);
+
+        energies.clear();
+
+        for (std::size_t i = 0; i < driver.getNumConformers(); i++)
+            energies.push_back(driver.getConformer(i).getEnergy());
+
+        std::sort(energies.begin(), energies.end());
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(TorsionDriverEnergyWindowPruningTest)
+{
+    using namespace CDPL;
+    using namespace ConfGen;
+
+    Chem::Molecule::SharedPointer mol = Chem::parseSMILES("c1ccc(cc1)-c1ccccc1");
+
+    BOOST_CHECK(mol);
+
+    prepareForConformerGeneration(*mol);
+
+    ConformerGenerator conf_gen;
+
+    BOOST_CHECK(conf_gen.generate(*mol) == ReturnCode::SUCCESS);
+    BOOST_CHECK(conf_gen.getNumConformers() > 0);
+
+    // strained input geometries with distorted bond lengths and angles at the split bond
+
+    const Math::Vector3DArray& ref_coords = conf_gen.getConformer(0);
+    std::vector<Math::Vector3DArray> input_coords(60);
+    unsigned long rand_state = 12345;
+
+    for (auto& coords : input_coords) {
+        coords = ref_coords;
+
+        for (std::size_t i = 0; i < coords.getSize(); i++)
+            for (std::size_t j = 0; j < 3; j++) {
+                rand_state = (rand_state * 1103515245 + 12345) % 2147483648;
+                coords[i][j] += (double(rand_state) / 2147483648.0 - 0.5) * 0.3;
+            }
+    }
+
+    EnergyArray all_energies;
+
+    driveTorsions(*mol, input_coords, 0.0, 1, all_energies);
+
+    BOOST_CHECK(!all_energies.empty());
+
+    if (all_energies.empty())
+        return;
+
+    EnergyArray energies;
+
+    for (double e_window : { 0.5, 2.0, 10.0 }) {
+        EnergyArray exp_energies;
+
+        for (double energy : all_energies)
+            if (energy <= (all_energies.front() + e_window))
+                exp_energies.push_back(energy);
+
+        for (std::size_t num_threads : { 1, 4 }) {
+            driveTorsions(*mol, input_coords, e_window, num_threads, energies);
+
+            BOOST_CHECK_EQUAL(energies.size(), exp_energies.size());
+
+            for (std::size_t i = 0; i < energies.size() && i < exp_energies.size(); i++)
+                BOOST_CHECK_SMALL(energies[i] - exp_energies[i], 1.0e-6);
+        }
+    }
+}
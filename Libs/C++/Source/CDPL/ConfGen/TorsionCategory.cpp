@@ -30,6 +30,8 @@
 #include "CDPL/Chem/AtomType.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
+#include "LazyTorsionMatchPattern.hpp"
+
 
 using namespace CDPL;
 
@@ -55,17 +57,26 @@ const std::string& ConfGen::TorsionCategory::getMatchPatternString() const
 
 void ConfGen::TorsionCategory::setMatchPatternString(const std::string& ptn_str)
 {
+    if (lazyMatchPattern) {
+        matchPattern = lazyMatchPattern->get();
+        lazyMatchPattern.reset();
+    }
+
     matchPatternStr = ptn_str;
 }
 
 const Chem::MolecularGraph::SharedPointer& ConfGen::TorsionCategory::getMatchPattern() const
 {
+    if (lazyMatchPattern)
+        return lazyMatchPattern->get();
+
     return matchPattern;
 }
 
 void ConfGen::TorsionCategory::setMatchPattern(const Chem::MolecularGraph::SharedPointer& ptn)
 {
     matchPattern = ptn;
+    lazyMatchPattern.reset();
 }
             
 unsigned int ConfGen::TorsionCategory::getBondAtom1Type() const
@@ -244,6 +255,8 @@ void ConfGen::TorsionCategory::swap(TorsionCategory& cat)
     std::swap(bondAtom2Type, cat.bondAtom2Type);
     
     matchPattern.swap(cat.matchPattern);
+    matchPatternStr.swap(cat.matchPatternStr);
+    lazyMatchPattern.swap(cat.lazyMatchPattern);
     name.swap(cat.name);
     categories.swap(cat.categories);
     rules.swap(cat.rules);
@@ -255,6 +268,8 @@ void ConfGen::TorsionCategory::clear()
     rules.clear();
     categories.clear();
     matchPattern.reset();
+    matchPatternStr.clear();
+    lazyMatchPattern.reset();
 
     bondAtom1Type = Chem::AtomType::UNKNOWN;
     bondAtom2Type = Chem::AtomType::UNKNOWN;
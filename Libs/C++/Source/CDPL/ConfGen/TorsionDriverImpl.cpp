@@ -337,7 +337,8 @@ ConfGen::FragmentTreeNode& ConfGen::TorsionDriverImpl::getFragmentNode(std::size
 
 unsigned int ConfGen::TorsionDriverImpl::generateConformers()
 {
-    unsigned int ret_code = fragTree.getRoot()->generateConformers(settings.getEnergyWindow(), settings.getMaxPoolSize());
+    unsigned int ret_code = fragTree.getRoot()->generateConformers(settings.getEnergyWindow(), settings.getMaxPoolSize(),
+                                                                     settings.getNumThreads());
 
     if (ret_code != ReturnCode::SUCCESS)
         return ret_code;
@@ -36,7 +36,7 @@ ConfGen::TorsionDriverSettings::TorsionDriverSettings():
     sampleHetAtomHs(false), sampleTolRanges(false), energyOrdered(true), eWindow(0.0), maxPoolSize(10000),
     forceFieldType(ForceFieldType::MMFF94S_NO_ESTAT), strictParam(true),
     dielectricConst(ForceField::MMFF94ElectrostaticInteractionParameterizer::DIELECTRIC_CONSTANT_WATER),
-    distExponent(ForceField::MMFF94ElectrostaticInteractionParameterizer::DEF_DISTANCE_EXPONENT)
+    distExponent(ForceField::MMFF94ElectrostaticInteractionParameterizer::DEF_DISTANCE_EXPONENT), numThreads(0)
 {}
 
 void ConfGen::TorsionDriverSettings::sampleHeteroAtomHydrogens(bool sample)
@@ -128,3 +128,13 @@ double ConfGen::TorsionDriverSettings::getDistanceExponent() const
 {
     return distExponent;
 }
+
+void ConfGen::TorsionDriverSettings::setNumThreads(std::size_t num_threads)
+{
+    numThreads = num_threads;
+}
+
+std::size_t ConfGen::TorsionDriverSettings::getNumThreads() const
+{
+    return numThreads;
+}
@@ -41,6 +41,7 @@
 
 #include "TorsionLibraryDataReader.hpp"
 #include "TorsionLibraryFormatData.hpp"
+#include "LazyTorsionMatchPattern.hpp"
 
 
 using namespace CDPL;
@@ -116,7 +117,11 @@ void ConfGen::TorsionLibraryDataReader::processCategory(const XMLNode* cat_node,
 
     if (attr)  {
         cat.setMatchPatternString(attr->value());
-        cat.setMatchPattern(parseSMARTS(attr->value()));
+
+        if (lazyPatterns)
+            cat.lazyMatchPattern.reset(new LazyTorsionMatchPattern(cat.getMatchPatternString()));
+        else
+            cat.setMatchPattern(parseSMARTS(attr->value()));
     }
 
     for (const XMLNode* node = cat_node->first_node(); node; node = node->next_sibling()) {
@@ -137,15 +142,20 @@ void ConfGen::TorsionLibraryDataReader::processRule(const XMLNode* rule_node, To
 
     const XMLAttribute* attr = rule_node->first_attribute(RULE_PATTERN_ATTR.c_str());
 
-    if (attr) {
-        rule.setMatchPattern(parseSMARTS(attr->value()));
+    if (!attr)
+        throw Base::IOError("TorsionLibraryDataReader: missing rule '" + RULE_PATTERN_ATTR + "' attribute");
+
+    if (lazyPatterns) {
         rule.setMatchPatternString(attr->value());
+        rule.lazyMatchPattern.reset(new LazyTorsionMatchPattern(rule.getMatchPatternString()));
 
-    } else
-        throw Base::IOError("TorsionLibraryDataReader: missing rule '" + RULE_PATTERN_ATTR + "' attribute");
+    } else {
+        rule.setMatchPattern(parseSMARTS(attr->value()));
+        rule.setMatchPatternString(attr->value());
 
-    if (!rule.getMatchPattern())
-        throw Base::IOError("TorsionLibraryDataReader: empty or invalid rule '" + RULE_PATTERN_ATTR + "' attribute");
+        if (!rule.getMatchPattern())
+            throw Base::IOError("TorsionLibraryDataReader: empty or invalid rule '" + RULE_PATTERN_ATTR + "' attribute");
+    }
 
     for (const XMLNode* node = rule_node->first_node(); node; node = node->next_sibling()) {
         if (node->name() == ANGLE_LIST_TAG) 
@@ -197,7 +207,7 @@ void ConfGen::TorsionLibraryDataReader::processAngleList(const XMLNode* ang_list
     }
 }
 
-Chem::MolecularGraph::SharedPointer ConfGen::TorsionLibraryDataReader::parseSMARTS(const char* str) const
+Chem::MolecularGraph::SharedPointer ConfGen::TorsionLibraryDataReader::parseSMARTS(const char* str)
 {
     using namespace Chem;
 
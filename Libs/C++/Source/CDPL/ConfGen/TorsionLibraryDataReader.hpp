@@ -47,9 +47,18 @@ namespace CDPL
         {
 
           public:
+            /*
+             * If lazy_ptns is true, rule and category SMARTS patterns are not compiled while reading but
+             * on first access of the match pattern (invalid patterns then result in an empty pattern).
+             */
+            TorsionLibraryDataReader(bool lazy_ptns = false):
+                lazyPatterns(lazy_ptns) {}
+
             void read(std::istream& is, TorsionLibrary& lib);
             void read(const char* data, TorsionLibrary& lib);
 
+            static Chem::MolecularGraph::SharedPointer parseSMARTS(const char* str);
+
           private:
             typedef rapidxml::xml_document<char>  XMLDocument;
             typedef rapidxml::xml_node<char>      XMLNode;
@@ -61,8 +70,7 @@ namespace CDPL
             void processRule(const XMLNode* rule_node, TorsionRule& rule) const;
             void processAngleList(const XMLNode* ang_list_node, TorsionRule& rule) const;
 
-            Chem::MolecularGraph::SharedPointer parseSMARTS(const char* str) const;
-
+            bool        lazyPatterns;
             CharBuffer  charBuffer;
             XMLDocument torLibDocument;
         };
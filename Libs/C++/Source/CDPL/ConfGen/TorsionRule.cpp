@@ -27,6 +27,8 @@
 #include "CDPL/ConfGen/TorsionRule.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
+#include "LazyTorsionMatchPattern.hpp"
+
 
 using namespace CDPL;
 
@@ -38,17 +40,26 @@ const std::string& ConfGen::TorsionRule::getMatchPatternString() const
 
 void ConfGen::TorsionRule::setMatchPatternString(const std::string& ptn_str)
 {
+    if (lazyMatchPattern) {
+        matchPattern = lazyMatchPattern->get();
+        lazyMatchPattern.reset();
+    }
+
     matchPatternStr = ptn_str;
 }
 
 const Chem::MolecularGraph::SharedPointer& ConfGen::TorsionRule::getMatchPattern() const
 {
+    if (lazyMatchPattern)
+        return lazyMatchPattern->get();
+
     return matchPattern;
 }
 
 void ConfGen::TorsionRule::setMatchPattern(const Chem::MolecularGraph::SharedPointer& ptn)
 {
     matchPattern = ptn;
+    lazyMatchPattern.reset();
 }
 
 void ConfGen::TorsionRule::addAngle(const AngleEntry& angle)
@@ -130,6 +141,8 @@ ConfGen::TorsionRule::ConstAngleEntryIterator ConfGen::TorsionRule::end() const
 void ConfGen::TorsionRule::swap(TorsionRule& cat)
 {
     matchPattern.swap(cat.matchPattern);
+    matchPatternStr.swap(cat.matchPatternStr);
+    lazyMatchPattern.swap(cat.lazyMatchPattern);
     angles.swap(cat.angles);
 }
 
@@ -137,6 +150,8 @@ void ConfGen::TorsionRule::clear()
 {
     angles.clear();
     matchPattern.reset();
+    matchPatternStr.clear();
+    lazyMatchPattern.reset();
 }
 
 void ConfGen::TorsionRule::checkAngleIndex(std::size_t idx, bool it) const
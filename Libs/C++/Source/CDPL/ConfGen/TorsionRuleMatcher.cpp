@@ -179,6 +179,9 @@ bool ConfGen::TorsionRuleMatcher::getRuleMatches(const TorsionRule& rule, const
 {
     using namespace Chem;
 
+    if (!rule.getMatchPattern())
+        return false;
+
     const MolecularGraph& ptn = *rule.getMatchPattern();
     std::size_t ctr_bond_idx = getCentralBondIndex(ptn);
 
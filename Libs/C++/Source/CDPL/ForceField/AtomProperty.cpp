@@ -26,6 +26,7 @@
 
 #include "CDPL/ForceField/AtomProperty.hpp"
 #include "CDPL/Base/LookupKeyDefinition.hpp"
+#include "CDPL/Base/PropertyContainer.hpp"
 
 
 namespace CDPL 
@@ -47,3 +48,22 @@ namespace CDPL
         void initAtomProperties() {}
     }
 }
+
+
+namespace
+{
+
+    struct FastAccessKeyRegistration
+    {
+
+        FastAccessKeyRegistration()
+        {
+            using namespace CDPL;
+
+            Base::PropertyContainer::registerFastAccessKey(ForceField::AtomProperty::MMFF94_SYMBOLIC_TYPE);
+            Base::PropertyContainer::registerFastAccessKey(ForceField::AtomProperty::MMFF94_NUMERIC_TYPE);
+            Base::PropertyContainer::registerFastAccessKey(ForceField::AtomProperty::MMFF94_CHARGE);
+        }
+
+    } fastAccessKeyRegistration;
+}
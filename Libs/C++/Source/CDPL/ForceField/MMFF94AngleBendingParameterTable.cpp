@@ -28,9 +28,6 @@
 #include <mutex>
 #include <functional>
 
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
-
 #include "CDPL/ForceField/MMFF94AngleBendingParameterTable.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
@@ -282,10 +279,13 @@ void ForceField::MMFF94AngleBendingParameterTable::load(std::istream& is)
 
 void ForceField::MMFF94AngleBendingParameterTable::loadDefaults()
 {
-    boost::iostreams::stream<boost::iostreams::array_source>
-        is(MMFF94ParameterData::ANGLE_BENDING_PARAMETERS,
-           MMFF94ParameterData::ANGLE_BENDING_PARAMETERS_LEN);
-    load(is);
+    for (std::size_t i = 0; i < MMFF94ParameterData::ANGLE_BENDING_PARAMETERS_LEN; i++) {
+        const double* entry = MMFF94ParameterData::ANGLE_BENDING_PARAMETERS[i];
+
+        addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                 static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]), entry[4],
+                 entry[5]);
+    }
 }
 
 void ForceField::MMFF94AngleBendingParameterTable::set(const SharedPointer& table)
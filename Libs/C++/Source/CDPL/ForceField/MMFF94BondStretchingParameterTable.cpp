@@ -28,9 +28,6 @@
 #include <mutex>
 #include <functional>
 
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
-
 #include "CDPL/ForceField/MMFF94BondStretchingParameterTable.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
@@ -261,10 +258,12 @@ void ForceField::MMFF94BondStretchingParameterTable::load(std::istream& is)
 
 void ForceField::MMFF94BondStretchingParameterTable::loadDefaults()
 {
-    boost::iostreams::stream<boost::iostreams::array_source>
-        is(MMFF94ParameterData::BOND_STRETCHING_PARAMETERS,
-           MMFF94ParameterData::BOND_STRETCHING_PARAMETERS_LEN);
-    load(is);
+    for (std::size_t i = 0; i < MMFF94ParameterData::BOND_STRETCHING_PARAMETERS_LEN; i++) {
+        const double* entry = MMFF94ParameterData::BOND_STRETCHING_PARAMETERS[i];
+
+        addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                 static_cast<unsigned int>(entry[2]), entry[3], entry[4]);
+    }
 }
 
 void ForceField::MMFF94BondStretchingParameterTable::set(const SharedPointer& table)
@@ -0,0 +1,640 @@
+/*
+ * MMFF94InteractionDataCache.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "StaticInit.hpp"
+
+#include <cstring>
+#include <string>
+#include <istream>
+#include <ostream>
+#include <vector>
+#include <algorithm>
+
+#include "CDPL/ForceField/MMFF94InteractionDataCache.hpp"
+#include "CDPL/ForceField/AtomFunctions.hpp"
+#include "CDPL/ForceField/BondFunctions.hpp"
+#include "CDPL/ForceField/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/MolecularGraph.hpp"
+#include "CDPL/Chem/Atom.hpp"
+#include "CDPL/Chem/Bond.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/BondFunctions.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/Fragment.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+#include "CDPL/Internal/ByteBuffer.hpp"
+
+
+using namespace CDPL;
+
+
+namespace
+{
+
+    const std::uint32_t CACHE_DATA_ID      = 0x4D494443; // "MIDC"
+    const std::uint32_t CACHE_DATA_VERSION = 2;
+    const std::size_t   HEADER_SIZE        = 16;
+    const std::size_t   READ_CHUNK_SIZE    = 1024 * 1024;
+    const std::size_t   MAX_TOP_DIST_CODE  = 4;
+    const std::size_t   TOP_DIST_CODE_BITS = 3;
+
+    std::uint64_t getBits(double value)
+    {
+        std::uint64_t bits;
+
+        std::memcpy(&bits, &value, sizeof(double));
+
+        return bits;
+    }
+
+    template <typename T>
+    std::uint64_t getFlagCode(const T& obj, bool (*has_func)(const T&), bool (*get_func)(const T&))
+    {
+        if (!has_func(obj))
+            return 0;
+
+        return (get_func(obj) ? 2 : 1);
+    }
+
+    void appendString(const std::string& str, std::vector<std::uint64_t>& key)
+    {
+        // string length followed by the characters packed into 64 bit words in a platform independent way
+
+        key.push_back(str.size());
+
+        for (std::size_t i = 0, len = str.size(); i < len; i += 8) {
+            std::uint64_t word = 0;
+
+            for (std::size_t j = 0; j < 8 && (i + j) < len; j++)
+                word |= std::uint64_t(static_cast<unsigned char>(str[i + j])) << (j * 8);
+
+            key.push_back(word);
+        }
+    }
+
+    void appendTopDistances(const Math::ULMatrix& mtx, std::size_t num_atoms, std::vector<std::uint64_t>& key)
+    {
+        // the parameterizers only distinguish topological distances 0, 1, 2, 3 and > 3
+
+        std::uint64_t word = 0;
+        std::size_t num_bits = 0;
+
+        for (std::size_t i = 0; i < num_atoms; i++) {
+            for (std::size_t j = i + 1; j < num_atoms; j++) {
+                std::uint64_t code = (i < mtx.getSize1() && j < mtx.getSize2() ? std::min(std::size_t(mtx(i, j)), MAX_TOP_DIST_CODE) : 0);
+
+                if ((num_bits + TOP_DIST_CODE_BITS) > 64) {
+                    key.push_back(word);
+                    word = 0;
+                    num_bits = 0;
+                }
+
+                word |= code << num_bits;
+                num_bits += TOP_DIST_CODE_BITS;
+            }
+        }
+
+        if (num_bits > 0)
+            key.push_back(word);
+    }
+
+    void appendRings(const Chem::FragmentList& rings, const Chem::MolecularGraph& molgraph, std::vector<std::uint64_t>& key)
+    {
+        key.push_back(rings.getSize());
+
+        for (const auto& ring : rings) {
+            key.push_back(ring.getNumAtoms());
+
+            for (const auto& atom : ring.getAtoms())
+                key.push_back(molgraph.containsAtom(atom) ? molgraph.getAtomIndex(atom) : ~std::uint64_t(0));
+
+            key.push_back(ring.getNumBonds());
+
+            for (const auto& bond : ring.getBonds())
+                key.push_back(molgraph.containsBond(bond) ? molgraph.getBondIndex(bond) : ~std::uint64_t(0));
+        }
+    }
+
+    void putIndex(Internal::ByteBuffer& buf, std::size_t idx)
+    {
+        buf.putInt(std::uint32_t(idx), false);
+    }
+
+    std::size_t getIndex(Internal::ByteBuffer& buf)
+    {
+        std::uint32_t idx;
+
+        buf.getInt(idx);
+
+        return idx;
+    }
+
+    double getDouble(Internal::ByteBuffer& buf)
+    {
+        double value;
+
+        buf.getFloat(value);
+
+        return value;
+    }
+
+    void writeData(Internal::ByteBuffer& buf, const ForceField::MMFF94InteractionData& ia_data)
+    {
+        using namespace ForceField;
+
+        putIndex(buf, ia_data.getBondStretchingInteractions().getSize());
+
+        for (const auto& ia : ia_data.getBondStretchingInteractions()) {
+            putIndex(buf, ia.getAtom1Index());
+            putIndex(buf, ia.getAtom2Index());
+            putIndex(buf, ia.getBondTypeIndex());
+            buf.putFloat(ia.getForceConstant());
+            buf.putFloat(ia.getReferenceLength());
+        }
+
+        putIndex(buf, ia_data.getAngleBendingInteractions().getSize());
+
+        for (const auto& ia : ia_data.getAngleBendingInteractions()) {
+            putIndex(buf, ia.getTerminalAtom1Index());
+            putIndex(buf, ia.getCenterAtomIndex());
+            putIndex(buf, ia.getTerminalAtom2Index());
+            putIndex(buf, ia.getAngleTypeIndex());
+            buf.putInt(std::uint8_t(ia.isLinearAngle()), false);
+            buf.putFloat(ia.getForceConstant());
+            buf.putFloat(ia.getReferenceAngle());
+        }
+
+        putIndex(buf, ia_data.getStretchBendInteractions().getSize());
+
+        for (const auto& ia : ia_data.getStretchBendInteractions()) {
+            putIndex(buf, ia.getTerminalAtom1Index());
+            putIndex(buf, ia.getCenterAtomIndex());
+            putIndex(buf, ia.getTerminalAtom2Index());
+            putIndex(buf, ia.getStretchBendTypeIndex());
+            buf.putFloat(ia.getReferenceAngle());
+            buf.putFloat(ia.getReferenceLength1());
+            buf.putFloat(ia.getReferenceLength2());
+            buf.putFloat(ia.getIJKForceConstant());
+            buf.putFloat(ia.getKJIForceConstant());
+        }
+
+        putIndex(buf, ia_data.getOutOfPlaneBendingInteractions().getSize());
+
+        for (const auto& ia : ia_data.getOutOfPlaneBendingInteractions()) {
+            putIndex(buf, ia.getTerminalAtom1Index());
+            putIndex(buf, ia.getCenterAtomIndex());
+            putIndex(buf, ia.getTerminalAtom2Index());
+            putIndex(buf, ia.getOutOfPlaneAtomIndex());
+            buf.putFloat(ia.getForceConstant());
+        }
+
+        putIndex(buf, ia_data.getTorsionInteractions().getSize());
+
+        for (const auto& ia : ia_data.getTorsionInteractions()) {
+            putIndex(buf, ia.getTerminalAtom1Index());
+            putIndex(buf, ia.getCenterAtom1Index());
+            putIndex(buf, ia.getCenterAtom2Index());
+            putIndex(buf, ia.getTerminalAtom2Index());
+            putIndex(buf, ia.getTorsionTypeIndex());
+            buf.putFloat(ia.getTorsionParameter1());
+            buf.putFloat(ia.getTorsionParameter2());
+            buf.putFloat(ia.getTorsionParameter3());
+        }
+
+        putIndex(buf, ia_data.getElectrostaticInteractions().getSize());
+
+        for (const auto& ia : ia_data.getElectrostaticInteractions()) {
+            putIndex(buf, ia.getAtom1Index());
+            putIndex(buf, ia.getAtom2Index());
+            buf.putFloat(ia.getAtom1Charge());
+            buf.putFloat(ia.getAtom2Charge());
+            buf.putFloat(ia.getScalingFactor());
+            buf.putFloat(ia.getDielectricConstant());
+            buf.putFloat(ia.getDistanceExponent());
+        }
+
+        putIndex(buf, ia_data.getVanDerWaalsInteractions().getSize());
+
+        for (const auto& ia : ia_data.getVanDerWaalsInteractions()) {
+            putIndex(buf, ia.getAtom1Index());
+            putIndex(buf, ia.getAtom2Index());
+            buf.putFloat(ia.getEIJ());
+            buf.putFloat(ia.getRIJ());
+        }
+    }
+
+    void readData(Internal::ByteBuffer& buf, ForceField::MMFF94InteractionData& ia_data)
+    {
+        using namespace ForceField;
+
+        ia_data.clear();
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t atom1_idx = getIndex(buf);
+            std::size_t atom2_idx = getIndex(buf);
+            unsigned int type_idx = getIndex(buf);
+            double force_const = getDouble(buf);
+            double ref_length = getDouble(buf);
+
+            ia_data.getBondStretchingInteractions().addElement(
+                MMFF94BondStretchingInteraction(atom1_idx, atom2_idx, type_idx, force_const, ref_length));
+        }
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t term_atom1_idx = getIndex(buf);
+            std::size_t ctr_atom_idx = getIndex(buf);
+            std::size_t term_atom2_idx = getIndex(buf);
+            unsigned int type_idx = getIndex(buf);
+            std::uint8_t linear;
+
+            buf.getInt(linear);
+
+            double force_const = getDouble(buf);
+            double ref_angle = getDouble(buf);
+
+            ia_data.getAngleBendingInteractions().addElement(
+                MMFF94AngleBendingInteraction(term_atom1_idx, ctr_atom_idx, term_atom2_idx, type_idx, linear != 0, force_const, ref_angle));
+        }
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t term_atom1_idx = getIndex(buf);
+            std::size_t ctr_atom_idx = getIndex(buf);
+            std::size_t term_atom2_idx = getIndex(buf);
+            unsigned int type_idx = getIndex(buf);
+            double ref_angle = getDouble(buf);
+            double ref_length1 = getDouble(buf);
+            double ref_length2 = getDouble(buf);
+            double ijk_force_const = getDouble(buf);
+            double kji_force_const = getDouble(buf);
+
+            ia_data.getStretchBendInteractions().addElement(
+                MMFF94StretchBendInteraction(term_atom1_idx, ctr_atom_idx, term_atom2_idx, type_idx, ref_angle,
+                                             ref_length1, ref_length2, ijk_force_const, kji_force_const));
+        }
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t term_atom1_idx = getIndex(buf);
+            std::size_t ctr_atom_idx = getIndex(buf);
+            std::size_t term_atom2_idx = getIndex(buf);
+            std::size_t oop_atom_idx = getIndex(buf);
+            double force_const = getDouble(buf);
+
+            ia_data.getOutOfPlaneBendingInteractions().addElement(
+                MMFF94OutOfPlaneBendingInteraction(term_atom1_idx, ctr_atom_idx, term_atom2_idx, oop_atom_idx, force_const));
+        }
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t term_atom1_idx = getIndex(buf);
+            std::size_t ctr_atom1_idx = getIndex(buf);
+            std::size_t ctr_atom2_idx = getIndex(buf);
+            std::size_t term_atom2_idx = getIndex(buf);
+            unsigned int type_idx = getIndex(buf);
+            double tor_param1 = getDouble(buf);
+            double tor_param2 = getDouble(buf);
+            double tor_param3 = getDouble(buf);
+
+            ia_data.getTorsionInteractions().addElement(
+                MMFF94TorsionInteraction(term_atom1_idx, ctr_atom1_idx, ctr_atom2_idx, term_atom2_idx, type_idx,
+                                         tor_param1, tor_param2, tor_param3));
+        }
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t atom1_idx = getIndex(buf);
+            std::size_t atom2_idx = getIndex(buf);
+            double atom1_chg = getDouble(buf);
+            double atom2_chg = getDouble(buf);
+            double scale_fact = getDouble(buf);
+            double de_const = getDouble(buf);
+            double dist_expo = getDouble(buf);
+
+            ia_data.getElectrostaticInteractions().addElement(
+                MMFF94ElectrostaticInteraction(atom1_idx, atom2_idx, atom1_chg, atom2_chg, scale_fact, de_const, dist_expo));
+        }
+
+        for (std::size_t i = 0, num_ias = getIndex(buf); i < num_ias; i++) {
+            std::size_t atom1_idx = getIndex(buf);
+            std::size_t atom2_idx = getIndex(buf);
+            double e_IJ = getDouble(buf);
+            double r_IJ = getDouble(buf);
+
+            ia_data.getVanDerWaalsInteractions().addElement(MMFF94VanDerWaalsInteraction(atom1_idx, atom2_idx, e_IJ, r_IJ));
+        }
+    }
+} // namespace
+
+
+constexpr std::size_t ForceField::MMFF94InteractionDataCache::DEF_MAX_SIZE;
+
+
+ForceField::MMFF94InteractionDataCache::MMFF94InteractionDataCache(std::size_t max_size):
+    maxSize(max_size), numHits(0), numMisses(0)
+{}
+
+void ForceField::MMFF94InteractionDataCache::setMaxSize(std::size_t max_size)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    maxSize = max_size;
+
+    shrink();
+}
+
+std::size_t ForceField::MMFF94InteractionDataCache::getMaxSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return maxSize;
+}
+
+std::size_t ForceField::MMFF94InteractionDataCache::getSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return entries.size();
+}
+
+void ForceField::MMFF94InteractionDataCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    entryMap.clear();
+    entries.clear();
+}
+
+std::size_t ForceField::MMFF94InteractionDataCache::getNumHits() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return numHits;
+}
+
+std::size_t ForceField::MMFF94InteractionDataCache::getNumMisses() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return numMisses;
+}
+
+void ForceField::MMFF94InteractionDataCache::resetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    numHits = 0;
+    numMisses = 0;
+}
+
+bool ForceField::MMFF94InteractionDataCache::getData(const Chem::MolecularGraph& molgraph, unsigned int param_set, unsigned int ia_types,
+                                                     bool strict, double de_const, double dist_expo, MMFF94InteractionData& ia_data)
+{
+    Key key;
+
+    makeKey(molgraph, param_set, ia_types, strict, de_const, dist_expo, key);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    EntryMap::iterator it = entryMap.find(key);
+
+    if (it == entryMap.end()) {
+        numMisses++;
+        return false;
+    }
+
+    numHits++;
+
+    entries.splice(entries.begin(), entries, it->second);
+    ia_data = it->second->data;
+
+    return true;
+}
+
+void ForceField::MMFF94InteractionDataCache::addData(const Chem::MolecularGraph& molgraph, unsigned int param_set, unsigned int ia_types,
+                                                     bool strict, double de_const, double dist_expo, const MMFF94InteractionData& ia_data)
+{
+    Key key;
+
+    makeKey(molgraph, param_set, ia_types, strict, de_const, dist_expo, key);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (maxSize == 0)
+        return;
+
+    EntryMap::iterator it = entryMap.find(key);
+
+    if (it != entryMap.end()) {
+        entries.splice(entries.begin(), entries, it->second);
+        it->second->data = ia_data;
+        return;
+    }
+
+    entries.push_front(Entry());
+    entries.front().key = key;
+    entries.front().data = ia_data;
+
+    entryMap.emplace(std::move(key), entries.begin());
+
+    shrink();
+}
+
+void ForceField::MMFF94InteractionDataCache::write(std::ostream& os) const
+{
+    Internal::ByteBuffer buf;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        putIndex(buf, entries.size());
+
+        for (auto it = entries.rbegin(), end = entries.rend(); it != end; ++it) {
+            putIndex(buf, it->key.size());
+
+            for (std::uint64_t value : it->key)
+                buf.putInt(value, false);
+
+            writeData(buf, it->data);
+        }
+    }
+
+    Internal::ByteBuffer hdr_buf(HEADER_SIZE);
+
+    hdr_buf.putInt(CACHE_DATA_ID, false);
+    hdr_buf.putInt(CACHE_DATA_VERSION, false);
+    hdr_buf.putInt(std::uint64_t(buf.getSize()), false);
+
+    hdr_buf.writeBuffer(os);
+    buf.writeBuffer(os);
+
+    if (!os.good())
+        throw Base::IOError("MMFF94InteractionDataCache: error while writing cache data");
+}
+
+void ForceField::MMFF94InteractionDataCache::read(std::istream& is)
+{
+    Internal::ByteBuffer buf;
+
+    if (buf.readBuffer(is, HEADER_SIZE) != HEADER_SIZE)
+        throw Base::IOError("MMFF94InteractionDataCache: could not read cache data header");
+
+    std::uint32_t data_id;
+    std::uint32_t version;
+    std::uint64_t data_size;
+
+    buf.getInt(data_id);
+    buf.getInt(version);
+    buf.getInt(data_size);
+
+    if (data_id != CACHE_DATA_ID)
+        throw Base::IOError("MMFF94InteractionDataCache: invalid cache data header");
+
+    if (version != CACHE_DATA_VERSION)
+        throw Base::IOError("MMFF94InteractionDataCache: unsupported cache data version " + std::to_string(version));
+
+    // read in chunks so that a corrupt data size does not lead to a huge allocation
+
+    std::vector<char> chunk(std::min(data_size, std::uint64_t(READ_CHUNK_SIZE)));
+
+    buf.resize(0);
+    buf.setIOPointer(0);
+
+    for (std::uint64_t num_left = data_size; num_left > 0; ) {
+        std::size_t num_bytes = std::min(num_left, std::uint64_t(chunk.size()));
+
+        is.read(&chunk[0], num_bytes);
+
+        if (std::size_t(is.gcount()) != num_bytes)
+            throw Base::IOError("MMFF94InteractionDataCache: unexpected end of cache data");
+
+        buf.putBytes(&chunk[0], num_bytes);
+        num_left -= num_bytes;
+    }
+
+    buf.setIOPointer(0);
+
+    EntryList new_entries;
+
+    for (std::size_t i = 0, num_entries = getIndex(buf); i < num_entries; i++) {
+        new_entries.push_front(Entry());
+
+        Entry& entry = new_entries.front();
+        std::size_t key_size = getIndex(buf);
+
+        if (key_size > (buf.getSize() - buf.getIOPointer()) / sizeof(std::uint64_t))
+            throw Base::IOError("MMFF94InteractionDataCache: invalid cache entry key size");
+
+        entry.key.resize(key_size);
+
+        for (std::uint64_t& value : entry.key)
+            buf.getInt(value);
+
+        readData(buf, entry.data);
+    }
+
+    if (buf.getIOPointer() != buf.getSize())
+        throw Base::IOError("MMFF94InteractionDataCache: trailing garbage in cache data");
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    entryMap.clear();
+    entries.swap(new_entries);
+
+    for (EntryList::iterator it = entries.begin(), end = entries.end(); it != end; ++it)
+        entryMap[it->key] = it;
+
+    shrink();
+}
+
+void ForceField::MMFF94InteractionDataCache::makeKey(const Chem::MolecularGraph& molgraph, unsigned int param_set, unsigned int ia_types,
+                                                     bool strict, double de_const, double dist_expo, Key& key) const
+{
+    using namespace Chem;
+
+    std::size_t num_atoms = molgraph.getNumAtoms();
+    std::size_t num_bonds = molgraph.getNumBonds();
+
+    key.clear();
+    key.reserve(8 + num_atoms * 7 + num_bonds * 5);
+
+    key.push_back(param_set);
+    key.push_back(ia_types);
+    key.push_back(strict);
+    key.push_back(getBits(de_const));
+    key.push_back(getBits(dist_expo));
+    key.push_back(num_atoms);
+    key.push_back(num_bonds);
+    key.push_back(std::uint64_t(hasTopologicalDistanceMatrix(molgraph)) | (std::uint64_t(hasMMFF94AromaticRings(molgraph)) << 1));
+
+    for (std::size_t i = 0; i < num_atoms; i++) {
+        const Atom& atom = molgraph.getAtom(i);
+
+        key.push_back(getType(atom));
+        key.push_back(std::uint64_t(getFormalCharge(atom)));
+        key.push_back(hasImplicitHydrogenCount(atom) ? getImplicitHydrogenCount(atom) + 1 : 0);
+        key.push_back(getFlagCode<Atom>(atom, &hasAromaticityFlag, &getAromaticityFlag) |
+                      (getFlagCode<Atom>(atom, &hasRingFlag, &getRingFlag) << 2) |
+                      (std::uint64_t(hasMMFF94Charge(atom)) << 4));
+        key.push_back(hasMMFF94NumericType(atom) ? getMMFF94NumericType(atom) + 1 : 0);
+        key.push_back(hasMMFF94Charge(atom) ? getBits(getMMFF94Charge(atom)) : 0);
+        key.push_back(hasMMFF94SymbolicType(atom));
+
+        if (hasMMFF94SymbolicType(atom))
+            appendString(getMMFF94SymbolicType(atom), key);
+    }
+
+    for (std::size_t i = 0; i < num_bonds; i++) {
+        const Bond& bond = molgraph.getBond(i);
+
+        key.push_back(molgraph.getAtomIndex(bond.getBegin()));
+        key.push_back(molgraph.getAtomIndex(bond.getEnd()));
+        key.push_back(getOrder(bond));
+        key.push_back(getFlagCode<Bond>(bond, &hasAromaticityFlag, &getAromaticityFlag) |
+                      (getFlagCode<Bond>(bond, &hasRingFlag, &getRingFlag) << 2));
+        key.push_back(hasMMFF94TypeIndex(bond) ? getMMFF94TypeIndex(bond) + 1 : 0);
+    }
+
+    if (hasTopologicalDistanceMatrix(molgraph))
+        appendTopDistances(*getTopologicalDistanceMatrix(molgraph), num_atoms, key);
+
+    if (hasMMFF94AromaticRings(molgraph))
+        appendRings(*getMMFF94AromaticRings(molgraph), molgraph, key);
+}
+
+void ForceField::MMFF94InteractionDataCache::shrink()
+{
+    while (entries.size() > maxSize) {
+        entryMap.erase(entries.back().key);
+        entries.pop_back();
+    }
+}
+
+std::size_t ForceField::MMFF94InteractionDataCache::KeyHashFunc::operator()(const Key& key) const
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+
+    for (std::uint64_t value : key) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    }
+
+    return std::size_t(hash);
+}
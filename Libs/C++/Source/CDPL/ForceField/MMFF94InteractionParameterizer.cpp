@@ -38,7 +38,9 @@
 using namespace CDPL; 
 
     
-ForceField::MMFF94InteractionParameterizer::MMFF94InteractionParameterizer(unsigned int param_set)
+ForceField::MMFF94InteractionParameterizer::MMFF94InteractionParameterizer(unsigned int param_set):
+    molGraph(0), customParams(false), filterFuncMask(0), deConst(MMFF94ElectrostaticInteractionParameterizer::DEF_DIELECTRIC_CONSTANT),
+    distExpo(MMFF94ElectrostaticInteractionParameterizer::DEF_DISTANCE_EXPONENT)
 {
     setPropertyFunctions();
     setParameterSet(param_set);
@@ -54,7 +56,13 @@ ForceField::MMFF94InteractionParameterizer::MMFF94InteractionParameterizer(const
     electrostaticParameterizer(parameterizer.electrostaticParameterizer),
     atomTyper(parameterizer.atomTyper),
     bondTyper(parameterizer.bondTyper),
-    chargeCalculator(parameterizer.chargeCalculator)
+    chargeCalculator(parameterizer.chargeCalculator), molGraph(0),
+    dataCache(parameterizer.dataCache),
+    paramSet(parameterizer.paramSet),
+    customParams(parameterizer.customParams),
+    filterFuncMask(parameterizer.filterFuncMask),
+    deConst(parameterizer.deConst),
+    distExpo(parameterizer.distExpo)
 {
     setPropertyFunctions();
 }
@@ -62,36 +70,43 @@ ForceField::MMFF94InteractionParameterizer::MMFF94InteractionParameterizer(const
 void ForceField::MMFF94InteractionParameterizer::setBondStretchingFilterFunction(const InteractionFilterFunction2& func)
 {
     bondStretchingParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::BOND_STRETCHING, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setAngleBendingFilterFunction(const InteractionFilterFunction3& func)
 {
     angleBendingParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::ANGLE_BENDING, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setStretchBendFilterFunction(const InteractionFilterFunction3& func)
 {
     stretchBendParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::STRETCH_BEND, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setOutOfPlaneBendingFilterFunction(const InteractionFilterFunction4& func)
 {
     outOfPlaneParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::OUT_OF_PLANE_BENDING, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setTorsionFilterFunction(const InteractionFilterFunction4& func)
 {
     torsionParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::TORSION, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setElectrostaticFilterFunction(const InteractionFilterFunction2& func)
 {
     electrostaticParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::ELECTROSTATIC, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setVanDerWaalsFilterFunction(const InteractionFilterFunction2& func)
 {
     vanDerWaalsParameterizer.setFilterFunction(func);
+    setFilterFunctionFlag(InteractionType::VAN_DER_WAALS, bool(func));
 } 
 
 void ForceField::MMFF94InteractionParameterizer::clearFilterFunctions()
@@ -103,30 +118,42 @@ void ForceField::MMFF94InteractionParameterizer::clearFilterFunctions()
     torsionParameterizer.setFilterFunction(InteractionFilterFunction4());
     vanDerWaalsParameterizer.setFilterFunction(InteractionFilterFunction2());
     electrostaticParameterizer.setFilterFunction(InteractionFilterFunction2());
+
+    filterFuncMask = 0;
 }
 
 void ForceField::MMFF94InteractionParameterizer::setSymbolicAtomTypePatternTable(const MMFF94SymbolicAtomTypePatternTable::SharedPointer& table)
 {
+    customParams = true;
+
     atomTyper.setSymbolicAtomTypePatternTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setHeavyToHydrogenAtomTypeMap(const MMFF94HeavyToHydrogenAtomTypeMap::SharedPointer& map)
 {
+    customParams = true;
+
     atomTyper.setHeavyToHydrogenAtomTypeMap(map);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setSymbolicToNumericAtomTypeMap(const MMFF94SymbolicToNumericAtomTypeMap::SharedPointer& map)
 {
+    customParams = true;
+
     atomTyper.setSymbolicToNumericAtomTypeMap(map);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setAromaticAtomTypeDefinitionTable(const MMFF94AromaticAtomTypeDefinitionTable::SharedPointer& table)
 {
+    customParams = true;
+
     atomTyper.setAromaticAtomTypeDefinitionTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setAtomTypePropertyTable(const MMFF94AtomTypePropertyTable::SharedPointer& table)
 {
+    customParams = true;
+
     bondStretchingParameterizer.setAtomTypePropertyTable(table);
     angleBendingParameterizer.setAtomTypePropertyTable(table);
     stretchBendParameterizer.setAtomTypePropertyTable(table);
@@ -139,21 +166,29 @@ void ForceField::MMFF94InteractionParameterizer::setAtomTypePropertyTable(const
 
 void ForceField::MMFF94InteractionParameterizer::setFormalAtomChargeDefinitionTable(const MMFF94FormalAtomChargeDefinitionTable::SharedPointer& table)
 {
+    customParams = true;
+
     chargeCalculator.setFormalChargeDefinitionTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setBondChargeIncrementTable(const MMFF94BondChargeIncrementTable::SharedPointer& table)
 {
+    customParams = true;
+
     chargeCalculator.setBondChargeIncrementTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setPartialBondChargeIncrementTable(const MMFF94PartialBondChargeIncrementTable::SharedPointer& table)
 {
+    customParams = true;
+
     chargeCalculator.setPartialBondChargeIncrementTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setPrimaryToParameterAtomTypeMap(const MMFF94PrimaryToParameterAtomTypeMap::SharedPointer& map)
 {
+    customParams = true;
+
     angleBendingParameterizer.setParameterAtomTypeMap(map);
     outOfPlaneParameterizer.setParameterAtomTypeMap(map);
     torsionParameterizer.setParameterAtomTypeMap(map);
@@ -161,65 +196,109 @@ void ForceField::MMFF94InteractionParameterizer::setPrimaryToParameterAtomTypeMa
 
 void ForceField::MMFF94InteractionParameterizer::setAngleBendingParameterTable(const MMFF94AngleBendingParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     angleBendingParameterizer.setAngleBendingParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setBondStretchingParameterTable(const MMFF94BondStretchingParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     bondStretchingParameterizer.setBondStretchingParameterTable(table);
     angleBendingParameterizer.setBondStretchingParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setBondStretchingRuleParameterTable(const MMFF94BondStretchingRuleParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     bondStretchingParameterizer.setBondStretchingRuleParameterTable(table);
     angleBendingParameterizer.setBondStretchingRuleParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setStretchBendParameterTable(const MMFF94StretchBendParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     stretchBendParameterizer.setStretchBendParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setDefaultStretchBendParameterTable(const MMFF94DefaultStretchBendParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     stretchBendParameterizer.setDefaultStretchBendParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setOutOfPlaneBendingParameterTable(const MMFF94OutOfPlaneBendingParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     outOfPlaneParameterizer.setOutOfPlaneBendingParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setTorsionParameterTable(const MMFF94TorsionParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     torsionParameterizer.setTorsionParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setVanDerWaalsParameterTable(const MMFF94VanDerWaalsParameterTable::SharedPointer& table)
 {
+    customParams = true;
+
     vanDerWaalsParameterizer.setVanDerWaalsParameterTable(table);
 }
 
 void ForceField::MMFF94InteractionParameterizer::setDielectricConstant(double de_const)
 {
     electrostaticParameterizer.setDielectricConstant(de_const);
+
+    deConst = de_const;
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setDistanceExponent(double dist_expo)
 {
     electrostaticParameterizer.setDistanceExponent(dist_expo);
+
+    distExpo = dist_expo;
 } 
 
 void ForceField::MMFF94InteractionParameterizer::setParameterSet(unsigned int param_set)
 {
     outOfPlaneParameterizer.setOutOfPlaneBendingParameterTable(MMFF94OutOfPlaneBendingParameterTable::get(param_set));
     torsionParameterizer.setTorsionParameterTable(MMFF94TorsionParameterTable::get(param_set));
+
+    paramSet = param_set;
+}
+
+void ForceField::MMFF94InteractionParameterizer::setInteractionDataCache(const MMFF94InteractionDataCache::SharedPointer& cache)
+{
+    dataCache = cache;
+}
+
+const ForceField::MMFF94InteractionDataCache::SharedPointer& ForceField::MMFF94InteractionParameterizer::getInteractionDataCache() const
+{
+    return dataCache;
 }
 
 void ForceField::MMFF94InteractionParameterizer::parameterize(const Chem::MolecularGraph& molgraph, MMFF94InteractionData& ia_list,
                                                               unsigned int ia_types, bool strict)
 {
+    bool use_cache = cacheUsable();
+
+    if (use_cache) {
+        if (!cachedData)
+            cachedData.reset(new MMFF94InteractionData());
+
+        if (dataCache->getData(molgraph, paramSet, ia_types, strict, deConst, distExpo, *cachedData)) {
+            copyData(*cachedData, ia_list, ia_types);
+            return;
+        }
+    }
+
     setup(molgraph, ia_types, strict);
 
     if ((ia_types & InteractionType::BOND_STRETCHING) || (ia_types & InteractionType::STRETCH_BEND))
@@ -249,6 +328,14 @@ void ForceField::MMFF94InteractionParameterizer::parameterize(const Chem::Molecu
 
     if (ia_types & InteractionType::VAN_DER_WAALS)
         vanDerWaalsParameterizer.parameterize(molgraph, ia_list.getVanDerWaalsInteractions(), strict);
+
+    if (use_cache) {
+        cachedData->clear();
+
+        copyData(ia_list, *cachedData, ia_types);
+
+        dataCache->addData(molgraph, paramSet, ia_types, strict, deConst, distExpo, *cachedData);
+    }
 }
 
 ForceField::MMFF94InteractionParameterizer& ForceField::MMFF94InteractionParameterizer::operator=(const MMFF94InteractionParameterizer& parameterizer)
@@ -266,12 +353,56 @@ ForceField::MMFF94InteractionParameterizer& ForceField::MMFF94InteractionParamet
     atomTyper = parameterizer.atomTyper;
     bondTyper = parameterizer.bondTyper;
     chargeCalculator = parameterizer.chargeCalculator;
-    
+    dataCache = parameterizer.dataCache;
+    paramSet = parameterizer.paramSet;
+    customParams = parameterizer.customParams;
+    filterFuncMask = parameterizer.filterFuncMask;
+    deConst = parameterizer.deConst;
+    distExpo = parameterizer.distExpo;
+
     setPropertyFunctions();
 
     return *this;
 }
 
+void ForceField::MMFF94InteractionParameterizer::setFilterFunctionFlag(unsigned int ia_type, bool set)
+{
+    if (set)
+        filterFuncMask |= ia_type;
+    else
+        filterFuncMask &= ~ia_type;
+}
+
+bool ForceField::MMFF94InteractionParameterizer::cacheUsable() const
+{
+    return (dataCache && !customParams && filterFuncMask == 0);
+}
+
+void ForceField::MMFF94InteractionParameterizer::copyData(const MMFF94InteractionData& src_data, MMFF94InteractionData& tgt_data,
+                                                          unsigned int ia_types)
+{
+    // mirrors the list update behavior of parameterize(): bond stretching and angle bending interaction lists are always
+    // (re-)populated or cleared, all other lists are only touched if the corresponding interaction type was requested
+
+    tgt_data.getBondStretchingInteractions() = src_data.getBondStretchingInteractions();
+    tgt_data.getAngleBendingInteractions() = src_data.getAngleBendingInteractions();
+
+    if (ia_types & InteractionType::STRETCH_BEND)
+        tgt_data.getStretchBendInteractions() = src_data.getStretchBendInteractions();
+
+    if (ia_types & InteractionType::OUT_OF_PLANE_BENDING)
+        tgt_data.getOutOfPlaneBendingInteractions() = src_data.getOutOfPlaneBendingInteractions();
+
+    if (ia_types & InteractionType::TORSION)
+        tgt_data.getTorsionInteractions() = src_data.getTorsionInteractions();
+
+    if (ia_types & InteractionType::ELECTROSTATIC)
+        tgt_data.getElectrostaticInteractions() = src_data.getElectrostaticInteractions();
+
+    if (ia_types & InteractionType::VAN_DER_WAALS)
+        tgt_data.getVanDerWaalsInteractions() = src_data.getVanDerWaalsInteractions();
+}
+
 void ForceField::MMFF94InteractionParameterizer::setPropertyFunctions()
 {
     using namespace std::placeholders;
@@ -29,9 +29,6 @@
 #include <mutex>
 #include <functional>
 
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
-
 #include "CDPL/ForceField/MMFF94OutOfPlaneBendingParameterTable.hpp"
 #include "CDPL/ForceField/MMFF94ParameterSet.hpp"
 #include "CDPL/Base/Exceptions.hpp"
@@ -97,7 +94,7 @@ ForceField::MMFF94OutOfPlaneBendingParameterTable::Entry::Entry(unsigned int ter
                                                                 unsigned int oop_atom_type,
                                                                 double       force_const):
     termAtom1Type(term_atom1_type),
-    ctrAtomType(ctr_atom_type), termAtom2Type(term_atom2_type), oopAtomType(term_atom2_type),
+    ctrAtomType(ctr_atom_type), termAtom2Type(term_atom2_type), oopAtomType(oop_atom_type),
     forceConst(force_const), initialized(true)
 {}
 
@@ -284,23 +281,32 @@ void ForceField::MMFF94OutOfPlaneBendingParameterTable::load(std::istream& is)
 void ForceField::MMFF94OutOfPlaneBendingParameterTable::loadDefaults(unsigned int param_set)
 {
     if (param_set == MMFF94ParameterSet::DYNAMIC) {
-        boost::iostreams::stream<boost::iostreams::array_source>
-            is(MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS,
-               MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS_LEN);
-        load(is);
+        for (std::size_t i = 0; i < MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS_LEN; i++) {
+            const double* entry = MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS[i];
+
+            addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                     static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]),
+                     entry[4]);
+        }
 
     } else if (param_set == MMFF94ParameterSet::STATIC_XOOP ||
                param_set == MMFF94ParameterSet::STATIC_RTOR_XOOP) {
-        boost::iostreams::stream<boost::iostreams::array_source>
-            is(MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS,
-               MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS_LEN);
-        load(is);
+        for (std::size_t i = 0; i < MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS_LEN; i++) {
+            const double* entry = MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS[i];
+
+            addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                     static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]),
+                     entry[4]);
+        }
 
     } else {
-        boost::iostreams::stream<boost::iostreams::array_source>
-            is(MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS,
-               MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS_LEN);
-        load(is);
+        for (std::size_t i = 0; i < MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS_LEN; i++) {
+            const double* entry = MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS[i];
+
+            addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                     static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]),
+                     entry[4]);
+        }
     }
 }
 
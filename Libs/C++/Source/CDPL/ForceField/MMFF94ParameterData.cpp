@@ -32,17 +32,17 @@ using namespace ForceField;
 
 // clang-format off
 
-const char MMFF94ParameterData::ANGLE_BENDING_PARAMETERS[] =
-    #include "MMFFANG.PAR.str"
-    ;
+const double MMFF94ParameterData::ANGLE_BENDING_PARAMETERS[][6] = {
+    #include "MMFFANG.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::ANGLE_BENDING_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::ANGLE_BENDING_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::ANGLE_BENDING_PARAMETERS) / sizeof(MMFF94ParameterData::ANGLE_BENDING_PARAMETERS[0]);
 
-const char MMFF94ParameterData::BOND_STRETCHING_PARAMETERS[] =
-    #include "MMFFBOND.PAR.str"
-    ;
+const double MMFF94ParameterData::BOND_STRETCHING_PARAMETERS[][5] = {
+    #include "MMFFBOND.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::BOND_STRETCHING_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::BOND_STRETCHING_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::BOND_STRETCHING_PARAMETERS) / sizeof(MMFF94ParameterData::BOND_STRETCHING_PARAMETERS[0]);
 
 const char MMFF94ParameterData::BOND_STRETCHING_RULE_PARAMETERS[] =
     #include "MMFFBNDK.PAR.str"
@@ -50,11 +50,11 @@ const char MMFF94ParameterData::BOND_STRETCHING_RULE_PARAMETERS[] =
 const std::size_t MMFF94ParameterData::BOND_STRETCHING_RULE_PARAMETERS_LEN =
     sizeof(MMFF94ParameterData::BOND_STRETCHING_RULE_PARAMETERS) - 1;
 
-const char MMFF94ParameterData::STRETCH_BEND_PARAMETERS[] =
-    #include "MMFFSTBN.PAR.str"
-    ;
+const double MMFF94ParameterData::STRETCH_BEND_PARAMETERS[][6] = {
+    #include "MMFFSTBN.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::STRETCH_BEND_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::STRETCH_BEND_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::STRETCH_BEND_PARAMETERS) / sizeof(MMFF94ParameterData::STRETCH_BEND_PARAMETERS[0]);
 
 const char MMFF94ParameterData::DEFAULT_STRETCH_BEND_PARAMETERS[] =
     #include "MMFFDFSB.PAR.str"
@@ -62,41 +62,41 @@ const char MMFF94ParameterData::DEFAULT_STRETCH_BEND_PARAMETERS[] =
 const std::size_t MMFF94ParameterData::DEFAULT_STRETCH_BEND_PARAMETERS_LEN =
     sizeof(MMFF94ParameterData::DEFAULT_STRETCH_BEND_PARAMETERS) - 1;
 
-const char MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS[] =
-    #include "MMFFOOP.PAR.str"
-    ;
+const double MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS[][5] = {
+    #include "MMFFOOP.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS) / sizeof(MMFF94ParameterData::OUT_OF_PLANE_BENDING_PARAMETERS[0]);
 
-const char MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS[] =
-    #include "MMFFSOOP.PAR.str"
-    ;
+const double MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS[][5] = {
+    #include "MMFFSOOP.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS) / sizeof(MMFF94ParameterData::STATIC_OUT_OF_PLANE_BENDING_PARAMETERS[0]);
 
-const char MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS[] =
-    #include "MMFFSXOOP.PAR.str"
-    ;
+const double MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS[][5] = {
+    #include "MMFFSXOOP.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS) / sizeof(MMFF94ParameterData::STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS[0]);
 
-const char MMFF94ParameterData::TORSION_PARAMETERS[] =
-    #include "MMFFTOR.PAR.str"
-    ;
+const double MMFF94ParameterData::TORSION_PARAMETERS[][8] = {
+    #include "MMFFTOR.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::TORSION_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::TORSION_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::TORSION_PARAMETERS) / sizeof(MMFF94ParameterData::TORSION_PARAMETERS[0]);
 
-const char MMFF94ParameterData::STATIC_TORSION_PARAMETERS[] =
-    #include "MMFFSTOR.PAR.str"
-    ;
+const double MMFF94ParameterData::STATIC_TORSION_PARAMETERS[][8] = {
+    #include "MMFFSTOR.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::STATIC_TORSION_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::STATIC_TORSION_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::STATIC_TORSION_PARAMETERS) / sizeof(MMFF94ParameterData::STATIC_TORSION_PARAMETERS[0]);
 
-const char MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS[] =
-    #include "MMFFSRTOR.PAR.str"
-    ;
+const double MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS[][8] = {
+    #include "MMFFSRTOR.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS) / sizeof(MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS[0]);
 
 const char MMFF94ParameterData::VAN_DER_WAALS_PARAMETERS[] =
     #include "MMFFVDW.PAR.str"
@@ -140,11 +140,11 @@ const char MMFF94ParameterData::ATOM_TYPE_PROPERTIES[] =
 const std::size_t MMFF94ParameterData::ATOM_TYPE_PROPERTIES_LEN =
     sizeof(MMFF94ParameterData::ATOM_TYPE_PROPERTIES) - 1;
 
-const char MMFF94ParameterData::BOND_CHARGE_INCREMENT_PARAMETERS[] =
-    #include "MMFFCHG.PAR.str"
-    ;
+const double MMFF94ParameterData::BOND_CHARGE_INCREMENT_PARAMETERS[][4] = {
+    #include "MMFFCHG.PAR.tab"
+};
 const std::size_t MMFF94ParameterData::BOND_CHARGE_INCREMENT_PARAMETERS_LEN =
-    sizeof(MMFF94ParameterData::BOND_CHARGE_INCREMENT_PARAMETERS) - 1;
+    sizeof(MMFF94ParameterData::BOND_CHARGE_INCREMENT_PARAMETERS) / sizeof(MMFF94ParameterData::BOND_CHARGE_INCREMENT_PARAMETERS[0]);
 
 const char MMFF94ParameterData::PARTIAL_BOND_CHARGE_INCREMENT_PARAMETERS[] =
     #include "MMFFPBCI.PAR.str"
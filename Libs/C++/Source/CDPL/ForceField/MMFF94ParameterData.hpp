@@ -37,37 +37,40 @@ namespace CDPL
         namespace MMFF94ParameterData
         {
 
-            extern const char        ANGLE_BENDING_PARAMETERS[];
+            // the purely numeric parameter tables are stored as pre-parsed arrays (one row per entry),
+            // the corresponding *_LEN constants specify the number of rows
+
+            extern const double      ANGLE_BENDING_PARAMETERS[][6];
             extern const std::size_t ANGLE_BENDING_PARAMETERS_LEN;
 
-            extern const char        BOND_STRETCHING_PARAMETERS[];
+            extern const double      BOND_STRETCHING_PARAMETERS[][5];
             extern const std::size_t BOND_STRETCHING_PARAMETERS_LEN;
 
             extern const char        BOND_STRETCHING_RULE_PARAMETERS[];
             extern const std::size_t BOND_STRETCHING_RULE_PARAMETERS_LEN;
 
-            extern const char        STRETCH_BEND_PARAMETERS[];
+            extern const double      STRETCH_BEND_PARAMETERS[][6];
             extern const std::size_t STRETCH_BEND_PARAMETERS_LEN;
 
             extern const char        DEFAULT_STRETCH_BEND_PARAMETERS[];
             extern const std::size_t DEFAULT_STRETCH_BEND_PARAMETERS_LEN;
 
-            extern const char        OUT_OF_PLANE_BENDING_PARAMETERS[];
+            extern const double      OUT_OF_PLANE_BENDING_PARAMETERS[][5];
             extern const std::size_t OUT_OF_PLANE_BENDING_PARAMETERS_LEN;
 
-            extern const char        STATIC_OUT_OF_PLANE_BENDING_PARAMETERS[];
+            extern const double      STATIC_OUT_OF_PLANE_BENDING_PARAMETERS[][5];
             extern const std::size_t STATIC_OUT_OF_PLANE_BENDING_PARAMETERS_LEN;
 
-            extern const char        STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS[];
+            extern const double      STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS[][5];
             extern const std::size_t STATIC_EXT_OUT_OF_PLANE_BENDING_PARAMETERS_LEN;
 
-            extern const char        TORSION_PARAMETERS[];
+            extern const double      TORSION_PARAMETERS[][8];
             extern const std::size_t TORSION_PARAMETERS_LEN;
 
-            extern const char        STATIC_TORSION_PARAMETERS[];
+            extern const double      STATIC_TORSION_PARAMETERS[][8];
             extern const std::size_t STATIC_TORSION_PARAMETERS_LEN;
 
-            extern const char        STATIC_REF_TORSION_PARAMETERS[];
+            extern const double      STATIC_REF_TORSION_PARAMETERS[][8];
             extern const std::size_t STATIC_REF_TORSION_PARAMETERS_LEN;
 
             extern const char        VAN_DER_WAALS_PARAMETERS[];
@@ -91,7 +94,7 @@ namespace CDPL
             extern const char        ATOM_TYPE_PROPERTIES[];
             extern const std::size_t ATOM_TYPE_PROPERTIES_LEN;
 
-            extern const char        BOND_CHARGE_INCREMENT_PARAMETERS[];
+            extern const double      BOND_CHARGE_INCREMENT_PARAMETERS[][4];
             extern const std::size_t BOND_CHARGE_INCREMENT_PARAMETERS_LEN;
 
             extern const char        PARTIAL_BOND_CHARGE_INCREMENT_PARAMETERS[];
@@ -28,9 +28,6 @@
 #include <mutex>
 #include <functional>
 
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/stream.hpp>
-
 #include "CDPL/ForceField/MMFF94TorsionParameterTable.hpp"
 #include "CDPL/ForceField/MMFF94ParameterSet.hpp"
 #include "CDPL/Base/Exceptions.hpp"
@@ -98,7 +95,7 @@ ForceField::MMFF94TorsionParameterTable::Entry::Entry(
     unsigned int ctr_atom2_type, unsigned int term_atom2_type, double tor_param1, double tor_param2,
     double tor_param3):
     torTypeIdx(tor_type_idx),
-    termAtom1Type(term_atom1_type), ctrAtom1Type(ctr_atom1_type), ctrAtom2Type(term_atom2_type),
+    termAtom1Type(term_atom1_type), ctrAtom1Type(ctr_atom1_type), ctrAtom2Type(ctr_atom2_type),
     termAtom2Type(term_atom2_type), torParam1(tor_param1), torParam2(tor_param2),
     torParam3(tor_param3), initialized(true)
 {}
@@ -320,23 +317,32 @@ void ForceField::MMFF94TorsionParameterTable::load(std::istream& is)
 void ForceField::MMFF94TorsionParameterTable::loadDefaults(unsigned int param_set)
 {
     if (param_set == MMFF94ParameterSet::DYNAMIC) {
-        boost::iostreams::stream<boost::iostreams::array_source>
-            is(MMFF94ParameterData::TORSION_PARAMETERS,
-               MMFF94ParameterData::TORSION_PARAMETERS_LEN);
-        load(is);
+        for (std::size_t i = 0; i < MMFF94ParameterData::TORSION_PARAMETERS_LEN; i++) {
+            const double* entry = MMFF94ParameterData::TORSION_PARAMETERS[i];
+
+            addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                     static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]),
+                     static_cast<unsigned int>(entry[4]), entry[5], entry[6], entry[7]);
+        }
 
     } else if (param_set == MMFF94ParameterSet::STATIC_RTOR ||
                param_set == MMFF94ParameterSet::STATIC_RTOR_XOOP) {
-        boost::iostreams::stream<boost::iostreams::array_source>
-            is(MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS,
-               MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS_LEN);
-        load(is);
+        for (std::size_t i = 0; i < MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS_LEN; i++) {
+            const double* entry = MMFF94ParameterData::STATIC_REF_TORSION_PARAMETERS[i];
+
+            addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                     static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]),
+                     static_cast<unsigned int>(entry[4]), entry[5], entry[6], entry[7]);
+        }
 
     } else {
-        boost::iostreams::stream<boost::iostreams::array_source>
-            is(MMFF94ParameterData::STATIC_TORSION_PARAMETERS,
-               MMFF94ParameterData::STATIC_TORSION_PARAMETERS_LEN);
-        load(is);
+        for (std::size_t i = 0; i < MMFF94ParameterData::STATIC_TORSION_PARAMETERS_LEN; i++) {
+            const double* entry = MMFF94ParameterData::STATIC_TORSION_PARAMETERS[i];
+
+            addEntry(static_cast<unsigned int>(entry[0]), static_cast<unsigned int>(entry[1]),
+                     static_cast<unsigned int>(entry[2]), static_cast<unsigned int>(entry[3]),
+                     static_cast<unsigned int>(entry[4]), entry[5], entry[6], entry[7]);
+        }
     }
 }
 
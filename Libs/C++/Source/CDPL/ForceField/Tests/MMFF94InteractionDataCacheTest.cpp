@@ -0,0 +1,216 @@
+/* 
+ * MMFF94AngleBendingParameterizerTest.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/ForceField/MMFF94InteractionDataCache.hpp"
+#include "CDPL/ForceField/MMFF94InteractionParameterizer.hpp"
+#include "CDPL/ForceField/MMFF94InteractionData.hpp"
+#include "CDPL/ForceField/MMFF94ParameterSet.hpp"
+#include "CDPL/ForceField/InteractionType.hpp"
+#include "CDPL/ForceField/AtomFunctions.hpp"
+#include "CDPL/ForceField/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/Fragment.hpp"
+#include "CDPL/Chem/FragmentList.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Math/Matrix.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+#include "MMFF94TestData.hpp"
+
+
+namespace
+{
+
+    std::string getDataString(const CDPL::ForceField::MMFF94InteractionData& ia_data)
+    {
+        using namespace CDPL;
+
+        ForceField::MMFF94InteractionDataCache cache(1);
+        std::ostringstream oss;
+
+        cache.addData(Chem::BasicMolecule(), 0, 0, false, 0.0, 0.0, ia_data);
+        cache.write(oss);
+
+        return oss.str();
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(MMFF94InteractionDataCacheTest)
+{
+    using namespace CDPL;
+    using namespace Testing;
+
+    std::size_t num_mols = MMFF94TestData::DYN_TEST_MOLECULES.size();
+
+    ForceField::MMFF94InteractionDataCache::SharedPointer cache(new ForceField::MMFF94InteractionDataCache(num_mols));
+    ForceField::MMFF94InteractionParameterizer parameterizer(ForceField::MMFF94ParameterSet::DYNAMIC);
+    ForceField::MMFF94InteractionParameterizer cached_parameterizer(ForceField::MMFF94ParameterSet::DYNAMIC);
+    ForceField::MMFF94InteractionData ia_data;
+    ForceField::MMFF94InteractionData cached_ia_data;
+
+    cached_parameterizer.setInteractionDataCache(cache);
+
+    BOOST_CHECK(cached_parameterizer.getInteractionDataCache() == cache);
+
+    for (std::size_t i = 0; i < 2; i++) {
+        for (std::size_t mol_idx = 0; mol_idx < num_mols; mol_idx++) {
+            const Chem::Molecule& mol = *MMFF94TestData::DYN_TEST_MOLECULES[mol_idx];
+
+            parameterizer.parameterize(mol, ia_data, ForceField::InteractionType::ALL, true);
+            cached_parameterizer.parameterize(mol, cached_ia_data, ForceField::InteractionType::ALL, true);
+
+            BOOST_CHECK_MESSAGE(getDataString(ia_data) == getDataString(cached_ia_data), 
+                                "Interaction data mismatch for molecule #" << mol_idx << " in pass " << i);
+        }
+    }
+
+    BOOST_CHECK(cache->getNumHits() + cache->getNumMisses() == 2 * num_mols);
+    BOOST_CHECK(cache->getNumHits() >= num_mols);
+    BOOST_CHECK(cache->getSize() == cache->getNumMisses());
+
+    std::stringstream ss;
+
+    cache->write(ss);
+
+    ForceField::MMFF94InteractionDataCache read_cache(num_mols);
+
+    read_cache.read(ss);
+
+    BOOST_CHECK(read_cache.getSize() == cache->getSize());
+
+    std::ostringstream oss1, oss2;
+
+    cache->write(oss1);
+    read_cache.write(oss2);
+
+    BOOST_CHECK(oss1.str() == oss2.str());
+
+    std::istringstream bad_iss(oss1.str().substr(0, oss1.str().size() / 2));
+
+    BOOST_CHECK_THROW(read_cache.read(bad_iss), Base::IOError);
+
+    // corrupt data size in the header and key size of the first entry
+
+    std::string bad_data = oss1.str();
+
+    bad_data.replace(8, 8, 8, '\xFF');
+    bad_iss.clear();
+    bad_iss.str(bad_data);
+
+    BOOST_CHECK_THROW(read_cache.read(bad_iss), Base::IOError);
+
+    bad_data = oss1.str();
+    bad_data.replace(20, 4, 4, '\xFF');
+    bad_iss.clear();
+    bad_iss.str(bad_data);
+
+    BOOST_CHECK_THROW(read_cache.read(bad_iss), Base::IOError);
+
+    cache->setMaxSize(1);
+
+    BOOST_CHECK(cache->getSize() == 1);
+
+    cached_parameterizer.setElectrostaticFilterFunction([](const Chem::Atom&, const Chem::Atom&) { return true; });
+    cache->resetStatistics();
+    cached_parameterizer.parameterize(*MMFF94TestData::DYN_TEST_MOLECULES[0], cached_ia_data, ForceField::InteractionType::ALL, true);
+
+    BOOST_CHECK(cache->getNumHits() == 0 && cache->getNumMisses() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(MMFF94InteractionDataCacheKeyTest)
+{
+    using namespace CDPL;
+    using namespace Testing;
+
+    Chem::BasicMolecule mol1(*MMFF94TestData::DYN_TEST_MOLECULES[0]);
+    Chem::BasicMolecule mol2(mol1);
+    ForceField::MMFF94InteractionDataCache cache;
+    ForceField::MMFF94InteractionData ia_data;
+
+    BOOST_CHECK(mol1.getNumAtoms() > 1);
+
+    // symbolic atom types
+
+    for (std::size_t i = 0; i < mol1.getNumAtoms(); i++) {
+        ForceField::setMMFF94SymbolicType(mol1.getAtom(i), "CR");
+        ForceField::setMMFF94SymbolicType(mol2.getAtom(i), i == 0 ? "C=C" : "CR");
+    }
+
+    cache.addData(mol1, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data);
+
+    BOOST_CHECK(cache.getData(mol1, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+    BOOST_CHECK(!cache.getData(mol2, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+
+    ForceField::setMMFF94SymbolicType(mol2.getAtom(0), "CR");
+
+    BOOST_CHECK(cache.getData(mol2, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+
+    // topological distance matrix content
+
+    Math::ULMatrix::SharedPointer dist_mtx1(new Math::ULMatrix());
+
+    Chem::calcTopologicalDistanceMatrix(mol1, *dist_mtx1);
+
+    Math::ULMatrix::SharedPointer dist_mtx2(new Math::ULMatrix(*dist_mtx1));
+
+    (*dist_mtx2)(0, 1) = ((*dist_mtx1)(0, 1) == 1 ? 2 : 1);
+
+    Chem::setTopologicalDistanceMatrix(mol1, dist_mtx1);
+    Chem::setTopologicalDistanceMatrix(mol2, dist_mtx2);
+
+    cache.addData(mol1, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data);
+
+    BOOST_CHECK(!cache.getData(mol2, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+
+    Chem::setTopologicalDistanceMatrix(mol2, dist_mtx1);
+
+    BOOST_CHECK(cache.getData(mol2, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+
+    // MMFF94 aromatic ring set content
+
+    Chem::FragmentList::SharedPointer rings1(new Chem::FragmentList());
+    Chem::FragmentList::SharedPointer rings2(new Chem::FragmentList());
+    Chem::Fragment::SharedPointer ring(new Chem::Fragment());
+
+    ring->addAtom(mol2.getAtom(0));
+    rings2->addElement(ring);
+
+    ForceField::setMMFF94AromaticRings(mol1, rings1);
+    ForceField::setMMFF94AromaticRings(mol2, rings2);
+
+    cache.addData(mol1, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data);
+
+    BOOST_CHECK(!cache.getData(mol2, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+
+    ForceField::setMMFF94AromaticRings(mol2, rings1);
+
+    BOOST_CHECK(cache.getData(mol2, 0, ForceField::InteractionType::ALL, true, 1.0, 1.0, ia_data));
+}
@@ -0,0 +1,193 @@
+/*
+ * MMFF94ParameterTableTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <cstdlib>
+#include <string>
+#include <fstream>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/ForceField/MMFF94AngleBendingParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94BondStretchingParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94BondChargeIncrementTable.hpp"
+#include "CDPL/ForceField/MMFF94OutOfPlaneBendingParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94StretchBendParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94TorsionParameterTable.hpp"
+#include "CDPL/ForceField/MMFF94ParameterSet.hpp"
+
+
+namespace
+{
+
+    // the builtin tables get filled from arrays that are generated at build time from the parameter files
+    // in Data/Builtin/ForceField - loading the original files must yield the same entries
+
+    template <typename Table>
+    void loadParameterFile(Table& table, const std::string& file_name)
+    {
+        std::ifstream is(std::getenv("CDPKIT_TEST_DATA_DIR") + std::string("/../Builtin/ForceField/") + file_name);
+
+        BOOST_CHECK_MESSAGE(is, "could not open parameter file " << file_name);
+
+        table.load(is);
+    }
+
+    void checkTables(const CDPL::ForceField::MMFF94AngleBendingParameterTable& table1,
+                     const CDPL::ForceField::MMFF94AngleBendingParameterTable& table2)
+    {
+        BOOST_CHECK(table1.getNumEntries() > 0);
+        BOOST_CHECK_EQUAL(table1.getNumEntries(), table2.getNumEntries());
+
+        for (const auto& entry1 : table1) {
+            const auto& entry2 = table2.getEntry(entry1.getAngleTypeIndex(), entry1.getTerminalAtom1Type(),
+                                                 entry1.getCenterAtomType(), entry1.getTerminalAtom2Type());
+
+            BOOST_CHECK(entry2);
+            BOOST_CHECK_EQUAL(entry1.getForceConstant(), entry2.getForceConstant());
+            BOOST_CHECK_EQUAL(entry1.getReferenceAngle(), entry2.getReferenceAngle());
+        }
+    }
+
+    void checkTables(const CDPL::ForceField::MMFF94BondStretchingParameterTable& table1,
+                     const CDPL::ForceField::MMFF94BondStretchingParameterTable& table2)
+    {
+        BOOST_CHECK(table1.getNumEntries() > 0);
+        BOOST_CHECK_EQUAL(table1.getNumEntries(), table2.getNumEntries());
+
+        for (const auto& entry1 : table1) {
+            const auto& entry2 = table2.getEntry(entry1.getBondTypeIndex(), entry1.getAtom1Type(), entry1.getAtom2Type());
+
+            BOOST_CHECK(entry2);
+            BOOST_CHECK_EQUAL(entry1.getForceConstant(), entry2.getForceConstant());
+            BOOST_CHECK_EQUAL(entry1.getReferenceLength(), entry2.getReferenceLength());
+        }
+    }
+
+    void checkTables(const CDPL::ForceField::MMFF94BondChargeIncrementTable& table1,
+                     const CDPL::ForceField::MMFF94BondChargeIncrementTable& table2)
+    {
+        BOOST_CHECK(table1.getNumEntries() > 0);
+        BOOST_CHECK_EQUAL(table1.getNumEntries(), table2.getNumEntries());
+
+        for (const auto& entry1 : table1) {
+            const auto& entry2 = table2.getEntry(entry1.getBondTypeIndex(), entry1.getAtom1Type(), entry1.getAtom2Type());
+
+            BOOST_CHECK(entry2);
+            BOOST_CHECK_EQUAL(entry1.getChargeIncrement(), entry2.getChargeIncrement());
+        }
+    }
+
+    void checkTables(const CDPL::ForceField::MMFF94OutOfPlaneBendingParameterTable& table1,
+                     const CDPL::ForceField::MMFF94OutOfPlaneBendingParameterTable& table2)
+    {
+        BOOST_CHECK(table1.getNumEntries() > 0);
+        BOOST_CHECK_EQUAL(table1.getNumEntries(), table2.getNumEntries());
+
+        for (const auto& entry1 : table1) {
+            const auto& entry2 = table2.getEntry(entry1.getTerminalAtom1Type(), entry1.getCenterAtomType(),
+                                                 entry1.getTerminalAtom2Type(), entry1.getOutOfPlaneAtomType());
+
+            BOOST_CHECK(entry2);
+            BOOST_CHECK_EQUAL(entry1.getForceConstant(), entry2.getForceConstant());
+        }
+    }
+
+    void checkTables(const CDPL::ForceField::MMFF94StretchBendParameterTable& table1,
+                     const CDPL::ForceField::MMFF94StretchBendParameterTable& table2)
+    {
+        BOOST_CHECK(table1.getNumEntries() > 0);
+        BOOST_CHECK_EQUAL(table1.getNumEntries(), table2.getNumEntries());
+
+        for (const auto& entry1 : table1) {
+            const auto& entry2 = table2.getEntry(entry1.getStretchBendTypeIndex(), entry1.getTerminalAtom1Type(),
+                                                 entry1.getCenterAtomType(), entry1.getTerminalAtom2Type());
+
+            BOOST_CHECK(entry2);
+            BOOST_CHECK_EQUAL(entry1.getIJKForceConstant(), entry2.getIJKForceConstant());
+            BOOST_CHECK_EQUAL(entry1.getKJIForceConstant(), entry2.getKJIForceConstant());
+        }
+    }
+
+    void checkTables(const CDPL::ForceField::MMFF94TorsionParameterTable& table1,
+                     const CDPL::ForceField::MMFF94TorsionParameterTable& table2)
+    {
+        BOOST_CHECK(table1.getNumEntries() > 0);
+        BOOST_CHECK_EQUAL(table1.getNumEntries(), table2.getNumEntries());
+
+        for (const auto& entry1 : table1) {
+            const auto& entry2 = table2.getEntry(entry1.getTorsionTypeIndex(), entry1.getTerminalAtom1Type(),
+                                                 entry1.getCenterAtom1Type(), entry1.getCenterAtom2Type(),
+                                                 entry1.getTerminalAtom2Type());
+
+            BOOST_CHECK(entry2);
+            BOOST_CHECK_EQUAL(entry1.getTorsionParameter1(), entry2.getTorsionParameter1());
+            BOOST_CHECK_EQUAL(entry1.getTorsionParameter2(), entry2.getTorsionParameter2());
+            BOOST_CHECK_EQUAL(entry1.getTorsionParameter3(), entry2.getTorsionParameter3());
+        }
+    }
+
+    template <typename Table>
+    void checkDefaults(const std::string& file_name)
+    {
+        Table def_table;
+        Table file_table;
+
+        def_table.loadDefaults();
+        loadParameterFile(file_table, file_name);
+
+        checkTables(def_table, file_table);
+    }
+
+    template <typename Table>
+    void checkDefaults(unsigned int param_set, const std::string& file_name)
+    {
+        Table def_table;
+        Table file_table;
+
+        def_table.loadDefaults(param_set);
+        loadParameterFile(file_table, file_name);
+
+        checkTables(def_table, file_table);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(MMFF94ParameterTableDefaultsTest)
+{
+    using namespace CDPL;
+    using namespace ForceField;
+
+    checkDefaults<MMFF94AngleBendingParameterTable>("MMFFANG.PAR");
+    checkDefaults<MMFF94BondStretchingParameterTable>("MMFFBOND.PAR");
+    checkDefaults<MMFF94BondChargeIncrementTable>("MMFFCHG.PAR");
+    checkDefaults<MMFF94StretchBendParameterTable>("MMFFSTBN.PAR");
+
+    checkDefaults<MMFF94OutOfPlaneBendingParameterTable>(MMFF94ParameterSet::DYNAMIC, "MMFFOOP.PAR");
+    checkDefaults<MMFF94OutOfPlaneBendingParameterTable>(MMFF94ParameterSet::STATIC, "MMFFSOOP.PAR");
+    checkDefaults<MMFF94OutOfPlaneBendingParameterTable>(MMFF94ParameterSet::STATIC_XOOP, "MMFFSXOOP.PAR");
+
+    checkDefaults<MMFF94TorsionParameterTable>(MMFF94ParameterSet::DYNAMIC, "MMFFTOR.PAR");
+    checkDefaults<MMFF94TorsionParameterTable>(MMFF94ParameterSet::STATIC, "MMFFSTOR.PAR");
+    checkDefaults<MMFF94TorsionParameterTable>(MMFF94ParameterSet::STATIC_RTOR, "MMFFSRTOR.PAR");
+}
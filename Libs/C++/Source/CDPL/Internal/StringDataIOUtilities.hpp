@@ -35,9 +35,13 @@
 #include <clocale>
 #include <limits>
 #include <cstdlib>
+#include <charconv>
 
+#include "CDPL/Config.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
+#include "StringUtilities.hpp"
+
 
 namespace CDPL
 {
@@ -75,6 +79,35 @@ namespace CDPL
             if (str_beg == str_end)
                 return empty_def_val;
 
+            // fast path: std::from_chars is locale independent and does not require a terminating null character;
+            // input that is not accepted falls through to the strtol/strtod based parsing below
+
+            if (std::numeric_limits<T>::is_integer) {
+                if (std::numeric_limits<T>::is_signed) {
+                    long val;
+                    std::from_chars_result res = std::from_chars(str_beg, str_end, val);
+
+                    if (res.ec == std::errc() && res.ptr == str_end)
+                        return T(val);
+
+                } else {
+                    unsigned long val;
+                    std::from_chars_result res = std::from_chars(str_beg, str_end, val);
+
+                    if (res.ec == std::errc() && res.ptr == str_end)
+                        return T(val);
+                }
+            }
+#ifdef HAVE_CXX17_FP_FROM_CHARS
+            else {
+                double val;
+                std::from_chars_result res = std::from_chars(str_beg, str_end, val);
+
+                if (res.ec == std::errc() && res.ptr == str_end)
+                    return T(val);
+            }
+#endif // HAVE_CXX17_FP_FROM_CHARS
+
             T     val;
             char* parse_end;
 
@@ -115,22 +148,37 @@ namespace CDPL
         T readNumber(std::istream& is, const char* err_msg = "Error", bool throw_ex = true,
                      const T empty_def_val = T(0), const T err_def_val = T(0), char eol_char = '\n')
         {
-            char  buf[FieldSize + 1];
-            char* buf_end_ptr = buf;
-            char  c           = 0;
+            typedef std::istream::traits_type Traits;
 
-            for (std::size_t i = 0; i < FieldSize && is.get(c) && c != eol_char; i++) {
-                if (std::isspace(c, std::locale::classic()))
+            checkStreamState(is, err_msg);
+
+            // operate directly on the stream buffer to avoid the per-character sentry overhead of std::istream::get()
+
+            std::streambuf* sbuf        = is.rdbuf();
+            char            buf[FieldSize + 1];
+            char*           buf_end_ptr = buf;
+
+            for (std::size_t i = 0; i < FieldSize; i++) {
+                Traits::int_type c = sbuf->sgetc();
+
+                if (Traits::eq_int_type(c, Traits::eof())) {
+                    is.setstate(std::istream::eofbit | std::istream::failbit);
+                    break;
+                }
+
+                if (Traits::to_char_type(c) == eol_char)
+                    break;
+
+                sbuf->sbumpc();
+
+                if (isWhitespace(Traits::to_char_type(c)))
                     continue;
 
-                *buf_end_ptr++ = c;
+                *buf_end_ptr++ = Traits::to_char_type(c);
             }
 
             checkStreamState(is, err_msg);
 
-            if (c == eol_char)
-                is.putback(eol_char);
-
             *buf_end_ptr = 0;
 
             return parseNumber<T>(buf, buf_end_ptr, err_msg, throw_ex, empty_def_val, err_def_val);
@@ -36,14 +36,27 @@ void CDPL::Internal::checkStreamState(const std::istream& is, const char* err_ms
 
 void CDPL::Internal::skipChars(std::istream& is, std::size_t count, const char* err_msg, char eol_char)
 {
-    char c = 0;
-    
-    for (std::size_t i = 0; i < count && is.get(c) && c != eol_char; i++);
+    typedef std::istream::traits_type Traits;
 
     checkStreamState(is, err_msg);
 
-    if (c == eol_char)
-        is.putback(eol_char);
+    std::streambuf* sbuf = is.rdbuf();
+
+    for (std::size_t i = 0; i < count; i++) {
+        Traits::int_type c = sbuf->sgetc();
+
+        if (Traits::eq_int_type(c, Traits::eof())) {
+            is.setstate(std::istream::eofbit | std::istream::failbit);
+            break;
+        }
+
+        if (Traits::to_char_type(c) == eol_char)
+            break;
+
+        sbuf->sbumpc();
+    }
+
+    checkStreamState(is, err_msg);
 }
 
 bool CDPL::Internal::skipToString(std::istream& is, const std::string& str, const char* err_msg, bool pos_after)
@@ -148,20 +161,38 @@ std::string& CDPL::Internal::readLine(std::istream& is, std::string& line, const
 std::string& CDPL::Internal::readString(std::istream& is, std::size_t field_size, std::string& str, bool clear,
                                   const char* err_msg, bool trim, char eol_char)
 {
+    typedef std::istream::traits_type Traits;
+
     if (clear)
         str.clear();
 
-    char c = 0;
+    checkStreamState(is, err_msg);
+
+    std::streambuf* sbuf = is.rdbuf();
     std::size_t ws_erase_beg = 0;
     bool skip_ws = trim;
 
-    for (std::size_t i = 0; i < field_size && is.get(c) && c != eol_char; i++) {
-        if (skip_ws && std::isspace(c, std::locale::classic()))
+    for (std::size_t i = 0; i < field_size; i++) {
+        Traits::int_type c = sbuf->sgetc();
+
+        if (Traits::eq_int_type(c, Traits::eof())) {
+            is.setstate(std::istream::eofbit | std::istream::failbit);
+            break;
+        }
+
+        if (Traits::to_char_type(c) == eol_char)
+            break;
+
+        sbuf->sbumpc();
+
+        bool is_ws = isWhitespace(Traits::to_char_type(c));
+        
+        if (skip_ws && is_ws)
             continue;
 
-        str.push_back(c);    
+        str.push_back(Traits::to_char_type(c));    
 
-        if (trim && !std::isspace(c, std::locale::classic()))
+        if (trim && !is_ws)
             ws_erase_beg = str.size(); 
 
         skip_ws = false;
@@ -169,9 +200,6 @@ std::string& CDPL::Internal::readString(std::istream& is, std::size_t field_size
 
     checkStreamState(is, err_msg);
 
-    if (c == eol_char) 
-        is.putback(eol_char);
-
     if (trim)
         str.resize(ws_erase_beg);
 
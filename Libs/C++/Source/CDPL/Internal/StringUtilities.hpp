@@ -35,6 +35,14 @@ namespace CDPL
     namespace Internal
     {
 
+        /*
+         * Equivalent to std::isspace(c, std::locale::classic()) but avoids the locale facet lookup.
+         */
+        inline bool isWhitespace(char c)
+        {
+            return (c == ' ' || (c >= '\t' && c <= '\r'));
+        }
+
         struct IsNonWhitespace
         {
 
@@ -42,7 +50,7 @@ namespace CDPL
 
             bool operator()(char c) const
             {
-                return !std::isspace(c, std::locale::classic());
+                return !isWhitespace(c);
             }
         };
 
@@ -53,7 +61,7 @@ namespace CDPL
 
             bool operator()(char c) const
             {
-                return std::isspace(c, std::locale::classic());
+                return isWhitespace(c);
             }
         };
 
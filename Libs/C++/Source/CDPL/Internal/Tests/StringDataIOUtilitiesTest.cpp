@@ -0,0 +1,85 @@
+/* 
+ * StringDataIOUtilitiesTest.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <sstream>
+#include <string>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Internal/StringDataIOUtilities.hpp"
+
+
+BOOST_AUTO_TEST_CASE(StringDataIOUtilitiesTest)
+{
+    using namespace CDPL;
+    using namespace Internal;
+
+    BOOST_CHECK_EQUAL(parseNumber<int>(std::string("-12")), -12);
+    BOOST_CHECK_EQUAL(parseNumber<int>(std::string("+12")), 12);
+    BOOST_CHECK_EQUAL(parseNumber<unsigned int>(std::string("007")), 7);
+    BOOST_CHECK_EQUAL(parseNumber<int>(std::string(""), "Error", true, 5), 5);
+    BOOST_CHECK_EQUAL(parseNumber<double>(std::string("-1.2500")), -1.25);
+    BOOST_CHECK_EQUAL(parseNumber<double>(std::string("+.5")), 0.5);
+    BOOST_CHECK_EQUAL(parseNumber<double>(std::string("1e2")), 100.0);
+    BOOST_CHECK_EQUAL(parseNumber<int>(std::string("1x"), "Error", false, 0, -1), -1);
+    BOOST_CHECK_THROW(parseNumber<double>(std::string("1.5.")), Base::IOError);
+
+    const char* num_str = "1234";
+
+    BOOST_CHECK_EQUAL(parseNumber<int>(num_str, num_str + 2), 12);
+
+//-------------
+
+    std::istringstream iss1("  1 -2.5000\nabc");
+
+    BOOST_CHECK_EQUAL((readNumber<int, 3>(iss1)), 1);
+    BOOST_CHECK_EQUAL((readNumber<double, 10>(iss1)), -2.5);
+    BOOST_CHECK_EQUAL((readNumber<int, 3>(iss1, "Error", true, 7)), 7);
+    BOOST_CHECK_EQUAL(iss1.get(), '\n');
+
+    BOOST_CHECK_THROW((readNumber<int, 3>(iss1)), Base::IOError);
+
+    std::istringstream iss2("12");
+
+    BOOST_CHECK_THROW((readNumber<int, 3>(iss2)), Base::IOError);
+
+//-------------
+
+    std::istringstream iss3("  ab  cd\nef");
+    std::string str;
+
+    BOOST_CHECK_EQUAL(readString(iss3, 6, str), "ab");
+    BOOST_CHECK_EQUAL(readString(iss3, 5, str, false, "Error", false), "abcd");
+    BOOST_CHECK_EQUAL(iss3.peek(), '\n');
+
+    skipChars(iss3, 2);
+
+    BOOST_CHECK_EQUAL(iss3.peek(), '\n');
+
+    skipLines(iss3);
+    skipChars(iss3, 1);
+
+    BOOST_CHECK_EQUAL(iss3.peek(), 'f');
+    BOOST_CHECK_THROW(skipChars(iss3, 2), Base::IOError);
+}
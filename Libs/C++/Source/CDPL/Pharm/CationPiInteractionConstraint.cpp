@@ -25,6 +25,7 @@
 #include "StaticInit.hpp"
 
 #include <cmath>
+#include <limits>
 
 #include "CDPL/Pharm/CationPiInteractionConstraint.hpp"
 #include "CDPL/Pharm/Feature.hpp"
@@ -56,6 +57,14 @@ double Pharm::CationPiInteractionConstraint::getMaxAngle() const
     return maxAngle;
 }
 
+double Pharm::CationPiInteractionConstraint::getMaxFeatureDistance() const
+{
+    if (maxAngle >= 90.0)
+        return std::numeric_limits<double>::max();
+
+    return (maxDist / std::cos(maxAngle / 180.0 * M_PI));
+}
+
 bool Pharm::CationPiInteractionConstraint::operator()(const Feature& ftr1, const Feature& ftr2) const
 {
     const Feature& aro_ftr = (aroCatOrder ? ftr1 : ftr2);
@@ -24,6 +24,8 @@
 
 #include "StaticInit.hpp"
 
+#include <algorithm>
+
 #include "CDPL/Pharm/DefaultInteractionAnalyzer.hpp"
 #include "CDPL/Pharm/IonicInteractionConstraint.hpp"
 #include "CDPL/Pharm/HydrophobicInteractionConstraint.hpp"
@@ -52,22 +54,37 @@ Pharm::DefaultInteractionAnalyzer::DefaultInteractionAnalyzer(const FeatureConta
 
 void Pharm::DefaultInteractionAnalyzer::init()
 {
-    setConstraintFunction(FeatureType::POSITIVE_IONIZABLE, FeatureType::NEGATIVE_IONIZABLE, IonicInteractionConstraint());
-    setConstraintFunction(FeatureType::NEGATIVE_IONIZABLE, FeatureType::POSITIVE_IONIZABLE, IonicInteractionConstraint());
+    IonicInteractionConstraint ionic_constr;
+
+    setConstraintFunction(FeatureType::POSITIVE_IONIZABLE, FeatureType::NEGATIVE_IONIZABLE, ionic_constr, ionic_constr.getMaxDistance());
+    setConstraintFunction(FeatureType::NEGATIVE_IONIZABLE, FeatureType::POSITIVE_IONIZABLE, ionic_constr, ionic_constr.getMaxDistance());
+
+    HydrophobicInteractionConstraint hyd_constr;
+
+    setConstraintFunction(FeatureType::HYDROPHOBIC, FeatureType::HYDROPHOBIC, hyd_constr, hyd_constr.getMaxDistance());
+
+    HBondingInteractionConstraint hba_constr(true);
+    HBondingInteractionConstraint hbd_constr(false);
+
+    setConstraintFunction(FeatureType::H_BOND_DONOR, FeatureType::H_BOND_ACCEPTOR, hba_constr, hba_constr.getMaxFeatureDistance());
+    setConstraintFunction(FeatureType::H_BOND_ACCEPTOR, FeatureType::H_BOND_DONOR, hbd_constr, hbd_constr.getMaxFeatureDistance());
+
+    XBondingInteractionConstraint xba_constr(true);
+    XBondingInteractionConstraint xbd_constr(false);
 
-    setConstraintFunction(FeatureType::HYDROPHOBIC, FeatureType::HYDROPHOBIC, HydrophobicInteractionConstraint());
+    setConstraintFunction(FeatureType::HALOGEN_BOND_DONOR, FeatureType::HALOGEN_BOND_ACCEPTOR, xba_constr, xba_constr.getMaxAXDistance());
+    setConstraintFunction(FeatureType::HALOGEN_BOND_ACCEPTOR, FeatureType::HALOGEN_BOND_DONOR, xbd_constr, xbd_constr.getMaxAXDistance());
 
-    setConstraintFunction(FeatureType::H_BOND_DONOR, FeatureType::H_BOND_ACCEPTOR, HBondingInteractionConstraint(true));
-    setConstraintFunction(FeatureType::H_BOND_ACCEPTOR, FeatureType::H_BOND_DONOR, HBondingInteractionConstraint(false));
+    CationPiInteractionConstraint aro_cat_constr(true);
+    CationPiInteractionConstraint cat_aro_constr(false);
 
-    setConstraintFunction(FeatureType::HALOGEN_BOND_DONOR, FeatureType::HALOGEN_BOND_ACCEPTOR, XBondingInteractionConstraint(true));
-    setConstraintFunction(FeatureType::HALOGEN_BOND_ACCEPTOR, FeatureType::HALOGEN_BOND_DONOR, XBondingInteractionConstraint(false));
+    setConstraintFunction(FeatureType::AROMATIC, FeatureType::POSITIVE_IONIZABLE, aro_cat_constr, aro_cat_constr.getMaxFeatureDistance());
+    setConstraintFunction(FeatureType::POSITIVE_IONIZABLE, FeatureType::AROMATIC, cat_aro_constr, cat_aro_constr.getMaxFeatureDistance());
 
-    setConstraintFunction(FeatureType::AROMATIC, FeatureType::POSITIVE_IONIZABLE, CationPiInteractionConstraint(true));
-    setConstraintFunction(FeatureType::POSITIVE_IONIZABLE, FeatureType::AROMATIC, CationPiInteractionConstraint(false));
+    OrthogonalPiPiInteractionConstraint ortho_pi_pi_constr;
+    ParallelPiPiInteractionConstraint para_pi_pi_constr;
 
     setConstraintFunction(FeatureType::AROMATIC, FeatureType::AROMATIC, 
-                          InteractionConstraintConnector(false, 
-                                                         OrthogonalPiPiInteractionConstraint(), 
-                                                         ParallelPiPiInteractionConstraint()));
+                          InteractionConstraintConnector(false, ortho_pi_pi_constr, para_pi_pi_constr),
+                          std::max(ortho_pi_pi_constr.getMaxFeatureDistance(), para_pi_pi_constr.getMaxFeatureDistance()));
 }
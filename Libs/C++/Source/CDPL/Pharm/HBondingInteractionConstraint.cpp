@@ -70,6 +70,11 @@ double Pharm::HBondingInteractionConstraint::getMaxAcceptorAngle() const
     return maxAccAngle;
 }
 
+double Pharm::HBondingInteractionConstraint::getMaxFeatureDistance() const
+{
+    return (maxLength + DEF_DONOR_TO_H_DIST);
+}
+
 bool Pharm::HBondingInteractionConstraint::operator()(const Feature& ftr1, const Feature& ftr2) const
 {
     const Feature& don_ftr = (donAccOrder ? ftr1 : ftr2);
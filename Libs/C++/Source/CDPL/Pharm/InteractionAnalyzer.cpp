@@ -24,10 +24,19 @@
 
 #include "StaticInit.hpp"
 
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
 #include "CDPL/Pharm/InteractionAnalyzer.hpp"
 #include "CDPL/Pharm/FeatureContainer.hpp"
 #include "CDPL/Pharm/Feature.hpp"
 #include "CDPL/Pharm/FeatureFunctions.hpp"
+#include "CDPL/Chem/Entity3DFunctions.hpp"
+#include "CDPL/Math/Vector.hpp"
+#include "CDPL/Base/Exceptions.hpp"
 
 
 using namespace CDPL; 
@@ -37,12 +46,155 @@ namespace
 {
 
     const Pharm::InteractionAnalyzer::ConstraintFunction DEF_FUNC;
+
+    constexpr std::int64_t CELL_INDEX_OFFSET = std::int64_t(1) << 20;
+    constexpr std::uint64_t CELL_INDEX_MASK  = (std::uint64_t(1) << 21) - 1;
+
+    std::int64_t getCellIndex(double coord, double cell_size)
+    {
+        return std::int64_t(std::floor(coord / cell_size));
+    }
+
+    std::uint64_t getCellKey(std::int64_t x, std::int64_t y, std::int64_t z)
+    {
+        return ((std::uint64_t(x + CELL_INDEX_OFFSET) & CELL_INDEX_MASK) << 42) |
+            ((std::uint64_t(y + CELL_INDEX_OFFSET) & CELL_INDEX_MASK) << 21) |
+            (std::uint64_t(z + CELL_INDEX_OFFSET) & CELL_INDEX_MASK);
+    }
+
+    double calcSquaredDistance(const Math::Vector3D& pos1, const Math::Vector3D& pos2)
+    {
+        double dx = pos1[0] - pos2[0];
+        double dy = pos1[1] - pos2[1];
+        double dz = pos1[2] - pos2[2];
+
+        return (dx * dx + dy * dy + dz * dz);
+    }
+}
+
+
+constexpr double Pharm::InteractionAnalyzer::NO_DISTANCE_LIMIT;
+
+
+class Pharm::InteractionAnalyzer::FeatureIndex
+{
+
+  public:
+    struct Entry
+    {
+
+        const Feature* feature;
+        std::size_t    index;
+        Math::Vector3D position;
+        std::uint64_t  cellKey;
+    };
+
+    typedef std::vector<Entry>                            EntryList;
+    typedef std::pair<std::size_t, std::size_t>           EntryRange;
+    typedef std::unordered_map<std::uint64_t, EntryRange> CellMap;
+
+    struct TypeBucket
+    {
+
+        TypeBucket(): cellSize(0.0) {}
+
+        double    cellSize;
+        EntryList entries;
+        EntryList unpositioned;
+        CellMap   cells;
+    };
+
+    typedef std::unordered_map<unsigned int, TypeBucket> TypeBucketMap;
+
+    FeatureIndex(const FeatureContainer& cntnr, const ConstraintFunctionMap& constr_map);
+
+    const TypeBucket* getBucket(unsigned int type) const
+    {
+        TypeBucketMap::const_iterator it = buckets.find(type);
+
+        return (it == buckets.end() ? 0 : &it->second);
+    }
+
+  private:
+    TypeBucketMap buckets;
+};
+
+
+Pharm::InteractionAnalyzer::FeatureIndex::FeatureIndex(const FeatureContainer& cntnr, const ConstraintFunctionMap& constr_map)
+{
+    std::size_t idx = 0;
+
+    for (FeatureContainer::ConstFeatureIterator it = cntnr.getFeaturesBegin(), end = cntnr.getFeaturesEnd(); it != end; ++it, idx++) {
+        const Feature& ftr = *it;
+        TypeBucket& bucket = buckets[getType(ftr)];
+        Entry entry;
+
+        entry.feature = &ftr;
+        entry.index = idx;
+        entry.cellKey = 0;
+
+        if (!has3DCoordinates(ftr)) {
+            bucket.unpositioned.push_back(entry);
+            continue;
+        }
+
+        entry.position = get3DCoordinates(ftr);
+        bucket.entries.push_back(entry);
+    }
+
+    for (TypeBucketMap::iterator b_it = buckets.begin(), b_end = buckets.end(); b_it != b_end; ++b_it) {
+        TypeBucket& bucket = b_it->second;
+        double cell_size = 0.0;
+
+        for (ConstraintFunctionMap::const_iterator c_it = constr_map.begin(), c_end = constr_map.end(); c_it != c_end; ++c_it) {
+            if (c_it->first.second != b_it->first || !c_it->second.function)
+                continue;
+
+            if (c_it->second.maxDistance == NO_DISTANCE_LIMIT) {
+                cell_size = 0.0;
+                break;
+            }
+
+            cell_size = std::max(cell_size, c_it->second.maxDistance);
+        }
+
+        if (cell_size <= 0.0)
+            continue;
+
+        bucket.cellSize = cell_size;
+
+        for (EntryList::iterator e_it = bucket.entries.begin(), e_end = bucket.entries.end(); e_it != e_end; ++e_it) {
+            const Math::Vector3D& pos = e_it->position;
+
+            e_it->cellKey = getCellKey(getCellIndex(pos[0], cell_size), getCellIndex(pos[1], cell_size), getCellIndex(pos[2], cell_size));
+        }
+
+        std::stable_sort(bucket.entries.begin(), bucket.entries.end(),
+                         [](const Entry& entry1, const Entry& entry2) { return (entry1.cellKey < entry2.cellKey); });
+
+        for (std::size_t i = 0, num_entries = bucket.entries.size(); i < num_entries; ) {
+            std::size_t j = i + 1;
+
+            for ( ; j < num_entries && bucket.entries[j].cellKey == bucket.entries[i].cellKey; j++);
+
+            bucket.cells[bucket.entries[i].cellKey] = EntryRange(i, j);
+            i = j;
+        }
+    }
 }
 
 
 void Pharm::InteractionAnalyzer::setConstraintFunction(unsigned int type1, unsigned int type2, const ConstraintFunction& func)
 {
-    constraintFuncMap[FeatureTypePair(type1, type2)] = func;
+    setConstraintFunction(type1, type2, func, NO_DISTANCE_LIMIT);
+}
+
+void Pharm::InteractionAnalyzer::setConstraintFunction(unsigned int type1, unsigned int type2, const ConstraintFunction& func, double max_dist)
+{
+    ConstraintData& data = constraintFuncMap[FeatureTypePair(type1, type2)];
+
+    data.function = func;
+    data.maxDistance = max_dist;
 }
 
 void Pharm::InteractionAnalyzer::removeConstraintFunction(unsigned int type1, unsigned int type2)
@@ -55,33 +207,139 @@ Pharm::InteractionAnalyzer::getConstraintFunction(unsigned int type1, unsigned i
 {
     ConstraintFunctionMap::const_iterator it = constraintFuncMap.find(FeatureTypePair(type1, type2));
 
-    return (it == constraintFuncMap.end() ? DEF_FUNC : it->second);
+    return (it == constraintFuncMap.end() ? DEF_FUNC : it->second.function);
+}
+
+double Pharm::InteractionAnalyzer::getMaxInteractionDistance(unsigned int type1, unsigned int type2) const
+{
+    ConstraintFunctionMap::const_iterator it = constraintFuncMap.find(FeatureTypePair(type1, type2));
+
+    return (it == constraintFuncMap.end() ? NO_DISTANCE_LIMIT : it->second.maxDistance);
+}
+
+void Pharm::InteractionAnalyzer::indexFeatures(const FeatureContainer& cntnr2)
+{
+    featureIndex = createFeatureIndex(cntnr2);
+}
+
+void Pharm::InteractionAnalyzer::clearFeatureIndex()
+{
+    featureIndex.reset();
+}
+
+bool Pharm::InteractionAnalyzer::hasFeatureIndex() const
+{
+    return bool(featureIndex);
+}
+
+Pharm::InteractionAnalyzer::FeatureIndexPointer Pharm::InteractionAnalyzer::createFeatureIndex(const FeatureContainer& cntnr2) const
+{
+    return FeatureIndexPointer(new FeatureIndex(cntnr2, constraintFuncMap));
 }
 
 void Pharm::InteractionAnalyzer::analyze(const FeatureContainer& cntnr1, const FeatureContainer& cntnr2, 
                                          FeatureMapping& iactions, bool append) const
 {
+    analyze(cntnr1, FeatureIndex(cntnr2, constraintFuncMap), iactions, append);
+}
+
+void Pharm::InteractionAnalyzer::analyze(const FeatureContainer& cntnr1, FeatureMapping& iactions, bool append) const
+{
+    if (!featureIndex)
+        throw Base::OperationFailed("InteractionAnalyzer: no feature index available");
+
+    analyze(cntnr1, *featureIndex, iactions, append);
+}
+
+void Pharm::InteractionAnalyzer::analyze(const FeatureContainer& cntnr1, const FeatureIndex& index, 
+                                         FeatureMapping& iactions, bool append) const
+{
+    typedef std::pair<const FeatureIndex::Entry*, const ConstraintFunction*> Candidate;
+    typedef std::vector<Candidate> CandidateList;
+
     if (!append)
         iactions.clear();
-    
+
     ConstraintFunctionMap::const_iterator cf_map_end = constraintFuncMap.end();
-    FeatureTypePair type_pair;
+    CandidateList candidates;
 
     for (FeatureContainer::ConstFeatureIterator it1 = cntnr1.getFeaturesBegin(), end1 = cntnr1.getFeaturesEnd(); it1 != end1; ++it1) {
         const Feature& ftr1 = *it1;
-        type_pair.first = getType(ftr1);
+        unsigned int type1 = getType(ftr1);
+        const Math::Vector3D* pos1 = (has3DCoordinates(ftr1) ? &get3DCoordinates(ftr1) : 0);
 
-        for (FeatureContainer::ConstFeatureIterator it2 = cntnr2.getFeaturesBegin(), end2 = cntnr2.getFeaturesEnd(); it2 != end2; ++it2) {
-            const Feature& ftr2 = *it2;
-            type_pair.second = getType(ftr2);
+        candidates.clear();
 
-            ConstraintFunctionMap::const_iterator cf_it = constraintFuncMap.find(type_pair);
+        for (ConstraintFunctionMap::const_iterator cf_it = constraintFuncMap.lower_bound(FeatureTypePair(type1, 0)); 
+             cf_it != cf_map_end && cf_it->first.first == type1; ++cf_it) {
 
-            if (cf_it == cf_map_end || !cf_it->second)
+            if (!cf_it->second.function)
                 continue;
 
-            if (cf_it->second(ftr1, ftr2))
-                iactions.insertEntry(&ftr1, &ftr2);
+            const FeatureIndex::TypeBucket* bucket = index.getBucket(cf_it->first.second);
+
+            if (!bucket)
+                continue;
+
+            const ConstraintFunction* func = &cf_it->second.function;
+            double max_dist = cf_it->second.maxDistance;
+
+            for (FeatureIndex::EntryList::const_iterator e_it = bucket->unpositioned.begin(), e_end = bucket->unpositioned.end(); e_it != e_end; ++e_it)
+                candidates.push_back(Candidate(&*e_it, func));
+
+            if (!pos1 || max_dist == NO_DISTANCE_LIMIT) {
+                for (FeatureIndex::EntryList::const_iterator e_it = bucket->entries.begin(), e_end = bucket->entries.end(); e_it != e_end; ++e_it)
+                    candidates.push_back(Candidate(&*e_it, func));
+
+                continue;
+            }
+
+            // the constraint function or its maximum distance may have been changed after the cell list was built - the number
+            // of cells to visit is calculated in floating point to not overflow for large distances
+            double max_dist_sqd = max_dist * max_dist;
+            double cell_range = (bucket->cellSize > 0.0 ? std::ceil(max_dist / bucket->cellSize) : 0.0);
+            double num_cells = (2.0 * cell_range + 1.0) * (2.0 * cell_range + 1.0) * (2.0 * cell_range + 1.0);
+
+            if (bucket->cellSize <= 0.0 || num_cells >= double(bucket->entries.size())) {
+                for (FeatureIndex::EntryList::const_iterator e_it = bucket->entries.begin(), e_end = bucket->entries.end(); e_it != e_end; ++e_it)
+                    if (calcSquaredDistance(e_it->position, *pos1) <= max_dist_sqd)
+                        candidates.push_back(Candidate(&*e_it, func));
+
+                continue;
+            }
+
+            std::int64_t range = std::int64_t(cell_range);
+            std::int64_t cx = getCellIndex((*pos1)[0], bucket->cellSize);
+            std::int64_t cy = getCellIndex((*pos1)[1], bucket->cellSize);
+            std::int64_t cz = getCellIndex((*pos1)[2], bucket->cellSize);
+
+            for (std::int64_t x = cx - range; x <= cx + range; x++) {
+                for (std::int64_t y = cy - range; y <= cy + range; y++) {
+                    for (std::int64_t z = cz - range; z <= cz + range; z++) {
+                        FeatureIndex::CellMap::const_iterator c_it = bucket->cells.find(getCellKey(x, y, z));
+
+                        if (c_it == bucket->cells.end())
+                            continue;
+
+                        for (std::size_t i = c_it->second.first; i < c_it->second.second; i++) {
+                            const FeatureIndex::Entry& entry = bucket->entries[i];
+
+                            if (calcSquaredDistance(entry.position, *pos1) <= max_dist_sqd)
+                                candidates.push_back(Candidate(&entry, func));
+                        }
+                    }
+                }
+            }
         }
+
+        // preserve the order of the features in the second container
+        std::sort(candidates.begin(), candidates.end(),
+                  [](const Candidate& cand1, const Candidate& cand2) { return (cand1.first->index < cand2.first->index); });
+
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        for (CandidateList::const_iterator c_it = candidates.begin(), c_end = candidates.end(); c_it != c_end; ++c_it) 
+            if ((*c_it->second)(ftr1, *c_it->first->feature))
+                iactions.insertEntry(&ftr1, c_it->first->feature);
     }
 }
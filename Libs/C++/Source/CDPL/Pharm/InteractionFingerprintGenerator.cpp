@@ -0,0 +1,476 @@
+/*
+ * InteractionFingerprintGenerator.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include "StaticInit.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+#include "CDPL/Pharm/InteractionFingerprintGenerator.hpp"
+#include "CDPL/Pharm/FeatureFunctions.hpp"
+#include "CDPL/Pharm/FeatureMapping.hpp"
+#include "CDPL/Chem/MolecularGraph.hpp"
+#include "CDPL/Chem/Atom.hpp"
+#include "CDPL/Chem/Bond.hpp"
+#include "CDPL/Chem/Fragment.hpp"
+#include "CDPL/Chem/Entity3DFunctions.hpp"
+#include "CDPL/Math/KabschAlgorithm.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+using namespace CDPL;
+
+
+constexpr std::size_t Pharm::InteractionFingerprintGenerator::NUM_LIGAND_FEATURE_TYPES;
+
+
+class Pharm::InteractionFingerprintGenerator::FrameProcessor
+{
+
+  public:
+    FrameProcessor(const InteractionFingerprintGenerator& gen, const InteractionAnalyzer& analyzer, const Pharmacophore* idx_env_pharm,
+                   const InteractionAnalyzer::FeatureIndex* env_index):
+        generator(gen), analyzer(analyzer), indexedEnvPharm(idx_env_pharm), envFeatureIndex(env_index), ligPharm(gen.ligPharm)
+    {
+        if (!indexedEnvPharm)
+            envPharm = gen.envPharm;
+    }
+
+    void process(const Math::Vector3DArray& lig_coords, std::size_t lig_offs,
+                 const Math::Vector3DArray& env_coords, std::size_t env_offs, BitIndexList& bits)
+    {
+        if (!lig_coords.isEmpty())
+            updateGeometries(ligPharm, generator.ligGeomData, lig_coords, lig_offs);
+
+        const Pharmacophore* env_pharm = indexedEnvPharm;
+
+        if (env_pharm)
+            analyzer.analyze(ligPharm, *envFeatureIndex, iactions, false);
+
+        else {
+            if (!env_coords.isEmpty())
+                updateGeometries(envPharm, generator.envGeomData, env_coords, env_offs);
+
+            analyzer.analyze(ligPharm, envPharm, iactions, false);
+            env_pharm = &envPharm;
+        }
+
+        bits.clear();
+
+        for (FeatureMapping::ConstEntryIterator it = iactions.getEntriesBegin(), end = iactions.getEntriesEnd(); it != end; ++it) {
+            unsigned int lig_type = getType(*it->first);
+
+            if (lig_type >= NUM_LIGAND_FEATURE_TYPES)
+                continue;
+
+            bits.push_back(env_pharm->getFeatureIndex(*it->second) * NUM_LIGAND_FEATURE_TYPES + lig_type);
+        }
+    }
+
+    static void updateGeometries(Pharmacophore& pharm, const FeatureGeometryDataList& geom_data, const Math::Vector3DArray& coords,
+                                 std::size_t offs, Math::KabschAlgorithm<double>& kabsch, Math::DMatrix& atom_coords)
+    {
+        for (std::size_t i = 0, num_ftrs = geom_data.size(); i < num_ftrs; i++) {
+            const FeatureGeometryData& data = geom_data[i];
+            std::size_t num_atoms = data.atomIndices.getSize();
+
+            if (num_atoms == 0)
+                continue;
+
+            Feature& ftr = pharm.getFeature(i);
+
+            if (num_atoms == 1) {
+                const Math::Vector3D& atom_pos = coords[offs + data.atomIndices[0]];
+                Math::Vector3D pos(data.refPosition);
+
+                pos[0] += atom_pos[0] - data.refAtomCoords(0, 0);
+                pos[1] += atom_pos[1] - data.refAtomCoords(1, 0);
+                pos[2] += atom_pos[2] - data.refAtomCoords(2, 0);
+
+                set3DCoordinates(ftr, pos);
+                continue;
+            }
+
+            atom_coords.resize(3, num_atoms, false);
+
+            for (std::size_t j = 0; j < num_atoms; j++) {
+                const Math::Vector3D& atom_pos = coords[offs + data.atomIndices[j]];
+
+                atom_coords(0, j) = atom_pos[0];
+                atom_coords(1, j) = atom_pos[1];
+                atom_coords(2, j) = atom_pos[2];
+            }
+
+            kabsch.align(data.refAtomCoords, atom_coords);
+
+            const Math::DMatrix& xform = kabsch.getTransform();
+            Math::Vector3D pos;
+
+            for (std::size_t j = 0; j < 3; j++)
+                pos[j] = xform(j, 0) * data.refPosition[0] + xform(j, 1) * data.refPosition[1] + xform(j, 2) * data.refPosition[2] + xform(j, 3);
+
+            set3DCoordinates(ftr, pos);
+
+            if (!data.hasOrientation)
+                continue;
+
+            Math::Vector3D orient;
+
+            for (std::size_t j = 0; j < 3; j++)
+                orient[j] = xform(j, 0) * data.refOrientation[0] + xform(j, 1) * data.refOrientation[1] + xform(j, 2) * data.refOrientation[2];
+
+            setOrientation(ftr, orient);
+        }
+    }
+
+  private:
+    void updateGeometries(Pharmacophore& pharm, const FeatureGeometryDataList& geom_data, const Math::Vector3DArray& coords, std::size_t offs)
+    {
+        updateGeometries(pharm, geom_data, coords, offs, kabsch, atomCoords);
+    }
+
+    const InteractionFingerprintGenerator&   generator;
+    const InteractionAnalyzer&               analyzer;
+    const Pharmacophore*                     indexedEnvPharm;
+    const InteractionAnalyzer::FeatureIndex* envFeatureIndex;
+    BasicPharmacophore                       ligPharm;
+    BasicPharmacophore                       envPharm;
+    FeatureMapping                           iactions;
+    Math::KabschAlgorithm<double>            kabsch;
+    Math::DMatrix                            atomCoords;
+};
+
+
+Pharm::InteractionFingerprintGenerator::InteractionFingerprintGenerator():
+    ligMolGraph(0), envMolGraph(0), numLigAtoms(0), numEnvAtoms(0), numThreads(0)
+{
+    envPharmGen.enableFeature(FeatureType::HALOGEN_BOND_ACCEPTOR, true);
+}
+
+void Pharm::InteractionFingerprintGenerator::setNumThreads(std::size_t num_threads)
+{
+    numThreads = num_threads;
+}
+
+std::size_t Pharm::InteractionFingerprintGenerator::getNumThreads() const
+{
+    return numThreads;
+}
+
+Pharm::PharmacophoreGenerator& Pharm::InteractionFingerprintGenerator::getLigandPharmacophoreGenerator()
+{
+    return ligPharmGen;
+}
+
+const Pharm::PharmacophoreGenerator& Pharm::InteractionFingerprintGenerator::getLigandPharmacophoreGenerator() const
+{
+    return ligPharmGen;
+}
+
+Pharm::PharmacophoreGenerator& Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophoreGenerator()
+{
+    return envPharmGen;
+}
+
+const Pharm::PharmacophoreGenerator& Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophoreGenerator() const
+{
+    return envPharmGen;
+}
+
+Pharm::InteractionAnalyzer& Pharm::InteractionFingerprintGenerator::getInteractionAnalyzer()
+{
+    return iaAnalyzer;
+}
+
+const Pharm::InteractionAnalyzer& Pharm::InteractionFingerprintGenerator::getInteractionAnalyzer() const
+{
+    return iaAnalyzer;
+}
+
+void Pharm::InteractionFingerprintGenerator::setup(const Chem::MolecularGraph& ligand, const Chem::MolecularGraph& env)
+{
+    ligMolGraph = &ligand;
+    envMolGraph = &env;
+    numLigAtoms = ligand.getNumAtoms();
+    numEnvAtoms = env.getNumAtoms();
+
+    ligPharmGen.generate(ligand, ligPharm, false);
+    envPharmGen.generate(env, envPharm, false);
+
+    initGeometryData(ligand, ligPharm, ligPharmGen.getAtom3DCoordinatesFunction(), ligGeomData);
+    initGeometryData(env, envPharm, envPharmGen.getAtom3DCoordinatesFunction(), envGeomData);
+}
+
+const Pharm::Pharmacophore& Pharm::InteractionFingerprintGenerator::getLigandPharmacophore() const
+{
+    return ligPharm;
+}
+
+const Pharm::Pharmacophore& Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophore() const
+{
+    return envPharm;
+}
+
+std::size_t Pharm::InteractionFingerprintGenerator::getNumBits() const
+{
+    return (envPharm.getNumFeatures() * NUM_LIGAND_FEATURE_TYPES);
+}
+
+void Pharm::InteractionFingerprintGenerator::generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, Util::BitSet& fp)
+{
+    fp.resize(getNumBits());
+    fp.reset();
+
+    processFrames(lig_coords, env_coords, 1,
+                  [&fp](std::size_t, const BitIndexList& bits) {
+                      for (std::size_t bit : bits)
+                          fp.set(bit);
+                  });
+}
+
+void Pharm::InteractionFingerprintGenerator::generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, Math::ULVector& counts)
+{
+    counts.resize(getNumBits());
+    counts.clear();
+
+    processFrames(lig_coords, env_coords, 1,
+                  [&counts](std::size_t, const BitIndexList& bits) {
+                      for (std::size_t bit : bits)
+                          counts(bit)++;
+                  });
+}
+
+void Pharm::InteractionFingerprintGenerator::generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, std::size_t num_frames,
+                                                      Util::BitSetArray& fps)
+{
+    std::size_t num_bits = getNumBits();
+
+    fps.resize(num_frames);
+
+    for (std::size_t i = 0; i < num_frames; i++) {
+        fps[i].resize(num_bits);
+        fps[i].reset();
+    }
+
+    processFrames(lig_coords, env_coords, num_frames,
+                  [&fps](std::size_t frame, const BitIndexList& bits) {
+                      Util::BitSet& fp = fps[frame];
+
+                      for (std::size_t bit : bits)
+                          fp.set(bit);
+                  });
+}
+
+void Pharm::InteractionFingerprintGenerator::generate(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords, std::size_t num_frames,
+                                                      Math::ULMatrix& counts)
+{
+    counts.resize(num_frames, getNumBits(), false);
+    counts.clear();
+
+    processFrames(lig_coords, env_coords, num_frames,
+                  [&counts](std::size_t frame, const BitIndexList& bits) {
+                      for (std::size_t bit : bits)
+                          counts(frame, bit)++;
+                  });
+}
+
+void Pharm::InteractionFingerprintGenerator::initGeometryData(const Chem::MolecularGraph& molgraph, Pharmacophore& pharm,
+                                                              const Chem::Atom3DCoordinatesFunction& coords_func, FeatureGeometryDataList& geom_data) const
+{
+    geom_data.clear();
+    geom_data.reserve(pharm.getNumFeatures());
+
+    for (std::size_t i = 0; i < pharm.getNumFeatures(); ) {
+        const Feature& ftr = pharm.getFeature(i);
+
+        geom_data.resize(geom_data.size() + 1);
+
+        FeatureGeometryData& data = geom_data.back();
+
+        // the feature atoms and their bonded neighbors define the local frame of the feature
+
+        if (hasSubstructure(ftr) && has3DCoordinates(ftr)) {
+            const Chem::Fragment& substruct = *getSubstructure(ftr);
+
+            for (Chem::Fragment::ConstAtomIterator a_it = substruct.getAtomsBegin(), a_end = substruct.getAtomsEnd(); a_it != a_end; ++a_it) {
+                const Chem::Atom& atom = *a_it;
+
+                if (!molgraph.containsAtom(atom))
+                    continue;
+
+                data.atomIndices.addElement(molgraph.getAtomIndex(atom));
+
+                Chem::Atom::ConstBondIterator b_it = atom.getBondsBegin();
+
+                for (Chem::Atom::ConstAtomIterator n_it = atom.getAtomsBegin(), n_end = atom.getAtomsEnd(); n_it != n_end; ++n_it, ++b_it) {
+                    if (molgraph.containsBond(*b_it) && molgraph.containsAtom(*n_it))
+                        data.atomIndices.addElement(molgraph.getAtomIndex(*n_it));
+                }
+            }
+        }
+
+        // features whose position cannot be derived from atom coordinates would keep their positions in all frames
+
+        if (data.atomIndices.isEmpty()) {
+            geom_data.pop_back();
+            pharm.removeFeature(i);
+            continue;
+        }
+
+        data.refPosition = get3DCoordinates(ftr);
+        data.hasOrientation = hasOrientation(ftr);
+
+        if (data.hasOrientation)
+            data.refOrientation = getOrientation(ftr);
+
+        std::sort(data.atomIndices.getElementsBegin(), data.atomIndices.getElementsEnd());
+
+        data.atomIndices.getData().erase(std::unique(data.atomIndices.getElementsBegin(), data.atomIndices.getElementsEnd()),
+                                         data.atomIndices.getElementsEnd());
+
+        std::size_t num_atoms = data.atomIndices.getSize();
+
+        data.refAtomCoords.resize(3, num_atoms, false);
+
+        for (std::size_t j = 0; j < num_atoms; j++) {
+            const Math::Vector3D& atom_pos = coords_func(molgraph.getAtom(data.atomIndices[j]));
+
+            data.refAtomCoords(0, j) = atom_pos[0];
+            data.refAtomCoords(1, j) = atom_pos[1];
+            data.refAtomCoords(2, j) = atom_pos[2];
+        }
+
+        i++;
+    }
+}
+
+std::size_t Pharm::InteractionFingerprintGenerator::getNumCoordinateFrames(const Math::Vector3DArray& coords, std::size_t num_atoms,
+                                                                           std::size_t num_frames) const
+{
+    std::size_t size = coords.getSize();
+
+    if (size == 0)
+        return 0;
+
+    if (size == num_atoms)
+        return 1;
+
+    if (size == num_atoms * num_frames)
+        return num_frames;
+
+    throw Base::SizeError("InteractionFingerprintGenerator: coordinates array size does not match number of atoms and frames");
+}
+
+template <typename ResultFunc>
+void Pharm::InteractionFingerprintGenerator::processFrames(const Math::Vector3DArray& lig_coords, const Math::Vector3DArray& env_coords,
+                                                           std::size_t num_frames, const ResultFunc& func)
+{
+    if (!ligMolGraph || !envMolGraph)
+        throw Base::OperationFailed("InteractionFingerprintGenerator: setup() has not been called");
+
+    if (num_frames == 0)
+        return;
+
+    // the molecular graphs do not get accessed here which allows callers to run the method without holding
+    // locks required for accessing them (e.g. the Python GIL)
+
+    std::size_t num_lig_atoms = numLigAtoms;
+    std::size_t num_env_atoms = numEnvAtoms;
+    std::size_t num_lig_frames = getNumCoordinateFrames(lig_coords, num_lig_atoms, num_frames);
+    std::size_t num_env_frames = getNumCoordinateFrames(env_coords, num_env_atoms, num_frames);
+
+    // if the environment does not move, its features get updated and indexed only once (the interaction analyzer
+    // is used directly since copies of its constraint functions might be Python objects) - the feature index is
+    // private to the call and leaves any index built by the user via the analyzer untouched
+
+    const InteractionAnalyzer& analyzer = iaAnalyzer;
+    BasicPharmacophore  static_env_pharm;
+    const Pharmacophore* idx_env_pharm = 0;
+    InteractionAnalyzer::FeatureIndexPointer env_index;
+
+    if (num_env_frames <= 1) {
+        if (num_env_frames == 1) {
+            Math::KabschAlgorithm<double> kabsch;
+            Math::DMatrix atom_coords;
+
+            static_env_pharm = envPharm;
+
+            FrameProcessor::updateGeometries(static_env_pharm, envGeomData, env_coords, 0, kabsch, atom_coords);
+            idx_env_pharm = &static_env_pharm;
+
+        } else
+            idx_env_pharm = &envPharm;
+
+        env_index = analyzer.createFeatureIndex(*idx_env_pharm);
+    }
+
+    std::size_t num_workers = std::max(std::min(numThreads, num_frames), std::size_t(1));
+    std::atomic<std::size_t> next_frame(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    auto work = [&, this]() {
+        try {
+            FrameProcessor proc(*this, analyzer, idx_env_pharm, env_index.get());
+            BitIndexList bits;
+
+            for (std::size_t frame = next_frame++; frame < num_frames; frame = next_frame++) {
+                proc.process(lig_coords, (num_lig_frames > 1 ? frame * num_lig_atoms : 0),
+                             env_coords, (num_env_frames > 1 ? frame * num_env_atoms : 0), bits);
+                func(frame, bits);
+            }
+
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+
+            if (!error)
+                error = std::current_exception();
+
+            next_frame = num_frames;
+        }
+    };
+
+    if (num_workers == 1) {
+        work();
+
+    } else {
+        std::vector<std::thread> threads;
+
+        threads.reserve(num_workers - 1);
+
+        for (std::size_t i = 1; i < num_workers; i++)
+            threads.emplace_back(work);
+
+        work();
+
+        for (std::vector<std::thread>::iterator it = threads.begin(), end = threads.end(); it != end; ++it)
+            it->join();
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
@@ -41,11 +41,10 @@ using namespace CDPL;
 
 void Pharm::prepareForPharmacophoreGeneration(Chem::Molecule& mol, bool calc_hyd, bool from_logp)
 {
-    perceiveSSSR(mol, false);
-    setRingFlags(mol, false);
-    calcImplicitHydrogenCounts(mol, false);
-    perceiveHybridizationStates(mol, false);
-    setAromaticityFlags(mol, false);
+    using namespace Chem;
+
+    prepareMolecularGraph(mol, PerceptionFlag::SSSR | PerceptionFlag::RING_FLAGS | PerceptionFlag::IMPLICIT_H_COUNTS |
+                          PerceptionFlag::HYBRIDIZATION_STATES | PerceptionFlag::AROMATICITY_FLAGS, false);
 
     if (makeHydrogenComplete(mol)) {
         try {
@@ -64,6 +64,11 @@ double Pharm::OrthogonalPiPiInteractionConstraint::getMaxAngle() const
     return maxAngle;
 }
 
+double Pharm::OrthogonalPiPiInteractionConstraint::getMaxFeatureDistance() const
+{
+    return std::sqrt(maxVDist * maxVDist + maxHDist * maxHDist);
+}
+
 bool Pharm::OrthogonalPiPiInteractionConstraint::operator()(const Feature& ftr1, const Feature& ftr2) const
 {
     Math::Vector3D ftr1_ftr2_vec(get3DCoordinates(ftr2) - get3DCoordinates(ftr1));
@@ -119,3 +119,23 @@ const Pharm::FeatureTypeHistogram& Pharm::PSDScreeningDBAccessor::getFeatureCoun
 {
     return impl->getFeatureCounts(mol_idx, mol_conf_idx);
 }
+
+void Pharm::PSDScreeningDBAccessor::prefetchPharmacophores(const Util::STArray& pharm_indices) const
+{
+    impl->prefetchPharmacophores(pharm_indices);
+}
+
+bool Pharm::PSDScreeningDBAccessor::getAtomCoordinatesAndRadii(std::size_t pharm_idx, Math::Vector3DArray& coords, Util::DArray& radii) const
+{
+    return impl->getAtomCoordinatesAndRadii(pharm_idx, coords, radii);
+}
+
+std::size_t Pharm::PSDScreeningDBAccessor::getNumBytesRead() const
+{
+    return impl->getNumBytesRead();
+}
+
+double Pharm::PSDScreeningDBAccessor::getDataDecodingTime() const
+{
+    return impl->getDataDecodingTime();
+}
@@ -24,9 +24,14 @@
 
 #include "StaticInit.hpp"
 
+#include <chrono>
+#include <algorithm>
+
 #include "CDPL/Pharm/ControlParameterFunctions.hpp"
 
 #include "CDPL/Chem/ControlParameterFunctions.hpp"
+#include "CDPL/Chem/AtomDictionary.hpp"
+#include "CDPL/Internal/Timer.hpp"
 
 #include "PSDScreeningDBAccessorImpl.hpp"
 #include "SQLScreeningDBMetaData.hpp"
@@ -49,6 +54,23 @@ namespace
         Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " = ?1 AND " +
         Pharm::SQLScreeningDB::MOL_CONF_IDX_COLUMN_NAME + " = ?2;";
 
+    const std::string PHARM_DATA_RANGE_QUERY_SQL = "SELECT " +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + ", " +
+        Pharm::SQLScreeningDB::MOL_CONF_IDX_COLUMN_NAME + ", " +
+        Pharm::SQLScreeningDB::PHARM_DATA_COLUMN_NAME + " FROM " +
+        Pharm::SQLScreeningDB::PHARM_TABLE_NAME + " WHERE " +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " >= ?1 AND " +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " <= ?2;";
+
+    const std::string ATOM_DATA_QUERY_SQL = "SELECT " +
+        Pharm::SQLScreeningDB::ATOM_DATA_COLUMN_NAME + " FROM " +
+        Pharm::SQLScreeningDB::ATOM_DATA_TABLE_NAME + " WHERE " +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " = ?1 AND " +
+        Pharm::SQLScreeningDB::MOL_CONF_IDX_COLUMN_NAME + " = ?2;";
+
+    const std::string ATOM_DATA_TABLE_EXISTS_QUERY_SQL = "SELECT name FROM sqlite_master WHERE type = 'table' AND name = '" +
+        Pharm::SQLScreeningDB::ATOM_DATA_TABLE_NAME + "';";
+
     const std::string MOL_ID_FROM_MOL_TABLE_QUERY_SQL = "SELECT " +
         Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " FROM " +
         Pharm::SQLScreeningDB::MOL_TABLE_NAME + ";";
@@ -64,18 +86,34 @@ namespace
         Pharm::SQLScreeningDB::FTR_TYPE_COLUMN_NAME + ", " +
         Pharm::SQLScreeningDB::FTR_COUNT_COLUMN_NAME + " FROM " +
         Pharm::SQLScreeningDB::FTR_COUNT_TABLE_NAME + ";";
+
+    constexpr std::size_t ATOM_DATA_RECORD_SIZE = 3 * sizeof(float) + sizeof(std::uint32_t);
+
+    enum
+    {
+
+        ATOM_DATA_TABLE_UNKNOWN,
+        ATOM_DATA_TABLE_MISSING,
+        ATOM_DATA_TABLE_PRESENT
+    };
 }
 
 
 Pharm::PSDScreeningDBAccessorImpl::PSDScreeningDBAccessorImpl():
-    pharmReader(controlParams), molReader(controlParams)
+    pharmReader(controlParams), molReader(controlParams), numBytesRead(0), decodingTime(0.0),
+    atomDataTableState(ATOM_DATA_TABLE_UNKNOWN), prefetchNumBytesRead(0), prefetchPharmReader(controlParams)
 {
     initControlParams();
 }
 
 void Pharm::PSDScreeningDBAccessorImpl::open(const std::string& name)
 {
-    openDBConnection(name, SQLITE_OPEN_READONLY);
+    // the connection is shared with the background prefetch task
+
+    openDBConnection(name, SQLITE_OPEN_READONLY | SQLITE_OPEN_FULLMUTEX);
+
+    numBytesRead = 0;
+    decodingTime = 0.0;
 }
 
 void Pharm::PSDScreeningDBAccessorImpl::close()
@@ -151,7 +189,12 @@ void Pharm::PSDScreeningDBAccessorImpl::getMolecule(std::size_t mol_idx, Chem::M
     byteBuffer.setIOPointer(0);
     byteBuffer.putBytes(reinterpret_cast<const char*>(blob), num_bytes);
 
+    Internal::Timer timer;
+
     molReader.readMolecule(mol, byteBuffer);
+
+    numBytesRead += num_bytes;
+    decodingTime += std::chrono::duration_cast<std::chrono::duration<double> >(timer.elapsed()).count();
 }
 
 void Pharm::PSDScreeningDBAccessorImpl::getPharmacophore(std::size_t pharm_idx, Pharmacophore& pharm)
@@ -164,6 +207,9 @@ void Pharm::PSDScreeningDBAccessorImpl::getPharmacophore(std::size_t pharm_idx,
     if (pharm_idx >= pharmIdxToMolIDConfIdxMap.size())
         throw Base::IndexError("PSDScreeningDBAccessorImpl: pharmacophore index out of bounds");
 
+    if (getPrefetchedPharmacophore(pharm_idx, pharm))
+        return;
+
     loadPharmacophore(pharmIdxToMolIDConfIdxMap[pharm_idx].first, pharmIdxToMolIDConfIdxMap[pharm_idx].second, pharm);
 } 
 
@@ -250,6 +296,101 @@ const Pharm::FeatureTypeHistogram& Pharm::PSDScreeningDBAccessorImpl::getFeature
     return featureCounts[pharm_idx];
 }
 
+void Pharm::PSDScreeningDBAccessorImpl::prefetchPharmacophores(const Util::STArray& pharm_indices)
+{
+    if (!getDBConnection())
+        throw Base::IOError("PSDScreeningDBAccessorImpl: no open database connection");
+
+    initPharmIdxMolIDConfIdxMappings();
+
+    // make the results of the previous request available before its buffers get reused
+
+    finishPrefetch();
+
+    if (pharm_indices.isEmpty())
+        return;
+
+    initPrefetchData(pharm_indices);
+
+    if (prefetchPharmIndices.isEmpty())
+        return;
+
+    prefetchTask = std::async(std::launch::async, &PSDScreeningDBAccessorImpl::loadPrefetchData, this);
+}
+
+bool Pharm::PSDScreeningDBAccessorImpl::getAtomCoordinatesAndRadii(std::size_t pharm_idx, Math::Vector3DArray& coords, Util::DArray& radii)
+{
+    if (!getDBConnection())
+        throw Base::IOError("PSDScreeningDBAccessorImpl: no open database connection");
+
+    initPharmIdxMolIDConfIdxMappings();
+
+    if (pharm_idx >= pharmIdxToMolIDConfIdxMap.size())
+        throw Base::IndexError("PSDScreeningDBAccessorImpl: pharmacophore index out of bounds");
+
+    if (!hasAtomDataTable())
+        return false;
+
+    setupStatement(selAtomDataStmt, ATOM_DATA_QUERY_SQL, true);
+
+    if (sqlite3_bind_int64(selAtomDataStmt.get(), 1, pharmIdxToMolIDConfIdxMap[pharm_idx].first) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while binding atom data molecule id to prepared statement");
+
+    if (sqlite3_bind_int(selAtomDataStmt.get(), 2, pharmIdxToMolIDConfIdxMap[pharm_idx].second) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while binding atom data molecule conformation index to prepared statement");
+
+    int res = sqlite3_step(selAtomDataStmt.get());
+
+    if (res != SQLITE_ROW && res != SQLITE_DONE)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while loading requested atom data");
+
+    if (res != SQLITE_ROW)
+        return false;
+
+    const void* blob = sqlite3_column_blob(selAtomDataStmt.get(), 0);
+    std::size_t num_bytes = sqlite3_column_bytes(selAtomDataStmt.get(), 0);
+
+    if ((num_bytes % ATOM_DATA_RECORD_SIZE) != 0)
+        throw Base::IOError("PSDScreeningDBAccessorImpl: invalid atom data record size");
+
+    byteBuffer.setIOPointer(0);
+    byteBuffer.putBytes(reinterpret_cast<const char*>(blob), num_bytes);
+    byteBuffer.setIOPointer(0);
+
+    std::size_t num_atoms = num_bytes / ATOM_DATA_RECORD_SIZE;
+    float value;
+    std::uint32_t atom_type;
+
+    coords.resize(num_atoms);
+    radii.resize(num_atoms);
+
+    for (std::size_t i = 0; i < num_atoms; i++) {
+        Math::Vector3D& pos = coords[i];
+
+        for (std::size_t j = 0; j < 3; j++) {
+            byteBuffer.getFloat(value);
+            pos[j] = value;
+        }
+
+        byteBuffer.getInt(atom_type);
+        radii[i] = Chem::AtomDictionary::getVdWRadius(atom_type);
+    }
+
+    numBytesRead += num_bytes;
+
+    return true;
+}
+
+std::size_t Pharm::PSDScreeningDBAccessorImpl::getNumBytesRead() const
+{
+    return numBytesRead;
+}
+
+double Pharm::PSDScreeningDBAccessorImpl::getDataDecodingTime() const
+{
+    return decodingTime;
+}
+
 void Pharm::PSDScreeningDBAccessorImpl::loadPharmacophore(std::int64_t mol_id, int mol_conf_idx, Pharmacophore& pharm)
 {
     setupStatement(selPharmDataStmt, PHARM_DATA_QUERY_SQL, true);
@@ -274,9 +415,172 @@ void Pharm::PSDScreeningDBAccessorImpl::loadPharmacophore(std::int64_t mol_id, i
     byteBuffer.setIOPointer(0);
     byteBuffer.putBytes(reinterpret_cast<const char*>(blob), num_bytes);
 
+    Internal::Timer timer;
+
     pharmReader.readPharmacophore(pharm, byteBuffer);
+
+    numBytesRead += num_bytes;
+    decodingTime += std::chrono::duration_cast<std::chrono::duration<double> >(timer.elapsed()).count();
 } 
 
+bool Pharm::PSDScreeningDBAccessorImpl::getPrefetchedPharmacophore(std::size_t pharm_idx, Pharmacophore& pharm)
+{
+    if (prefetchTask.valid() && prefetchPharmIdxToSlotMap.find(pharm_idx) != prefetchPharmIdxToSlotMap.end())
+        finishPrefetch();
+
+    PharmIdxToPharmacophoreMap::const_iterator it = prefetchedPharms.find(pharm_idx);
+
+    if (it == prefetchedPharms.end())
+        return false;
+
+    pharm.append(*it->second);
+    pharm.addProperties(*it->second);
+
+    return true;
+}
+
+void Pharm::PSDScreeningDBAccessorImpl::initPrefetchData(const Util::STArray& pharm_indices)
+{
+    std::int64_t min_mol_id = 0;
+    std::int64_t max_mol_id = 0;
+
+    prefetchPharmIndices.clear();
+    prefetchPharmIdxToSlotMap.clear();
+
+    for (Util::STArray::ConstElementIterator it = pharm_indices.getElementsBegin(), end = pharm_indices.getElementsEnd(); it != end; ++it) {
+        std::size_t pharm_idx = *it;
+
+        if (pharm_idx >= pharmIdxToMolIDConfIdxMap.size())
+            throw Base::IndexError("PSDScreeningDBAccessorImpl: pharmacophore index out of bounds");
+
+        if (!prefetchPharmIdxToSlotMap.insert(UIntToUIntMap::value_type(pharm_idx, prefetchPharmIndices.getSize())).second)
+            continue;
+
+        std::int64_t mol_id = pharmIdxToMolIDConfIdxMap[pharm_idx].first;
+
+        if (prefetchPharmIndices.isEmpty()) {
+            min_mol_id = mol_id;
+            max_mol_id = mol_id;
+
+        } else {
+            min_mol_id = std::min(min_mol_id, mol_id);
+            max_mol_id = std::max(max_mol_id, mol_id);
+        }
+
+        prefetchPharmIndices.addElement(pharm_idx);
+    }
+
+    std::size_t num_pharms = prefetchPharmIndices.getSize();
+
+    if (prefetchDataBuffers.size() < num_pharms)
+        prefetchDataBuffers.resize(num_pharms);
+
+    for (std::size_t i = 0; i < num_pharms; i++)
+        prefetchDataBuffers[i].resize(0);
+
+    setupStatement(selPharmDataRangeStmt, PHARM_DATA_RANGE_QUERY_SQL, true);
+
+    if (sqlite3_bind_int64(selPharmDataRangeStmt.get(), 1, min_mol_id) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while binding minimum pharmacophore molecule id to prepared statement");
+
+    if (sqlite3_bind_int64(selPharmDataRangeStmt.get(), 2, max_mol_id) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while binding maximum pharmacophore molecule id to prepared statement");
+
+    prefetchPharms.resize(num_pharms);
+    prefetchNumBytesRead = 0;
+}
+
+// executed by the background prefetch task; must only access selPharmDataRangeStmt, the (read-only) pharmacophore
+// index mappings, prefetchPharmIndices, prefetchPharmIdxToSlotMap, prefetchDataBuffers, prefetchPharms,
+// prefetchNumBytesRead and prefetchPharmReader
+
+double Pharm::PSDScreeningDBAccessorImpl::loadPrefetchData()
+{
+    int res;
+
+    while ((res = sqlite3_step(selPharmDataRangeStmt.get())) == SQLITE_ROW) {
+        sqlite3_int64 mol_id = sqlite3_column_int64(selPharmDataRangeStmt.get(), 0);
+        int conf_idx = sqlite3_column_int(selPharmDataRangeStmt.get(), 1);
+
+        MolIDConfIdxToPharmIdxMap::const_iterator pharm_idx_it = molIDConfIdxToPharmIdxMap.find(MolIDConfIdxPair(mol_id, conf_idx));
+
+        if (pharm_idx_it == molIDConfIdxToPharmIdxMap.end())
+            continue;
+
+        UIntToUIntMap::const_iterator slot_it = prefetchPharmIdxToSlotMap.find(pharm_idx_it->second);
+
+        if (slot_it == prefetchPharmIdxToSlotMap.end())
+            continue;
+
+        const void* blob = sqlite3_column_blob(selPharmDataRangeStmt.get(), 2);
+        std::size_t num_bytes = sqlite3_column_bytes(selPharmDataRangeStmt.get(), 2);
+        Internal::ByteBuffer& buffer = prefetchDataBuffers[slot_it->second];
+
+        buffer.setIOPointer(0);
+        buffer.putBytes(reinterpret_cast<const char*>(blob), num_bytes);
+
+        prefetchNumBytesRead += num_bytes;
+    }
+
+    if (res != SQLITE_DONE)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while loading pharmacophore data");
+
+    Internal::Timer timer;
+
+    for (std::size_t i = 0, num_pharms = prefetchPharmIndices.getSize(); i < num_pharms; i++) {
+        if (prefetchDataBuffers[i].getSize() == 0) {
+            prefetchPharms[i].reset();
+            continue;
+        }
+
+        prefetchPharms[i].reset(new BasicPharmacophore());
+        prefetchPharmReader.readPharmacophore(*prefetchPharms[i], prefetchDataBuffers[i]);
+    }
+
+    return std::chrono::duration_cast<std::chrono::duration<double> >(timer.elapsed()).count();
+}
+
+void Pharm::PSDScreeningDBAccessorImpl::finishPrefetch()
+{
+    if (!prefetchTask.valid())
+        return;
+
+    try {
+        decodingTime += prefetchTask.get();
+        numBytesRead += prefetchNumBytesRead;
+
+    } catch (...) {
+        clearPrefetchData();
+        throw;
+    }
+
+    prefetchedPharms.clear();
+
+    for (std::size_t i = 0, num_pharms = prefetchPharmIndices.getSize(); i < num_pharms; i++) {
+        if (!prefetchPharms[i])
+            continue;
+
+        prefetchedPharms[prefetchPharmIndices[i]] = prefetchPharms[i];
+        prefetchPharms[i].reset();
+    }
+
+    prefetchPharmIndices.clear();
+    prefetchPharmIdxToSlotMap.clear();
+}
+
+void Pharm::PSDScreeningDBAccessorImpl::clearPrefetchData()
+{
+    if (prefetchTask.valid())
+        prefetchTask.wait();
+
+    prefetchTask = std::future<double>();
+
+    prefetchPharmIndices.clear();
+    prefetchPharmIdxToSlotMap.clear();
+    prefetchPharms.clear();
+    prefetchedPharms.clear();
+}
+
 void Pharm::PSDScreeningDBAccessorImpl::initControlParams()
 {
     Pharm::setStrictErrorCheckingParameter(controlParams, true);
@@ -285,14 +589,20 @@ void Pharm::PSDScreeningDBAccessorImpl::initControlParams()
 
 void Pharm::PSDScreeningDBAccessorImpl::closeDBConnection()
 {
+    clearPrefetchData();
+
     selMolDataStmt.reset();
     selPharmDataStmt.reset();
+    selPharmDataRangeStmt.reset();
     selMolIDStmt.reset();
     selMolIDConfIdxStmt.reset();
     selFtrCountsStmt.reset();
+    selAtomDataStmt.reset();
 
     SQLiteDataIOBase::closeDBConnection();
 
+    atomDataTableState = ATOM_DATA_TABLE_UNKNOWN;
+
     featureCounts.clear();
     molIdxToIDMap.clear();
     molIDToIdxMap.clear();
@@ -301,6 +611,25 @@ void Pharm::PSDScreeningDBAccessorImpl::closeDBConnection()
     molIDConfIdxToPharmIdxMap.clear();
 }
 
+bool Pharm::PSDScreeningDBAccessorImpl::hasAtomDataTable()
+{
+    if (atomDataTableState != ATOM_DATA_TABLE_UNKNOWN)
+        return (atomDataTableState == ATOM_DATA_TABLE_PRESENT);
+
+    SQLite3StmtPointer stmt_ptr;
+
+    setupStatement(stmt_ptr, ATOM_DATA_TABLE_EXISTS_QUERY_SQL, false);
+
+    int res = sqlite3_step(stmt_ptr.get());
+
+    if (res != SQLITE_ROW && res != SQLITE_DONE)
+        throwSQLiteIOError("PSDScreeningDBAccessorImpl: error while checking for atom data table");
+
+    atomDataTableState = (res == SQLITE_ROW ? ATOM_DATA_TABLE_PRESENT : ATOM_DATA_TABLE_MISSING);
+
+    return (atomDataTableState == ATOM_DATA_TABLE_PRESENT);
+}
+
 void Pharm::PSDScreeningDBAccessorImpl::initMolIdxIDMappings()
 {
     if (!molIdxToIDMap.empty())
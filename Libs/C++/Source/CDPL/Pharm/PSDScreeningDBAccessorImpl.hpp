@@ -28,6 +28,7 @@
 #include <vector>
 #include <utility>
 #include <unordered_map>
+#include <future>
 #include <cstdint>
 #include <cstddef>
 
@@ -36,8 +37,11 @@
 #include "CDPL/Pharm/SQLiteDataIOBase.hpp"
 #include "CDPL/Pharm/FeatureTypeHistogram.hpp"
 #include "CDPL/Pharm/CDFPharmacophoreDataReader.hpp"
+#include "CDPL/Pharm/BasicPharmacophore.hpp"
 #include "CDPL/Chem/CDFDataReader.hpp"
 #include "CDPL/Base/ControlParameterList.hpp"
+#include "CDPL/Util/Array.hpp"
+#include "CDPL/Math/VectorArray.hpp"
 #include "CDPL/Internal/ByteBuffer.hpp"
 
 
@@ -85,6 +89,14 @@ namespace CDPL
 
             const FeatureTypeHistogram& getFeatureCounts(std::size_t mol_idx, std::size_t mol_conf_idx);
 
+            void prefetchPharmacophores(const Util::STArray& pharm_indices);
+
+            bool getAtomCoordinatesAndRadii(std::size_t pharm_idx, Math::Vector3DArray& coords, Util::DArray& radii);
+
+            std::size_t getNumBytesRead() const;
+
+            double getDataDecodingTime() const;
+
           private:
             void initControlParams();
 
@@ -92,6 +104,14 @@ namespace CDPL
 
             void loadPharmacophore(std::int64_t mol_id, int conf_idx, Pharmacophore& pharm);
 
+            bool getPrefetchedPharmacophore(std::size_t pharm_idx, Pharmacophore& pharm);
+            void initPrefetchData(const Util::STArray& pharm_indices);
+            double loadPrefetchData();
+            void finishPrefetch();
+            void clearPrefetchData();
+
+            bool hasAtomDataTable();
+
             void initMolIdxIDMappings();
             void initPharmIdxMolIDConfIdxMappings();
             void loadFeatureCounts();
@@ -102,12 +122,18 @@ namespace CDPL
             typedef std::vector<MolIDConfIdxPair>                                                     MolIDConfIdxPairArray;
             typedef std::unordered_map<std::int64_t, std::size_t>                                     MolIDToUIntMap;
             typedef std::unordered_map<MolIDConfIdxPair, std::size_t, boost::hash<MolIDConfIdxPair> > MolIDConfIdxToPharmIdxMap;
+            typedef std::unordered_map<std::size_t, std::size_t>                                      UIntToUIntMap;
+            typedef std::unordered_map<std::size_t, BasicPharmacophore::SharedPointer>                PharmIdxToPharmacophoreMap;
+            typedef std::vector<BasicPharmacophore::SharedPointer>                                    PharmacophoreArray;
+            typedef std::vector<Internal::ByteBuffer>                                                 ByteBufferArray;
 
             SQLite3StmtPointer         selMolDataStmt;
             SQLite3StmtPointer         selPharmDataStmt;
+            SQLite3StmtPointer         selPharmDataRangeStmt;
             SQLite3StmtPointer         selMolIDStmt;
             SQLite3StmtPointer         selMolIDConfIdxStmt;
             SQLite3StmtPointer         selFtrCountsStmt;
+            SQLite3StmtPointer         selAtomDataStmt;
             FeatureCountsArray         featureCounts;
             MolIDArray                 molIdxToIDMap;
             MolIDToUIntMap             molIDToIdxMap;
@@ -118,6 +144,17 @@ namespace CDPL
             Base::ControlParameterList controlParams;
             CDFPharmacophoreDataReader pharmReader;
             Chem::CDFDataReader        molReader;
+            std::size_t                numBytesRead;
+            double                     decodingTime;
+            int                        atomDataTableState;
+            Util::STArray              prefetchPharmIndices;
+            UIntToUIntMap              prefetchPharmIdxToSlotMap;
+            ByteBufferArray            prefetchDataBuffers;
+            PharmacophoreArray         prefetchPharms;
+            PharmIdxToPharmacophoreMap prefetchedPharms;
+            std::size_t                prefetchNumBytesRead;
+            CDFPharmacophoreDataReader prefetchPharmReader;
+            std::future<double>        prefetchTask;
         };
     } // namespace Pharm
 } // namespace CDPL
@@ -35,6 +35,7 @@
 #include "CDPL/Chem/MolecularGraphFunctions.hpp"
 #include "CDPL/Chem/AtomContainerFunctions.hpp"
 #include "CDPL/Chem/AtomArray3DCoordinatesFunctor.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
 #include "CDPL/Base/Exceptions.hpp"
 
 #include "PSDScreeningDBCreatorImpl.hpp"
@@ -77,15 +78,28 @@ namespace
     const std::string DROP_FTR_COUNT_TABLE_SQL = "DROP TABLE IF EXISTS " + 
         Pharm::SQLScreeningDB::FTR_COUNT_TABLE_NAME + ";";
 
+    const std::string CREATE_ATOM_DATA_TABLE_SQL = "CREATE TABLE IF NOT EXISTS " + 
+        Pharm::SQLScreeningDB::ATOM_DATA_TABLE_NAME + "(" + 
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " INTEGER, " + 
+        Pharm::SQLScreeningDB::MOL_CONF_IDX_COLUMN_NAME + " INTEGER, " + 
+        Pharm::SQLScreeningDB::ATOM_DATA_COLUMN_NAME + " BLOB, PRIMARY KEY(" +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + ", " +
+        Pharm::SQLScreeningDB::MOL_CONF_IDX_COLUMN_NAME + "));";
+
+    const std::string DROP_ATOM_DATA_TABLE_SQL = "DROP TABLE IF EXISTS " + 
+        Pharm::SQLScreeningDB::ATOM_DATA_TABLE_NAME + ";";
+
     const std::string CREATE_TABLES_SQL = 
         CREATE_MOL_TABLE_SQL +
         CREATE_PHARM_TABLE_SQL +
-        CREATE_FTR_COUNT_TABLE_SQL;
+        CREATE_FTR_COUNT_TABLE_SQL +
+        CREATE_ATOM_DATA_TABLE_SQL;
     
     const std::string DROP_TABLES_SQL = 
         DROP_MOL_TABLE_SQL +
         DROP_PHARM_TABLE_SQL +
-        DROP_FTR_COUNT_TABLE_SQL;
+        DROP_FTR_COUNT_TABLE_SQL +
+        DROP_ATOM_DATA_TABLE_SQL;
 
     const std::string MOL_ID_AND_HASH_QUERY_SQL = "SELECT " +
         Pharm::SQLScreeningDB::MOL_HASH_COLUMN_NAME + ", " +
@@ -104,6 +118,10 @@ namespace
         Pharm::SQLScreeningDB::FTR_COUNT_TABLE_NAME + " WHERE " +
         Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " = ?1;";
 
+    const std::string DELETE_ATOM_DATA_WITH_MOL_ID_SQL = "DELETE FROM " +
+        Pharm::SQLScreeningDB::ATOM_DATA_TABLE_NAME + " WHERE " +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + " = ?1;";
+
     const std::string INSERT_MOL_DATA_SQL = "INSERT INTO " +
         Pharm::SQLScreeningDB::MOL_TABLE_NAME + "(" +
         Pharm::SQLScreeningDB::MOL_HASH_COLUMN_NAME + ", " +
@@ -122,6 +140,12 @@ namespace
         Pharm::SQLScreeningDB::FTR_TYPE_COLUMN_NAME + ", " +
         Pharm::SQLScreeningDB::FTR_COUNT_COLUMN_NAME + ") VALUES (?1, ?2, ?3, ?4);";
 
+    const std::string INSERT_ATOM_DATA_SQL = "INSERT INTO " +
+        Pharm::SQLScreeningDB::ATOM_DATA_TABLE_NAME + "(" +
+        Pharm::SQLScreeningDB::MOL_ID_COLUMN_NAME + ", " +
+        Pharm::SQLScreeningDB::MOL_CONF_IDX_COLUMN_NAME + ", " +
+        Pharm::SQLScreeningDB::ATOM_DATA_COLUMN_NAME + ") VALUES (?1, ?2, ?3);";
+
     const std::string BEGIN_TRANSACTION_SQL    = "BEGIN TRANSACTION;";
     const std::string COMMIT_TRANSACTION_SQL   = "COMMIT TRANSACTION;";
     const std::string ROLLBACK_TRANSACTION_SQL = "ROLLBACK TRANSACTION;";
@@ -197,9 +221,11 @@ void Pharm::PSDScreeningDBCreatorImpl::closeDBConnection()
     insMoleculeStmt.reset();
     insPharmStmt.reset();
     insFtrCountStmt.reset();
+    insAtomDataStmt.reset();
     delMolWithMolIDStmt.reset();
     delPharmsWithMolIDStmt.reset();
     delFeatureCountsWithMolIDStmt.reset();
+    delAtomDataWithMolIDStmt.reset();
     delTwoPointPharmsWithMolIDStmt.reset();
     delThreePointPharmsWithMolIDStmt.reset();
 
@@ -301,7 +327,7 @@ bool  Pharm::PSDScreeningDBCreatorImpl::merge(const ScreeningDBAccessor& db_acc,
 
         db_acc.getMolecule(i, mol);
 
-        calcCIPPriorities(mol, false);
+        prepareMolecularGraph(mol, Chem::PerceptionFlag::CIP_PRIORITIES, false);
         numProcessed++;
 
         std::uint64_t mol_hash = hashCalculator.calculate(mol);
@@ -328,6 +354,7 @@ bool  Pharm::PSDScreeningDBCreatorImpl::merge(const ScreeningDBAccessor& db_acc,
 
         std::int64_t mol_id = insertMolecule(mol, mol_hash);
         std::size_t num_pharms = db_acc.getNumPharmacophores(i);
+        std::size_t num_confs = getNumConformations(mol);
 
         for (std::size_t j = 0; j < num_pharms; j++) {
             pharmacophore.clear();
@@ -337,6 +364,19 @@ bool  Pharm::PSDScreeningDBCreatorImpl::merge(const ScreeningDBAccessor& db_acc,
 
             insertPharmacophore(mol_id, j);
             insertFtrCounts(mol_id, j);
+
+            if (j < num_confs) {
+                coordinates.clear();
+                getConformation(mol, j, coordinates);
+
+                insertAtomData(mol, mol_id, j);
+
+            } else if (num_confs == 0 && j == 0 && hasCoordinates(mol, 3)) {
+                coordinates.clear();
+                get3DCoordinates(mol, coordinates);
+
+                insertAtomData(mol, mol_id, j);
+            }
         }
 
         commitTransaction();
@@ -422,6 +462,7 @@ std::size_t Pharm::PSDScreeningDBCreatorImpl::deleteEntries(std::uint64_t mol_ha
         deleteRowsWithMolID(delMolWithMolIDStmt, DELETE_MOL_WITH_MOL_ID_SQL, mol_id);
         deleteRowsWithMolID(delPharmsWithMolIDStmt, DELETE_PHARMS_WITH_MOL_ID_SQL, mol_id);
         deleteRowsWithMolID(delFeatureCountsWithMolIDStmt, DELETE_FTR_COUNTS_WITH_MOL_ID_SQL, mol_id);
+        deleteRowsWithMolID(delAtomDataWithMolIDStmt, DELETE_ATOM_DATA_WITH_MOL_ID_SQL, mol_id);
     }
 
     return num_del;
@@ -478,6 +519,7 @@ void Pharm::PSDScreeningDBCreatorImpl::genAndInsertPharmData(const Chem::Molecul
     insertPharmacophore(mol_id, conf_idx);
     genFtrCounts();
     insertFtrCounts(mol_id, conf_idx);
+    insertAtomData(molgraph, mol_id, conf_idx);
 }
 
 void Pharm::PSDScreeningDBCreatorImpl::insertPharmacophore(std::int64_t mol_id, std::size_t conf_idx)
@@ -499,6 +541,41 @@ void Pharm::PSDScreeningDBCreatorImpl::insertPharmacophore(std::int64_t mol_id,
     evalStatement(insPharmStmt);
 }
 
+void Pharm::PSDScreeningDBCreatorImpl::insertAtomData(const Chem::MolecularGraph& molgraph, std::int64_t mol_id, std::size_t conf_idx)
+{
+    // the atom coordinates of the current conformation and the atom types are stored as consecutive
+    // (x, y, z, type) records; the coordinates get rounded to single precision exactly as in the
+    // molecule record so that clash tests on these data yield identical results
+
+    std::size_t num_atoms = molgraph.getNumAtoms();
+
+    byteBuffer.resize(0);
+    byteBuffer.setIOPointer(0);
+
+    for (std::size_t i = 0; i < num_atoms; i++) {
+        const Math::Vector3D& pos = coordinates[i];
+
+        byteBuffer.putFloat(float(pos[0]));
+        byteBuffer.putFloat(float(pos[1]));
+        byteBuffer.putFloat(float(pos[2]));
+        byteBuffer.putInt(std::uint32_t(getType(molgraph.getAtom(i))), false);
+    }
+
+    setupStatement(insAtomDataStmt, INSERT_ATOM_DATA_SQL, true);
+
+    if (sqlite3_bind_int64(insAtomDataStmt.get(), 1, mol_id) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBCreatorImpl: error while binding atom data molecule ID to prepared statement");
+
+    if (sqlite3_bind_int(insAtomDataStmt.get(), 2, boost::numeric_cast<int>(conf_idx)) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBCreatorImpl: error while binding atom data conf. index to prepared statement");
+
+    if (sqlite3_bind_blob(insAtomDataStmt.get(), 3, byteBuffer.getData(), boost::numeric_cast<int>(byteBuffer.getSize()),
+                          SQLITE_TRANSIENT) != SQLITE_OK)
+        throwSQLiteIOError("PSDScreeningDBCreatorImpl: error while binding atom data BLOB to prepared statement");
+
+    evalStatement(insAtomDataStmt);
+}
+
 void Pharm::PSDScreeningDBCreatorImpl::genFtrCounts()
 {
     featureCounts.clear();
@@ -101,6 +101,8 @@ namespace CDPL
 
             void insertPharmacophore(std::int64_t mol_id, std::size_t conf_idx);
 
+            void insertAtomData(const Chem::MolecularGraph& molgraph, std::int64_t mol_id, std::size_t conf_idx);
+
             void genFtrCounts();
             void insertFtrCounts(std::int64_t mol_id, std::size_t conf_idx);
             void insertFtrCount(std::int64_t mol_id, std::size_t conf_idx, unsigned int ftr_type, std::size_t ftr_count);
@@ -118,9 +120,11 @@ namespace CDPL
             SQLite3StmtPointer            insMoleculeStmt;
             SQLite3StmtPointer            insPharmStmt;
             SQLite3StmtPointer            insFtrCountStmt;
+            SQLite3StmtPointer            insAtomDataStmt;
             SQLite3StmtPointer            delMolWithMolIDStmt;
             SQLite3StmtPointer            delPharmsWithMolIDStmt;
             SQLite3StmtPointer            delFeatureCountsWithMolIDStmt;
+            SQLite3StmtPointer            delAtomDataWithMolIDStmt;
             SQLite3StmtPointer            delTwoPointPharmsWithMolIDStmt;
             SQLite3StmtPointer            delThreePointPharmsWithMolIDStmt;
             MolHashToIDMap                molHashToIDMap;
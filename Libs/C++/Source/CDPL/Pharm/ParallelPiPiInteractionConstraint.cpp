@@ -65,6 +65,11 @@ double Pharm::ParallelPiPiInteractionConstraint::getMaxAngle() const
     return maxAngle;
 }
 
+double Pharm::ParallelPiPiInteractionConstraint::getMaxFeatureDistance() const
+{
+    return std::sqrt(maxHDist * maxHDist + maxVDist * maxVDist);
+}
+
 bool Pharm::ParallelPiPiInteractionConstraint::operator()(const Feature& ftr1, const Feature& ftr2) const
 {
     Math::Vector3D ftr1_ftr2_vec(get3DCoordinates(ftr2) - get3DCoordinates(ftr1));
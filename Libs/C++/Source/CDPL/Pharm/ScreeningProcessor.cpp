@@ -37,9 +37,9 @@ using namespace CDPL;
 Pharm::ScreeningProcessor::SearchHit::SearchHit(const ScreeningProcessor& hit_prov, const FeatureContainer& qry_pharm,
                                                 const FeatureContainer& hit_pharm, const Chem::Molecule& mol, 
                                                 const Math::Matrix4D& xform, std::size_t pharm_idx, 
-                                                std::size_t mol_idx, std::size_t conf_idx):
+                                                std::size_t mol_idx, std::size_t conf_idx, std::size_t qry_pharm_idx):
     provider(&hit_prov), qryPharm(&qry_pharm), hitPharm(&hit_pharm), molecule(&mol),
-    almntTransform(&xform), pharmIndex(pharm_idx), molIndex(mol_idx), confIndex(conf_idx) {}
+    almntTransform(&xform), pharmIndex(pharm_idx), molIndex(mol_idx), confIndex(conf_idx), qryPharmIndex(qry_pharm_idx) {}
 
 const Pharm::ScreeningProcessor& Pharm::ScreeningProcessor::SearchHit::getHitProvider() const
 {
@@ -81,6 +81,11 @@ std::size_t Pharm::ScreeningProcessor::SearchHit::getHitConformationIndex() cons
     return confIndex;
 }
 
+std::size_t Pharm::ScreeningProcessor::SearchHit::getQueryPharmacophoreIndex() const
+{
+    return qryPharmIndex;
+}
+
 
 // ScreeningProcessor
 
@@ -174,3 +179,13 @@ std::size_t Pharm::ScreeningProcessor::searchDB(const FeatureContainer& query, s
 {
     return impl->searchDB(query, mol_start_idx, mol_end_idx);
 }
+
+std::size_t Pharm::ScreeningProcessor::searchDB(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, std::size_t mol_end_idx)
+{
+    return impl->searchDB(queries, mol_start_idx, mol_end_idx);
+}
+
+const Pharm::ScreeningProcessorStatistics& Pharm::ScreeningProcessor::getStatistics() const
+{
+    return impl->getStatistics();
+}
@@ -30,6 +30,7 @@
 #include <iterator>
 #include <cassert>
 #include <functional>
+#include <chrono>
 
 #include "CDPL/Pharm/ScreeningDBAccessor.hpp"
 #include "CDPL/Pharm/Feature.hpp"
@@ -44,6 +45,8 @@
 #include "CDPL/Chem/AtomDictionary.hpp"
 #include "CDPL/Math/VectorArrayFunctions.hpp"
 #include "CDPL/Math/VectorAdapter.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+#include "CDPL/Internal/Timer.hpp"
 
 #include "ScreeningProcessorImpl.hpp"
 
@@ -57,6 +60,17 @@ namespace
     constexpr double NAN_SCORE         = std::numeric_limits<double>::quiet_NaN();
     constexpr double VDW_RADIUS_FACTOR = 0.5;
 
+    constexpr std::size_t PREFETCH_CHUNK_SIZE = 256;
+
+    constexpr double      XVOL_GRID_STEP_SIZE       = 0.5;
+    constexpr double      XVOL_GRID_MAX_ATOM_RADIUS = 1.5;
+    constexpr std::size_t XVOL_GRID_MAX_NUM_CELLS   = 1 << 21;
+
+    inline double getElapsedSeconds(const Internal::Timer& timer)
+    {
+        return std::chrono::duration_cast<std::chrono::duration<double> >(timer.elapsed()).count();
+    }
+
     struct FeatureTolCmpFunc
     {
 
@@ -70,7 +84,8 @@ namespace
 Pharm::ScreeningProcessorImpl::ScreeningProcessorImpl(ScreeningProcessor& parent, ScreeningDBAccessor& db_acc): 
     parent(&parent), dbAccessor(&db_acc), reportMode(ScreeningProcessor::FIRST_MATCHING_CONF), maxOmittedFeatures(0),
     checkXVolumes(true), bestAlignments(false), hitCallback(), progressCallback(), 
-    scoringFunction(PharmacophoreFitScreeningScore()), featureGeomMatchFunction(), pharmAlignment(true)
+    scoringFunction(PharmacophoreFitScreeningScore()), featureGeomMatchFunction(), singleQuery(1), numQueries(0),
+    currQuery(0), alignedQuery(0), pharmAlignment(true), initDB2PointPharmSet(true)
 {
     using namespace std::placeholders;
     
@@ -161,44 +176,87 @@ const Pharm::ScreeningProcessor::ScoringFunction& Pharm::ScreeningProcessorImpl:
     return scoringFunction;
 }
 
+const Pharm::ScreeningProcessorStatistics& Pharm::ScreeningProcessorImpl::getStatistics() const
+{
+    return statistics;
+}
+
 std::size_t Pharm::ScreeningProcessorImpl::searchDB(const FeatureContainer& query, std::size_t mol_start_idx, 
                                                     std::size_t mol_end_idx)
 {
-    prepareDBSearch(query, mol_start_idx, mol_end_idx);
+    singleQuery[0] = &query;
+
+    return searchDB(singleQuery, mol_start_idx, mol_end_idx);
+}
+
+std::size_t Pharm::ScreeningProcessorImpl::searchDB(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, 
+                                                    std::size_t mol_end_idx)
+{
+    Internal::Timer timer;
+    std::size_t num_bytes_read = dbAccessor->getNumBytesRead();
+    double decoding_time = dbAccessor->getDataDecodingTime();
+
+    statistics.clear();
+
+    std::size_t num_hits = doSearchDB(queries, mol_start_idx, mol_end_idx);
+
+    statistics.setCounter(ScreeningProcessorStatistics::NUM_HITS, num_hits);
+    statistics.setCounter(ScreeningProcessorStatistics::NUM_BYTES_READ, dbAccessor->getNumBytesRead() - num_bytes_read);
+    statistics.setDataDecodingTime(dbAccessor->getDataDecodingTime() - decoding_time);
+    statistics.setTotalTime(getElapsedSeconds(timer));
+
+    return num_hits;
+}
+
+std::size_t Pharm::ScreeningProcessorImpl::doSearchDB(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, 
+                                                      std::size_t mol_end_idx)
+{
+    prepareDBSearch(queries, mol_start_idx, mol_end_idx);
 
     std::size_t num_pharm_entries = pharmIndices.size();
 
+    statistics.setCounter(ScreeningProcessorStatistics::NUM_SCREENED_PHARMACOPHORES, num_pharm_entries);
+
+    // the pharmacophores of the next chunk get loaded by the DB accessor (if supported) while the
+    // current chunk is processed
+
+    prefetchPharmacophores(0);
+
     for (std::size_t i = 0; i <= num_pharm_entries; i++) {
         if (progressCallback && !progressCallback(i, num_pharm_entries))
             return numHits;
 
-        if (reportMode == ScreeningProcessor::BEST_MATCHING_CONF && !std::isnan(bestConfAlmntScore) &&
-            (i == num_pharm_entries || pharmIndices[i].second != bestConfAlmntMolIdx)) {
-            
-            if (!reportHit(SearchHit(*parent, query, dbPharmacophore, dbMolecule, bestConfAlmntTransform,
-                                     bestConfAlmntPharmIdx, bestConfAlmntMolIdx, bestConfAlmntConfIdx),
-                           bestConfAlmntScore))
-                return numHits;
-        }
+        if (i % PREFETCH_CHUNK_SIZE == 0)
+            prefetchPharmacophores(i + PREFETCH_CHUNK_SIZE);
+
+        if (reportMode == ScreeningProcessor::BEST_MATCHING_CONF && !reportBestConfHits(i))
+            return numHits;
 
         if (i == num_pharm_entries)
             continue;
 
         std::size_t mol_idx = pharmIndices[i].second;
+        std::size_t pharm_idx = pharmIndices[i].first;
 
-        if (reportMode == ScreeningProcessor::FIRST_MATCHING_CONF && molHitSet.test(mol_idx)) 
-            continue;
+        // the loaded database pharmacophore and the data derived from it are shared by all queries
 
-        std::size_t pharm_idx = pharmIndices[i].first;
+        for (std::size_t j = 0; j < numQueries; j++) {
+            currQuery = &queryData[j];
 
-        if (!checkFeatureCounts(pharm_idx))
-            continue;
+            if (reportMode == ScreeningProcessor::FIRST_MATCHING_CONF && currQuery->molHitSet.test(mol_idx)) {
+                statistics.increaseCounter(ScreeningProcessorStatistics::NUM_SKIPPED_PHARMACOPHORES);
+                continue;
+            }
 
-        if (!check2PointPharmacophores(pharm_idx))
-            continue;
+            if (!checkFeatureCounts(pharm_idx))
+                continue;
 
-        if (!performAlignment(pharm_idx, mol_idx))
-            return numHits;
+            if (!check2PointPharmacophores(pharm_idx))
+                continue;
+
+            if (!performAlignment(pharm_idx, mol_idx))
+                return numHits;
+        }
     }
 
     if (num_pharm_entries == 0 && progressCallback)
@@ -207,44 +265,60 @@ std::size_t Pharm::ScreeningProcessorImpl::searchDB(const FeatureContainer& quer
     return numHits;
 }
 
-void Pharm::ScreeningProcessorImpl::prepareDBSearch(const FeatureContainer& query, std::size_t mol_start_idx, 
+void Pharm::ScreeningProcessorImpl::prepareDBSearch(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, 
                                                     std::size_t mol_end_idx)
 {
-    initQueryData(query);
+    numQueries = queries.size();
+
+    if (queryData.size() < numQueries)
+        queryData.resize(numQueries);
 
     numHits = 0;
     loadedPharmIndex = dbAccessor->getNumPharmacophores();
     loadedMolIndex = dbAccessor->getNumMolecules();
 
-    if (reportMode == ScreeningProcessor::FIRST_MATCHING_CONF) {
-        molHitSet.resize(loadedMolIndex);
-        molHitSet.reset();
+    for (std::size_t i = 0; i < numQueries; i++) {
+        if (!queries[i])
+            throw Base::NullPointerException("ScreeningProcessor: null query pharmacophore");
+
+        QueryData& data = queryData[i];
+
+        initQueryData(*queries[i], i, data);
+
+        if (reportMode == ScreeningProcessor::FIRST_MATCHING_CONF) {
+            data.molHitSet.resize(loadedMolIndex);
+            data.molHitSet.reset();
 
-    } else if (reportMode == ScreeningProcessor::BEST_MATCHING_CONF)
-        bestConfAlmntScore = NAN_SCORE;
+        } else if (reportMode == ScreeningProcessor::BEST_MATCHING_CONF)
+            data.bestConfAlmntScore = NAN_SCORE;
+    }
+
+    currQuery = (numQueries > 0 ? &queryData[0] : static_cast<QueryData*>(0));
+    alignedQuery = 0;
 
     initPharmIndexList(mol_start_idx, mol_end_idx);
 }
 
-void Pharm::ScreeningProcessorImpl::initQueryData(const FeatureContainer& query)
+void Pharm::ScreeningProcessorImpl::initQueryData(const FeatureContainer& query, std::size_t query_idx, QueryData& data)
 {
-    queryPharmacophore = &query;
+    data.pharmacophore = &query;
+    data.index = query_idx;
 
-    queryMandFeatures.clear();
-    queryMandFeatureTypes.clear();
-    queryOptFeatures.clear();
-    alignedQueryMandFeatures.clear();
-    queryFeatureCounts.clear();
-    queryFeatureTolerances.clear();
-    queryFeaturePositions.clear();
-    pharmAlignment.clearEntities(true);
-    xVolumeIndices.clear();
+    data.mandFeatures.clear();
+    data.mandFeatureTypes.clear();
+    data.optFeatures.clear();
+    data.alignedMandFeatures.clear();
+    data.alignedOptFeatures.clear();
+    data.featureCounts.clear();
+    data.featureTolerances.clear();
+    data.featurePositions.clear();
+    data.xVolumeIndices.clear();
 
     for (FeatureContainer::ConstFeatureIterator it = query.getFeaturesBegin(), end = query.getFeaturesEnd(); it != end; ++it) {
         const Feature& ftr = *it;
 
-        queryFeatureTolerances.push_back(getTolerance(ftr));
-        queryFeaturePositions.addElement(get3DCoordinates(ftr));
+        data.featureTolerances.push_back(getTolerance(ftr));
+        data.featurePositions.addElement(get3DCoordinates(ftr));
 
         if (getDisabledFlag(ftr))
             continue;
@@ -253,47 +327,140 @@ void Pharm::ScreeningProcessorImpl::initQueryData(const FeatureContainer& query)
             if (getOptionalFlag(ftr))
                 continue;
 
-            xVolumeIndices.push_back(ftr.getIndex());
+            data.xVolumeIndices.push_back(ftr.getIndex());
             continue;
         }
 
         if (getOptionalFlag(ftr))
-            insertFeature(ftr, queryOptFeatures);
+            insertFeature(ftr, data.optFeatures);
         else
-            insertFeature(ftr, queryMandFeatures);
+            insertFeature(ftr, data.mandFeatures);
     }
 
-    for (FeatureMatrix::iterator it = queryMandFeatures.begin(), end = queryMandFeatures.end(); it != end; ++it) {
+    for (FeatureMatrix::iterator it = data.mandFeatures.begin(), end = data.mandFeatures.end(); it != end; ++it) {
         FeatureList& ftr_list = *it; assert(!ftr_list.empty());        
         const Feature& max_tol_ftr = **std::max_element(ftr_list.begin(), ftr_list.end(), FeatureTolCmpFunc());
         unsigned int type = getType(max_tol_ftr);
 
-        pharmAlignment.addEntity(max_tol_ftr, true);
-        alignedQueryMandFeatures.push_back(&max_tol_ftr);
-        queryMandFeatureTypes.push_back(type);
-        queryFeatureCounts[type]++;
+        data.alignedMandFeatures.push_back(&max_tol_ftr);
+        data.mandFeatureTypes.push_back(type);
+        data.featureCounts[type]++;
     }
 
-    for (FeatureMatrix::iterator it = queryOptFeatures.begin(), end = queryOptFeatures.end(); it != end; ++it) {
+    for (FeatureMatrix::iterator it = data.optFeatures.begin(), end = data.optFeatures.end(); it != end; ++it) {
         FeatureList& ftr_list = *it; assert(!ftr_list.empty());        
-         const Feature& max_tol_ftr = **std::max_element(ftr_list.begin(), ftr_list.end(), FeatureTolCmpFunc());
+        const Feature& max_tol_ftr = **std::max_element(ftr_list.begin(), ftr_list.end(), FeatureTolCmpFunc());
         
-        pharmAlignment.addEntity(max_tol_ftr, true);
-        alignedQueryOptFeatures.push_back(&max_tol_ftr);
+        data.alignedOptFeatures.push_back(&max_tol_ftr);
     }
 
-    query2PointPharmList.clear();
+    data.twoPointPharms.clear();
+
+    query2PointPharmGen.generate(FeatureListIterator(data.alignedMandFeatures.begin()),
+                                 FeatureListIterator(data.alignedMandFeatures.end()),
+                                 std::back_inserter(data.twoPointPharms));
+
+    data.minNumFeatureMatches = (data.mandFeatures.size() > maxOmittedFeatures ? 
+                                 std::size_t(data.mandFeatures.size() - maxOmittedFeatures) : std::size_t(0));
+
+    data.minNum2PointPharmMatches = (data.minNumFeatureMatches < 2 ? std::size_t(0) : 
+                                     (data.minNumFeatureMatches * (data.minNumFeatureMatches - 1)) / 2);
+
+    initXVolumeGrid(data);
+}
+
+void Pharm::ScreeningProcessorImpl::initXVolumeGrid(QueryData& data) const
+{
+    // Rasterizes the exclusion volumes, enlarged by XVOL_GRID_MAX_ATOM_RADIUS, into a bit grid. An atom with a radius
+    // <= XVOL_GRID_MAX_ATOM_RADIUS that lies in a cell whose bit is not set cannot clash with any exclusion volume.
+
+    data.xVolumeGrid.clear();
+
+    if (data.xVolumeIndices.empty())
+        return;
+
+    double bbox_min[3];
+    double bbox_max[3];
+
+    for (std::size_t i = 0, num_x_vols = data.xVolumeIndices.size(); i < num_x_vols; i++) {
+        std::size_t ftr_idx = data.xVolumeIndices[i];
+        const Math::Vector3D& pos = data.featurePositions[ftr_idx];
+        double radius = data.featureTolerances[ftr_idx] + XVOL_GRID_MAX_ATOM_RADIUS;
+
+        for (std::size_t j = 0; j < 3; j++) {
+            if (i == 0 || (pos[j] - radius) < bbox_min[j])
+                bbox_min[j] = pos[j] - radius;
+
+            if (i == 0 || (pos[j] + radius) > bbox_max[j])
+                bbox_max[j] = pos[j] + radius;
+        }
+    }
+
+    double step_size = XVOL_GRID_STEP_SIZE;
+    std::size_t* grid_size = data.xVolumeGridSize;
+
+    while (true) {
+        for (std::size_t i = 0; i < 3; i++)
+            grid_size[i] = std::max(std::size_t(1), std::size_t(std::ceil((bbox_max[i] - bbox_min[i]) / step_size)));
+
+        if (grid_size[0] * grid_size[1] * grid_size[2] <= XVOL_GRID_MAX_NUM_CELLS)
+            break;
+
+        step_size *= 2.0;
+    }
+
+    for (std::size_t i = 0; i < 3; i++)
+        data.xVolumeGridOrigin[i] = bbox_min[i];
+
+    data.xVolumeGridStepSize = step_size;
+    data.xVolumeGrid.resize(grid_size[0] * grid_size[1] * grid_size[2]);
+
+    std::size_t cell_min[3];
+    std::size_t cell_max[3];
+
+    for (IndexList::const_iterator it = data.xVolumeIndices.begin(), end = data.xVolumeIndices.end(); it != end; ++it) {
+        const Math::Vector3D& pos = data.featurePositions[*it];
+        double radius = data.featureTolerances[*it] + XVOL_GRID_MAX_ATOM_RADIUS;
+        double radius_sqrd = radius * radius;
+
+        for (std::size_t i = 0; i < 3; i++) {
+            cell_min[i] = std::size_t(std::max(0.0, std::floor((pos[i] - radius - bbox_min[i]) / step_size)));
+            cell_max[i] = std::min(grid_size[i] - 1, std::size_t(std::max(0.0, std::floor((pos[i] + radius - bbox_min[i]) / step_size))));
+        }
+
+        for (std::size_t x = cell_min[0]; x <= cell_max[0]; x++) {
+            double dx = std::max(0.0, std::max(bbox_min[0] + x * step_size - pos[0], pos[0] - (bbox_min[0] + (x + 1) * step_size)));
+
+            for (std::size_t y = cell_min[1]; y <= cell_max[1]; y++) {
+                double dy = std::max(0.0, std::max(bbox_min[1] + y * step_size - pos[1], pos[1] - (bbox_min[1] + (y + 1) * step_size)));
+
+                for (std::size_t z = cell_min[2]; z <= cell_max[2]; z++) {
+                    double dz = std::max(0.0, std::max(bbox_min[2] + z * step_size - pos[2], pos[2] - (bbox_min[2] + (z + 1) * step_size)));
+
+                    if ((dx * dx + dy * dy + dz * dz) <= radius_sqrd)
+                        data.xVolumeGrid.set((x * grid_size[1] + y) * grid_size[2] + z);
+                }
+            }
+        }
+    }
+}
+
+void Pharm::ScreeningProcessorImpl::initQueryAlignment()
+{
+    if (alignedQuery == currQuery)
+        return;
+
+    pharmAlignment.clearEntities(true);
 
-    query2PointPharmGen.generate(FeatureListIterator(alignedQueryMandFeatures.begin()),
-                                 FeatureListIterator(alignedQueryMandFeatures.end()),
-                                 std::back_inserter(query2PointPharmList));
+    for (FeatureList::const_iterator it = currQuery->alignedMandFeatures.begin(), end = currQuery->alignedMandFeatures.end(); it != end; ++it)
+        pharmAlignment.addEntity(**it, true);
 
-    std::size_t min_num_ftrs = (queryMandFeatures.size() > maxOmittedFeatures ? 
-                                std::size_t(queryMandFeatures.size() - maxOmittedFeatures) : std::size_t(0));
+    for (FeatureList::const_iterator it = currQuery->alignedOptFeatures.begin(), end = currQuery->alignedOptFeatures.end(); it != end; ++it)
+        pharmAlignment.addEntity(**it, true);
 
-    minNum2PointPharmMatches = (min_num_ftrs < 2 ? std::size_t(0) : (min_num_ftrs * (min_num_ftrs - 1)) / 2);
+    pharmAlignment.setMinTopologicalMappingSize(currQuery->minNumFeatureMatches);
 
-    pharmAlignment.setMinTopologicalMappingSize(min_num_ftrs);
+    alignedQuery = currQuery;
 }
 
 void Pharm::ScreeningProcessorImpl::insertFeature(const Feature& ftr, FeatureMatrix& ftr_mtx) const
@@ -339,7 +506,37 @@ void Pharm::ScreeningProcessorImpl::initPharmIndexList(std::size_t mol_start_idx
     std::sort(pharmIndices.begin(), pharmIndices.end(), IndexPair2ndCmpFunc());
 }
 
-bool Pharm::ScreeningProcessorImpl::checkFeatureCounts(std::size_t pharm_idx) const
+void Pharm::ScreeningProcessorImpl::prefetchPharmacophores(std::size_t list_idx)
+{
+    prefetchPharmIndices.clear();
+
+    for (std::size_t i = list_idx, end = std::min(list_idx + PREFETCH_CHUNK_SIZE, pharmIndices.size()); i < end; i++) {
+        std::size_t pharm_idx = pharmIndices[i].first;
+
+        for (std::size_t j = 0; j < numQueries; j++) {
+            if (matchFeatureCounts(pharm_idx, queryData[j])) {
+                prefetchPharmIndices.addElement(pharm_idx);
+                break;
+            }
+        }
+    }
+
+    if (!prefetchPharmIndices.isEmpty())
+        dbAccessor->prefetchPharmacophores(prefetchPharmIndices);
+}
+
+bool Pharm::ScreeningProcessorImpl::checkFeatureCounts(std::size_t pharm_idx)
+{
+    Internal::Timer timer;
+    bool passed = matchFeatureCounts(pharm_idx, *currQuery);
+
+    statistics.addStageCounts(ScreeningProcessorStatistics::FEATURE_COUNT_FILTER, 1, passed);
+    statistics.addStageTime(ScreeningProcessorStatistics::FEATURE_COUNT_FILTER, getElapsedSeconds(timer));
+
+    return passed;
+}
+
+bool Pharm::ScreeningProcessorImpl::matchFeatureCounts(std::size_t pharm_idx, const QueryData& data) const
 {
     const FeatureTypeHistogram& db_ftr_cnts = dbAccessor->getFeatureCounts(pharm_idx);
     std::size_t num_db_ftrs = 0;
@@ -348,11 +545,11 @@ bool Pharm::ScreeningProcessorImpl::checkFeatureCounts(std::size_t pharm_idx) co
              end = db_ftr_cnts.getEntriesEnd(); it != end; ++it)
         num_db_ftrs += it->second;
     
-    if ((num_db_ftrs + maxOmittedFeatures) < queryMandFeatures.size())
+    if ((num_db_ftrs + maxOmittedFeatures) < data.mandFeatures.size())
         return false;
 
-    for (FeatureTypeHistogram::ConstEntryIterator it = queryFeatureCounts.getEntriesBegin(), 
-             end = queryFeatureCounts.getEntriesEnd(); it != end; ++it) {
+    for (FeatureTypeHistogram::ConstEntryIterator it = data.featureCounts.getEntriesBegin(), 
+             end = data.featureCounts.getEntriesEnd(); it != end; ++it) {
 
         std::size_t db_ftr_cnt = db_ftr_cnts.getValue(it->first, 0);
 
@@ -365,23 +562,40 @@ bool Pharm::ScreeningProcessorImpl::checkFeatureCounts(std::size_t pharm_idx) co
 
 bool Pharm::ScreeningProcessorImpl::check2PointPharmacophores(std::size_t pharm_idx)
 {
-    if (minNum2PointPharmMatches == 0)
+    if (currQuery->minNum2PointPharmMatches == 0)
         return true;
 
     loadPharmacophore(pharm_idx);
 
-    db2PointPharmSet.clear();
-    db2PointPharmGen.generate(dbPharmacophore.getFeaturesBegin(),
-                              dbPharmacophore.getFeaturesEnd(),
-                              std::inserter(db2PointPharmSet, db2PointPharmSet.begin()));
+    Internal::Timer timer;
+    bool passed = match2PointPharmacophores();
+
+    statistics.addStageCounts(ScreeningProcessorStatistics::TWO_POINT_PHARMACOPHORE_FILTER, 1, passed);
+    statistics.addStageTime(ScreeningProcessorStatistics::TWO_POINT_PHARMACOPHORE_FILTER, getElapsedSeconds(timer));
+
+    return passed;
+}
+
+bool Pharm::ScreeningProcessorImpl::match2PointPharmacophores()
+{
+    if (initDB2PointPharmSet) {
+        db2PointPharmSet.clear();
+        db2PointPharmGen.generate(dbPharmacophore.getFeaturesBegin(),
+                                  dbPharmacophore.getFeaturesEnd(),
+                                  std::inserter(db2PointPharmSet, db2PointPharmSet.begin()));
+
+        initDB2PointPharmSet = false;
+    }
 
     typedef std::pair<TwoPointPharmacophoreSet::const_iterator, TwoPointPharmacophoreSet::const_iterator> IterPair;
 
-    std::size_t num_query_2pt_pharms = query2PointPharmList.size();
-    std::size_t max_num_mismatches = num_query_2pt_pharms - minNum2PointPharmMatches;
+    const TwoPointPharmacophoreList& query_2pt_pharms = currQuery->twoPointPharms;
+    std::size_t min_num_matches = currQuery->minNum2PointPharmMatches;
+    std::size_t num_query_2pt_pharms = query_2pt_pharms.size();
+    std::size_t max_num_mismatches = num_query_2pt_pharms - min_num_matches;
 
     for (std::size_t i = 0, num_matches = 0, num_mismatches = 0; i < num_query_2pt_pharms; i++) {
-        const QueryTwoPointPharmacophore& query_2pt_pharm = query2PointPharmList[i];
+        const QueryTwoPointPharmacophore& query_2pt_pharm = query_2pt_pharms[i];
 
         double min_dist = query_2pt_pharm.getFeatureDistance() - query_2pt_pharm.getFeature1Tolerance() 
             - query_2pt_pharm.getFeature2Tolerance();
@@ -400,7 +614,7 @@ bool Pharm::ScreeningProcessorImpl::check2PointPharmacophores(std::size_t pharm_
             if (dist >= min_dist && dist <= max_dist) {
                 num_matches++;
 
-                if (num_matches >= minNum2PointPharmMatches)
+                if (num_matches >= min_num_matches)
                     return true;
 
                 match = true;
@@ -422,24 +636,47 @@ bool Pharm::ScreeningProcessorImpl::check2PointPharmacophores(std::size_t pharm_
 bool Pharm::ScreeningProcessorImpl::performAlignment(std::size_t pharm_idx, std::size_t mol_idx)
 {
     loadPharmacophore(pharm_idx);
+    initQueryAlignment();
 
     pharmAlignment.clearEntities(false);
     pharmAlignment.addFeatures(dbPharmacophore, false);
 
     double best_score = NAN_SCORE;
     std::size_t conf_idx = dbAccessor->getConformationIndex(pharm_idx);
+    Internal::Timer timer;
 
     while (pharmAlignment.nextAlignment()) {
-        if (!checkGeomAlignment())
+        statistics.addStageTime(ScreeningProcessorStatistics::TOPOLOGICAL_ALIGNMENT, getElapsedSeconds(timer));
+        timer.reset();
+
+        bool passed = checkGeomAlignment();
+
+        statistics.addStageCounts(ScreeningProcessorStatistics::SPATIAL_ALIGNMENT, 1, passed);
+        statistics.addStageTime(ScreeningProcessorStatistics::SPATIAL_ALIGNMENT, getElapsedSeconds(timer));
+
+        if (!passed) {
+            timer.reset();
             continue;
+        }
 
-        if (!checkXVolumeClashes(mol_idx, conf_idx))
+        if (!checkXVolumeClashes(pharm_idx, mol_idx, conf_idx)) {
+            timer.reset();
             continue;
+        }
+
+        SearchHit hit(*parent, *currQuery->pharmacophore, dbPharmacophore, dbMolecule, 
+                      pharmAlignment.getTransform(), pharm_idx, mol_idx, conf_idx, currQuery->index);
+
+        if (scoringFunction)
+            loadMolecule(mol_idx); // keep molecule load time out of the scoring time
+
+        timer.reset();
 
-        SearchHit hit(*parent, *queryPharmacophore, dbPharmacophore, dbMolecule, 
-                      pharmAlignment.getTransform(), pharm_idx, mol_idx, conf_idx);
         double score = calcScore(hit);
 
+        statistics.addStageCounts(ScreeningProcessorStatistics::SCORING, 1, 1);
+        statistics.addStageTime(ScreeningProcessorStatistics::SCORING, getElapsedSeconds(timer));
+
         if (!bestAlignments)
             return processHit(hit, score);
 
@@ -447,18 +684,23 @@ bool Pharm::ScreeningProcessorImpl::performAlignment(std::size_t pharm_idx, std:
             best_score = score;
             bestAlmntTransform = pharmAlignment.getTransform();
         }
+
+        timer.reset();
     }
 
+    statistics.addStageTime(ScreeningProcessorStatistics::TOPOLOGICAL_ALIGNMENT, getElapsedSeconds(timer));
+
     if (!std::isnan(best_score))
-        return processHit(SearchHit(*parent, *queryPharmacophore, dbPharmacophore, dbMolecule, 
-                                    bestAlmntTransform, pharm_idx, mol_idx, conf_idx), best_score);
+        return processHit(SearchHit(*parent, *currQuery->pharmacophore, dbPharmacophore, dbMolecule, 
+                                    bestAlmntTransform, pharm_idx, mol_idx, conf_idx, currQuery->index), best_score);
 
     return true;
 }
 
 bool Pharm::ScreeningProcessorImpl::checkGeomAlignment()
 {
-    std::size_t num_al_mand_ftrs = alignedQueryMandFeatures.size();
+    const FeatureList& aligned_mand_ftrs = currQuery->alignedMandFeatures;
+    std::size_t num_al_mand_ftrs = aligned_mand_ftrs.size();
     std::size_t min_num_matches = (num_al_mand_ftrs > maxOmittedFeatures ? 
                                    std::size_t(num_al_mand_ftrs - maxOmittedFeatures) : std::size_t(0));
 
@@ -487,12 +729,12 @@ bool Pharm::ScreeningProcessorImpl::checkGeomAlignment()
     std::size_t num_matches = 0;
 
     for (std::size_t i = 0; i < num_al_mand_ftrs; i++) {
-        std::size_t query_ftr_idx = alignedQueryMandFeatures[i]->getIndex();
+        std::size_t query_ftr_idx = aligned_mand_ftrs[i]->getIndex();
 
-        const Math::Vector3D& query_pos = queryFeaturePositions[query_ftr_idx];
-        double query_tol = queryFeatureTolerances[query_ftr_idx];
+        const Math::Vector3D& query_pos = currQuery->featurePositions[query_ftr_idx];
+        double query_tol = currQuery->featureTolerances[query_ftr_idx];
 
-        const FeatureList& db_ftr_list = dbFeaturesByType[queryMandFeatureTypes[i]];
+        const FeatureList& db_ftr_list = dbFeaturesByType[currQuery->mandFeatureTypes[i]];
         bool match = false;
 
         for (FeatureList::const_iterator db_ftr_it = db_ftr_list.begin(), db_ftr_end = db_ftr_list.end(); db_ftr_it != db_ftr_end && !match; ++db_ftr_it) {
@@ -505,7 +747,7 @@ bool Pharm::ScreeningProcessorImpl::checkGeomAlignment()
             if (length(tmp) > query_tol)
                 continue;
 
-            const FeatureList& query_ftr_list = queryMandFeatures[i];
+            const FeatureList& query_ftr_list = currQuery->mandFeatures[i];
 
             for (FeatureList::const_iterator ftr_it = query_ftr_list.begin(), ftr_end = query_ftr_list.end(); ftr_it != ftr_end; ++ftr_it) {
                 if (featureGeomMatchFunction(**ftr_it, db_ftr, xform) > 0.0) {
@@ -532,40 +774,73 @@ bool Pharm::ScreeningProcessorImpl::checkGeomAlignment()
     return true;
 }
 
-bool Pharm::ScreeningProcessorImpl::checkXVolumeClashes(std::size_t mol_idx, std::size_t conf_idx)
+bool Pharm::ScreeningProcessorImpl::checkXVolumeClashes(std::size_t pharm_idx, std::size_t mol_idx, std::size_t conf_idx)
 {
-    if (!checkXVolumes || xVolumeIndices.empty())
+    if (!checkXVolumes || currQuery->xVolumeIndices.empty())
         return true;
 
-    loadMolecule(mol_idx);
+    loadAtomData(pharm_idx, mol_idx, conf_idx);
 
-    if (atomVdWRadii.empty())
-        for (Chem::BasicMolecule::ConstAtomIterator it = dbMolecule.getAtomsBegin(), 
-                 end = dbMolecule.getAtomsEnd(); it != end; ++it)
-            atomVdWRadii.push_back(Chem::AtomDictionary::getVdWRadius(getType(*it)) * VDW_RADIUS_FACTOR);
+    Internal::Timer timer;
+    bool passed = !hasXVolumeClashes();
 
-    if (atomCoordinates.isEmpty())
-        getConformation(dbMolecule, conf_idx, atomCoordinates);
+    statistics.addStageCounts(ScreeningProcessorStatistics::XVOLUME_CLASH_FILTER, 1, passed);
+    statistics.addStageTime(ScreeningProcessorStatistics::XVOLUME_CLASH_FILTER, getElapsedSeconds(timer));
 
-    const Math::Matrix4D& xform = pharmAlignment.getTransform();
-    Math::Vector3D al_pos;
-    Math::Vector3D tmp;
+    return passed;
+}
 
+bool Pharm::ScreeningProcessorImpl::hasXVolumeClashes() const
+{
+    const Math::Matrix4D& xform = pharmAlignment.getTransform();
+    const IndexList& x_vol_indices = currQuery->xVolumeIndices;
+    const Math::Vector3D& grid_origin = currQuery->xVolumeGridOrigin;
+    const std::size_t* grid_size = currQuery->xVolumeGridSize;
+    double grid_step_size = currQuery->xVolumeGridStepSize;
     std::size_t num_atoms = atomCoordinates.getSize();
-    std::size_t num_x_vols = xVolumeIndices.size();
+    std::size_t num_x_vols = x_vol_indices.size();
+    double al_pos[3];
+    Math::Vector3D tmp;
 
     for (std::size_t i = 0; i < num_atoms; i++) {
-        al_pos.assign(range(prod(xform, homog(atomCoordinates[i])), 0, 3));
+        const Math::Vector3D& pos = atomCoordinates[i];
+
+        for (std::size_t j = 0; j < 3; j++)
+            al_pos[j] = xform(j, 0) * pos[0] + xform(j, 1) * pos[1] + xform(j, 2) * pos[2] + xform(j, 3);
+
+        if (atomVdWRadii[i] <= XVOL_GRID_MAX_ATOM_RADIUS) {
+            std::size_t cell_idx = 0;
+            bool outside = false;
+
+            for (std::size_t j = 0; j < 3; j++) {
+                double cell_coord = std::floor((al_pos[j] - grid_origin[j]) / grid_step_size);
+
+                if (cell_coord < 0.0 || cell_coord >= grid_size[j]) {
+                    outside = true;
+                    break;
+                }
+
+                cell_idx = cell_idx * grid_size[j] + std::size_t(cell_coord);
+            }
+
+            if (outside || !currQuery->xVolumeGrid.test(cell_idx))
+                continue;
+        }
 
         for (std::size_t j = 0; j < num_x_vols; j++) {
-            tmp.assign(al_pos - queryFeaturePositions[xVolumeIndices[j]]);
+            std::size_t ftr_idx = x_vol_indices[j];
+            const Math::Vector3D& x_vol_pos = currQuery->featurePositions[ftr_idx];
 
-            if (length(tmp) < (queryFeatureTolerances[xVolumeIndices[j]] + atomVdWRadii[i]))
-                return false;
+            tmp[0] = al_pos[0] - x_vol_pos[0];
+            tmp[1] = al_pos[1] - x_vol_pos[1];
+            tmp[2] = al_pos[2] - x_vol_pos[2];
+
+            if (length(tmp) < (currQuery->featureTolerances[ftr_idx] + atomVdWRadii[i]))
+                return true;
         }
     }
 
-    return true;
+    return false;
 }
 
 double Pharm::ScreeningProcessorImpl::calcScore(const SearchHit& hit)
@@ -578,13 +853,22 @@ double Pharm::ScreeningProcessorImpl::calcScore(const SearchHit& hit)
     return scoringFunction(hit);
 }
 
-bool Pharm::ScreeningProcessorImpl::checkTopologicalMapping(const Util::STPairArray& mapping) const
+bool Pharm::ScreeningProcessorImpl::checkTopologicalMapping(const Util::STPairArray& mapping)
+{
+    bool passed = isValidTopologicalMapping(mapping);
+
+    statistics.addStageCounts(ScreeningProcessorStatistics::TOPOLOGICAL_ALIGNMENT, 1, passed);
+
+    return passed;
+}
+
+bool Pharm::ScreeningProcessorImpl::isValidTopologicalMapping(const Util::STPairArray& mapping) const
 {
-    if (alignedQueryOptFeatures.empty())
+    if (currQuery->alignedOptFeatures.empty())
         return true;
 
-    std::size_t min_num_matches = (alignedQueryMandFeatures.size() > maxOmittedFeatures ? 
-                                   std::size_t(alignedQueryMandFeatures.size() - maxOmittedFeatures) : std::size_t(0));
+    std::size_t min_num_matches = (currQuery->alignedMandFeatures.size() > maxOmittedFeatures ? 
+                                   std::size_t(currQuery->alignedMandFeatures.size() - maxOmittedFeatures) : std::size_t(0));
 
     if (min_num_matches == 0)
         return true;
@@ -599,15 +883,37 @@ bool Pharm::ScreeningProcessorImpl::checkTopologicalMapping(const Util::STPairAr
     return false;
 }
 
+void Pharm::ScreeningProcessorImpl::loadAtomData(std::size_t pharm_idx, std::size_t mol_idx, std::size_t conf_idx)
+{
+    if (!atomCoordinates.isEmpty())
+        return;
+
+    atomVdWRadii.clear();
+
+    if (!dbAccessor->getAtomCoordinatesAndRadii(pharm_idx, atomCoordinates, atomVdWRadii)) {
+        loadMolecule(mol_idx);
+        getConformation(dbMolecule, conf_idx, atomCoordinates);
+
+        for (Chem::BasicMolecule::ConstAtomIterator it = dbMolecule.getAtomsBegin(), end = dbMolecule.getAtomsEnd(); it != end; ++it)
+            atomVdWRadii.addElement(Chem::AtomDictionary::getVdWRadius(getType(*it)));
+    }
+
+    for (Util::DArray::ElementIterator it = atomVdWRadii.getElementsBegin(), end = atomVdWRadii.getElementsEnd(); it != end; ++it)
+        *it *= VDW_RADIUS_FACTOR;
+}
+
 void Pharm::ScreeningProcessorImpl::loadMolecule(std::size_t mol_idx)
 {
     if (mol_idx == loadedMolIndex)
         return;
 
-    atomVdWRadii.clear();
+    Internal::Timer timer;
 
     dbAccessor->getMolecule(mol_idx, dbMolecule);
 
+    statistics.increaseCounter(ScreeningProcessorStatistics::NUM_LOADED_MOLECULES);
+    statistics.addMoleculeLoadTime(getElapsedSeconds(timer));
+
     loadedMolIndex = mol_idx;
 }
 
@@ -619,23 +925,50 @@ void Pharm::ScreeningProcessorImpl::loadPharmacophore(std::size_t pharm_idx)
     atomCoordinates.clear();
     dbFeaturePositions.clear();
     initDBFeaturesByType = true;
+    initDB2PointPharmSet = true;
+
+    Internal::Timer timer;
 
     dbAccessor->getPharmacophore(pharm_idx, dbPharmacophore);
 
+    statistics.increaseCounter(ScreeningProcessorStatistics::NUM_LOADED_PHARMACOPHORES);
+    statistics.addPharmacophoreLoadTime(getElapsedSeconds(timer));
+
     loadedPharmIndex = pharm_idx;
 }
 
+bool Pharm::ScreeningProcessorImpl::reportBestConfHits(std::size_t list_idx)
+{
+    for (std::size_t i = 0; i < numQueries; i++) {
+        currQuery = &queryData[i];
+
+        if (std::isnan(currQuery->bestConfAlmntScore))
+            continue;
+
+        if (list_idx < pharmIndices.size() && pharmIndices[list_idx].second == currQuery->bestConfAlmntMolIdx)
+            continue;
+
+        if (!reportHit(SearchHit(*parent, *currQuery->pharmacophore, dbPharmacophore, dbMolecule, currQuery->bestConfAlmntTransform,
+                                 currQuery->bestConfAlmntPharmIdx, currQuery->bestConfAlmntMolIdx, currQuery->bestConfAlmntConfIdx,
+                                 currQuery->index),
+                       currQuery->bestConfAlmntScore))
+            return false;
+    }
+
+    return true;
+}
+
 bool Pharm::ScreeningProcessorImpl::processHit(const SearchHit& hit, double score)
 {
     if (reportMode == ScreeningProcessor::BEST_MATCHING_CONF) {
-        if (!std::isnan(bestConfAlmntScore) && score <= bestConfAlmntScore)
+        if (!std::isnan(currQuery->bestConfAlmntScore) && score <= currQuery->bestConfAlmntScore)
             return true;
 
-        bestConfAlmntScore = score;
-        bestConfAlmntTransform = hit.getHitAlignmentTransform();
-        bestConfAlmntMolIdx = hit.getHitMoleculeIndex();
-        bestConfAlmntConfIdx = hit.getHitConformationIndex();
-        bestConfAlmntPharmIdx = hit.getHitPharmacophoreIndex();
+        currQuery->bestConfAlmntScore = score;
+        currQuery->bestConfAlmntTransform = hit.getHitAlignmentTransform();
+        currQuery->bestConfAlmntMolIdx = hit.getHitMoleculeIndex();
+        currQuery->bestConfAlmntConfIdx = hit.getHitConformationIndex();
+        currQuery->bestConfAlmntPharmIdx = hit.getHitPharmacophoreIndex();
         
         return true;
     } 
@@ -648,10 +981,10 @@ bool Pharm::ScreeningProcessorImpl::reportHit(const SearchHit& hit, double score
     numHits++;
 
     if (reportMode == ScreeningProcessor::FIRST_MATCHING_CONF) {
-        molHitSet.set(hit.getHitMoleculeIndex());
+        currQuery->molHitSet.set(hit.getHitMoleculeIndex());
 
     } else if (reportMode == ScreeningProcessor::BEST_MATCHING_CONF) 
-        bestConfAlmntScore = NAN_SCORE;
+        currQuery->bestConfAlmntScore = NAN_SCORE;
 
     if (!hitCallback)
         return true;
@@ -664,8 +997,8 @@ bool Pharm::ScreeningProcessorImpl::reportHit(const SearchHit& hit, double score
 
 const Math::Vector3D& Pharm::ScreeningProcessorImpl::getFeatureCoordinates(const Feature& ftr)
 {
-    if (&ftr.getPharmacophore() == queryPharmacophore)
-        return queryFeaturePositions[ftr.getIndex()];
+    if (&ftr.getPharmacophore() == currQuery->pharmacophore)
+        return currQuery->featurePositions[ftr.getIndex()];
 
     if (dbFeaturePositions.isEmpty())
         get3DCoordinates(dbPharmacophore, dbFeaturePositions);
@@ -32,6 +32,7 @@
 #include <boost/iterator/indirect_iterator.hpp>
 
 #include "CDPL/Pharm/ScreeningProcessor.hpp"
+#include "CDPL/Pharm/ScreeningProcessorStatistics.hpp"
 #include "CDPL/Pharm/PharmacophoreAlignment.hpp"
 #include "CDPL/Pharm/FeatureTypeHistogram.hpp"
 #include "CDPL/Pharm/BasicPharmacophore.hpp"
@@ -44,6 +45,7 @@
 #include "CDPL/Math/Vector.hpp"
 #include "CDPL/Math/VectorArray.hpp"
 #include "CDPL/Util/BitSet.hpp"
+#include "CDPL/Util/Array.hpp"
 
 
 namespace CDPL
@@ -62,6 +64,7 @@ namespace CDPL
             typedef ScreeningProcessor::ProgressCallbackFunction ProgressCallbackFunction;
             typedef ScreeningProcessor::ScoringFunction          ScoringFunction;
             typedef ScreeningProcessor::SearchHit                SearchHit;
+            typedef ScreeningProcessor::QueryPharmacophoreList   QueryPharmacophoreList;
 
           public:
             ScreeningProcessorImpl(ScreeningProcessor& parent, ScreeningDBAccessor& db_acc);
@@ -100,6 +103,10 @@ namespace CDPL
 
             std::size_t searchDB(const FeatureContainer& query, std::size_t mol_start_idx, std::size_t mol_end_idx);
 
+            std::size_t searchDB(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, std::size_t mol_end_idx);
+
+            const ScreeningProcessorStatistics& getStatistics() const;
+
           private:
             typedef std::vector<QueryTwoPointPharmacophore>       TwoPointPharmacophoreList;
             typedef std::vector<const Feature*>                   FeatureList;
@@ -116,6 +123,37 @@ namespace CDPL
 
             typedef boost::indirect_iterator<FeatureList::const_iterator, const Feature> FeatureListIterator;
 
+            struct QueryData
+            {
+
+                const FeatureContainer*   pharmacophore;
+                std::size_t               index;
+                FeatureMatrix             mandFeatures;
+                FeatureMatrix             optFeatures;
+                FeatureList               alignedMandFeatures;
+                FeatureList               alignedOptFeatures;
+                FeatureTypeTable          mandFeatureTypes;
+                FeatureTypeHistogram      featureCounts;
+                RadiusTable               featureTolerances;
+                Math::Vector3DArray       featurePositions;
+                IndexList                 xVolumeIndices;
+                TwoPointPharmacophoreList twoPointPharms;
+                std::size_t               minNumFeatureMatches;
+                std::size_t               minNum2PointPharmMatches;
+                Util::BitSet              molHitSet;
+                Util::BitSet              xVolumeGrid;
+                Math::Vector3D            xVolumeGridOrigin;
+                std::size_t               xVolumeGridSize[3];
+                double                    xVolumeGridStepSize;
+                Math::Matrix4D            bestConfAlmntTransform;
+                std::size_t               bestConfAlmntMolIdx;
+                std::size_t               bestConfAlmntConfIdx;
+                std::size_t               bestConfAlmntPharmIdx;
+                double                    bestConfAlmntScore;
+            };
+
+            typedef std::vector<QueryData> QueryDataArray;
+
             struct IndexPair2ndCmpFunc
             {
 
@@ -125,29 +163,41 @@ namespace CDPL
                 }
             };
 
-            void prepareDBSearch(const FeatureContainer& query, std::size_t mol_start_idx, std::size_t mol_end_idx);
+            std::size_t doSearchDB(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, std::size_t mol_end_idx);
 
-            void initQueryData(const FeatureContainer& query);
+            void prepareDBSearch(const QueryPharmacophoreList& queries, std::size_t mol_start_idx, std::size_t mol_end_idx);
+
+            void initQueryData(const FeatureContainer& query, std::size_t query_idx, QueryData& data);
+            void initXVolumeGrid(QueryData& data) const;
+            void initQueryAlignment();
             void initPharmIndexList(std::size_t mol_start_idx, std::size_t mol_end_idx);
 
+            void prefetchPharmacophores(std::size_t list_idx);
+
             void insertFeature(const Feature& ftr, FeatureMatrix& ftr_mtx) const;
 
-            bool checkFeatureCounts(std::size_t pharm_idx) const;
+            bool checkFeatureCounts(std::size_t pharm_idx);
+            bool matchFeatureCounts(std::size_t pharm_idx, const QueryData& data) const;
             bool check2PointPharmacophores(std::size_t pharm_idx);
+            bool match2PointPharmacophores();
             bool performAlignment(std::size_t pharm_idx, std::size_t mol_idx);
 
             bool checkGeomAlignment();
-            bool checkXVolumeClashes(std::size_t mol_idx, std::size_t conf_idx);
+            bool checkXVolumeClashes(std::size_t pharm_idx, std::size_t mol_idx, std::size_t conf_idx);
+            bool hasXVolumeClashes() const;
 
-            bool checkTopologicalMapping(const Util::STPairArray& mapping) const;
+            bool checkTopologicalMapping(const Util::STPairArray& mapping);
+            bool isValidTopologicalMapping(const Util::STPairArray& mapping) const;
 
             double calcScore(const SearchHit& hit);
 
             void loadPharmacophore(std::size_t pharm_idx);
+            void loadAtomData(std::size_t pharm_idx, std::size_t mol_idx, std::size_t conf_idx);
             void loadMolecule(std::size_t mol_idx);
 
             const Math::Vector3D& getFeatureCoordinates(const Feature& ftr);
 
+            bool reportBestConfHits(std::size_t list_idx);
             bool processHit(const SearchHit& hit, double score);
             bool reportHit(const SearchHit& hit, double score);
 
@@ -161,41 +211,31 @@ namespace CDPL
             ProgressCallbackFunction          progressCallback;
             ScoringFunction                   scoringFunction;
             FeatureGeometryMatchFunctor       featureGeomMatchFunction;
-            const FeatureContainer*           queryPharmacophore;
+            QueryDataArray                    queryData;
+            QueryPharmacophoreList            singleQuery;
+            std::size_t                       numQueries;
+            QueryData*                        currQuery;
+            const QueryData*                  alignedQuery;
             BasicPharmacophore                dbPharmacophore;
             Chem::BasicMolecule               dbMolecule;
             PharmacophoreAlignment            pharmAlignment;
             Query2PointPharmGenerator         query2PointPharmGen;
             DB2PointPharmGenerator            db2PointPharmGen;
-            FeatureTypeHistogram              queryFeatureCounts;
-            TwoPointPharmacophoreList         query2PointPharmList;
             TwoPointPharmacophoreSet          db2PointPharmSet;
-            std::size_t                       minNum2PointPharmMatches;
-            FeatureMatrix                     queryMandFeatures;
-            FeatureMatrix                     queryOptFeatures;
-            FeatureList                       alignedQueryMandFeatures;
-            FeatureList                       alignedQueryOptFeatures;
-            FeatureTypeTable                  queryMandFeatureTypes;
-            IndexList                         xVolumeIndices;
+            bool                              initDB2PointPharmSet;
             Math::Vector3DArray               atomCoordinates;
-            RadiusTable                       atomVdWRadii;
-            RadiusTable                       queryFeatureTolerances;
-            Math::Vector3DArray               queryFeaturePositions;
+            Util::DArray                      atomVdWRadii;
             Math::Vector3DArray               dbFeaturePositions;
             Math::Vector3DArray               alignedDBFeaturePositions;
             TypeToFeatureListMap              dbFeaturesByType;
             bool                              initDBFeaturesByType;
             IndexPairList                     pharmIndices;
-            Util::BitSet                      molHitSet;
+            Util::STArray                     prefetchPharmIndices;
             std::size_t                       numHits;
             std::size_t                       loadedPharmIndex;
             std::size_t                       loadedMolIndex;
             Math::Matrix4D                    bestAlmntTransform;
-            Math::Matrix4D                    bestConfAlmntTransform;
-            std::size_t                       bestConfAlmntMolIdx;
-            std::size_t                       bestConfAlmntConfIdx;
-            std::size_t                       bestConfAlmntPharmIdx;
-            double                            bestConfAlmntScore;
+            ScreeningProcessorStatistics      statistics;
         };
     } // namespace Pharm
 } // namespace CDPL
@@ -0,0 +1,262 @@
+/* 
+ * ScreeningProcessorStatistics.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+
+#include "StaticInit.hpp"
+
+#include "CDPL/Pharm/ScreeningProcessorStatistics.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+using namespace CDPL;
+
+
+namespace
+{
+
+    const char* STAGE_NAMES[] = {
+        "feature_count_filter",
+        "two_point_pharmacophore_filter",
+        "topological_alignment",
+        "spatial_alignment",
+        "xvolume_clash_filter",
+        "scoring"
+    };
+
+    const char* COUNTER_NAMES[] = {
+        "num_screened_pharmacophores",
+        "num_skipped_pharmacophores",
+        "num_loaded_pharmacophores",
+        "num_loaded_molecules",
+        "num_bytes_read",
+        "num_hits"
+    };
+
+    static_assert(sizeof(STAGE_NAMES) / sizeof(const char*) == Pharm::ScreeningProcessorStatistics::NUM_STAGES,
+                  "stage name table size mismatch");
+    static_assert(sizeof(COUNTER_NAMES) / sizeof(const char*) == Pharm::ScreeningProcessorStatistics::NUM_COUNTERS,
+                  "counter name table size mismatch");
+}
+
+
+Pharm::ScreeningProcessorStatistics::ScreeningProcessorStatistics()
+{
+    clear();
+}
+
+void Pharm::ScreeningProcessorStatistics::clear()
+{
+    totalTime = 0.0;
+    pharmLoadTime = 0.0;
+    molLoadTime = 0.0;
+    decodingTime = 0.0;
+
+    numTested.fill(0);
+    numPassed.fill(0);
+    stageTimes.fill(0.0);
+    counters.fill(0);
+}
+
+double Pharm::ScreeningProcessorStatistics::getTotalTime() const
+{
+    return totalTime;
+}
+
+void Pharm::ScreeningProcessorStatistics::setTotalTime(double time)
+{
+    totalTime = time;
+}
+
+std::size_t Pharm::ScreeningProcessorStatistics::getNumTested(Stage stage) const
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    return numTested[stage];
+}
+
+std::size_t Pharm::ScreeningProcessorStatistics::getNumPassed(Stage stage) const
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    return numPassed[stage];
+}
+
+double Pharm::ScreeningProcessorStatistics::getPassRate(Stage stage) const
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    if (numTested[stage] == 0)
+        return 0.0;
+
+    return (double(numPassed[stage]) / numTested[stage]);
+}
+
+void Pharm::ScreeningProcessorStatistics::setStageCounts(Stage stage, std::size_t num_tested, std::size_t num_passed)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    numTested[stage] = num_tested;
+    numPassed[stage] = num_passed;
+}
+
+void Pharm::ScreeningProcessorStatistics::addStageCounts(Stage stage, std::size_t num_tested, std::size_t num_passed)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    numTested[stage] += num_tested;
+    numPassed[stage] += num_passed;
+}
+
+double Pharm::ScreeningProcessorStatistics::getStageTime(Stage stage) const
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    return stageTimes[stage];
+}
+
+void Pharm::ScreeningProcessorStatistics::setStageTime(Stage stage, double time)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    stageTimes[stage] = time;
+}
+
+void Pharm::ScreeningProcessorStatistics::addStageTime(Stage stage, double time)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    stageTimes[stage] += time;
+}
+
+std::size_t Pharm::ScreeningProcessorStatistics::getCounter(Counter counter) const
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ScreeningProcessorStatistics: counter out of bounds");
+
+    return counters[counter];
+}
+
+void Pharm::ScreeningProcessorStatistics::setCounter(Counter counter, std::size_t value)
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ScreeningProcessorStatistics: counter out of bounds");
+
+    counters[counter] = value;
+}
+
+void Pharm::ScreeningProcessorStatistics::increaseCounter(Counter counter, std::size_t inc)
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ScreeningProcessorStatistics: counter out of bounds");
+
+    counters[counter] += inc;
+}
+
+double Pharm::ScreeningProcessorStatistics::getPharmacophoreLoadTime() const
+{
+    return pharmLoadTime;
+}
+
+void Pharm::ScreeningProcessorStatistics::setPharmacophoreLoadTime(double time)
+{
+    pharmLoadTime = time;
+}
+
+void Pharm::ScreeningProcessorStatistics::addPharmacophoreLoadTime(double time)
+{
+    pharmLoadTime += time;
+}
+
+double Pharm::ScreeningProcessorStatistics::getMoleculeLoadTime() const
+{
+    return molLoadTime;
+}
+
+void Pharm::ScreeningProcessorStatistics::setMoleculeLoadTime(double time)
+{
+    molLoadTime = time;
+}
+
+void Pharm::ScreeningProcessorStatistics::addMoleculeLoadTime(double time)
+{
+    molLoadTime += time;
+}
+
+double Pharm::ScreeningProcessorStatistics::getDataDecodingTime() const
+{
+    return decodingTime;
+}
+
+void Pharm::ScreeningProcessorStatistics::setDataDecodingTime(double time)
+{
+    decodingTime = time;
+}
+
+void Pharm::ScreeningProcessorStatistics::addDataDecodingTime(double time)
+{
+    decodingTime += time;
+}
+
+Pharm::ScreeningProcessorStatistics& Pharm::ScreeningProcessorStatistics::operator+=(const ScreeningProcessorStatistics& stats)
+{
+    totalTime += stats.totalTime;
+    pharmLoadTime += stats.pharmLoadTime;
+    molLoadTime += stats.molLoadTime;
+    decodingTime += stats.decodingTime;
+
+    for (std::size_t i = 0; i < NUM_STAGES; i++) {
+        numTested[i] += stats.numTested[i];
+        numPassed[i] += stats.numPassed[i];
+        stageTimes[i] += stats.stageTimes[i];
+    }
+
+    for (std::size_t i = 0; i < NUM_COUNTERS; i++)
+        counters[i] += stats.counters[i];
+
+    return *this;
+}
+
+const char* Pharm::ScreeningProcessorStatistics::getStageName(Stage stage)
+{
+    if (std::size_t(stage) >= NUM_STAGES)
+        throw Base::IndexError("ScreeningProcessorStatistics: stage out of bounds");
+
+    return STAGE_NAMES[stage];
+}
+
+const char* Pharm::ScreeningProcessorStatistics::getCounterName(Counter counter)
+{
+    if (std::size_t(counter) >= NUM_COUNTERS)
+        throw Base::IndexError("ScreeningProcessorStatistics: counter out of bounds");
+
+    return COUNTER_NAMES[counter];
+}
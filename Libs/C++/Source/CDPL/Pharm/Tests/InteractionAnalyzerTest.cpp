@@ -0,0 +1,204 @@
+/*
+ * InteractionAnalyzerTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include "CDPL/Pharm/InteractionAnalyzer.hpp"
+#include "CDPL/Pharm/BasicPharmacophore.hpp"
+#include "CDPL/Pharm/Feature.hpp"
+#include "CDPL/Pharm/FeatureFunctions.hpp"
+#include "CDPL/Chem/Entity3DFunctions.hpp"
+#include "CDPL/Math/Vector.hpp"
+#include "CDPL/Base/Exceptions.hpp"
+
+
+namespace
+{
+
+    const unsigned int NUM_TEST_FEATURE_TYPES = 4;
+
+    bool checkConstraints(const CDPL::Pharm::Feature& ftr1, const CDPL::Pharm::Feature& ftr2)
+    {
+        return ((CDPL::Pharm::getTolerance(ftr1) + CDPL::Pharm::getTolerance(ftr2)) > 1.0);
+    }
+
+    template <typename Engine>
+    void genRandomFeatures(CDPL::Pharm::BasicPharmacophore& pharm, Engine& rand_engine)
+    {
+        using namespace CDPL;
+        using namespace Pharm;
+
+        boost::random::uniform_int_distribution<std::size_t> num_ftrs_dist(0, 60);
+        boost::random::uniform_int_distribution<unsigned int> type_dist(0, NUM_TEST_FEATURE_TYPES - 1);
+        boost::random::uniform_real_distribution<double> coords_dist(-10.0, 10.0);
+        boost::random::uniform_real_distribution<double> unit_dist(0.0, 1.0);
+
+        pharm.clear();
+
+        for (std::size_t i = 0, num_ftrs = num_ftrs_dist(rand_engine); i < num_ftrs; i++) {
+            Feature& ftr = pharm.addFeature();
+
+            setType(ftr, type_dist(rand_engine));
+            setTolerance(ftr, unit_dist(rand_engine));
+
+            // some features without coordinates
+
+            if (unit_dist(rand_engine) < 0.1)
+                continue;
+
+            Math::Vector3D pos;
+
+            pos[0] = coords_dist(rand_engine);
+            pos[1] = coords_dist(rand_engine);
+            pos[2] = coords_dist(rand_engine);
+
+            Chem::set3DCoordinates(ftr, pos);
+        }
+    }
+
+    void analyzeBruteForce(const CDPL::Pharm::InteractionAnalyzer& analyzer, const CDPL::Pharm::FeatureContainer& cntnr1,
+                           const CDPL::Pharm::FeatureContainer& cntnr2, CDPL::Pharm::FeatureMapping& iactions)
+    {
+        using namespace CDPL;
+        using namespace Pharm;
+
+        iactions.clear();
+
+        for (FeatureContainer::ConstFeatureIterator it1 = cntnr1.getFeaturesBegin(), end1 = cntnr1.getFeaturesEnd(); it1 != end1; ++it1) {
+            const Feature& ftr1 = *it1;
+
+            for (FeatureContainer::ConstFeatureIterator it2 = cntnr2.getFeaturesBegin(), end2 = cntnr2.getFeaturesEnd(); it2 != end2; ++it2) {
+                const Feature& ftr2 = *it2;
+                const InteractionAnalyzer::ConstraintFunction& func = analyzer.getConstraintFunction(getType(ftr1), getType(ftr2));
+
+                if (!func)
+                    continue;
+
+                double max_dist = analyzer.getMaxInteractionDistance(getType(ftr1), getType(ftr2));
+
+                if (max_dist != InteractionAnalyzer::NO_DISTANCE_LIMIT && Chem::has3DCoordinates(ftr1) && Chem::has3DCoordinates(ftr2)) {
+                    Math::Vector3D dist_vec(Chem::get3DCoordinates(ftr1) - Chem::get3DCoordinates(ftr2));
+
+                    if (Math::innerProd(dist_vec, dist_vec) > max_dist * max_dist)
+                        continue;
+                }
+
+                if (func(ftr1, ftr2))
+                    iactions.insertEntry(&ftr1, &ftr2);
+            }
+        }
+    }
+
+    void checkMappings(const CDPL::Pharm::FeatureMapping& iactions, const CDPL::Pharm::FeatureMapping& exp_iactions)
+    {
+        using namespace CDPL;
+        using namespace Pharm;
+
+        BOOST_CHECK_EQUAL(iactions.getSize(), exp_iactions.getSize());
+
+        for (FeatureMapping::ConstEntryIterator it1 = iactions.getEntriesBegin(), end1 = iactions.getEntriesEnd(), it2 = exp_iactions.getEntriesBegin(),
+                 end2 = exp_iactions.getEntriesEnd(); it1 != end1 && it2 != end2; ++it1, ++it2) {
+
+            BOOST_CHECK(it1->first == it2->first);
+            BOOST_CHECK(it1->second == it2->second);
+        }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(InteractionAnalyzerTest)
+{
+    using namespace CDPL;
+    using namespace Pharm;
+
+    InteractionAnalyzer analyzer;
+    BasicPharmacophore cntnr1;
+    BasicPharmacophore cntnr2;
+    FeatureMapping iactions;
+    FeatureMapping exp_iactions;
+
+    BOOST_CHECK(!analyzer.hasFeatureIndex());
+    BOOST_CHECK_THROW(analyzer.analyze(cntnr1, iactions), Base::OperationFailed);
+
+    analyzer.setConstraintFunction(0, 1, &checkConstraints, 3.0);
+    analyzer.setConstraintFunction(0, 2, &checkConstraints, InteractionAnalyzer::NO_DISTANCE_LIMIT);
+    analyzer.setConstraintFunction(1, 1, &checkConstraints, 2.0);
+    analyzer.setConstraintFunction(2, 0, &checkConstraints, 5.0);
+    analyzer.setConstraintFunction(2, 1, &checkConstraints, 0.5);
+    analyzer.setConstraintFunction(3, 1, &checkConstraints, 6.0);
+    analyzer.setConstraintFunction(1, 2, &checkConstraints);
+    analyzer.setConstraintFunction(3, 3, InteractionAnalyzer::ConstraintFunction(), 4.0);
+
+    boost::random::mt11213b rand_engine;
+
+    for (std::size_t i = 0; i < 50; i++) {
+        genRandomFeatures(cntnr1, rand_engine);
+        genRandomFeatures(cntnr2, rand_engine);
+
+        analyzeBruteForce(analyzer, cntnr1, cntnr2, exp_iactions);
+
+        analyzer.analyze(cntnr1, cntnr2, iactions);
+        checkMappings(iactions, exp_iactions);
+
+        analyzer.indexFeatures(cntnr2);
+
+        BOOST_CHECK(analyzer.hasFeatureIndex());
+
+        analyzer.analyze(cntnr1, iactions);
+        checkMappings(iactions, exp_iactions);
+
+        // appended mappings
+
+        analyzer.analyze(cntnr1, iactions, true);
+
+        BOOST_CHECK_EQUAL(iactions.getSize(), 2 * exp_iactions.getSize());
+
+        // constraint changes after indexing (the cell sizes no longer match the maximum distances)
+
+        analyzer.setConstraintFunction(1, 1, &checkConstraints, 7.5);
+        analyzer.setConstraintFunction(2, 1, &checkConstraints, 1.0e12);
+        analyzer.setConstraintFunction(3, 3, &checkConstraints, 4.0);
+
+        analyzeBruteForce(analyzer, cntnr1, cntnr2, exp_iactions);
+
+        analyzer.analyze(cntnr1, iactions);
+        checkMappings(iactions, exp_iactions);
+
+        analyzer.analyze(cntnr1, cntnr2, iactions);
+        checkMappings(iactions, exp_iactions);
+
+        analyzer.setConstraintFunction(1, 1, &checkConstraints, 2.0);
+        analyzer.setConstraintFunction(2, 1, &checkConstraints, 0.5);
+        analyzer.setConstraintFunction(3, 3, InteractionAnalyzer::ConstraintFunction(), 4.0);
+
+        analyzer.clearFeatureIndex();
+
+        BOOST_CHECK(!analyzer.hasFeatureIndex());
+        BOOST_CHECK_THROW(analyzer.analyze(cntnr1, iactions), Base::OperationFailed);
+    }
+}
@@ -0,0 +1,234 @@
+/*
+ * InteractionFingerprintGeneratorTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <cstdlib>
+#include <string>
+#include <fstream>
+#include <cmath>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Pharm/InteractionFingerprintGenerator.hpp"
+#include "CDPL/Pharm/InteractionPharmacophoreGenerator.hpp"
+#include "CDPL/Pharm/BasicPharmacophore.hpp"
+#include "CDPL/Pharm/FeatureMapping.hpp"
+#include "CDPL/Pharm/FeatureFunctions.hpp"
+#include "CDPL/Pharm/MoleculeFunctions.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/Fragment.hpp"
+#include "CDPL/Chem/SDFMoleculeReader.hpp"
+#include "CDPL/Chem/Entity3DFunctions.hpp"
+#include "CDPL/Chem/FragmentFunctions.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Biomol/PDBMoleculeReader.hpp"
+#include "CDPL/Biomol/AtomFunctions.hpp"
+#include "CDPL/Biomol/MolecularGraphFunctions.hpp"
+#include "CDPL/Math/AffineTransform.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+#include "CDPL/Math/Matrix.hpp"
+#include "CDPL/Util/BitSet.hpp"
+
+
+namespace
+{
+
+    bool isWaterOrLigandAtom(const CDPL::Chem::Atom& atom)
+    {
+        const std::string& res_code = CDPL::Biomol::getResidueCode(atom);
+
+        return (res_code == "HOH" || res_code == "LS2");
+    }
+
+    void getCoordinates(const CDPL::Chem::MolecularGraph& molgraph, CDPL::Math::Vector3DArray& coords)
+    {
+        coords.clear();
+
+        for (std::size_t i = 0; i < molgraph.getNumAtoms(); i++)
+            coords.addElement(CDPL::Chem::get3DCoordinates(molgraph.getAtom(i)));
+    }
+
+    void setCoordinates(CDPL::Chem::MolecularGraph& molgraph, const CDPL::Math::Vector3DArray& coords, std::size_t offs)
+    {
+        for (std::size_t i = 0; i < molgraph.getNumAtoms(); i++)
+            CDPL::Chem::set3DCoordinates(molgraph.getAtom(i), coords[offs + i]);
+    }
+
+    // appends rigidly moved coordinates - rigid body motions keep the fingerprint generator's
+    // feature geometry updates exact and thus comparable to a regeneration of the features
+
+    void appendTransformedCoordinates(const CDPL::Math::Vector3DArray& coords, double angle, double shift, CDPL::Math::Vector3DArray& xform_coords)
+    {
+        using namespace CDPL;
+
+        Math::Vector3D ctr;
+
+        for (std::size_t i = 0; i < coords.getSize(); i++)
+            ctr += coords[i];
+
+        ctr /= coords.getSize();
+
+        Math::Matrix3D rot = Math::RotationMatrix<double>(3, angle, 0.48, 0.6, 0.64);
+        Math::Vector3D trans = Math::vec(shift, -0.5 * shift, 0.25 * shift);
+
+        for (std::size_t i = 0; i < coords.getSize(); i++)
+            xform_coords.addElement(Math::prod(rot, coords[i] - ctr) + ctr + trans);
+    }
+
+    void getInteractionCounts(CDPL::Pharm::InteractionPharmacophoreGenerator& gen, const CDPL::Chem::MolecularGraph& ligand,
+                              const CDPL::Chem::MolecularGraph& env, CDPL::Math::ULVector& counts)
+    {
+        using namespace CDPL;
+        using namespace Pharm;
+
+        BasicPharmacophore ia_pharm;
+
+        gen.generate(ligand, env, ia_pharm, false);
+
+        const Pharmacophore& env_pharm = gen.getEnvironmentPharmacophore();
+        const FeatureMapping& iactions = gen.getInteractionMapping();
+
+        counts.resize(env_pharm.getNumFeatures() * InteractionFingerprintGenerator::NUM_LIGAND_FEATURE_TYPES, false);
+        counts.clear();
+
+        for (FeatureMapping::ConstEntryIterator it = iactions.getEntriesBegin(), end = iactions.getEntriesEnd(); it != end; ++it)
+            counts(env_pharm.getFeatureIndex(*it->second) * InteractionFingerprintGenerator::NUM_LIGAND_FEATURE_TYPES + getType(*it->first))++;
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(InteractionFingerprintGeneratorTest)
+{
+    using namespace CDPL;
+    using namespace Pharm;
+
+    Chem::BasicMolecule ligand;
+    Chem::BasicMolecule protein;
+
+    std::ifstream lig_ifs(std::string(std::string(std::getenv("CDPKIT_TEST_DATA_DIR")) + "/1ke6_B_LS2.sdf").c_str());
+    std::ifstream prot_ifs(std::string(std::string(std::getenv("CDPKIT_TEST_DATA_DIR")) + "/1ke6.pdb").c_str());
+
+    BOOST_CHECK(lig_ifs);
+    BOOST_CHECK(prot_ifs);
+
+    BOOST_CHECK(Chem::SDFMoleculeReader(lig_ifs).read(ligand));
+    BOOST_CHECK(Biomol::PDBMoleculeReader(prot_ifs).read(protein));
+
+    prepareForPharmacophoreGeneration(ligand);
+    prepareForPharmacophoreGeneration(protein);
+
+    Chem::Fragment env;
+
+    Biomol::extractEnvironmentResidues(ligand, protein, env, 8.0);
+    Chem::removeAtomsIf(env, &isWaterOrLigandAtom);
+    Chem::perceiveSSSR(env, true);
+
+    BOOST_CHECK(env.getNumAtoms() > 0);
+
+    // frames with moving ligand, with moving environment and with both moving by the same amount
+
+    const std::size_t num_frames = 12;
+
+    Math::Vector3DArray lig_coords;
+    Math::Vector3DArray env_coords;
+    Math::Vector3DArray ref_lig_coords;
+    Math::Vector3DArray ref_env_coords;
+
+    getCoordinates(ligand, ref_lig_coords);
+    getCoordinates(env, ref_env_coords);
+
+    for (std::size_t i = 0; i < num_frames; i++) {
+        double angle = 0.05 * (i % 4);
+        double shift = 0.3 * (i / 4) - 0.3;
+
+        appendTransformedCoordinates(ref_lig_coords, (i % 3 == 1 ? 0.0 : angle), (i % 3 == 1 ? 0.0 : shift), lig_coords);
+        appendTransformedCoordinates(ref_env_coords, (i % 3 == 0 ? 0.0 : angle), (i % 3 == 0 ? 0.0 : shift), env_coords);
+    }
+
+    // fingerprints have to be generated before the atom coordinates of the molecular graphs get modified
+
+    InteractionFingerprintGenerator fp_gen;
+    Util::BitSetArray fps[2];
+    Math::ULMatrix counts[2];
+    Util::BitSet fp;
+    Math::ULVector fp_counts;
+
+    fp_gen.setup(ligand, env);
+
+    BOOST_CHECK(fp_gen.getNumBits() == fp_gen.getEnvironmentPharmacophore().getNumFeatures() * InteractionFingerprintGenerator::NUM_LIGAND_FEATURE_TYPES);
+
+    // a feature index built by the user must survive the generation of fingerprints
+
+    fp_gen.getInteractionAnalyzer().indexFeatures(fp_gen.getEnvironmentPharmacophore());
+
+    for (std::size_t i = 0; i < 2; i++) {
+        fp_gen.setNumThreads(i == 0 ? 0 : 4);
+        fp_gen.generate(lig_coords, env_coords, num_frames, fps[i]);
+        fp_gen.generate(lig_coords, env_coords, num_frames, counts[i]);
+
+        BOOST_CHECK(fps[i].getSize() == num_frames);
+        BOOST_CHECK(counts[i].getSize1() == num_frames);
+        BOOST_CHECK(counts[i].getSize2() == fp_gen.getNumBits());
+    }
+
+    InteractionPharmacophoreGenerator ia_ph4_gen;
+    Math::ULVector exp_counts;
+    std::size_t num_set_bits = 0;
+
+    ia_ph4_gen.addExclusionVolumes(false);
+
+    for (std::size_t i = 0; i < num_frames && i < fps[0].getSize() && i < counts[0].getSize1() && i < fps[1].getSize() && i < counts[1].getSize1(); i++) {
+        setCoordinates(ligand, lig_coords, i * ligand.getNumAtoms());
+        setCoordinates(env, env_coords, i * env.getNumAtoms());
+
+        getInteractionCounts(ia_ph4_gen, ligand, env, exp_counts);
+
+        BOOST_CHECK(ia_ph4_gen.getCorePharmacophore().getNumFeatures() == fp_gen.getLigandPharmacophore().getNumFeatures());
+        BOOST_CHECK(ia_ph4_gen.getEnvironmentPharmacophore().getNumFeatures() == fp_gen.getEnvironmentPharmacophore().getNumFeatures());
+        BOOST_CHECK(exp_counts.getSize() == fp_gen.getNumBits());
+
+        Math::Vector3DArray frame_lig_coords;
+        Math::Vector3DArray frame_env_coords;
+
+        getCoordinates(ligand, frame_lig_coords);
+        getCoordinates(env, frame_env_coords);
+
+        fp_gen.generate(frame_lig_coords, frame_env_coords, fp);
+        fp_gen.generate(frame_lig_coords, frame_env_coords, fp_counts);
+
+        for (std::size_t j = 0; j < exp_counts.getSize() && j < fp_gen.getNumBits(); j++) {
+            num_set_bits += (exp_counts(j) > 0);
+
+            BOOST_CHECK_EQUAL(bool(fp.test(j)), exp_counts(j) > 0);
+            BOOST_CHECK_EQUAL(fp_counts(j), exp_counts(j));
+
+            for (std::size_t k = 0; k < 2; k++) {
+                BOOST_CHECK_EQUAL(bool(fps[k][i].test(j)), exp_counts(j) > 0);
+                BOOST_CHECK_EQUAL(counts[k](i, j), exp_counts(j));
+            }
+        }
+    }
+
+    BOOST_CHECK(num_set_bits > 0);
+    BOOST_CHECK(fp_gen.getInteractionAnalyzer().hasFeatureIndex());
+}
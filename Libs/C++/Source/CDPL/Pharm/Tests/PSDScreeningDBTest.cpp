@@ -0,0 +1,112 @@
+/*
+ * PSDScreeningDBTest.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <cstdio>
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Pharm/PSDScreeningDBCreator.hpp"
+#include "CDPL/Pharm/PSDScreeningDBAccessor.hpp"
+#include "CDPL/Pharm/MoleculeFunctions.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/UtilityFunctions.hpp"
+#include "CDPL/Chem/AtomContainerFunctions.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Chem/AtomFunctions.hpp"
+#include "CDPL/Chem/AtomDictionary.hpp"
+#include "CDPL/Math/VectorArray.hpp"
+#include "CDPL/Util/Array.hpp"
+
+
+BOOST_AUTO_TEST_CASE(PSDScreeningDBAtomDataTest)
+{
+    using namespace CDPL;
+    using namespace Pharm;
+
+    const std::string db_name = "PSDScreeningDBAtomDataTest.psd";
+
+    Chem::Molecule::SharedPointer mol = Chem::parseSMILES("Oc1ccc(cc1)C(=O)NCC[NH3+]");
+
+    BOOST_CHECK(mol);
+
+    prepareForPharmacophoreGeneration(*mol);
+
+    // required by the molecule hash code calculation
+
+    Chem::calcCIPPriorities(*mol, false);
+    Chem::calcAtomCIPConfigurations(*mol, false);
+    Chem::calcBondCIPConfigurations(*mol, false);
+
+    // coordinates far away from the origin that cannot be represented exactly in single precision
+
+    Math::Vector3DArray coords;
+
+    for (std::size_t i = 0; i < 2; i++) {
+        coords.clear();
+
+        for (std::size_t j = 0; j < mol->getNumAtoms(); j++)
+            coords.addElement(Math::vec(1234.56789 + j * 1.1111111 + i * 0.3333333, -987.654321 + j * 0.7777777, 0.1 * j - i * 0.2));
+
+        Chem::addConformation(*mol, coords, 0.0);
+    }
+
+    {
+        PSDScreeningDBCreator creator(db_name, ScreeningDBCreator::CREATE);
+
+        BOOST_CHECK(creator.process(*mol));
+    }
+
+    PSDScreeningDBAccessor accessor(db_name);
+    Chem::BasicMolecule db_mol;
+    Math::Vector3DArray db_coords;
+    Util::DArray radii;
+
+    BOOST_CHECK(accessor.getNumPharmacophores() == 2);
+
+    for (std::size_t i = 0; i < accessor.getNumPharmacophores(); i++) {
+        BOOST_CHECK(accessor.getAtomCoordinatesAndRadii(i, coords, radii));
+
+        accessor.getMolecule(accessor.getMoleculeIndex(i), db_mol);
+
+        db_coords.clear();
+        Chem::getConformation(db_mol, accessor.getConformationIndex(i), db_coords);
+
+        BOOST_CHECK(coords.getSize() == db_mol.getNumAtoms());
+        BOOST_CHECK(radii.getSize() == db_mol.getNumAtoms());
+        BOOST_CHECK(db_coords.getSize() == db_mol.getNumAtoms());
+
+        // the clash test must see exactly the same data as for the decoded molecule
+
+        for (std::size_t j = 0; j < db_mol.getNumAtoms() && j < coords.getSize() && j < db_coords.getSize(); j++) {
+            BOOST_CHECK_EQUAL(coords[j][0], db_coords[j][0]);
+            BOOST_CHECK_EQUAL(coords[j][1], db_coords[j][1]);
+            BOOST_CHECK_EQUAL(coords[j][2], db_coords[j][2]);
+            BOOST_CHECK_EQUAL(radii[j], Chem::AtomDictionary::getVdWRadius(getType(db_mol.getAtom(j))));
+        }
+    }
+
+    accessor.close();
+
+    std::remove(db_name.c_str());
+}
@@ -32,13 +32,14 @@
 using namespace CDPL;
 
 
-Util::BronKerboschAlgorithm::BronKerboschAlgorithm(const BitSetArray& adj_mtx)
+Util::BronKerboschAlgorithm::BronKerboschAlgorithm(const BitSetArray& adj_mtx, std::size_t min_clique_size)
 {
-    init(adj_mtx);
+    init(adj_mtx, min_clique_size);
 }
 
 Util::BronKerboschAlgorithm::BronKerboschAlgorithm(const BronKerboschAlgorithm& bka):
-    adjMatrix(bka.adjMatrix), nodeDegrees(bka.nodeDegrees)
+    adjMatrix(bka.adjMatrix), minCliqueSize(bka.minCliqueSize), nodeDegrees(bka.nodeDegrees),
+    numEmittedCliques(bka.numEmittedCliques), numPrunedBranches(bka.numPrunedBranches)
 {
     for (StateStack::const_iterator it = bka.states.begin(), end = bka.states.end(); it != end; ++it) {
         State* state = stateCache.get();
@@ -51,7 +52,10 @@ Util::BronKerboschAlgorithm::BronKerboschAlgorithm(const BronKerboschAlgorithm&
 Util::BronKerboschAlgorithm& Util::BronKerboschAlgorithm::operator=(const BronKerboschAlgorithm& bka)
 {
     adjMatrix = bka.adjMatrix;
+    minCliqueSize = bka.minCliqueSize;
     nodeDegrees = bka.nodeDegrees;
+    numEmittedCliques = bka.numEmittedCliques;
+    numPrunedBranches = bka.numPrunedBranches;
 
     states.clear();
     stateCache.putAll();
@@ -66,11 +70,14 @@ Util::BronKerboschAlgorithm& Util::BronKerboschAlgorithm::operator=(const BronKe
     return *this;
 }
 
-void Util::BronKerboschAlgorithm::init(const BitSetArray& adj_mtx)
+void Util::BronKerboschAlgorithm::init(const BitSetArray& adj_mtx, std::size_t min_clique_size)
 {
     using namespace std::placeholders;
 
     adjMatrix = &adj_mtx;
+    minCliqueSize = min_clique_size;
+    numEmittedCliques = 0;
+    numPrunedBranches = 0;
 
     nodeDegrees.clear();
 
@@ -100,11 +107,20 @@ bool Util::BronKerboschAlgorithm::nextClique(BitSet& clique)
         State* state = states.back();
 
         if (state->v == 0) {
+            if (minCliqueSize > 0 && !canReachMinCliqueSize(*state)) {
+                states.pop_back();
+                stateCache.put();
+
+                numPrunedBranches++;
+                continue;
+            }
+
             if (state->pool.none() && state->excl.none()) {
                 states.pop_back();
                 stateCache.put();
 
                 clique = state->curr;                
+                numEmittedCliques++;
                 return true;
             }
     
@@ -153,3 +169,47 @@ bool Util::BronKerboschAlgorithm::nextClique(BitSet& clique)
 
     return false;
 }
+
+std::size_t Util::BronKerboschAlgorithm::getMinCliqueSize() const
+{
+    return minCliqueSize;
+}
+
+std::size_t Util::BronKerboschAlgorithm::getNumEmittedCliques() const
+{
+    return numEmittedCliques;
+}
+
+std::size_t Util::BronKerboschAlgorithm::getNumPrunedBranches() const
+{
+    return numPrunedBranches;
+}
+
+bool Util::BronKerboschAlgorithm::canReachMinCliqueSize(const State& state)
+{
+    std::size_t clique_size = state.curr.count();
+
+    if (clique_size >= minCliqueSize)
+        return true;
+
+    // the number of color classes of a greedy coloring of the candidate nodes is an upper bound
+    // for the number of nodes that can still be added to the current clique
+
+    std::size_t num_req_colors = minCliqueSize - clique_size;
+
+    uncolNodes = state.pool;
+
+    for (std::size_t num_colors = 0; uncolNodes.any(); ) {
+        if (++num_colors >= num_req_colors)
+            return true;
+
+        colorClassCands = uncolNodes;
+
+        for (std::size_t i = colorClassCands.find_first(); i != BitSet::npos; i = colorClassCands.find_next(i)) {
+            uncolNodes.reset(i);
+            colorClassCands -= (*adjMatrix)[i];
+        }
+    }
+
+    return false;
+}
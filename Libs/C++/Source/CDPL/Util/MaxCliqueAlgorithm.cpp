@@ -0,0 +1,365 @@
+/* 
+ * MaxCliqueAlgorithm.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+
+#include "CDPL/Util/MaxCliqueAlgorithm.hpp"
+
+
+using namespace CDPL;
+
+
+namespace
+{
+
+    std::size_t findLowestBit(std::uint64_t word)
+    {
+        static const std::size_t DE_BRUIJN_INDICES[64] = {
+            0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+            62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+            63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+            46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+        };
+
+        return DE_BRUIJN_INDICES[((word & (~word + 1)) * 0x03F79D71B4CB0A89ULL) >> 58];
+    }
+
+    /*
+     * Fixed-width bitset implementing the subset of the boost::dynamic_bitset interface
+     * that is required by the maximum clique search.
+     */
+    template <std::size_t NumWords>
+    class FixedBitSet
+    {
+
+      public:
+        typedef std::uint64_t Word;
+
+        static const std::size_t npos = std::size_t(-1);
+
+        FixedBitSet() {
+            reset();
+        }
+
+        void resize(std::size_t) {}
+
+        void reset() {
+            std::fill(words, words + NumWords, Word(0));
+        }
+
+        void set(std::size_t i) {
+            words[i >> 6] |= (Word(1) << (i & 63));
+        }
+
+        void reset(std::size_t i) {
+            words[i >> 6] &= ~(Word(1) << (i & 63));
+        }
+
+        bool none() const {
+            for (std::size_t i = 0; i < NumWords; i++)
+                if (words[i])
+                    return false;
+
+            return true;
+        }
+
+        bool any() const {
+            return !none();
+        }
+
+        std::size_t find_first() const {
+            return findFrom(0, words[0]);
+        }
+
+        std::size_t find_next(std::size_t i) const {
+            if (++i >= NumWords * 64)
+                return npos;
+
+            std::size_t word_idx = i >> 6;
+
+            return findFrom(word_idx, words[word_idx] & (~Word(0) << (i & 63)));
+        }
+
+        FixedBitSet& operator&=(const FixedBitSet& bs) {
+            for (std::size_t i = 0; i < NumWords; i++)
+                words[i] &= bs.words[i];
+
+            return *this;
+        }
+
+        FixedBitSet& operator-=(const FixedBitSet& bs) {
+            for (std::size_t i = 0; i < NumWords; i++)
+                words[i] &= ~bs.words[i];
+
+            return *this;
+        }
+
+      private:
+        std::size_t findFrom(std::size_t word_idx, Word word) const {
+            while (true) {
+                if (word)
+                    return ((word_idx << 6) + findLowestBit(word));
+
+                if (++word_idx == NumWords)
+                    return npos;
+
+                word = words[word_idx];
+            }
+        }
+
+        Word words[NumWords];
+    };
+
+    template <typename BS>
+    class MaxCliqueSearch
+    {
+
+      public:
+        MaxCliqueSearch(const Util::BitSetArray& adj_mtx, std::size_t min_clique_size):
+            minCliqueSize(min_clique_size), numSearchNodes(0), numPrunedBranches(0)
+        {
+            std::size_t num_nodes = adj_mtx.getSize();
+
+            for (std::size_t i = 0; i < num_nodes; i++)
+                nodeOrder.push_back(i);
+
+            // nodes of high degree get the lowest indices and thus are colored first
+
+            std::stable_sort(nodeOrder.begin(), nodeOrder.end(),
+                             [&adj_mtx](std::size_t n1, std::size_t n2) {
+                                 return (adj_mtx[n1].count() > adj_mtx[n2].count());
+                             });
+
+            NodeArray node_indices(num_nodes);
+
+            for (std::size_t i = 0; i < num_nodes; i++)
+                node_indices[nodeOrder[i]] = i;
+
+            adjMatrix.resize(num_nodes);
+
+            for (std::size_t i = 0; i < num_nodes; i++) {
+                BS& nbrs = adjMatrix[node_indices[i]];
+                const Util::BitSet& orig_nbrs = adj_mtx[i];
+
+                initBitSet(nbrs, num_nodes);
+
+                for (std::size_t j = orig_nbrs.find_first(); j != Util::BitSet::npos; j = orig_nbrs.find_next(j))
+                    if (j < num_nodes && j != i)
+                        nbrs.set(node_indices[j]);
+            }
+
+            candNodeStack.resize(num_nodes + 1);
+            nodeOrderStack.resize(num_nodes + 1);
+            nodeColorStack.resize(num_nodes + 1);
+
+            initBitSet(uncolNodes, num_nodes);
+            initBitSet(colorClassCands, num_nodes);
+        }
+
+        bool search(Util::BitSet& clique) {
+            std::size_t num_nodes = adjMatrix.size();
+
+            if (num_nodes == 0)
+                return false;
+
+            BS& cand_nodes = candNodeStack[0];
+
+            initBitSet(cand_nodes, num_nodes);
+
+            for (std::size_t i = 0; i < num_nodes; i++)
+                cand_nodes.set(i);
+
+            expand(0);
+
+            if (maxClique.empty() || maxClique.size() < minCliqueSize)
+                return false;
+
+            clique.resize(num_nodes);
+            clique.reset();
+
+            for (NodeArray::const_iterator it = maxClique.begin(), end = maxClique.end(); it != end; ++it)
+                clique.set(nodeOrder[*it]);
+
+            return true;
+        }
+
+        std::size_t getNumSearchNodes() const {
+            return numSearchNodes;
+        }
+
+        std::size_t getNumPrunedBranches() const {
+            return numPrunedBranches;
+        }
+
+      private:
+        typedef std::vector<std::size_t> NodeArray;
+        typedef std::vector<BS>          BitSetArray;
+        typedef std::vector<NodeArray>   NodeArrayStack;
+
+        static void initBitSet(BS& bs, std::size_t num_bits) {
+            bs.resize(num_bits);
+            bs.reset();
+        }
+
+        void expand(std::size_t depth) {
+            BS&        cand_nodes  = candNodeStack[depth];
+            NodeArray& node_order  = nodeOrderStack[depth];
+            NodeArray& node_colors = nodeColorStack[depth];
+
+            colorSort(cand_nodes, node_order, node_colors);
+
+            for (std::size_t i = node_order.size(); i > 0; i--) {
+                if ((currClique.size() + node_colors[i - 1]) < getTargetCliqueSize()) {
+                    numPrunedBranches++;
+                    return;
+                }
+
+                std::size_t node = node_order[i - 1];
+                BS& new_cand_nodes = candNodeStack[depth + 1];
+
+                new_cand_nodes = cand_nodes;
+                new_cand_nodes &= adjMatrix[node];
+
+                currClique.push_back(node);
+                numSearchNodes++;
+
+                if (new_cand_nodes.none()) {
+                    if (currClique.size() >= getTargetCliqueSize())
+                        maxClique = currClique;
+
+                } else
+                    expand(depth + 1);
+
+                currClique.pop_back();
+                cand_nodes.reset(node);
+            }
+        }
+
+        void colorSort(const BS& cand_nodes, NodeArray& node_order, NodeArray& node_colors) {
+            node_order.clear();
+            node_colors.clear();
+
+            uncolNodes = cand_nodes;
+
+            for (std::size_t color = 1; uncolNodes.any(); color++) {
+                colorClassCands = uncolNodes;
+
+                for (std::size_t i = colorClassCands.find_first(); i != BS::npos; i = colorClassCands.find_next(i)) {
+                    uncolNodes.reset(i);
+                    colorClassCands -= adjMatrix[i];
+
+                    node_order.push_back(i);
+                    node_colors.push_back(color);
+                }
+            }
+        }
+
+        std::size_t getTargetCliqueSize() const {
+            return std::max(maxClique.size() + 1, minCliqueSize);
+        }
+
+        std::size_t    minCliqueSize;
+        std::size_t    numSearchNodes;
+        std::size_t    numPrunedBranches;
+        NodeArray      nodeOrder;
+        BitSetArray    adjMatrix;
+        BitSetArray    candNodeStack;
+        NodeArrayStack nodeOrderStack;
+        NodeArrayStack nodeColorStack;
+        BS             uncolNodes;
+        BS             colorClassCands;
+        NodeArray      currClique;
+        NodeArray      maxClique;
+    };
+}
+
+
+Util::MaxCliqueAlgorithm::MaxCliqueAlgorithm():
+    adjMatrix(0), minCliqueSize(0), numSearchNodes(0), numPrunedBranches(0)
+{}
+
+Util::MaxCliqueAlgorithm::MaxCliqueAlgorithm(const BitSetArray& adj_mtx, std::size_t min_clique_size)
+{
+    init(adj_mtx, min_clique_size);
+}
+
+void Util::MaxCliqueAlgorithm::init(const BitSetArray& adj_mtx, std::size_t min_clique_size)
+{
+    adjMatrix = &adj_mtx;
+    minCliqueSize = min_clique_size;
+    numSearchNodes = 0;
+    numPrunedBranches = 0;
+}
+
+bool Util::MaxCliqueAlgorithm::findMaxClique(BitSet& clique)
+{
+    numSearchNodes = 0;
+    numPrunedBranches = 0;
+
+    if (!adjMatrix)
+        return false;
+
+    std::size_t num_nodes = adjMatrix->getSize();
+
+    if (num_nodes <= 64)
+        return doFindMaxClique<FixedBitSet<1> >(clique);
+
+    if (num_nodes <= 128)
+        return doFindMaxClique<FixedBitSet<2> >(clique);
+
+    if (num_nodes <= 256)
+        return doFindMaxClique<FixedBitSet<4> >(clique);
+
+    return doFindMaxClique<BitSet>(clique);
+}
+
+std::size_t Util::MaxCliqueAlgorithm::getMinCliqueSize() const
+{
+    return minCliqueSize;
+}
+
+std::size_t Util::MaxCliqueAlgorithm::getNumSearchNodes() const
+{
+    return numSearchNodes;
+}
+
+std::size_t Util::MaxCliqueAlgorithm::getNumPrunedBranches() const
+{
+    return numPrunedBranches;
+}
+
+template <typename BS>
+bool Util::MaxCliqueAlgorithm::doFindMaxClique(BitSet& clique)
+{
+    MaxCliqueSearch<BS> search(*adjMatrix, minCliqueSize);
+
+    bool found = search.search(clique);
+
+    numSearchNodes = search.getNumSearchNodes();
+    numPrunedBranches = search.getNumPrunedBranches();
+
+    return found;
+}
@@ -224,5 +224,43 @@ BOOST_AUTO_TEST_CASE(BronKerboschAlgorithmTest)
 
     BOOST_CHECK(bka3.nextClique(clique) == false);
     BOOST_CHECK(bka3.nextClique(clique) == false);
-}
 
+//-------------
+
+    createAdjMatrix(100, adj_mtx);
+
+    createClique(0, 10, adj_mtx);
+    createClique(11, 15, adj_mtx);
+    createClique(14, 17, adj_mtx);
+    createClique(15, 50, adj_mtx);
+    createClique(49, 52, adj_mtx);
+    createClique(51, 95, adj_mtx);
+    createClique(90, 99, adj_mtx);
+    createClique(95, 100, adj_mtx);
+
+    BronKerboschAlgorithm bka5(adj_mtx, 9);
+
+    BOOST_CHECK_EQUAL(bka5.getMinCliqueSize(), 9);
+
+    BOOST_CHECK(bka5.nextClique(clique));
+    BOOST_CHECK_EQUAL(clique.count(), 10);
+
+    BOOST_CHECK(bka5.nextClique(clique));
+    BOOST_CHECK_EQUAL(clique.count(), 35);
+
+    BOOST_CHECK(bka5.nextClique(clique));
+    BOOST_CHECK_EQUAL(clique.count(), 44);
+
+    BOOST_CHECK(bka5.nextClique(clique));
+    BOOST_CHECK_EQUAL(clique.count(), 9);
+
+    BOOST_CHECK(bka5.nextClique(clique) == false);
+
+    BOOST_CHECK_EQUAL(bka5.getNumEmittedCliques(), 4);
+    BOOST_CHECK(bka5.getNumPrunedBranches() > 0);
+
+    bka5.init(adj_mtx, 45);
+
+    BOOST_CHECK(bka5.nextClique(clique) == false);
+    BOOST_CHECK_EQUAL(bka5.getNumEmittedCliques(), 0);
+}
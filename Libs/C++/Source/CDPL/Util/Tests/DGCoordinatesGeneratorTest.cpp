@@ -163,3 +163,67 @@ BOOST_AUTO_TEST_CASE(DGCoordinatesGeneratorTest)
     BOOST_CHECK(vol_rms_dev < 0.000001);
 }
 
+
+BOOST_AUTO_TEST_CASE(DGCoordinatesGeneratorBatchTest)
+{
+    using namespace CDPL;
+    using namespace Util;
+    
+    constexpr std::size_t NUM_POINTS     = 50;
+    constexpr std::size_t NUM_LANES      = 4;
+    constexpr double      BOX_SIZE       = 50.0; 
+
+    DGCoordinatesGenerator<3, double> coords_gen;
+    CoordsArray test_points(NUM_POINTS);
+    std::vector<CoordsArray> gen_coords(NUM_LANES, CoordsArray(NUM_POINTS));
+
+    boost::random::mt19937 rand_eng(100);
+    boost::random::uniform_real_distribution<double> rand_dist(-BOX_SIZE / 2, BOX_SIZE / 2);
+
+    for (std::size_t i = 0; i < NUM_POINTS; i++) {
+        test_points[i][2] = rand_dist(rand_eng);
+        test_points[i][1] = rand_dist(rand_eng);
+        test_points[i][0] = rand_dist(rand_eng);
+    }
+
+    for (std::size_t i = 0; i < NUM_POINTS; i++) {
+        for (std::size_t j = i + 1; j < NUM_POINTS; j++) {
+            double dist = length(test_points[i] - test_points[j]);
+            
+            coords_gen.addDistanceConstraint(i, j, dist, dist);
+        }
+    }
+
+    std::size_t vol_constr_inds[] = { 0, 1, 2, 3 };
+    double vol = calcVolume(vol_constr_inds, test_points);
+
+    coords_gen.addVolumeConstraint(0, 1, 2, 3, vol, vol);
+
+    for (std::size_t i = 0; i < NUM_LANES; i++) {
+        for (std::size_t j = 0; j < NUM_POINTS; j++) {
+            gen_coords[i][j][2] = rand_dist(rand_eng);
+            gen_coords[i][j][1] = rand_dist(rand_eng);
+            gen_coords[i][j][0] = rand_dist(rand_eng);
+        }
+    }
+
+    // a batch of a single coordinates array must give the same result as the non-batched embedding
+
+    CoordsArray ref_coords = gen_coords[0];
+
+    coords_gen.setRandomSeed(7);
+    coords_gen.generate(NUM_POINTS, ref_coords);
+
+    coords_gen.setRandomSeed(7);
+    coords_gen.generateBatch(NUM_POINTS, gen_coords.begin(), gen_coords.begin() + 1);
+
+    for (std::size_t i = 0; i < NUM_POINTS; i++)
+        BOOST_CHECK(length(ref_coords[i] - gen_coords[0][i]) == 0.0);
+
+    // all coordinates arrays of a batch get embedded
+
+    coords_gen.generateBatch(NUM_POINTS, gen_coords.begin(), gen_coords.end());
+
+    for (std::size_t i = 0; i < NUM_LANES; i++)
+        BOOST_CHECK(coords_gen.getDistanceError(gen_coords[i]) < 0.1);
+}
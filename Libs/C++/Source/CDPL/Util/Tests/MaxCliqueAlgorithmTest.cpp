@@ -0,0 +1,165 @@
+/* 
+ * MaxCliqueAlgorithmTest.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/test/auto_unit_test.hpp>
+
+#include "CDPL/Util/MaxCliqueAlgorithm.hpp"
+#include "CDPL/Util/BronKerboschAlgorithm.hpp"
+
+
+namespace
+{
+    void createAdjMatrix(std::size_t dim, CDPL::Util::BitSetArray& adj_mtx)
+    {
+        adj_mtx.clear();
+        
+        for (std::size_t i = 0; i < dim; i++) 
+            adj_mtx.addElement(CDPL::Util::BitSet(dim, false));
+    }
+
+    void createClique(std::size_t from, std::size_t to, CDPL::Util::BitSetArray& adj_mtx)
+    {
+        for (std::size_t i = from; i < to; i++) 
+            for (std::size_t j = from; j < to; j++)
+                if (i != j)
+                    adj_mtx[i].set(j);
+    }
+
+    void connect(std::size_t i, std::size_t j, CDPL::Util::BitSetArray& adj_mtx)
+    {
+        adj_mtx[i].set(j);
+        adj_mtx[j].set(i);
+    }
+
+    bool isClique(const CDPL::Util::BitSet& clique, const CDPL::Util::BitSetArray& adj_mtx)
+    {
+        for (std::size_t i = clique.find_first(); i != CDPL::Util::BitSet::npos; i = clique.find_next(i))
+            for (std::size_t j = clique.find_next(i); j != CDPL::Util::BitSet::npos; j = clique.find_next(j))
+                if (!adj_mtx[i].test(j))
+                    return false;
+
+        return true;
+    }
+
+    std::size_t getMaxCliqueSizeBK(const CDPL::Util::BitSetArray& adj_mtx)
+    {
+        CDPL::Util::BronKerboschAlgorithm bka(adj_mtx);
+        CDPL::Util::BitSet clique;
+        std::size_t max_size = 0;
+
+        while (bka.nextClique(clique))
+            max_size = std::max(max_size, clique.count());
+
+        return max_size;
+    }
+
+    void createRandomGraph(std::size_t dim, unsigned int seed, CDPL::Util::BitSetArray& adj_mtx)
+    {
+        createAdjMatrix(dim, adj_mtx);
+
+        for (std::size_t i = 0; i < dim; i++) 
+            for (std::size_t j = i + 1; j < dim; j++) {
+                seed = seed * 1103515245 + 12345;
+
+                if (((seed >> 16) % 100) < 60)
+                    connect(i, j, adj_mtx);
+            }
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(MaxCliqueAlgorithmTest)
+{
+    using namespace CDPL;
+    using namespace Util;
+
+    BitSetArray adj_mtx;
+    BitSet clique;
+
+    MaxCliqueAlgorithm mca1;
+
+    BOOST_CHECK(mca1.findMaxClique(clique) == false);
+
+    createAdjMatrix(100, adj_mtx);
+
+    createClique(0, 10, adj_mtx);
+    createClique(11, 15, adj_mtx);
+    createClique(14, 17, adj_mtx);
+    createClique(15, 50, adj_mtx);
+    createClique(49, 52, adj_mtx);
+    createClique(51, 95, adj_mtx);
+    createClique(90, 99, adj_mtx);
+    createClique(95, 100, adj_mtx);
+
+    mca1.init(adj_mtx);
+
+    BOOST_CHECK(mca1.findMaxClique(clique));
+    BOOST_CHECK_EQUAL(clique.size(), 100);
+    BOOST_CHECK_EQUAL(clique.count(), 44);
+    BOOST_CHECK_EQUAL(clique.find_first(), 51);
+    BOOST_CHECK(isClique(clique, adj_mtx));
+    BOOST_CHECK(mca1.getNumSearchNodes() > 0);
+
+    mca1.init(adj_mtx, 44);
+
+    BOOST_CHECK_EQUAL(mca1.getMinCliqueSize(), 44);
+    BOOST_CHECK(mca1.findMaxClique(clique));
+    BOOST_CHECK_EQUAL(clique.count(), 44);
+
+    mca1.init(adj_mtx, 45);
+
+    BOOST_CHECK(mca1.findMaxClique(clique) == false);
+
+//-------------
+
+    createAdjMatrix(6, adj_mtx);
+    
+    connect(0, 1, adj_mtx);
+    connect(1, 4, adj_mtx);
+    connect(4, 0, adj_mtx);
+    connect(4, 3, adj_mtx);
+    connect(1, 2, adj_mtx);
+    connect(2, 3, adj_mtx);
+    connect(3, 5, adj_mtx);
+
+    MaxCliqueAlgorithm mca2(adj_mtx);
+
+    BOOST_CHECK(mca2.findMaxClique(clique));
+    BOOST_CHECK_EQUAL(clique.count(), 3);
+    BOOST_CHECK(clique.test(0) && clique.test(1) && clique.test(4));
+
+//-------------
+
+    for (std::size_t dim = 20; dim <= 300; dim += 70) {
+        createRandomGraph(dim, unsigned(dim), adj_mtx);
+
+        MaxCliqueAlgorithm mca3(adj_mtx);
+
+        BOOST_CHECK(mca3.findMaxClique(clique));
+        BOOST_CHECK(isClique(clique, adj_mtx));
+
+        if (dim <= 90)
+            BOOST_CHECK_EQUAL(clique.count(), getMaxCliqueSizeBK(adj_mtx));
+    }
+}
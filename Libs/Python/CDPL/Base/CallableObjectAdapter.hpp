@@ -30,6 +30,8 @@
 #include <boost/python.hpp>
 #include <boost/type_traits.hpp>
 
+#include "GILGuard.hpp"
+
 
 namespace CDPLPythonBase
 {
@@ -88,6 +90,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             return python::call<ResType>(callable.ptr(), makeRef(arg1), makeRef(arg2), makeRef(arg3), makeRef(arg4));
         }
 
@@ -107,6 +111,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             result = python::call<python::object>(callable.ptr(), makeRef(arg1), makeRef(arg2), makeRef(arg3), makeRef(arg4));
 
             return python::extract<ResType&>(result);
@@ -131,6 +137,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             return python::call<ResType>(callable.ptr(), makeRef(arg1), makeRef(arg2), makeRef(arg3));
         }
 
@@ -150,6 +158,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             result = python::call<python::object>(callable.ptr(), makeRef(arg1), makeRef(arg2), makeRef(arg3));
 
             return python::extract<ResType&>(result);
@@ -174,6 +184,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             return python::call<ResType>(callable.ptr(), makeRef(arg1), makeRef(arg2));
         }
 
@@ -193,6 +205,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             result = python::call<python::object>(callable.ptr(), makeRef(arg1), makeRef(arg2));
 
             return python::extract<ResType&>(result);
@@ -217,6 +231,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             return python::call<ResType>(callable.ptr(), makeRef(arg));
         }
 
@@ -236,6 +252,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             result = python::call<python::object>(callable.ptr(), makeRef(arg));
 
             return python::extract<ResType&>(result);
@@ -260,6 +278,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             return python::call<ResType>(callable.ptr());
         }
 
@@ -279,6 +299,8 @@ namespace CDPLPythonBase
         {
             using namespace boost;
 
+            GILAcquireGuard gil;
+
             result = python::call<python::object>(callable.ptr());
 
             return python::extract<ResType&>(result);
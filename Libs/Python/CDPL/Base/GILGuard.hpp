@@ -0,0 +1,100 @@
+/*
+ * GILGuard.hpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#ifndef CDPL_PYTHON_BASE_GILGUARD_HPP
+#define CDPL_PYTHON_BASE_GILGUARD_HPP
+
+#include <boost/python.hpp>
+
+
+namespace CDPLPythonBase
+{
+
+    /*
+     * Releases the global interpreter lock for the lifetime of the guard so that other Python threads
+     * can run while a long-running C++ operation is in progress. The lock gets reacquired on destruction
+     * (also if an exception is thrown) before control returns to Boost.Python.
+     */
+    class GILReleaseGuard
+    {
+
+      public:
+        explicit GILReleaseGuard(bool release = true):
+            threadState(release ? PyEval_SaveThread() : 0) {}
+
+        ~GILReleaseGuard()
+        {
+            if (threadState)
+                PyEval_RestoreThread(threadState);
+        }
+
+        GILReleaseGuard(const GILReleaseGuard&) = delete;
+
+        GILReleaseGuard& operator=(const GILReleaseGuard&) = delete;
+
+      private:
+        PyThreadState* threadState;
+    };
+
+    /*
+     * Makes sure that the calling thread holds the global interpreter lock while Python code gets
+     * executed (e.g. a Python callable invoked as callback from C++ code that runs with released GIL).
+     */
+    class GILAcquireGuard
+    {
+
+      public:
+        GILAcquireGuard():
+            state(PyGILState_Ensure()) {}
+
+        ~GILAcquireGuard()
+        {
+            PyGILState_Release(state);
+        }
+
+        GILAcquireGuard(const GILAcquireGuard&) = delete;
+
+        GILAcquireGuard& operator=(const GILAcquireGuard&) = delete;
+
+      private:
+        PyGILState_STATE state;
+    };
+
+    /*
+     * Tells whether the argument object is an instance of a Python class derived from an exported
+     * C++ class. Calls to the virtual methods of such an object execute Python code and therefore
+     * must not happen while the global interpreter lock is released.
+     */
+    template <typename T>
+    bool isPythonImplemented(const T& obj)
+    {
+        using namespace boost;
+
+        const python::detail::wrapper_base* wrapper = dynamic_cast<const python::detail::wrapper_base*>(&obj);
+
+        return (wrapper && python::detail::wrapper_base_::get_owner(*wrapper));
+    }
+} // namespace CDPLPythonBase
+
+#endif // CDPL_PYTHON_BASE_GILGUARD_HPP
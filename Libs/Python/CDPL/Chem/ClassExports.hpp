@@ -41,6 +41,7 @@ namespace CDPLPythonChem
     void exportBasicAtom();
     void exportBasicBond();
     void exportBasicMolecule();
+    void exportFrozenMolecule();
     void exportBasicReaction();
     void exportFragment();
     void exportElectronSystem();
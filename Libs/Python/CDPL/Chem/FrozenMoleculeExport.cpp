@@ -0,0 +1,76 @@
+/* 
+ * FrozenMoleculeExport.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/Chem/FrozenMolecule.hpp"
+
+#include "ClassExports.hpp"
+
+
+#define MAKE_ARRAY_GETTER_DEF(FUNC_NAME, PROP_NAME)                                              \
+    .def(#FUNC_NAME, &Chem::FrozenMolecule::FUNC_NAME, python::arg("self"),                      \
+         python::return_internal_reference<>())                                                  \
+    .add_property(#PROP_NAME, python::make_function(&Chem::FrozenMolecule::FUNC_NAME,            \
+                                                    python::return_internal_reference<>()))
+
+
+void CDPLPythonChem::exportFrozenMolecule()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    void (Chem::FrozenMolecule::*copyFrozenMolFunc)(const Chem::FrozenMolecule&) = &Chem::FrozenMolecule::copy;
+    void (Chem::FrozenMolecule::*copyMolFunc)(const Chem::Molecule&) = &Chem::FrozenMolecule::copy;
+    void (Chem::FrozenMolecule::*copyMolGraphFunc)(const Chem::MolecularGraph&) = &Chem::FrozenMolecule::copy;
+
+    Chem::FrozenMolecule& (Chem::FrozenMolecule::*assignFrozenMolFunc)(const Chem::FrozenMolecule&) = &Chem::FrozenMolecule::operator=;
+    Chem::Molecule& (Chem::Molecule::*assignMolFunc)(const Chem::Molecule&) = &Chem::Molecule::operator=;
+    Chem::Molecule& (Chem::Molecule::*assignMolGraphFunc)(const Chem::MolecularGraph&) = &Chem::Molecule::operator=;
+
+    python::class_<Chem::FrozenMolecule, Chem::FrozenMolecule::SharedPointer,
+                   python::bases<Chem::Molecule> >("FrozenMolecule", python::no_init)
+        .def(python::init<>(python::arg("self")))
+        .def(python::init<const Chem::FrozenMolecule&>((python::arg("self"), python::arg("mol"))))
+        .def(python::init<const Chem::MolecularGraph&>((python::arg("self"), python::arg("molgraph"))))
+        .def("copy", copyFrozenMolFunc, (python::arg("self"), python::arg("mol")))
+        .def("copy", copyMolFunc, (python::arg("self"), python::arg("mol")))
+        .def("copy", copyMolGraphFunc, (python::arg("self"), python::arg("molgraph")))
+        .def("assign", assignFrozenMolFunc, (python::arg("self"), python::arg("mol")), python::return_self<>())
+        .def("assign", assignMolFunc, (python::arg("self"), python::arg("mol")), python::return_self<>())
+        .def("assign", assignMolGraphFunc, (python::arg("self"), python::arg("molgraph")), python::return_self<>())
+        .def("updatePropertyArrays", &Chem::FrozenMolecule::updatePropertyArrays, python::arg("self"))
+        MAKE_ARRAY_GETTER_DEF(getNeighborOffsets, neighborOffsets)
+        MAKE_ARRAY_GETTER_DEF(getNeighborAtomIndices, neighborAtomIndices)
+        MAKE_ARRAY_GETTER_DEF(getNeighborBondIndices, neighborBondIndices)
+        MAKE_ARRAY_GETTER_DEF(getAtomTypes, atomTypes)
+        MAKE_ARRAY_GETTER_DEF(getAtomFormalCharges, atomFormalCharges)
+        MAKE_ARRAY_GETTER_DEF(getAtomImplicitHydrogenCounts, atomImplicitHydrogenCounts)
+        MAKE_ARRAY_GETTER_DEF(getAromaticAtomMask, aromaticAtomMask)
+        MAKE_ARRAY_GETTER_DEF(getRingAtomMask, ringAtomMask)
+        MAKE_ARRAY_GETTER_DEF(getAtom3DCoordinates, atom3DCoordinates)
+        MAKE_ARRAY_GETTER_DEF(getBondOrders, bondOrders)
+        MAKE_ARRAY_GETTER_DEF(getAromaticBondMask, aromaticBondMask)
+        MAKE_ARRAY_GETTER_DEF(getRingBondMask, ringBondMask);
+}
@@ -46,6 +46,8 @@ void CDPLPythonChem::exportFunctionWrappers()
     using namespace CDPL;
     using namespace Chem;
 
+    CDPLPythonBase::Function0Export<bool()>("BoolFunctor");
+
     CDPLPythonBase::Function1Export<const MatchExpression<Atom, MolecularGraph>::SharedPointer&(const Atom&), Atom&>("AtomMatchExpressionPtrAtomFunctor");
     CDPLPythonBase::Function1Export<const MatchExpression<Bond, MolecularGraph>::SharedPointer&(const Bond&), Bond&>("BondMatchExpressionPtrBondFunctor");
     CDPLPythonBase::Function1Export<const MatchExpression<MolecularGraph>::SharedPointer&(const MolecularGraph&)>("MolGraphMatchExpressionPtrMolGraphFunctor");
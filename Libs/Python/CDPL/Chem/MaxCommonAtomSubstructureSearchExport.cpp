@@ -67,6 +67,18 @@ void CDPLPythonChem::exportMaxCommonAtomSubstructureSearch()
              python::arg("self"))
         .def("setMinSubstructureSize", &Chem::MaxCommonAtomSubstructureSearch::setMinSubstructureSize, 
              (python::arg("self"), python::arg("min_size")))
+        .def("setAbortCallback", &Chem::MaxCommonAtomSubstructureSearch::setAbortCallback, 
+             (python::arg("self"), python::arg("func")))
+        .def("getAbortCallback", &Chem::MaxCommonAtomSubstructureSearch::getAbortCallback, 
+             python::arg("self"), python::return_internal_reference<>())
+        .def("setTimeout", &Chem::MaxCommonAtomSubstructureSearch::setTimeout, (python::arg("self"), python::arg("mil_secs")))
+        .def("getTimeout", &Chem::MaxCommonAtomSubstructureSearch::getTimeout, python::arg("self"))
+        .def("setMaxNumSearchNodes", &Chem::MaxCommonAtomSubstructureSearch::setMaxNumSearchNodes, 
+             (python::arg("self"), python::arg("max_num_nodes")))
+        .def("getMaxNumSearchNodes", &Chem::MaxCommonAtomSubstructureSearch::getMaxNumSearchNodes, python::arg("self"))
+        .def("setNumThreads", &Chem::MaxCommonAtomSubstructureSearch::setNumThreads, (python::arg("self"), python::arg("num_threads")))
+        .def("getNumThreads", &Chem::MaxCommonAtomSubstructureSearch::getNumThreads, python::arg("self"))
+        .def("searchAborted", &Chem::MaxCommonAtomSubstructureSearch::searchAborted, python::arg("self"))
         .def("setQuery", &Chem::MaxCommonAtomSubstructureSearch::setQuery, 
              (python::arg("self"), python::arg("query")), python::with_custodian_and_ward<1, 2>())
         .add_property("numMappings", &Chem::MaxCommonAtomSubstructureSearch::getNumMappings)
@@ -75,6 +87,13 @@ void CDPLPythonChem::exportMaxCommonAtomSubstructureSearch()
                       &Chem::MaxCommonAtomSubstructureSearch::setMaxNumMappings)
         .add_property("minSubstructureSize", &Chem::MaxCommonAtomSubstructureSearch::getMinSubstructureSize, 
                       &Chem::MaxCommonAtomSubstructureSearch::setMinSubstructureSize)
+        .add_property("abortCallback", python::make_function(&Chem::MaxCommonAtomSubstructureSearch::getAbortCallback, 
+                                                             python::return_internal_reference<>()),
+                      &Chem::MaxCommonAtomSubstructureSearch::setAbortCallback)
+        .add_property("timeout", &Chem::MaxCommonAtomSubstructureSearch::getTimeout, &Chem::MaxCommonAtomSubstructureSearch::setTimeout)
+        .add_property("maxNumSearchNodes", &Chem::MaxCommonAtomSubstructureSearch::getMaxNumSearchNodes, 
+                      &Chem::MaxCommonAtomSubstructureSearch::setMaxNumSearchNodes)
+        .add_property("numThreads", &Chem::MaxCommonAtomSubstructureSearch::getNumThreads, &Chem::MaxCommonAtomSubstructureSearch::setNumThreads)
         .def("__getitem__", getMappingFunc, (python::arg("self"), python::arg("idx")), 
              python::return_internal_reference<1>())
         .def("__len__", &Chem::MaxCommonAtomSubstructureSearch::getNumMappings, python::arg("self"))
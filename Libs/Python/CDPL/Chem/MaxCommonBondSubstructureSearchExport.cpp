@@ -65,6 +65,18 @@ void CDPLPythonChem::exportMaxCommonBondSubstructureSearch()
              python::arg("self"))
         .def("setMinSubstructureSize", &Chem::MaxCommonBondSubstructureSearch::setMinSubstructureSize, 
              (python::arg("self"), python::arg("min_size")))
+        .def("setAbortCallback", &Chem::MaxCommonBondSubstructureSearch::setAbortCallback, 
+             (python::arg("self"), python::arg("func")))
+        .def("getAbortCallback", &Chem::MaxCommonBondSubstructureSearch::getAbortCallback, 
+             python::arg("self"), python::return_internal_reference<>())
+        .def("setTimeout", &Chem::MaxCommonBondSubstructureSearch::setTimeout, (python::arg("self"), python::arg("mil_secs")))
+        .def("getTimeout", &Chem::MaxCommonBondSubstructureSearch::getTimeout, python::arg("self"))
+        .def("setMaxNumSearchNodes", &Chem::MaxCommonBondSubstructureSearch::setMaxNumSearchNodes, 
+             (python::arg("self"), python::arg("max_num_nodes")))
+        .def("getMaxNumSearchNodes", &Chem::MaxCommonBondSubstructureSearch::getMaxNumSearchNodes, python::arg("self"))
+        .def("setNumThreads", &Chem::MaxCommonBondSubstructureSearch::setNumThreads, (python::arg("self"), python::arg("num_threads")))
+        .def("getNumThreads", &Chem::MaxCommonBondSubstructureSearch::getNumThreads, python::arg("self"))
+        .def("searchAborted", &Chem::MaxCommonBondSubstructureSearch::searchAborted, python::arg("self"))
         .def("setQuery", &Chem::MaxCommonBondSubstructureSearch::setQuery, 
              (python::arg("self"), python::arg("query")), python::with_custodian_and_ward<1, 2>())
         .add_property("numMappings", &Chem::MaxCommonBondSubstructureSearch::getNumMappings)
@@ -73,6 +85,13 @@ void CDPLPythonChem::exportMaxCommonBondSubstructureSearch()
                       &Chem::MaxCommonBondSubstructureSearch::setMaxNumMappings)
         .add_property("minSubstructureSize", &Chem::MaxCommonBondSubstructureSearch::getMinSubstructureSize, 
                       &Chem::MaxCommonBondSubstructureSearch::setMinSubstructureSize)
+        .add_property("abortCallback", python::make_function(&Chem::MaxCommonBondSubstructureSearch::getAbortCallback, 
+                                                             python::return_internal_reference<>()),
+                      &Chem::MaxCommonBondSubstructureSearch::setAbortCallback)
+        .add_property("timeout", &Chem::MaxCommonBondSubstructureSearch::getTimeout, &Chem::MaxCommonBondSubstructureSearch::setTimeout)
+        .add_property("maxNumSearchNodes", &Chem::MaxCommonBondSubstructureSearch::getMaxNumSearchNodes, 
+                      &Chem::MaxCommonBondSubstructureSearch::setMaxNumSearchNodes)
+        .add_property("numThreads", &Chem::MaxCommonBondSubstructureSearch::getNumThreads, &Chem::MaxCommonBondSubstructureSearch::setNumThreads)
         .def("__getitem__", getMappingFunc, (python::arg("self"), python::arg("idx")), 
              python::return_internal_reference<1>())
         .def("__len__", &Chem::MaxCommonBondSubstructureSearch::getNumMappings, python::arg("self"))
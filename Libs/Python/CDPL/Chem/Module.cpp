@@ -46,6 +46,7 @@ BOOST_PYTHON_MODULE(_chem)
     exportBasicAtom();
     exportBasicBond();
     exportBasicMolecule();
+    exportFrozenMolecule();
     exportBasicReaction();
     exportFragment();
     exportElectronSystem();
@@ -239,6 +240,7 @@ BOOST_PYTHON_MODULE(_chem)
 
     exportAtomPropertyFlags();
     exportBondPropertyFlags();
+    exportPerceptionFlags();
     exportReactionRoles();
     exportAtomTypes();
     exportAtomConfigurations();
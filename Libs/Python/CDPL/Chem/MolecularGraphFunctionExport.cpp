@@ -291,6 +291,14 @@ void CDPLPythonChem::exportMolecularGraphFunctions()
 
     python::def("calcBasicProperties", &Chem::calcBasicProperties,
                 (python::arg("molgraph"), python::arg("overwrite")));
+    python::def("getPerceptionState", &Chem::getPerceptionState, python::arg("molgraph"));
+    python::def("setPerceptionState", &Chem::setPerceptionState, (python::arg("molgraph"), python::arg("flags")));
+    python::def("clearPerceptionState", &Chem::clearPerceptionState, python::arg("molgraph"));
+    python::def("prepareMolecularGraph", &Chem::prepareMolecularGraph,
+                (python::arg("molgraph"), python::arg("flags"), python::arg("overwrite")));
+    python::def("getNumPerformedPerceptions", &Chem::getNumPerformedPerceptions);
+    python::def("getNumSkippedPerceptions", &Chem::getNumSkippedPerceptions);
+    python::def("resetPerceptionCounters", &Chem::resetPerceptionCounters);
 
     EXPORT_MOLGRAPH_FUNCS_COPY_REF_CW(AromaticSubstructure, substruct)
     EXPORT_MOLGRAPH_FUNCS_COPY_REF_CW(CyclicSubstructure, substruct)
@@ -23,10 +23,12 @@
 
 
 #include "CDPL/Chem/Molecule.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
 
 #include "Base/DataReaderExport.hpp"
 #include "Util/CompoundDataReaderExport.hpp"
 #include "Util/MultiFormatDataReaderExport.hpp"
+#include "Util/ParallelDataReaderExport.hpp"
 
 #include "ClassExports.hpp"
 
@@ -44,4 +46,5 @@ void CDPLPythonChem::exportMoleculeReader()
     CDPLPythonBase::DataReaderExport<Chem::Molecule>("MoleculeReaderBase", "mol");
     CDPLPythonUtil::CompoundDataReaderExport<Chem::Molecule>("CompoundMoleculeReader");
     CDPLPythonUtil::MultiFormatDataReaderExport<Chem::Molecule>("MoleculeReader");
+    CDPLPythonUtil::ParallelDataReaderExport<Chem::Molecule, Chem::BasicMolecule>("ParallelMoleculeReader");
 }
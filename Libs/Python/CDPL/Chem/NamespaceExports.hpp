@@ -31,6 +31,7 @@ namespace CDPLPythonChem
 
     void exportAtomPropertyFlags();
     void exportBondPropertyFlags();
+    void exportPerceptionFlags();
     void exportReactionRoles();
     void exportAtomTypes();
     void exportAtomConfigurations();
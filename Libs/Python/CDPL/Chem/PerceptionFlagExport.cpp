@@ -0,0 +1,55 @@
+/* 
+ * PerceptionFlagExport.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/Chem/PerceptionFlag.hpp"
+
+#include "NamespaceExports.hpp"
+
+
+namespace 
+{
+
+    struct PerceptionFlag {};
+}
+
+
+void CDPLPythonChem::exportPerceptionFlags()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    python::class_<PerceptionFlag, boost::noncopyable>("PerceptionFlag", python::no_init)
+        .def_readonly("NONE", &Chem::PerceptionFlag::NONE)
+        .def_readonly("COMPONENTS", &Chem::PerceptionFlag::COMPONENTS)
+        .def_readonly("SSSR", &Chem::PerceptionFlag::SSSR)
+        .def_readonly("RING_FLAGS", &Chem::PerceptionFlag::RING_FLAGS)
+        .def_readonly("IMPLICIT_H_COUNTS", &Chem::PerceptionFlag::IMPLICIT_H_COUNTS)
+        .def_readonly("HYBRIDIZATION_STATES", &Chem::PerceptionFlag::HYBRIDIZATION_STATES)
+        .def_readonly("AROMATICITY_FLAGS", &Chem::PerceptionFlag::AROMATICITY_FLAGS)
+        .def_readonly("CIP_PRIORITIES", &Chem::PerceptionFlag::CIP_PRIORITIES)
+        .def_readonly("TOPOLOGICAL_DISTANCE_MATRIX", &Chem::PerceptionFlag::TOPOLOGICAL_DISTANCE_MATRIX)
+        .def_readonly("BASIC_PROPERTIES", &Chem::PerceptionFlag::BASIC_PROPERTIES);
+}
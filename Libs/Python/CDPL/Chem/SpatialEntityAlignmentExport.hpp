@@ -89,6 +89,8 @@ namespace CDPLPythonChem
                      (python::arg("self"), python::arg("min_size")))
                 .def("getMinTopologicalMappingSize", &AlignmentType::getMinTopologicalMappingSize,
                      python::arg("self"))
+                .def("getNumEmittedCliques", &AlignmentType::getNumEmittedCliques, python::arg("self"))
+                .def("getNumPrunedCliqueSearchBranches", &AlignmentType::getNumPrunedCliqueSearchBranches, python::arg("self"))
                 .def("reset", &AlignmentType::reset, python::arg("reset"))
                 .def("nextAlignment", &AlignmentType::nextAlignment,
                      python::arg("self"))
@@ -102,6 +104,8 @@ namespace CDPLPythonChem
                               python::make_function(&AlignmentType::getTopologicalMapping, python::return_internal_reference<>()))
                 .add_property("minTopologicalMappingSize", &AlignmentType::getMinTopologicalMappingSize,
                               &AlignmentType::setMinTopologicalMappingSize)
+                .add_property("numEmittedCliques", &AlignmentType::getNumEmittedCliques)
+                .add_property("numPrunedCliqueSearchBranches", &AlignmentType::getNumPrunedCliqueSearchBranches)
                 .add_property("exhaustiveSearch", &AlignmentType::exhaustiveSearchPerformed,
                               &AlignmentType::performExhaustiveSearch)
                 .add_property("transform",
@@ -59,6 +59,11 @@ namespace CDPLPythonChem
                      (python::arg("self"), python::arg("func")))
                 .def("getEntityPairMatchFunction", &AlignmentType::getEntityPairMatchFunction,
                      python::arg("self"), python::return_internal_reference<>())
+                .def("setMinMappingSize", &AlignmentType::setMinMappingSize,
+                     (python::arg("self"), python::arg("min_size")))
+                .def("getMinMappingSize", &AlignmentType::getMinMappingSize, python::arg("self"))
+                .def("getNumEmittedCliques", &AlignmentType::getNumEmittedCliques, python::arg("self"))
+                .def("getNumPrunedCliqueSearchBranches", &AlignmentType::getNumPrunedCliqueSearchBranches, python::arg("self"))
                 .def("addEntity", &addEntityFunc, (python::arg("self"), python::arg("entity"), python::arg("first_set")),
                      python::with_custodian_and_ward<1, 2>())
                 .def("clearEntities", &AlignmentType::clearEntities,
@@ -78,7 +83,10 @@ namespace CDPLPythonChem
                               &AlignmentType::setEntityMatchFunction)
                 .add_property("entityPairMatchFunction",
                               python::make_function(&AlignmentType::getEntityPairMatchFunction, python::return_internal_reference<>()),
-                              &AlignmentType::setEntityPairMatchFunction);
+                              &AlignmentType::setEntityPairMatchFunction)
+                .add_property("minMappingSize", &AlignmentType::getMinMappingSize, &AlignmentType::setMinMappingSize)
+                .add_property("numEmittedCliques", &AlignmentType::getNumEmittedCliques)
+                .add_property("numPrunedCliqueSearchBranches", &AlignmentType::getNumPrunedCliqueSearchBranches);
         }
 
         static boost::python::object getEntitiesFunc(AlignmentType& alignment, bool first_set)
@@ -47,6 +47,7 @@ namespace CDPLPythonConfGen
     void exportRMSDConformerSelector();
     void exportStructureGeneratorSettings();
     void exportConformerGeneratorSettings();
+    void exportConformerGeneratorStatistics();
     void exportFragmentConformerGeneratorSettings();
     void exportFragmentAssemblerSettings();
     void exportStructureGenerator();
@@ -28,11 +28,42 @@
 #include "CDPL/Chem/MolecularGraph.hpp"
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/GILGuard.hpp"
 //#include "Base/CopyAssOp.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    unsigned int generate1(CDPL::ConfGen::ConformerGenerator& gen, const CDPL::Chem::MolecularGraph& molgraph)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph));
+
+        return gen.generate(molgraph);
+    }
+
+    unsigned int generate2(CDPL::ConfGen::ConformerGenerator& gen, const CDPL::Chem::MolecularGraph& molgraph,
+                           const CDPL::Chem::MolecularGraph& fixed_substr)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph) &&
+                                                  !CDPLPythonBase::isPythonImplemented(fixed_substr));
+
+        return gen.generate(molgraph, fixed_substr);
+    }
+
+    unsigned int generate3(CDPL::ConfGen::ConformerGenerator& gen, const CDPL::Chem::MolecularGraph& molgraph,
+                           const CDPL::Chem::MolecularGraph& fixed_substr, const CDPL::Math::Vector3DArray& fixed_substr_coords)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph) &&
+                                                  !CDPLPythonBase::isPythonImplemented(fixed_substr));
+
+        return gen.generate(molgraph, fixed_substr, fixed_substr_coords);
+    }
+}
+
+
 void CDPLPythonConfGen::exportConformerGenerator()
 {
     using namespace boost;
@@ -68,15 +99,13 @@ void CDPLPythonConfGen::exportConformerGenerator()
              (python::arg("self"), python::arg("func")))
         .def("getLogMessageCallback", &ConfGen::ConformerGenerator::getLogMessageCallback, 
              python::arg("self"), python::return_internal_reference<>())
-        .def("generate", static_cast<unsigned int (ConfGen::ConformerGenerator::*)
-             (const Chem::MolecularGraph&)>(&ConfGen::ConformerGenerator::generate),
+        .def("getStatistics", &ConfGen::ConformerGenerator::getStatistics, 
+             python::arg("self"), python::return_internal_reference<>())
+        .def("generate", &generate1,
              (python::arg("self"), python::arg("molgraph")))
-        .def("generate", static_cast<unsigned int (ConfGen::ConformerGenerator::*)
-             (const Chem::MolecularGraph&, const Chem::MolecularGraph&)>(&ConfGen::ConformerGenerator::generate),
+        .def("generate", &generate2,
              (python::arg("self"), python::arg("molgraph"), python::arg("fixed_substr")))
-        .def("generate", static_cast<unsigned int (ConfGen::ConformerGenerator::*)
-             (const Chem::MolecularGraph&, const Chem::MolecularGraph&, const Math::Vector3DArray&)>
-             (&ConfGen::ConformerGenerator::generate),
+        .def("generate", &generate3,
              (python::arg("self"), python::arg("molgraph"), python::arg("fixed_substr"), python::arg("fixed_substr_coords")))
         .def("setConformers", &ConfGen::ConformerGenerator::setConformers,
              (python::arg("self"), python::arg("molgraph")))
@@ -100,6 +129,8 @@ void CDPLPythonConfGen::exportConformerGenerator()
                       python::make_function(&ConfGen::ConformerGenerator::getTimeoutCallback,
                                             python::return_internal_reference<>()),
                       &ConfGen::ConformerGenerator::setTimeoutCallback)
+        .add_property("statistics", python::make_function(&ConfGen::ConformerGenerator::getStatistics,
+                                                          python::return_internal_reference<>()))
         .add_property("logMessageCallback", 
                       python::make_function(&ConfGen::ConformerGenerator::getLogMessageCallback,
                                             python::return_internal_reference<>()),
@@ -159,6 +159,10 @@ void CDPLPythonConfGen::exportConformerGeneratorSettings()
              (python::arg("self"), python::arg("size")))
         .def("getConvergenceCheckCycleSize", &ConfGen::ConformerGeneratorSettings::getConvergenceCheckCycleSize, 
              python::arg("self"))
+        .def("setNumSamplingThreads", &ConfGen::ConformerGeneratorSettings::setNumSamplingThreads, 
+             (python::arg("self"), python::arg("num_threads")))
+        .def("getNumSamplingThreads", &ConfGen::ConformerGeneratorSettings::getNumSamplingThreads, 
+             python::arg("self"))
         .def("setMacrocycleRotorBondCountThreshold", &ConfGen::ConformerGeneratorSettings::setMacrocycleRotorBondCountThreshold, 
              (python::arg("self"), python::arg("max_size")))
         .def("getMacrocycleRotorBondCountThreshold", &ConfGen::ConformerGeneratorSettings::getMacrocycleRotorBondCountThreshold, 
@@ -221,6 +225,8 @@ void CDPLPythonConfGen::exportConformerGeneratorSettings()
                       &ConfGen::ConformerGeneratorSettings::setMaxNumSampledConformers)
         .add_property("convCheckCycleSize", &ConfGen::ConformerGeneratorSettings::getConvergenceCheckCycleSize, 
                       &ConfGen::ConformerGeneratorSettings::setConvergenceCheckCycleSize)
+        .add_property("numSamplingThreads", &ConfGen::ConformerGeneratorSettings::getNumSamplingThreads, 
+                      &ConfGen::ConformerGeneratorSettings::setNumSamplingThreads)
         .add_property("macrocycleRotorBondCountThresh", &ConfGen::ConformerGeneratorSettings::getMacrocycleRotorBondCountThreshold, 
                       &ConfGen::ConformerGeneratorSettings::setMacrocycleRotorBondCountThreshold)
         .add_property("fragmentBuildSettings", 
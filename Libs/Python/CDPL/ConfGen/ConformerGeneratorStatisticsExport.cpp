@@ -0,0 +1,107 @@
+/* 
+ * ConformerGeneratorStatisticsExport.cpp 
+ *
+ * This file is part of the Utilical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/ConfGen/ConformerGeneratorStatistics.hpp"
+
+#include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/CopyAssOp.hpp"
+
+#include "ClassExports.hpp"
+
+
+void CDPLPythonConfGen::exportConformerGeneratorStatistics()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    python::class_<ConfGen::ConformerGeneratorStatistics> cl("ConformerGeneratorStatistics", python::no_init);
+    python::scope scope = cl;
+
+    python::enum_<ConfGen::ConformerGeneratorStatistics::Stage>("Stage")
+        .value("FORCE_FIELD_SETUP", ConfGen::ConformerGeneratorStatistics::FORCE_FIELD_SETUP)
+        .value("FRAGMENT_LIBRARY_LOOKUP", ConfGen::ConformerGeneratorStatistics::FRAGMENT_LIBRARY_LOOKUP)
+        .value("FRAGMENT_CONFORMER_GENERATION", ConfGen::ConformerGeneratorStatistics::FRAGMENT_CONFORMER_GENERATION)
+        .value("TORSION_RULE_MATCHING", ConfGen::ConformerGeneratorStatistics::TORSION_RULE_MATCHING)
+        .value("TORSION_DRIVING", ConfGen::ConformerGeneratorStatistics::TORSION_DRIVING)
+        .value("FRAGMENT_COMBINATION", ConfGen::ConformerGeneratorStatistics::FRAGMENT_COMBINATION)
+        .value("STRUCTURE_EMBEDDING", ConfGen::ConformerGeneratorStatistics::STRUCTURE_EMBEDDING)
+        .value("ENERGY_MINIMIZATION", ConfGen::ConformerGeneratorStatistics::ENERGY_MINIMIZATION)
+        .value("OUTPUT_SELECTION", ConfGen::ConformerGeneratorStatistics::OUTPUT_SELECTION)
+        .export_values();
+
+    python::enum_<ConfGen::ConformerGeneratorStatistics::Counter>("Counter")
+        .value("NUM_ROTATABLE_BONDS", ConfGen::ConformerGeneratorStatistics::NUM_ROTATABLE_BONDS)
+        .value("NUM_TORSION_FRAGMENTS", ConfGen::ConformerGeneratorStatistics::NUM_TORSION_FRAGMENTS)
+        .value("NUM_FRAGMENT_LIBRARY_HITS", ConfGen::ConformerGeneratorStatistics::NUM_FRAGMENT_LIBRARY_HITS)
+        .value("NUM_FRAGMENT_CACHE_HITS", ConfGen::ConformerGeneratorStatistics::NUM_FRAGMENT_CACHE_HITS)
+        .value("NUM_GENERATED_FRAGMENTS", ConfGen::ConformerGeneratorStatistics::NUM_GENERATED_FRAGMENTS)
+        .value("NUM_FRAGMENT_CONFORMER_COMBINATIONS", ConfGen::ConformerGeneratorStatistics::NUM_FRAGMENT_CONFORMER_COMBINATIONS)
+        .value("NUM_SAMPLED_CONFORMERS", ConfGen::ConformerGeneratorStatistics::NUM_SAMPLED_CONFORMERS)
+        .value("NUM_STRUCTURE_GENERATION_FAILURES", ConfGen::ConformerGeneratorStatistics::NUM_STRUCTURE_GENERATION_FAILURES)
+        .value("NUM_MINIMIZATIONS", ConfGen::ConformerGeneratorStatistics::NUM_MINIMIZATIONS)
+        .value("NUM_MINIMIZATION_ITERATIONS", ConfGen::ConformerGeneratorStatistics::NUM_MINIMIZATION_ITERATIONS)
+        .value("NUM_REJECTED_CONFORMERS", ConfGen::ConformerGeneratorStatistics::NUM_REJECTED_CONFORMERS)
+        .value("NUM_OUTPUT_CONFORMERS", ConfGen::ConformerGeneratorStatistics::NUM_OUTPUT_CONFORMERS)
+        .export_values();
+
+    cl
+        .def(python::init<>(python::arg("self")))
+        .def(python::init<const ConfGen::ConformerGeneratorStatistics&>((python::arg("self"), python::arg("stats"))))
+        .def(CDPLPythonBase::ObjectIdentityCheckVisitor<ConfGen::ConformerGeneratorStatistics>())
+        .def("assign", CDPLPythonBase::copyAssOp<ConfGen::ConformerGeneratorStatistics>(), 
+             (python::arg("self"), python::arg("stats")), python::return_self<>())
+        .def("clear", &ConfGen::ConformerGeneratorStatistics::clear, python::arg("self"))
+        .def("getTotalTime", &ConfGen::ConformerGeneratorStatistics::getTotalTime, python::arg("self"))
+        .def("setTotalTime", &ConfGen::ConformerGeneratorStatistics::setTotalTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("getStageTime", &ConfGen::ConformerGeneratorStatistics::getStageTime, 
+             (python::arg("self"), python::arg("stage")))
+        .def("setStageTime", &ConfGen::ConformerGeneratorStatistics::setStageTime, 
+             (python::arg("self"), python::arg("stage"), python::arg("time")))
+        .def("addStageTime", &ConfGen::ConformerGeneratorStatistics::addStageTime, 
+             (python::arg("self"), python::arg("stage"), python::arg("time")))
+        .def("getCounter", &ConfGen::ConformerGeneratorStatistics::getCounter, 
+             (python::arg("self"), python::arg("counter")))
+        .def("setCounter", &ConfGen::ConformerGeneratorStatistics::setCounter, 
+             (python::arg("self"), python::arg("counter"), python::arg("value")))
+        .def("increaseCounter", &ConfGen::ConformerGeneratorStatistics::increaseCounter, 
+             (python::arg("self"), python::arg("counter"), python::arg("inc") = 1))
+        .def("getFragmentLibraryHitRate", &ConfGen::ConformerGeneratorStatistics::getFragmentLibraryHitRate, python::arg("self"))
+        .def("getFragmentCacheHitRate", &ConfGen::ConformerGeneratorStatistics::getFragmentCacheHitRate, python::arg("self"))
+        .def("__iadd__", &ConfGen::ConformerGeneratorStatistics::operator+=, (python::arg("self"), python::arg("stats")), 
+             python::return_self<>())
+        .def("getStageName", &ConfGen::ConformerGeneratorStatistics::getStageName, python::arg("stage"))
+        .staticmethod("getStageName")
+        .def("getCounterName", &ConfGen::ConformerGeneratorStatistics::getCounterName, python::arg("counter"))
+        .staticmethod("getCounterName")
+        .def_readonly("NUM_STAGES", ConfGen::ConformerGeneratorStatistics::NUM_STAGES)
+        .def_readonly("NUM_COUNTERS", ConfGen::ConformerGeneratorStatistics::NUM_COUNTERS)
+        .add_property("totalTime", &ConfGen::ConformerGeneratorStatistics::getTotalTime, 
+                      &ConfGen::ConformerGeneratorStatistics::setTotalTime)
+        .add_property("fragmentLibraryHitRate", &ConfGen::ConformerGeneratorStatistics::getFragmentLibraryHitRate)
+        .add_property("fragmentCacheHitRate", &ConfGen::ConformerGeneratorStatistics::getFragmentCacheHitRate);
+}
@@ -52,6 +52,7 @@ void CDPLPythonConfGen::exportDGStructureGenerator()
         .def("setup", static_cast<void (ConfGen::DGStructureGenerator::*)(const Chem::MolecularGraph&, const ForceField::MMFF94InteractionData&)>
              (&ConfGen::DGStructureGenerator::setup), 
              (python::arg("self"), python::arg("molgraph"), python::arg("ia_data")))
+        .def("setRandomSeed", &ConfGen::DGStructureGenerator::setRandomSeed, (python::arg("self"), python::arg("seed")))
         .def("generate", &ConfGen::DGStructureGenerator::generate, (python::arg("self"), python::arg("coords")))
         .def("getNumAtomStereoCenters", &ConfGen::DGStructureGenerator::getNumAtomStereoCenters, python::arg("self"))
         .def("getNumBondStereoCenters", &ConfGen::DGStructureGenerator::getNumBondStereoCenters, python::arg("self"))
@@ -54,9 +54,15 @@ void CDPLPythonConfGen::exportDGStructureGeneratorSettings()
              (python::arg("self"), python::arg("enable")))
         .def("enablePlanarityConstraints", GetBoolFunc(&ConfGen::DGStructureGeneratorSettings::enablePlanarityConstraints), 
              python::arg("self"))
+        .def("setEmbeddingBatchSize", &ConfGen::DGStructureGeneratorSettings::setEmbeddingBatchSize, 
+             (python::arg("self"), python::arg("size")))
+        .def("getEmbeddingBatchSize", &ConfGen::DGStructureGeneratorSettings::getEmbeddingBatchSize, 
+             python::arg("self"))
         .def_readonly("DEFAULT_", ConfGen::DGStructureGeneratorSettings::DEFAULT)
         .add_property("boxSize", &ConfGen::DGStructureGeneratorSettings::getBoxSize, 
                       &ConfGen::DGStructureGeneratorSettings::setBoxSize)
         .add_property("planarityConstraints", GetBoolFunc(&ConfGen::DGStructureGeneratorSettings::enablePlanarityConstraints), 
-                      SetBoolFunc(&ConfGen::DGStructureGeneratorSettings::enablePlanarityConstraints));
+                      SetBoolFunc(&ConfGen::DGStructureGeneratorSettings::enablePlanarityConstraints))
+        .add_property("embeddingBatchSize", &ConfGen::DGStructureGeneratorSettings::getEmbeddingBatchSize, 
+                      &ConfGen::DGStructureGeneratorSettings::setEmbeddingBatchSize);
 }
@@ -75,10 +75,14 @@ void CDPLPythonConfGen::exportFragmentLibrary()
         .def("getEntries", &getEntries, python::arg("self")) 
         .def("load", &ConfGen::FragmentLibrary::load, (python::arg("self"), python::arg("is"))) 
         .def("loadDefaults", &ConfGen::FragmentLibrary::loadDefaults, python::arg("self")) 
-        .def("save", &ConfGen::FragmentLibrary::save, (python::arg("self"), python::arg("os"))) 
+        .def("save", &ConfGen::FragmentLibrary::save, (python::arg("self"), python::arg("os"), python::arg("write_index") = false)) 
+        .def("mapFile", &ConfGen::FragmentLibrary::mapFile, (python::arg("self"), python::arg("file_name"))) 
+        .def("unmapFile", &ConfGen::FragmentLibrary::unmapFile, python::arg("self")) 
+        .def("getNumMappedEntries", &ConfGen::FragmentLibrary::getNumMappedEntries, python::arg("self")) 
         .def("assign", CDPLPythonBase::copyAssOp<ConfGen::FragmentLibrary>(), 
              (python::arg("self"), python::arg("lib")), python::return_self<>())
         .add_property("numEntries", &ConfGen::FragmentLibrary::getNumEntries)
+        .add_property("numMappedEntries", &ConfGen::FragmentLibrary::getNumMappedEntries)
         .add_property("entries", python::make_function(&getEntries))
         .def("set", &ConfGen::FragmentLibrary::set, python::arg("lib"))
         .staticmethod("set")
@@ -57,6 +57,7 @@ BOOST_PYTHON_MODULE(_confgen)
     exportRMSDConformerSelector();
     exportStructureGeneratorSettings();
     exportConformerGeneratorSettings();
+    exportConformerGeneratorStatistics();
     exportFragmentConformerGeneratorSettings();
     exportFragmentAssemblerSettings();
 
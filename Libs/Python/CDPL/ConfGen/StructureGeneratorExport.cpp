@@ -28,11 +28,42 @@
 #include "CDPL/Chem/MolecularGraph.hpp"
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/GILGuard.hpp"
 //#include "Base/CopyAssOp.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    unsigned int generate1(CDPL::ConfGen::StructureGenerator& gen, const CDPL::Chem::MolecularGraph& molgraph)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph));
+
+        return gen.generate(molgraph);
+    }
+
+    unsigned int generate2(CDPL::ConfGen::StructureGenerator& gen, const CDPL::Chem::MolecularGraph& molgraph,
+                           const CDPL::Chem::MolecularGraph& fixed_substr)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph) &&
+                                                  !CDPLPythonBase::isPythonImplemented(fixed_substr));
+
+        return gen.generate(molgraph, fixed_substr);
+    }
+
+    unsigned int generate3(CDPL::ConfGen::StructureGenerator& gen, const CDPL::Chem::MolecularGraph& molgraph,
+                           const CDPL::Chem::MolecularGraph& fixed_substr, const CDPL::Math::Vector3DArray& fixed_substr_coords)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph) &&
+                                                  !CDPLPythonBase::isPythonImplemented(fixed_substr));
+
+        return gen.generate(molgraph, fixed_substr, fixed_substr_coords);
+    }
+}
+
+
 void CDPLPythonConfGen::exportStructureGenerator()
 {
     using namespace boost;
@@ -68,15 +99,13 @@ void CDPLPythonConfGen::exportStructureGenerator()
              (python::arg("self"), python::arg("func")))
         .def("getLogMessageCallback", &ConfGen::StructureGenerator::getLogMessageCallback, 
              python::arg("self"), python::return_internal_reference<>())
-        .def("generate", static_cast<unsigned int (ConfGen::StructureGenerator::*)
-             (const Chem::MolecularGraph&)>(&ConfGen::StructureGenerator::generate),
+        .def("getStatistics", &ConfGen::StructureGenerator::getStatistics, 
+             python::arg("self"), python::return_internal_reference<>())
+        .def("generate", &generate1,
              (python::arg("self"), python::arg("molgraph")))
-        .def("generate", static_cast<unsigned int (ConfGen::StructureGenerator::*)
-             (const Chem::MolecularGraph&, const Chem::MolecularGraph&)>(&ConfGen::StructureGenerator::generate),
+        .def("generate", &generate2,
              (python::arg("self"), python::arg("molgraph"), python::arg("fixed_substr")))
-        .def("generate", static_cast<unsigned int (ConfGen::StructureGenerator::*)
-             (const Chem::MolecularGraph&, const Chem::MolecularGraph&, const Math::Vector3DArray&)>
-             (&ConfGen::StructureGenerator::generate),
+        .def("generate", &generate3,
              (python::arg("self"), python::arg("molgraph"), python::arg("fixed_substr"), python::arg("fixed_substr_coords")))
         .def("setCoordinates", &ConfGen::StructureGenerator::setCoordinates,
              (python::arg("self"), python::arg("molgraph")))
@@ -96,6 +125,8 @@ void CDPLPythonConfGen::exportStructureGenerator()
                       python::make_function(&ConfGen::StructureGenerator::getTimeoutCallback,
                                             python::return_internal_reference<>()),
                       &ConfGen::StructureGenerator::setTimeoutCallback)
+        .add_property("statistics", python::make_function(&ConfGen::StructureGenerator::getStatistics,
+                                                          python::return_internal_reference<>()))
         .add_property("logMessageCallback", 
                       python::make_function(&ConfGen::StructureGenerator::getLogMessageCallback,
                                             python::return_internal_reference<>()),
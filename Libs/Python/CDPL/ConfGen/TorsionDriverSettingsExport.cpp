@@ -82,6 +82,10 @@ void CDPLPythonConfGen::exportTorsionDriverSettings()
              (python::arg("self"), python::arg("dist_expo")))
         .def("getDistanceExponent", &ConfGen::TorsionDriverSettings::getDistanceExponent, 
              python::arg("self"))
+        .def("setNumThreads", &ConfGen::TorsionDriverSettings::setNumThreads, 
+             (python::arg("self"), python::arg("num_threads")))
+        .def("getNumThreads", &ConfGen::TorsionDriverSettings::getNumThreads, 
+             python::arg("self"))
         .def_readonly("DEFAULT", ConfGen::TorsionDriverSettings::DEFAULT)
         .add_property("sampleHetAtomHydrogens", GetBoolFunc(&ConfGen::TorsionDriverSettings::sampleHeteroAtomHydrogens),
                       SetBoolFunc(&ConfGen::TorsionDriverSettings::sampleHeteroAtomHydrogens))
@@ -95,6 +99,8 @@ void CDPLPythonConfGen::exportTorsionDriverSettings()
                       &ConfGen::TorsionDriverSettings::setDielectricConstant)
         .add_property("distanceExponent", &ConfGen::TorsionDriverSettings::getDistanceExponent, 
                       &ConfGen::TorsionDriverSettings::setDistanceExponent)
+        .add_property("numThreads", &ConfGen::TorsionDriverSettings::getNumThreads, 
+                      &ConfGen::TorsionDriverSettings::setNumThreads)
         .add_property("energyOrdered", GetBoolFunc(&ConfGen::TorsionDriverSettings::orderByEnergy),
                       SetBoolFunc(&ConfGen::TorsionDriverSettings::orderByEnergy))
         .add_property("energyWindow", &ConfGen::TorsionDriverSettings::getEnergyWindow,
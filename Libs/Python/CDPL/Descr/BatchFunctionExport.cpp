@@ -0,0 +1,478 @@
+/*
+ * BatchFunctionExport.cpp
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include <boost/python.hpp>
+
+#include "CDPL/Config.hpp"
+
+#ifdef HAVE_NUMPY
+
+#include "CDPL/Descr/CircularFingerprintGenerator.hpp"
+#include "CDPL/Descr/PathFingerprintGenerator.hpp"
+#include "CDPL/Descr/MACCSFingerprintGenerator.hpp"
+#include "CDPL/Descr/PubChemFingerprintGenerator.hpp"
+#include "CDPL/Descr/AutoCorrelation2DVectorCalculator.hpp"
+#include "CDPL/Descr/MoleculeAutoCorr2DDescriptorCalculator.hpp"
+#include "CDPL/Descr/MoleculeAutoCorr3DDescriptorCalculator.hpp"
+#include "CDPL/Descr/MoleculeRDFDescriptorCalculator.hpp"
+#include "CDPL/Descr/SimilarityFunctions.hpp"
+#include "CDPL/Chem/BasicMolecule.hpp"
+#include "CDPL/Chem/MolecularGraphFunctions.hpp"
+#include "CDPL/Base/DataReader.hpp"
+#include "CDPL/Util/BitSet.hpp"
+#include "CDPL/Math/Vector.hpp"
+
+#include "Base/GILGuard.hpp"
+#include "Math/NumPy.hpp"
+
+#endif // HAVE_NUMPY
+
+#include "FunctionExports.hpp"
+
+
+#ifdef HAVE_NUMPY
+
+namespace
+{
+
+    /*
+     * Collects the molecular graphs to process from a Python iterable of Chem.MolecularGraph instances or
+     * reads them from a Chem.MoleculeReader. Molecules obtained from a reader get their basic properties
+     * calculated (see Chem.calcBasicProperties()) before processing.
+     */
+    class MolecularGraphBatch
+    {
+
+      public:
+        MolecularGraphBatch(const boost::python::object& molgraphs):
+            pythonImpl(false)
+        {
+            using namespace boost;
+            using namespace CDPL;
+
+            python::extract<Base::DataReader<Chem::Molecule>&> reader_ext(molgraphs);
+
+            if (reader_ext.check()) {
+                readMolecules(reader_ext());
+                return;
+            }
+
+            python::stl_input_iterator<python::object> it(molgraphs), end;
+
+            for ( ; it != end; ++it) {
+                const python::object& obj = *it;
+                const Chem::MolecularGraph& molgraph = python::extract<const Chem::MolecularGraph&>(obj);
+
+                pythonImpl |= CDPLPythonBase::isPythonImplemented(molgraph);
+
+                objects.push_back(obj);
+                molGraphs.push_back(&molgraph);
+            }
+        }
+
+        std::size_t getSize() const
+        {
+            return molGraphs.size();
+        }
+
+        const CDPL::Chem::MolecularGraph& operator[](std::size_t idx) const
+        {
+            if (idx < molecules.size())
+                CDPL::Chem::calcBasicProperties(*molecules[idx], false);
+
+            return *molGraphs[idx];
+        }
+
+        bool containsPythonObjects() const
+        {
+            return pythonImpl;
+        }
+
+      private:
+        void readMolecules(CDPL::Base::DataReader<CDPL::Chem::Molecule>& reader)
+        {
+            using namespace CDPL;
+
+            pythonImpl = CDPLPythonBase::isPythonImplemented(reader);
+
+            CDPLPythonBase::GILReleaseGuard gil_guard(!pythonImpl);
+
+            for (Chem::BasicMolecule::SharedPointer mol_ptr(new Chem::BasicMolecule()); reader.read(*mol_ptr); mol_ptr.reset(new Chem::BasicMolecule())) {
+                molecules.push_back(mol_ptr);
+                molGraphs.push_back(mol_ptr.get());
+            }
+        }
+
+        typedef std::vector<const CDPL::Chem::MolecularGraph*>      MolecularGraphList;
+        typedef std::vector<CDPL::Chem::BasicMolecule::SharedPointer> MoleculeList;
+        typedef std::vector<boost::python::object>                  ObjectList;
+
+        MolecularGraphList molGraphs;
+        MoleculeList       molecules;
+        ObjectList         objects;
+        bool               pythonImpl;
+    };
+
+    class BitSetBatch
+    {
+
+      public:
+        BitSetBatch(const boost::python::object& bitsets)
+        {
+            using namespace boost;
+
+            python::stl_input_iterator<python::object> it(bitsets), end;
+
+            for ( ; it != end; ++it) {
+                objects.push_back(*it);
+                bitSets.push_back(&python::extract<const CDPL::Util::BitSet&>(objects.back())());
+            }
+        }
+
+        std::size_t getSize() const
+        {
+            return bitSets.size();
+        }
+
+        const CDPL::Util::BitSet& operator[](std::size_t idx) const
+        {
+            return *bitSets[idx];
+        }
+
+      private:
+        std::vector<const CDPL::Util::BitSet*> bitSets;
+        std::vector<boost::python::object>     objects;
+    };
+
+    std::size_t getNumThreads(std::size_t num_threads, std::size_t num_items)
+    {
+        if (num_threads == 0)
+            num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        return std::max(std::min(num_threads, num_items), std::size_t(1));
+    }
+
+    /*
+     * Calls func(thread_idx, item_idx) for all items on the specified number of threads. Exceptions thrown
+     * by a worker stop the processing of further items and get rethrown in the calling thread.
+     */
+    template <typename Func>
+    void processItems(std::size_t num_items, std::size_t num_threads, Func& func)
+    {
+        if (num_threads <= 1) {
+            for (std::size_t i = 0; i < num_items; i++)
+                func(0, i);
+
+            return;
+        }
+
+        std::atomic<std::size_t> next_item(0);
+        std::exception_ptr       error;
+        std::mutex               mutex;
+
+        auto worker_func = [&](std::size_t thread_idx) {
+            try {
+                for (std::size_t i = next_item++; i < num_items; i = next_item++)
+                    func(thread_idx, i);
+
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if (!error)
+                    error = std::current_exception();
+
+                next_item = num_items;
+            }
+        };
+
+        std::vector<std::thread> workers;
+
+        for (std::size_t i = 1; i < num_threads; i++)
+            workers.emplace_back(worker_func, i);
+
+        worker_func(0);
+
+        for (auto& thread : workers)
+            thread.join();
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    boost::python::object toNDArray(const std::vector<CDPL::Util::BitSet>& bitsets)
+    {
+        using namespace boost;
+
+        std::size_t num_bits = 0;
+
+        for (const auto& bs : bitsets)
+            num_bits = std::max(num_bits, bs.size());
+
+        npy_intp  shape[] = { npy_intp(bitsets.size()), npy_intp(num_bits) };
+        PyObject* array = PyArray_ZEROS(2, shape, NPY_UINT8, 0);
+
+        if (!array)
+            python::throw_error_already_set();
+
+        PyArrayObject* nd_array = reinterpret_cast<PyArrayObject*>(array);
+
+        for (std::size_t i = 0; i < bitsets.size(); i++) {
+            const CDPL::Util::BitSet& bs = bitsets[i];
+
+            for (CDPL::Util::BitSet::size_type j = bs.find_first(); j != CDPL::Util::BitSet::npos; j = bs.find_next(j))
+                *static_cast<std::uint8_t*>(PyArray_GETPTR2(nd_array, i, j)) = 1;
+        }
+
+        return python::object(python::handle<>(array));
+    }
+
+    boost::python::object toNDArray(const std::vector<CDPL::Math::DVector>& vectors)
+    {
+        using namespace boost;
+
+        std::size_t num_elem = 0;
+
+        for (const auto& vec : vectors)
+            num_elem = std::max(num_elem, vec.getSize());
+
+        npy_intp  shape[] = { npy_intp(vectors.size()), npy_intp(num_elem) };
+        PyObject* array = PyArray_ZEROS(2, shape, NPY_FLOAT64, 0);
+
+        if (!array)
+            python::throw_error_already_set();
+
+        PyArrayObject* nd_array = reinterpret_cast<PyArrayObject*>(array);
+
+        for (std::size_t i = 0; i < vectors.size(); i++) {
+            const CDPL::Math::DVector& vec = vectors[i];
+
+            for (std::size_t j = 0, size = vec.getSize(); j < size; j++)
+                *static_cast<double*>(PyArray_GETPTR2(nd_array, i, j)) = vec(j);
+        }
+
+        return python::object(python::handle<>(array));
+    }
+
+    template <typename GeneratorType, typename CalcFunc, typename ResultType>
+    boost::python::object processBatch(const GeneratorType& gen, const boost::python::object& molgraphs, std::size_t num_threads,
+                                       const CalcFunc& calc_func, std::vector<ResultType>& results)
+    {
+        MolecularGraphBatch batch(molgraphs);
+
+        num_threads = (batch.containsPythonObjects() ? std::size_t(1) : getNumThreads(num_threads, batch.getSize()));
+
+        // generator copies are made while the GIL is held (they might reference Python callables)
+        std::vector<GeneratorType> generators(num_threads, gen);
+
+        results.resize(batch.getSize());
+
+        auto func = [&](std::size_t thread_idx, std::size_t item_idx) {
+            calc_func(generators[thread_idx], batch[item_idx], results[item_idx]);
+        };
+
+        {
+            CDPLPythonBase::GILReleaseGuard gil_guard(!batch.containsPythonObjects());
+
+            processItems(batch.getSize(), num_threads, func);
+        }
+
+        return toNDArray(results);
+    }
+
+    template <typename GeneratorType>
+    boost::python::object generateFingerprints(GeneratorType& gen, const boost::python::object& molgraphs, std::size_t num_bits,
+                                               std::size_t num_threads)
+    {
+        std::vector<CDPL::Util::BitSet> fps;
+
+        return processBatch(gen, molgraphs, num_threads,
+                            [num_bits](GeneratorType& generator, const CDPL::Chem::MolecularGraph& molgraph, CDPL::Util::BitSet& fp) {
+                                fp.resize(num_bits);
+                                generator.generate(molgraph, fp);
+                            }, fps);
+    }
+
+    boost::python::object generateCircularFingerprints(CDPL::Descr::CircularFingerprintGenerator& gen, const boost::python::object& molgraphs,
+                                                       std::size_t num_bits, std::size_t num_threads)
+    {
+        using namespace CDPL;
+
+        std::vector<Util::BitSet> fps;
+
+        return processBatch(gen, molgraphs, num_threads,
+                            [num_bits](Descr::CircularFingerprintGenerator& generator, const Chem::MolecularGraph& molgraph, Util::BitSet& fp) {
+                                fp.resize(num_bits);
+                                generator.generate(molgraph);
+                                generator.setFeatureBits(fp);
+                            }, fps);
+    }
+
+    template <typename GeneratorType>
+    boost::python::object generateFixedSizeFingerprints(GeneratorType& gen, const boost::python::object& molgraphs, std::size_t num_threads)
+    {
+        return generateFingerprints(gen, molgraphs, 0, num_threads);
+    }
+
+    template <typename CalculatorType>
+    boost::python::object calcDescriptors(CalculatorType& calc, const boost::python::object& molgraphs, std::size_t num_threads)
+    {
+        std::vector<CDPL::Math::DVector> descrs;
+
+        return processBatch(calc, molgraphs, num_threads,
+                            [](CalculatorType& calculator, const CDPL::Chem::MolecularGraph& molgraph, CDPL::Math::DVector& descr) {
+                                calculator.calculate(molgraph, descr);
+                            }, descrs);
+    }
+
+    template <double (*SimFunc)(const CDPL::Util::BitSet&, const CDPL::Util::BitSet&)>
+    struct SimilarityFunction
+    {
+
+        double operator()(const CDPL::Util::BitSet& bs1, const CDPL::Util::BitSet& bs2) const
+        {
+            return SimFunc(bs1, bs2);
+        }
+    };
+
+    struct TverskySimilarityFunction
+    {
+
+        TverskySimilarityFunction(double a, double b):
+            a(a), b(b) {}
+
+        double operator()(const CDPL::Util::BitSet& bs1, const CDPL::Util::BitSet& bs2) const
+        {
+            return CDPL::Descr::calcTverskySimilarity(bs1, bs2, a, b);
+        }
+
+        double a;
+        double b;
+    };
+
+    template <typename SimFunc>
+    boost::python::object calcSimilarityMatrix(const boost::python::object& bitsets1, const boost::python::object& bitsets2,
+                                               std::size_t num_threads, const SimFunc& sim_func, bool symmetric)
+    {
+        using namespace boost;
+
+        BitSetBatch batch1(bitsets1);
+        BitSetBatch batch2(bitsets2.is_none() ? bitsets1 : bitsets2);
+
+        symmetric &= bitsets2.is_none();
+
+        npy_intp  shape[] = { npy_intp(batch1.getSize()), npy_intp(batch2.getSize()) };
+        PyObject* array = PyArray_ZEROS(2, shape, NPY_FLOAT64, 0);
+
+        if (!array)
+            python::throw_error_already_set();
+
+        python::object array_obj((python::handle<>(array)));
+        PyArrayObject* nd_array = reinterpret_cast<PyArrayObject*>(array);
+
+        auto func = [&](std::size_t, std::size_t row_idx) {
+            const CDPL::Util::BitSet& bs1 = batch1[row_idx];
+
+            for (std::size_t j = (symmetric ? row_idx : 0), num_cols = batch2.getSize(); j < num_cols; j++) {
+                double sim = sim_func(bs1, batch2[j]);
+
+                *static_cast<double*>(PyArray_GETPTR2(nd_array, row_idx, j)) = sim;
+
+                if (symmetric)
+                    *static_cast<double*>(PyArray_GETPTR2(nd_array, j, row_idx)) = sim;
+            }
+        };
+
+        {
+            CDPLPythonBase::GILReleaseGuard gil_guard;
+
+            processItems(batch1.getSize(), getNumThreads(num_threads, batch1.getSize()), func);
+        }
+
+        return array_obj;
+    }
+
+    template <double (*SimFunc)(const CDPL::Util::BitSet&, const CDPL::Util::BitSet&), bool Symmetric>
+    boost::python::object calcSimilarityMatrix(const boost::python::object& bitsets1, const boost::python::object& bitsets2,
+                                               std::size_t num_threads)
+    {
+        return calcSimilarityMatrix(bitsets1, bitsets2, num_threads, SimilarityFunction<SimFunc>(), Symmetric);
+    }
+
+    boost::python::object calcTverskySimilarityMatrix(const boost::python::object& bitsets1, const boost::python::object& bitsets2,
+                                                      double a, double b, std::size_t num_threads)
+    {
+        return calcSimilarityMatrix(bitsets1, bitsets2, num_threads, TverskySimilarityFunction(a, b), a == b);
+    }
+}
+
+#endif // HAVE_NUMPY
+
+
+void CDPLPythonDescr::exportBatchFunctions()
+{
+#ifdef HAVE_NUMPY
+    using namespace boost;
+    using namespace CDPL;
+
+    python::def("generateFingerprints", &generateCircularFingerprints,
+                (python::arg("gen"), python::arg("molgraphs"), python::arg("num_bits"), python::arg("num_threads") = 0));
+    python::def("generateFingerprints", &generateFingerprints<Descr::PathFingerprintGenerator>,
+                (python::arg("gen"), python::arg("molgraphs"), python::arg("num_bits"), python::arg("num_threads") = 0));
+    python::def("generateFingerprints", &generateFixedSizeFingerprints<Descr::MACCSFingerprintGenerator>,
+                (python::arg("gen"), python::arg("molgraphs"), python::arg("num_threads") = 0));
+    python::def("generateFingerprints", &generateFixedSizeFingerprints<Descr::PubChemFingerprintGenerator>,
+                (python::arg("gen"), python::arg("molgraphs"), python::arg("num_threads") = 0));
+
+    python::def("calcDescriptors", &calcDescriptors<Descr::AutoCorrelation2DVectorCalculator>,
+                (python::arg("calc"), python::arg("molgraphs"), python::arg("num_threads") = 0));
+    python::def("calcDescriptors", &calcDescriptors<Descr::MoleculeAutoCorr2DDescriptorCalculator>,
+                (python::arg("calc"), python::arg("molgraphs"), python::arg("num_threads") = 0));
+    python::def("calcDescriptors", &calcDescriptors<Descr::MoleculeAutoCorr3DDescriptorCalculator>,
+                (python::arg("calc"), python::arg("molgraphs"), python::arg("num_threads") = 0));
+    python::def("calcDescriptors", &calcDescriptors<Descr::MoleculeRDFDescriptorCalculator>,
+                (python::arg("calc"), python::arg("molgraphs"), python::arg("num_threads") = 0));
+
+    python::def("calcTanimotoSimilarityMatrix", &calcSimilarityMatrix<&Descr::calcTanimotoSimilarity, true>,
+                (python::arg("bitsets1"), python::arg("bitsets2") = python::object(), python::arg("num_threads") = 0));
+    python::def("calcCosineSimilarityMatrix", &calcSimilarityMatrix<&Descr::calcCosineSimilarity, true>,
+                (python::arg("bitsets1"), python::arg("bitsets2") = python::object(), python::arg("num_threads") = 0));
+    python::def("calcEuclideanSimilarityMatrix", &calcSimilarityMatrix<&Descr::calcEuclideanSimilarity, true>,
+                (python::arg("bitsets1"), python::arg("bitsets2") = python::object(), python::arg("num_threads") = 0));
+    python::def("calcDiceSimilarityMatrix", &calcSimilarityMatrix<&Descr::calcDiceSimilarity, true>,
+                (python::arg("bitsets1"), python::arg("bitsets2") = python::object(), python::arg("num_threads") = 0));
+    python::def("calcManhattanSimilarityMatrix", &calcSimilarityMatrix<&Descr::calcManhattanSimilarity, true>,
+                (python::arg("bitsets1"), python::arg("bitsets2") = python::object(), python::arg("num_threads") = 0));
+    python::def("calcTverskySimilarityMatrix", &calcTverskySimilarityMatrix,
+                (python::arg("bitsets1"), python::arg("bitsets2"), python::arg("a"), python::arg("b"), python::arg("num_threads") = 0));
+#endif // HAVE_NUMPY
+}
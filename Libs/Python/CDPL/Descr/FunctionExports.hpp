@@ -33,6 +33,7 @@ namespace CDPLPythonDescr
     void exportAtomContainerFunctions();
     void exportMolecularGraphFunctions();
     void exportSimilarityFunctions();
+    void exportBatchFunctions();
 } // namespace CDPLPythonDescr
 
 #endif // CDPL_PYTHON_DESCR_FUNCTIONEXPORTS_HPP
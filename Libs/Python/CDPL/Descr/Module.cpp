@@ -24,15 +24,25 @@
 
 #include <boost/python.hpp>
 
+#include "CDPL/Config.hpp"
+
 #include "ClassExports.hpp"
 #include "FunctionExports.hpp"
 #include "ConverterRegistration.hpp"
 
+#ifdef HAVE_NUMPY
+# include "Math/NumPy.hpp"
+#endif // HAVE_NUMPY
+
 
 BOOST_PYTHON_MODULE(_descr)
 {
     using namespace CDPLPythonDescr;
 
+#ifdef HAVE_NUMPY
+    CDPLPythonMath::NumPy::init();
+#endif // HAVE_NUMPY
+
     exportAutoCorrelation2DVectorCalculator();
     exportAtomRDFCodeCalculator();
     exportMoleculeRDFDescriptorCalculator();
@@ -61,6 +71,7 @@ BOOST_PYTHON_MODULE(_descr)
     exportAtomContainerFunctions();
     exportMolecularGraphFunctions();
     exportSimilarityFunctions();
+    exportBatchFunctions();
 
     registerFromPythonConverters();
 }
@@ -55,6 +55,7 @@ namespace CDPLPythonForceField
     void exportMMFF94VanDerWaalsInteractionList();
     void exportMMFF94ElectrostaticInteractionList();
     void exportMMFF94InteractionData();
+    void exportMMFF94InteractionDataCache();
 
     void exportMMFF94BondStretchingInteractionParameterizer();
     void exportMMFF94AngleBendingInteractionParameterizer();
@@ -29,17 +29,30 @@
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
 #include "Base/CopyAssOp.hpp"
+#include "Base/GILGuard.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    typedef CDPL::ForceField::MMFF94EnergyCalculator<double> CalculatorType;
+
+    const double& calcEnergy(CalculatorType& calc, const CDPL::Math::Vector3DArray& coords)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        return calc(coords);
+    }
+}
+
+
 void CDPLPythonForceField::exportMMFF94EnergyCalculator()
 {
     using namespace boost;
     using namespace CDPL;
 
-    typedef ForceField::MMFF94EnergyCalculator<double> CalculatorType;
-
     python::class_<CalculatorType>("MMFF94EnergyCalculator", python::no_init)
         .def(python::init<>(python::arg("self")))
         .def(python::init<const CalculatorType&>((python::arg("self"), python::arg("calc")))[python::with_custodian_and_ward<1, 2>()])
@@ -51,7 +64,7 @@ void CDPLPythonForceField::exportMMFF94EnergyCalculator()
         .def("getEnabledInteractionTypes", &CalculatorType::getEnabledInteractionTypes, python::arg("self"))
         .def("setup", &CalculatorType::setup, (python::arg("self"), python::arg("ia_data")), 
              python::with_custodian_and_ward<1, 2>())
-        .def("__call__", &CalculatorType::operator()<Math::Vector3DArray>, (python::arg("self"), python::arg("coords")),
+        .def("__call__", &calcEnergy, (python::arg("self"), python::arg("coords")),
              python::return_value_policy<python::copy_const_reference>())
         .def("getTotalEnergy", &CalculatorType::getTotalEnergy, python::arg("self"),
              python::return_value_policy<python::copy_const_reference>())
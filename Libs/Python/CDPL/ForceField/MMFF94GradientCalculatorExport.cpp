@@ -29,17 +29,37 @@
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
 #include "Base/CopyAssOp.hpp"
+#include "Base/GILGuard.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    typedef CDPL::ForceField::MMFF94GradientCalculator<double> CalculatorType;
+
+    const double& calcEnergy(CalculatorType& calc, const CDPL::Math::Vector3DArray& coords)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        return calc(coords);
+    }
+
+    const double& calcEnergyAndGradient(CalculatorType& calc, const CDPL::Math::Vector3DArray& coords, CDPL::Math::Vector3DArray& grad)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        return calc(coords, grad);
+    }
+}
+
+
 void CDPLPythonForceField::exportMMFF94GradientCalculator()
 {
     using namespace boost;
     using namespace CDPL;
 
-    typedef ForceField::MMFF94GradientCalculator<double> CalculatorType;
-
     python::class_<CalculatorType>("MMFF94GradientCalculator", python::no_init)
         .def(python::init<>(python::arg("self")))
         .def(python::init<const CalculatorType&>((python::arg("self"), python::arg("calc")))[python::with_custodian_and_ward<1, 2>()])
@@ -52,10 +72,10 @@ void CDPLPythonForceField::exportMMFF94GradientCalculator()
         .def("getEnabledInteractionTypes", &CalculatorType::getEnabledInteractionTypes, python::arg("self"))
         .def("setup", &CalculatorType::setup, (python::arg("self"), python::arg("ia_data"), python::arg("num_atoms")),
              python::with_custodian_and_ward<1, 2>())
-        .def("__call__", &CalculatorType::operator()<Math::Vector3DArray>, 
+        .def("__call__", &calcEnergy, 
              (python::arg("self"), python::arg("coords")),
              python::return_value_policy<python::copy_const_reference>())
-        .def("__call__", &CalculatorType::operator()<Math::Vector3DArray, Math::Vector3DArray>, 
+        .def("__call__", &calcEnergyAndGradient, 
              (python::arg("self"), python::arg("coords"), python::arg("grad")),
              python::return_value_policy<python::copy_const_reference>())
         .def("getTotalEnergy", &CalculatorType::getTotalEnergy, python::arg("self"),
@@ -0,0 +1,64 @@
+/* 
+ * MMFF94InteractionDataCacheExport.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/ForceField/MMFF94InteractionDataCache.hpp"
+#include "CDPL/Chem/MolecularGraph.hpp"
+
+#include "Base/ObjectIdentityCheckVisitor.hpp"
+
+#include "ClassExports.hpp"
+
+
+void CDPLPythonForceField::exportMMFF94InteractionDataCache()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    python::class_<ForceField::MMFF94InteractionDataCache, ForceField::MMFF94InteractionDataCache::SharedPointer,
+                   boost::noncopyable>("MMFF94InteractionDataCache", python::no_init)
+        .def(python::init<std::size_t>((python::arg("self"), python::arg("max_size") = ForceField::MMFF94InteractionDataCache::DEF_MAX_SIZE)))
+        .def(CDPLPythonBase::ObjectIdentityCheckVisitor<ForceField::MMFF94InteractionDataCache>())    
+        .def("setMaxSize", &ForceField::MMFF94InteractionDataCache::setMaxSize, (python::arg("self"), python::arg("max_size")))
+        .def("getMaxSize", &ForceField::MMFF94InteractionDataCache::getMaxSize, python::arg("self"))
+        .def("getSize", &ForceField::MMFF94InteractionDataCache::getSize, python::arg("self"))
+        .def("clear", &ForceField::MMFF94InteractionDataCache::clear, python::arg("self"))
+        .def("getNumHits", &ForceField::MMFF94InteractionDataCache::getNumHits, python::arg("self"))
+        .def("getNumMisses", &ForceField::MMFF94InteractionDataCache::getNumMisses, python::arg("self"))
+        .def("resetStatistics", &ForceField::MMFF94InteractionDataCache::resetStatistics, python::arg("self"))
+        .def("getData", &ForceField::MMFF94InteractionDataCache::getData, 
+             (python::arg("self"), python::arg("molgraph"), python::arg("param_set"), python::arg("ia_types"), python::arg("strict"),
+              python::arg("de_const"), python::arg("dist_expo"), python::arg("ia_data")))
+        .def("addData", &ForceField::MMFF94InteractionDataCache::addData, 
+             (python::arg("self"), python::arg("molgraph"), python::arg("param_set"), python::arg("ia_types"), python::arg("strict"),
+              python::arg("de_const"), python::arg("dist_expo"), python::arg("ia_data")))
+        .def("write", &ForceField::MMFF94InteractionDataCache::write, (python::arg("self"), python::arg("os")))
+        .def("read", &ForceField::MMFF94InteractionDataCache::read, (python::arg("self"), python::arg("is")))
+        .add_property("maxSize", &ForceField::MMFF94InteractionDataCache::getMaxSize, &ForceField::MMFF94InteractionDataCache::setMaxSize)
+        .add_property("size", &ForceField::MMFF94InteractionDataCache::getSize)
+        .add_property("numHits", &ForceField::MMFF94InteractionDataCache::getNumHits)
+        .add_property("numMisses", &ForceField::MMFF94InteractionDataCache::getNumMisses)
+        .def_readonly("DEF_MAX_SIZE", ForceField::MMFF94InteractionDataCache::DEF_MAX_SIZE);
+}
@@ -26,13 +26,28 @@
 
 #include "CDPL/ForceField/MMFF94InteractionParameterizer.hpp"
 #include "CDPL/ForceField/MMFF94InteractionData.hpp"
+#include "CDPL/Chem/MolecularGraph.hpp"
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
 #include "Base/CopyAssOp.hpp"
+#include "Base/GILGuard.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    void parameterize(CDPL::ForceField::MMFF94InteractionParameterizer& parameterizer, const CDPL::Chem::MolecularGraph& molgraph, 
+                      CDPL::ForceField::MMFF94InteractionData& ia_data, unsigned int ia_types, bool strict)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph));
+
+        parameterizer.parameterize(molgraph, ia_data, ia_types, strict);
+    }
+}
+
+
 void CDPLPythonForceField::exportMMFF94InteractionParameterizer()
 {
     using namespace boost;
@@ -98,9 +113,16 @@ void CDPLPythonForceField::exportMMFF94InteractionParameterizer()
              (python::arg("self"), python::arg("dist_expo")))
         .def("setParameterSet", &ForceField::MMFF94InteractionParameterizer::setParameterSet, 
              (python::arg("self"), python::arg("param_set")))
+        .def("setInteractionDataCache", &ForceField::MMFF94InteractionParameterizer::setInteractionDataCache, 
+             (python::arg("self"), python::arg("cache")))
+        .def("getInteractionDataCache", &ForceField::MMFF94InteractionParameterizer::getInteractionDataCache, 
+             python::arg("self"), python::return_value_policy<python::copy_const_reference>())
         .def("assign", CDPLPythonBase::copyAssOp<ForceField::MMFF94InteractionParameterizer>(),
              (python::arg("self"), python::arg("parameterizer")), python::return_self<>())
-        .def("parameterize", &ForceField::MMFF94InteractionParameterizer::parameterize, 
+        .def("parameterize", &parameterize, 
              (python::arg("self"), python::arg("molgraph"), python::arg("ia_data"), 
-              python::arg("ia_types") = ForceField::InteractionType::ALL, python::arg("strict") = true));
+              python::arg("ia_types") = ForceField::InteractionType::ALL, python::arg("strict") = true))
+        .add_property("interactionDataCache", python::make_function(&ForceField::MMFF94InteractionParameterizer::getInteractionDataCache,
+                                                                    python::return_value_policy<python::copy_const_reference>()),
+                      &ForceField::MMFF94InteractionParameterizer::setInteractionDataCache);
 }
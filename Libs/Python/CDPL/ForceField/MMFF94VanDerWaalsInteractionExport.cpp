@@ -73,7 +73,10 @@ namespace
                                                            atom1_params.factG, atom1_params.donAccType,
                                                            atom2_params.polarizability, atom2_params.effElNumber, 
                                                            atom2_params.factA, atom2_params.factG, atom2_params.donAccType,
-                                                           expo, fact_b, beta, fact_darad, fact_daeps) {} 
+                                                           expo, fact_b, beta, fact_darad, fact_daeps) {}
+
+        MMFF94VanDerWaalsInteractionWrapper(std::size_t atom1_idx, std::size_t atom2_idx, double e_IJ, double r_IJ):
+            CDPL::ForceField::MMFF94VanDerWaalsInteraction(atom1_idx, atom2_idx, e_IJ, r_IJ) {}
     };
 }
 
@@ -105,6 +108,8 @@ void CDPLPythonForceField::exportMMFF94VanDerWaalsInteraction()
                  (python::arg("self"), python::arg("atom1_idx"), python::arg("atom2_idx"), python::arg("atom_params1"), 
                   python::arg("atom_params2"), python::arg("expo"), python::arg("fact_b"), python::arg("beta"), 
                   python::arg("fact_darad"), python::arg("fact_daeps"))))
+        .def(python::init<std::size_t, std::size_t, double, double>(
+                 (python::arg("self"), python::arg("atom1_idx"), python::arg("atom2_idx"), python::arg("e_IJ"), python::arg("r_IJ"))))
         .def("getAtom1Index", &ForceField::MMFF94VanDerWaalsInteraction::getAtom1Index, python::arg("self"))
         .def("getAtom2Index", &ForceField::MMFF94VanDerWaalsInteraction::getAtom2Index, python::arg("self"))
         .def("getEIJ", &ForceField::MMFF94VanDerWaalsInteraction::getEIJ, python::arg("self"))
@@ -71,6 +71,7 @@ BOOST_PYTHON_MODULE(_forcefield)
     exportMMFF94VanDerWaalsInteractionList();
     exportMMFF94ElectrostaticInteractionList();
     exportMMFF94InteractionData();
+    exportMMFF94InteractionDataCache();
 
     exportMMFF94BondStretchingInteractionParameterizer();
     exportMMFF94AngleBendingInteractionParameterizer();
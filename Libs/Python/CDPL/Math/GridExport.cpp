@@ -70,8 +70,34 @@ namespace
                 .def(GridVisitor<GridType>())
                 .def(GridNDArrayInitVisitor<GridType>())
                 .def(GridNDArrayAssignVisitor<GridType, true>())
-                .def(GridContainerVisitor<GridType>());
+                .def(GridContainerVisitor<GridType>())
+#ifdef HAVE_NUMPY
+                .def("asArray", &asArray, python::arg("self"))
+#endif
+                ;
         }
+#ifdef HAVE_NUMPY
+        static boost::python::object asArray(const boost::python::object& self) {
+            using namespace boost;
+            using namespace CDPLPythonMath;
+
+            if (!NumPy::available())
+                return python::object();            
+
+            typedef typename GridType::ValueType ValueType;
+
+            GridType& grd = python::extract<GridType&>(self);
+            npy_intp shape[] = { npy_intp(grd.getSize1()), npy_intp(grd.getSize2()), npy_intp(grd.getSize3()) };
+            npy_intp strides[] = { npy_intp(sizeof(ValueType)), npy_intp(sizeof(ValueType) * grd.getSize1()), 
+                                   npy_intp(sizeof(ValueType) * grd.getSize1() * grd.getSize2()) };
+            PyObject* array = NumPy::createView(grd.isEmpty() ? static_cast<ValueType*>(0) : grd.getData().data(), 3, shape, strides, self.ptr());
+
+            if (!array)
+                python::throw_error_already_set();
+
+            return python::object(python::handle<>(array));
+        }
+#endif
     };
 }       
 
@@ -94,6 +94,26 @@ namespace CDPLPythonMath
             return 0;
         }
 
+        PyObject* createView(void* data, int type_num, int num_dims, npy_intp* shape, npy_intp* strides, PyObject* owner)
+        {
+            if (!data)
+                return PyArray_SimpleNew(num_dims, shape, type_num);
+
+            PyObject* array = PyArray_New(&PyArray_Type, num_dims, shape, type_num, strides, data, 0, 
+                                          NPY_ARRAY_ALIGNED | NPY_ARRAY_WRITEABLE, 0);
+            if (!array)
+                return 0;
+
+            Py_INCREF(owner);
+
+            if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(array), owner) != 0) {
+                Py_DECREF(array);
+                return 0;
+            }
+
+            return array;
+        }
+
         bool checkDim(PyArrayObject* arr, std::size_t dim) 
         {
             return (std::size_t(PyArray_NDIM(arr)) == dim);
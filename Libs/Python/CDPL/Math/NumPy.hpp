@@ -148,6 +148,20 @@ namespace CDPLPythonMath
 
         PyArrayObject* castToNDArray(PyObject* obj);
 
+        PyObject* createView(void* data, int type_num, int num_dims, npy_intp* shape, npy_intp* strides, PyObject* owner);
+
+        template <typename T>
+        PyObject* createView(T* data, int num_dims, npy_intp* shape, npy_intp* strides, PyObject* owner)
+        {
+            return createView(static_cast<void*>(data), DataTypeNum<T>::Value, num_dims, shape, strides, owner);
+        }
+
+        template <typename T>
+        bool isContiguous(PyArrayObject* arr)
+        {
+            return (PyArray_IS_C_CONTIGUOUS(arr) && PyArray_ISALIGNED(arr) && PyArray_ITEMSIZE(arr) == npy_intp(sizeof(T)));
+        }
+
         template <typename T>
         bool checkDataType(PyArrayObject* arr)
         {
@@ -23,6 +23,8 @@
 
 
 #include <cstddef>
+#include <cstring>
+#include <memory>
 
 #include <boost/python.hpp>
 
@@ -60,107 +62,113 @@ namespace
 #ifdef HAVE_NUMPY
                 .def("__init__", python::make_constructor(&construct, python::default_call_policies(), (python::arg("a"))))
                 .def("toArray", &toArray, (python::arg("self"), python::arg("as_vec")))
+                .def("asArray", &asArray, (python::arg("self"), python::arg("as_vec") = false))
+                .def("__array__", &arrayProtocol, (python::arg("self"), python::arg("dtype") = python::object(), python::arg("copy") = python::object()))
                 .def("assign", &assign, (python::arg("self"), python::arg("a")))
 #endif
                 ;
         }
 #ifdef HAVE_NUMPY
+        typedef typename ArrayType::ValueType VectorType;
+        typedef typename VectorType::ValueType ElemValueType;
+
+        static_assert(sizeof(VectorType) == sizeof(ElemValueType) * Dim, "VectorArray: unexpected vector storage layout");
+
+        static ElemValueType* getElementData(ArrayType& va) {
+            if (va.isEmpty())
+                return 0;
+
+            return reinterpret_cast<ElemValueType*>(va.getData().data());
+        }
+
+        static const ElemValueType* getElementData(const ArrayType& va) {
+            if (va.isEmpty())
+                return 0;
+
+            return reinterpret_cast<const ElemValueType*>(va.getData().data());
+        }
+
         static boost::python::object toArray(const ArrayType& va, bool as_vec) {
             using namespace boost;
             using namespace CDPLPythonMath;
 
             if (!NumPy::available())
-                python::object();            
+                return python::object();            
 
-            typedef typename ArrayType::ValueType::ValueType ValueType;
+            npy_intp shape[] = { npy_intp(va.getSize() * Dim), npy_intp(Dim) };
 
-            if (as_vec) {
-                npy_intp shape[] = { npy_intp(va.getSize() * Dim) };
-                PyObject* array = PyArray_SimpleNew(1, shape, NumPy::DataTypeNum<ValueType>::Value);
-
-                if (array) {
-                    ValueType* data = static_cast<ValueType*>(PyArray_GETPTR1(reinterpret_cast<PyArrayObject*>(array), 0));
-
-                    for (std::size_t i = 0, size = va.getSize(); i < size; i++) 
-                        for (std::size_t j = 0; j < Dim; j++, data++) 
-                        *data = va[i][j];
-
-                    return python::object(python::handle<>(array));
-                }
+            if (!as_vec)
+                shape[0] = npy_intp(va.getSize());
 
-            } else {
-                npy_intp shape[] = { npy_intp(va.getSize()), npy_intp(Dim) };
-                PyObject* py_obj = PyArray_SimpleNew(2, shape, NumPy::DataTypeNum<ValueType>::Value);
-                PyArrayObject* array = reinterpret_cast<PyArrayObject*>(py_obj);
+            PyObject* array = PyArray_SimpleNew((as_vec ? 1 : 2), shape, NumPy::DataTypeNum<ElemValueType>::Value);
 
-                if (array) {
-                    for (std::size_t i = 0, size = va.getSize(); i < size; i++)
-                        for (std::size_t j = 0; j < Dim; j++)
-                            *static_cast<ValueType*>(PyArray_GETPTR2(array, i, j)) = va[i][j];
+            if (!array)
+                return python::object();            
 
-                    return python::object(python::handle<>(py_obj));
-                }
-            }
+            if (!va.isEmpty())
+                std::memcpy(PyArray_DATA(reinterpret_cast<PyArrayObject*>(array)), getElementData(va), va.getSize() * sizeof(VectorType));
 
-            return python::object();            
+            return python::object(python::handle<>(array));
         }
 
-        static void assign(ArrayType& va, PyArrayObject* arr) {
-            using namespace CDPL;
+        static boost::python::object asArray(const boost::python::object& self, bool as_vec) {
             using namespace boost;
             using namespace CDPLPythonMath;
 
-            typedef typename ArrayType::ValueType::ValueType ElemValueType;
+            if (!NumPy::available())
+                return python::object();            
 
-            if (!NumPy::checkDataType<ElemValueType>(arr)) {
-                PyErr_SetString(PyExc_TypeError, "VectorArray: NumPy.NDArray of incompatible type");
+            ArrayType& va = python::extract<ArrayType&>(self);
+            npy_intp shape[] = { npy_intp(va.getSize()), npy_intp(Dim) };
+            npy_intp strides[] = { npy_intp(sizeof(VectorType)), npy_intp(sizeof(ElemValueType)) };
 
-                python::throw_error_already_set();
+            if (as_vec) {
+                shape[0] = npy_intp(va.getSize() * Dim);
+                strides[0] = npy_intp(sizeof(ElemValueType));
             }
 
-            if (NumPy::checkDim(arr, 2)) {
-                npy_intp* dims = PyArray_DIMS(arr);
+            PyObject* array = NumPy::createView(getElementData(va), (as_vec ? 1 : 2), shape, strides, self.ptr());
 
-                if (std::size_t(dims[1]) != ArrayType::ValueType::Size) {
-                    PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
+            if (!array)
+                python::throw_error_already_set();
 
-                    python::throw_error_already_set();
-                }
+            return python::object(python::handle<>(array));
+        }
 
-                va.resize(dims[0]);
+        static boost::python::object arrayProtocol(const boost::python::object& self, const boost::python::object& dtype, 
+                                                   const boost::python::object& copy) {
+            using namespace boost;
 
-                for (npy_intp i = 0; i < dims[0]; i++)
-                    for (std::size_t j = 0; j < ArrayType::ValueType::Size; j++)
-                        va[i][j] = *reinterpret_cast<ElemValueType*>(PyArray_GETPTR2(arr, i, j));
+            python::object array = (copy.is_none() || !python::extract<bool>(copy)() ? 
+                                    asArray(self, false) : toArray(python::extract<const ArrayType&>(self)(), false));
 
-            } else if (NumPy::checkDim(arr, 1)) {
-                npy_intp* dims = PyArray_DIMS(arr);
-    
-                if ((std::size_t(dims[0]) % ArrayType::ValueType::Size) != 0) {
-                    PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
+            if (dtype.is_none() || array.is_none())
+                return array;
 
-                    python::throw_error_already_set();
-                }
+            return array.attr("astype")(dtype);
+        }
 
-                va.resize(dims[0] / ArrayType::ValueType::Size);
+        static bool assignContiguous(ArrayType& va, PyArrayObject* arr) {
+            using namespace CDPLPythonMath;
 
-                for (npy_intp i = 0; i < dims[0]; i++)
-                    va[i / ArrayType::ValueType::Size][i % ArrayType::ValueType::Size] = *reinterpret_cast<ElemValueType*>(PyArray_GETPTR1(arr, i));
+            if (!NumPy::isContiguous<ElemValueType>(arr))
+                return false;
 
-            } else {
-                PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
-                
-                python::throw_error_already_set();
-            }
+            std::size_t num_elem = PyArray_SIZE(arr);
+
+            va.resize(num_elem / Dim);
+
+            if (num_elem > 0)
+                std::memcpy(getElementData(va), PyArray_DATA(arr), num_elem * sizeof(ElemValueType));
+
+            return true;
         }
 
-        static ArrayType* construct(PyArrayObject* arr) {
+        static void assign(ArrayType& va, PyArrayObject* arr) {
             using namespace CDPL;
             using namespace boost;
             using namespace CDPLPythonMath;
 
-            typedef typename ArrayType::ValueType::ValueType ElemValueType;
-
             if (!NumPy::checkDataType<ElemValueType>(arr)) {
                 PyErr_SetString(PyExc_TypeError, "VectorArray: NumPy.NDArray of incompatible type");
 
@@ -170,49 +178,51 @@ namespace
             if (NumPy::checkDim(arr, 2)) {
                 npy_intp* dims = PyArray_DIMS(arr);
 
-                if (std::size_t(dims[1]) != ArrayType::ValueType::Size) {
+                if (std::size_t(dims[1]) != Dim) {
                     PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
 
                     python::throw_error_already_set();
                 }
 
-                std::unique_ptr<ArrayType> va_ptr(new ArrayType());
-                ArrayType& va = *va_ptr;
+                if (assignContiguous(va, arr))
+                    return;
 
                 va.resize(dims[0]);
 
                 for (npy_intp i = 0; i < dims[0]; i++)
-                    for (std::size_t j = 0; j < ArrayType::ValueType::Size; j++)
+                    for (std::size_t j = 0; j < Dim; j++)
                         va[i][j] = *reinterpret_cast<ElemValueType*>(PyArray_GETPTR2(arr, i, j));
 
-                return va_ptr.release();
-            } 
-
-            if (NumPy::checkDim(arr, 1)) {
+            } else if (NumPy::checkDim(arr, 1)) {
                 npy_intp* dims = PyArray_DIMS(arr);
     
-                if ((std::size_t(dims[0]) % ArrayType::ValueType::Size) != 0) {
+                if ((std::size_t(dims[0]) % Dim) != 0) {
                     PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
 
                     python::throw_error_already_set();
                 }
 
-                std::unique_ptr<ArrayType> va_ptr(new ArrayType());
-                ArrayType& va = *va_ptr;
+                if (assignContiguous(va, arr))
+                    return;
 
-                va.resize(dims[0] / ArrayType::ValueType::Size);
+                va.resize(dims[0] / Dim);
 
                 for (npy_intp i = 0; i < dims[0]; i++)
-                    va[i / ArrayType::ValueType::Size][i % ArrayType::ValueType::Size] = *reinterpret_cast<ElemValueType*>(PyArray_GETPTR1(arr, i));
+                    va[i / Dim][i % Dim] = *reinterpret_cast<ElemValueType*>(PyArray_GETPTR1(arr, i));
 
-                return va_ptr.release();
-            } 
+            } else {
+                PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
+                
+                python::throw_error_already_set();
+            }
+        }
 
-            PyErr_SetString(PyExc_ValueError, "VectorArray: NumPy.NDArray dimension error");
+        static ArrayType* construct(PyArrayObject* arr) {
+            std::unique_ptr<ArrayType> va_ptr(new ArrayType());
 
-            python::throw_error_already_set();
+            assign(*va_ptr, arr);
 
-            return 0;
+            return va_ptr.release();
         }
 #endif
     };
@@ -59,12 +59,14 @@ void CDPLPythonPharm::exportCationPiInteractionConstraint()
         .def("getMinDistance", &Pharm::CationPiInteractionConstraint::getMinDistance, python::arg("self"))
         .def("getMaxDistance", &Pharm::CationPiInteractionConstraint::getMaxDistance, python::arg("self"))
         .def("getMaxAngle", &Pharm::CationPiInteractionConstraint::getMaxAngle, python::arg("self"))
+        .def("getMaxFeatureDistance", &Pharm::CationPiInteractionConstraint::getMaxFeatureDistance, python::arg("self"))
         .def("assign", CDPLPythonBase::copyAssOp<Pharm::CationPiInteractionConstraint>(), 
              (python::arg("self"), python::arg("constr")), python::return_self<>())
         .def("__call__", &callOperator, (python::arg("self"), python::arg("ftr1"), python::arg("ftr2")))
         .add_property("minDistance", &Pharm::CationPiInteractionConstraint::getMinDistance)
         .add_property("maxDistance", &Pharm::CationPiInteractionConstraint::getMaxDistance)
         .add_property("maxAngle", &Pharm::CationPiInteractionConstraint::getMaxAngle)
+        .add_property("maxFeatureDistance", &Pharm::CationPiInteractionConstraint::getMaxFeatureDistance)
         .def_readonly("DEF_MIN_DISTANCE", Pharm::CationPiInteractionConstraint::DEF_MIN_DISTANCE)
         .def_readonly("DEF_MAX_DISTANCE", Pharm::CationPiInteractionConstraint::DEF_MAX_DISTANCE)
         .def_readonly("DEF_MAX_ANGLE", Pharm::CationPiInteractionConstraint::DEF_MAX_ANGLE);
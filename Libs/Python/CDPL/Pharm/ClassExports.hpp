@@ -63,6 +63,7 @@ namespace CDPLPythonPharm
     void exportScreeningDBCreator();
     void exportScreeningDBAccessor();
     void exportScreeningProcessor();
+    void exportScreeningProcessorStatistics();
     void exportPharmacophoreFitScreeningScore();
 
     void exportFileScreeningHitCollector();
@@ -101,6 +102,7 @@ namespace CDPLPythonPharm
     void exportHBondingInteractionConstraint();
     void exportXBondingInteractionConstraint();
     void exportInteractionPharmacophoreGenerator();
+    void exportInteractionFingerprintGenerator();
 
     void exportFeatureInteractionScore();
     void exportFeatureInteractionScoreCombiner();
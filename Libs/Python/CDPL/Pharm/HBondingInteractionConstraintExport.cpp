@@ -61,6 +61,7 @@ void CDPLPythonPharm::exportHBondingInteractionConstraint()
         .def("getMaxLength", &Pharm::HBondingInteractionConstraint::getMaxLength, python::arg("self"))
         .def("getMinAHDAngle", &Pharm::HBondingInteractionConstraint::getMinAHDAngle, python::arg("self"))
         .def("getMaxAcceptorAngle", &Pharm::HBondingInteractionConstraint::getMaxAcceptorAngle, python::arg("self"))
+        .def("getMaxFeatureDistance", &Pharm::HBondingInteractionConstraint::getMaxFeatureDistance, python::arg("self"))
         .def("assign", CDPLPythonBase::copyAssOp<Pharm::HBondingInteractionConstraint>(), 
              (python::arg("self"), python::arg("constr")), python::return_self<>())
         .def("__call__", &callOperator, (python::arg("self"), python::arg("ftr1"), python::arg("ftr2")))
@@ -68,6 +69,7 @@ void CDPLPythonPharm::exportHBondingInteractionConstraint()
         .add_property("maxLength", &Pharm::HBondingInteractionConstraint::getMaxLength)
         .add_property("minAHDAngle", &Pharm::HBondingInteractionConstraint::getMinAHDAngle)
         .add_property("maxAcceptorAngle", &Pharm::HBondingInteractionConstraint::getMaxAcceptorAngle)
+        .add_property("maxFeatureDistance", &Pharm::HBondingInteractionConstraint::getMaxFeatureDistance)
         .def_readonly("DEF_MIN_HB_LENGTH", Pharm::HBondingInteractionConstraint::DEF_MIN_HB_LENGTH)
         .def_readonly("DEF_MAX_HB_LENGTH", Pharm::HBondingInteractionConstraint::DEF_MAX_HB_LENGTH)
         .def_readonly("DEF_MIN_AHD_ANGLE", Pharm::HBondingInteractionConstraint::DEF_MIN_AHD_ANGLE)
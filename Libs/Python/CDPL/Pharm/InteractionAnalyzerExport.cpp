@@ -43,16 +43,31 @@ void CDPLPythonPharm::exportInteractionAnalyzer()
         .def(python::init<const Pharm::InteractionAnalyzer&>(
                  (python::arg("self"), python::arg("analyzer"))))
         .def(CDPLPythonBase::ObjectIdentityCheckVisitor<Pharm::InteractionAnalyzer>())    
-        .def("setConstraintFunction", &Pharm::InteractionAnalyzer::setConstraintFunction, 
+        .def("setConstraintFunction", static_cast<void (Pharm::InteractionAnalyzer::*)(unsigned int, unsigned int, const Pharm::InteractionAnalyzer::ConstraintFunction&)>(
+                 &Pharm::InteractionAnalyzer::setConstraintFunction), 
              (python::arg("self"), python::arg("type1"), python::arg("type2"), python::arg("func")))
+        .def("setConstraintFunction", static_cast<void (Pharm::InteractionAnalyzer::*)(unsigned int, unsigned int, const Pharm::InteractionAnalyzer::ConstraintFunction&, double)>(
+                 &Pharm::InteractionAnalyzer::setConstraintFunction), 
+             (python::arg("self"), python::arg("type1"), python::arg("type2"), python::arg("func"), python::arg("max_dist")))
         .def("removeConstraintFunction", &Pharm::InteractionAnalyzer::removeConstraintFunction, 
              (python::arg("self"), python::arg("type1"), python::arg("type2")))
         .def("getConstraintFunction", &Pharm::InteractionAnalyzer::getConstraintFunction, 
              (python::arg("self"), python::arg("type1"), python::arg("type2")),
              python::return_value_policy<python::copy_const_reference>())
+        .def("getMaxInteractionDistance", &Pharm::InteractionAnalyzer::getMaxInteractionDistance, 
+             (python::arg("self"), python::arg("type1"), python::arg("type2")))
+        .def("indexFeatures", &Pharm::InteractionAnalyzer::indexFeatures, (python::arg("self"), python::arg("cntnr2")),
+             python::with_custodian_and_ward<1, 2>())
+        .def("clearFeatureIndex", &Pharm::InteractionAnalyzer::clearFeatureIndex, python::arg("self"))
+        .def("hasFeatureIndex", &Pharm::InteractionAnalyzer::hasFeatureIndex, python::arg("self"))
         .def("assign", &Pharm::InteractionAnalyzer::operator=, 
              (python::arg("self"), python::arg("analyzer")), python::return_self<>())
-        .def("analyze", &Pharm::InteractionAnalyzer::analyze,
+        .def("analyze", static_cast<void (Pharm::InteractionAnalyzer::*)(const Pharm::FeatureContainer&, const Pharm::FeatureContainer&, Pharm::FeatureMapping&, bool) const>(
+                 &Pharm::InteractionAnalyzer::analyze),
              (python::arg("self"), python::arg("cntnr1"), python::arg("cntnr2"), 
-              python::arg("iactions"), python::arg("append") = false));
+              python::arg("iactions"), python::arg("append") = false))
+        .def("analyze", static_cast<void (Pharm::InteractionAnalyzer::*)(const Pharm::FeatureContainer&, Pharm::FeatureMapping&, bool) const>(
+                 &Pharm::InteractionAnalyzer::analyze),
+             (python::arg("self"), python::arg("cntnr1"), python::arg("iactions"), python::arg("append") = false))
+        .def_readonly("NO_DISTANCE_LIMIT", Pharm::InteractionAnalyzer::NO_DISTANCE_LIMIT);
 }
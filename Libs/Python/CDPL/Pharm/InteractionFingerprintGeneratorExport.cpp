@@ -0,0 +1,133 @@
+/* 
+ * InteractionFingerprintGeneratorExport.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/Pharm/InteractionFingerprintGenerator.hpp"
+#include "CDPL/Chem/MolecularGraph.hpp"
+
+#include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/GILGuard.hpp"
+
+#include "ClassExports.hpp"
+
+
+namespace
+{
+
+    // the molecular graphs specified in setup() are not accessed and Python constraint functions
+    // of the interaction analyzer reacquire the GIL when called from worker threads
+
+    void generate1(CDPL::Pharm::InteractionFingerprintGenerator& gen, const CDPL::Math::Vector3DArray& lig_coords,
+                   const CDPL::Math::Vector3DArray& env_coords, CDPL::Util::BitSet& fp)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        gen.generate(lig_coords, env_coords, fp);
+    }
+
+    void generate2(CDPL::Pharm::InteractionFingerprintGenerator& gen, const CDPL::Math::Vector3DArray& lig_coords,
+                   const CDPL::Math::Vector3DArray& env_coords, CDPL::Math::ULVector& counts)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        gen.generate(lig_coords, env_coords, counts);
+    }
+
+    void generate3(CDPL::Pharm::InteractionFingerprintGenerator& gen, const CDPL::Math::Vector3DArray& lig_coords,
+                   const CDPL::Math::Vector3DArray& env_coords, std::size_t num_frames, CDPL::Util::BitSetArray& fps)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        gen.generate(lig_coords, env_coords, num_frames, fps);
+    }
+
+    void generate4(CDPL::Pharm::InteractionFingerprintGenerator& gen, const CDPL::Math::Vector3DArray& lig_coords,
+                   const CDPL::Math::Vector3DArray& env_coords, std::size_t num_frames, CDPL::Math::ULMatrix& counts)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard;
+
+        gen.generate(lig_coords, env_coords, num_frames, counts);
+    }
+}
+
+
+void CDPLPythonPharm::exportInteractionFingerprintGenerator()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    python::class_<Pharm::InteractionFingerprintGenerator, Pharm::InteractionFingerprintGenerator::SharedPointer,
+                   boost::noncopyable>("InteractionFingerprintGenerator", python::no_init)
+        .def(python::init<>(python::arg("self")))
+        .def(CDPLPythonBase::ObjectIdentityCheckVisitor<Pharm::InteractionFingerprintGenerator>())    
+        .def("setNumThreads", &Pharm::InteractionFingerprintGenerator::setNumThreads, 
+             (python::arg("self"), python::arg("num_threads")))
+        .def("getNumThreads", &Pharm::InteractionFingerprintGenerator::getNumThreads, python::arg("self"))
+        .def("getLigandPharmacophoreGenerator", static_cast<Pharm::PharmacophoreGenerator& (Pharm::InteractionFingerprintGenerator::*)()>(
+                 &Pharm::InteractionFingerprintGenerator::getLigandPharmacophoreGenerator),
+             python::arg("self"), python::return_internal_reference<>())
+        .def("getEnvironmentPharmacophoreGenerator", static_cast<Pharm::PharmacophoreGenerator& (Pharm::InteractionFingerprintGenerator::*)()>(
+                 &Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophoreGenerator),
+             python::arg("self"), python::return_internal_reference<>())
+        .def("getInteractionAnalyzer", static_cast<Pharm::InteractionAnalyzer& (Pharm::InteractionFingerprintGenerator::*)()>(
+                 &Pharm::InteractionFingerprintGenerator::getInteractionAnalyzer),
+             python::arg("self"), python::return_internal_reference<>())
+        .def("setup", &Pharm::InteractionFingerprintGenerator::setup, 
+             (python::arg("self"), python::arg("ligand"), python::arg("env")),
+             python::with_custodian_and_ward<1, 2, python::with_custodian_and_ward<1, 3> >())
+        .def("getLigandPharmacophore", &Pharm::InteractionFingerprintGenerator::getLigandPharmacophore,
+             python::arg("self"), python::return_internal_reference<>())
+        .def("getEnvironmentPharmacophore", &Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophore,
+             python::arg("self"), python::return_internal_reference<>())
+        .def("getNumBits", &Pharm::InteractionFingerprintGenerator::getNumBits, python::arg("self"))
+        .def("generate", &generate1,
+             (python::arg("self"), python::arg("lig_coords"), python::arg("env_coords"), python::arg("fp")))
+        .def("generate", &generate2,
+             (python::arg("self"), python::arg("lig_coords"), python::arg("env_coords"), python::arg("counts")))
+        .def("generate", &generate3,
+             (python::arg("self"), python::arg("lig_coords"), python::arg("env_coords"), python::arg("num_frames"), python::arg("fps")))
+        .def("generate", &generate4,
+             (python::arg("self"), python::arg("lig_coords"), python::arg("env_coords"), python::arg("num_frames"), python::arg("counts")))
+        .add_property("numThreads", &Pharm::InteractionFingerprintGenerator::getNumThreads,
+                      &Pharm::InteractionFingerprintGenerator::setNumThreads)
+        .add_property("numBits", &Pharm::InteractionFingerprintGenerator::getNumBits)
+        .add_property("ligandPharmacophoreGenerator", 
+                      python::make_function(static_cast<Pharm::PharmacophoreGenerator& (Pharm::InteractionFingerprintGenerator::*)()>(
+                                                &Pharm::InteractionFingerprintGenerator::getLigandPharmacophoreGenerator), 
+                                            python::return_internal_reference<>()))
+        .add_property("envPharmacophoreGenerator", 
+                      python::make_function(static_cast<Pharm::PharmacophoreGenerator& (Pharm::InteractionFingerprintGenerator::*)()>(
+                                                &Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophoreGenerator), 
+                                            python::return_internal_reference<>()))
+        .add_property("interactionAnalyzer", 
+                      python::make_function(static_cast<Pharm::InteractionAnalyzer& (Pharm::InteractionFingerprintGenerator::*)()>(
+                                                &Pharm::InteractionFingerprintGenerator::getInteractionAnalyzer),
+                                            python::return_internal_reference<>()))
+        .add_property("ligandPharmacophore", python::make_function(&Pharm::InteractionFingerprintGenerator::getLigandPharmacophore,
+                                                                   python::return_internal_reference<>()))
+        .add_property("envPharmacophore", python::make_function(&Pharm::InteractionFingerprintGenerator::getEnvironmentPharmacophore,
+                                                                python::return_internal_reference<>()))
+        .def_readonly("NUM_LIGAND_FEATURE_TYPES", Pharm::InteractionFingerprintGenerator::NUM_LIGAND_FEATURE_TYPES);
+}
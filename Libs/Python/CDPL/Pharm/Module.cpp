@@ -66,6 +66,7 @@ BOOST_PYTHON_MODULE(_pharm)
     exportScreeningDBCreator();
     exportScreeningDBAccessor();
     exportScreeningProcessor();
+    exportScreeningProcessorStatistics();
     exportPharmacophoreFitScreeningScore();
 
     exportFileScreeningHitCollector();
@@ -104,6 +105,7 @@ BOOST_PYTHON_MODULE(_pharm)
     exportHBondingInteractionConstraint();
     exportXBondingInteractionConstraint();
     exportInteractionPharmacophoreGenerator();
+    exportInteractionFingerprintGenerator();
 
     exportFeatureInteractionScore();
     exportFeatureInteractionScoreCombiner();
@@ -61,6 +61,7 @@ void CDPLPythonPharm::exportOrthogonalPiPiInteractionConstraint()
         .def("getMaxHDistance", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxHDistance, python::arg("self"))
         .def("getMaxVDistance", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxVDistance, python::arg("self"))
         .def("getMaxAngle", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxAngle, python::arg("self"))
+        .def("getMaxFeatureDistance", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxFeatureDistance, python::arg("self"))
         .def("assign", CDPLPythonBase::copyAssOp<Pharm::OrthogonalPiPiInteractionConstraint>(), 
              (python::arg("self"), python::arg("constr")), python::return_self<>())
         .def("__call__", &callOperator, (python::arg("self"), python::arg("ftr1"), python::arg("ftr2")))
@@ -68,6 +69,7 @@ void CDPLPythonPharm::exportOrthogonalPiPiInteractionConstraint()
         .add_property("maxHDistance", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxHDistance)
         .add_property("maxVDistance", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxVDistance)
         .add_property("maxAngle", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxAngle)
+        .add_property("maxFeatureDistance", &Pharm::OrthogonalPiPiInteractionConstraint::getMaxFeatureDistance)
         .def_readonly("DEF_MIN_H_DISTANCE", Pharm::OrthogonalPiPiInteractionConstraint::DEF_MIN_H_DISTANCE)
         .def_readonly("DEF_MAX_H_DISTANCE", Pharm::OrthogonalPiPiInteractionConstraint::DEF_MAX_H_DISTANCE)
         .def_readonly("DEF_MAX_V_DISTANCE", Pharm::OrthogonalPiPiInteractionConstraint::DEF_MAX_V_DISTANCE)
@@ -61,6 +61,7 @@ void CDPLPythonPharm::exportParallelPiPiInteractionConstraint()
         .def("getMaxVDistance", &Pharm::ParallelPiPiInteractionConstraint::getMaxVDistance, python::arg("self"))
         .def("getMaxHDistance", &Pharm::ParallelPiPiInteractionConstraint::getMaxHDistance, python::arg("self"))
         .def("getMaxAngle", &Pharm::ParallelPiPiInteractionConstraint::getMaxAngle, python::arg("self"))
+        .def("getMaxFeatureDistance", &Pharm::ParallelPiPiInteractionConstraint::getMaxFeatureDistance, python::arg("self"))
         .def("assign", CDPLPythonBase::copyAssOp<Pharm::ParallelPiPiInteractionConstraint>(), 
              (python::arg("self"), python::arg("constr")), python::return_self<>())
         .def("__call__", &callOperator, (python::arg("self"), python::arg("ftr1"), python::arg("ftr2")))
@@ -68,6 +69,7 @@ void CDPLPythonPharm::exportParallelPiPiInteractionConstraint()
         .add_property("maxVDistance", &Pharm::ParallelPiPiInteractionConstraint::getMaxVDistance)
         .add_property("maxHDistance", &Pharm::ParallelPiPiInteractionConstraint::getMaxHDistance)
         .add_property("maxAngle", &Pharm::ParallelPiPiInteractionConstraint::getMaxAngle)
+        .add_property("maxFeatureDistance", &Pharm::ParallelPiPiInteractionConstraint::getMaxFeatureDistance)
         .def_readonly("DEF_MIN_V_DISTANCE", Pharm::ParallelPiPiInteractionConstraint::DEF_MIN_V_DISTANCE)
         .def_readonly("DEF_MAX_V_DISTANCE", Pharm::ParallelPiPiInteractionConstraint::DEF_MAX_V_DISTANCE)
         .def_readonly("DEF_MAX_H_DISTANCE", Pharm::ParallelPiPiInteractionConstraint::DEF_MAX_H_DISTANCE)
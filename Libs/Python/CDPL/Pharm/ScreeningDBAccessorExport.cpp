@@ -97,6 +97,52 @@ namespace
         const CDPL::Pharm::FeatureTypeHistogram& getFeatureCounts(std::size_t mol_idx, std::size_t mol_conf_idx) const {
             return this->get_override("getFeatureCounts")(mol_idx, mol_conf_idx);
         }
+
+        void prefetchPharmacophores(const CDPL::Util::STArray& pharm_indices) const {
+            if (boost::python::override f = this->get_override("prefetchPharmacophores")) {
+                f(boost::ref(pharm_indices));
+                return;
+            }
+
+            CDPL::Pharm::ScreeningDBAccessor::prefetchPharmacophores(pharm_indices);
+        }
+
+        void prefetchPharmacophoresDef(const CDPL::Util::STArray& pharm_indices) const {
+            CDPL::Pharm::ScreeningDBAccessor::prefetchPharmacophores(pharm_indices);
+        }
+
+        bool getAtomCoordinatesAndRadii(std::size_t pharm_idx, CDPL::Math::Vector3DArray& coords, CDPL::Util::DArray& radii) const {
+            if (boost::python::override f = this->get_override("getAtomCoordinatesAndRadii"))
+                return f(pharm_idx, boost::ref(coords), boost::ref(radii));
+
+            return CDPL::Pharm::ScreeningDBAccessor::getAtomCoordinatesAndRadii(pharm_idx, coords, radii);
+        }
+
+        bool getAtomCoordinatesAndRadiiDef(std::size_t pharm_idx, CDPL::Math::Vector3DArray& coords, CDPL::Util::DArray& radii) const {
+            return CDPL::Pharm::ScreeningDBAccessor::getAtomCoordinatesAndRadii(pharm_idx, coords, radii);
+        }
+
+        std::size_t getNumBytesRead() const {
+            if (boost::python::override f = this->get_override("getNumBytesRead"))
+                return f();
+
+            return CDPL::Pharm::ScreeningDBAccessor::getNumBytesRead();
+        }
+
+        std::size_t getNumBytesReadDef() const {
+            return CDPL::Pharm::ScreeningDBAccessor::getNumBytesRead();
+        }
+
+        double getDataDecodingTime() const {
+            if (boost::python::override f = this->get_override("getDataDecodingTime"))
+                return f();
+
+            return CDPL::Pharm::ScreeningDBAccessor::getDataDecodingTime();
+        }
+
+        double getDataDecodingTimeDef() const {
+            return CDPL::Pharm::ScreeningDBAccessor::getDataDecodingTime();
+        }
     };
 }
 
@@ -146,11 +192,21 @@ void CDPLPythonPharm::exportScreeningDBAccessor()
         .def("getFeatureCounts", python::pure_virtual(
                  static_cast<const Pharm::FeatureTypeHistogram& (Pharm::ScreeningDBAccessor::*)(std::size_t, std::size_t) const>(&Pharm::ScreeningDBAccessor::getFeatureCounts)),
              (python::arg("self"), python::arg("mol_idx"), python::arg("mol_conf_idx")), python::return_internal_reference<>())
+        .def("prefetchPharmacophores", &Pharm::ScreeningDBAccessor::prefetchPharmacophores, &ScreeningDBAccessorWrapper::prefetchPharmacophoresDef,
+             (python::arg("self"), python::arg("pharm_indices")))
+        .def("getAtomCoordinatesAndRadii", &Pharm::ScreeningDBAccessor::getAtomCoordinatesAndRadii, &ScreeningDBAccessorWrapper::getAtomCoordinatesAndRadiiDef,
+             (python::arg("self"), python::arg("pharm_idx"), python::arg("coords"), python::arg("radii")))
+        .def("getNumBytesRead", &Pharm::ScreeningDBAccessor::getNumBytesRead, &ScreeningDBAccessorWrapper::getNumBytesReadDef,
+             python::arg("self"))
+        .def("getDataDecodingTime", &Pharm::ScreeningDBAccessor::getDataDecodingTime, &ScreeningDBAccessorWrapper::getDataDecodingTimeDef,
+             python::arg("self"))
         .add_property("databaseName", python::make_function(&Pharm::ScreeningDBAccessor::getDatabaseName,                                            
                                                             python::return_value_policy<python::copy_const_reference>()))
         .add_property("numMolecules", &Pharm::ScreeningDBAccessor::getNumMolecules)
         .add_property("numPharmacophores", 
-                      static_cast<std::size_t (Pharm::ScreeningDBAccessor::*)() const>(&Pharm::ScreeningDBAccessor::getNumPharmacophores));
+                      static_cast<std::size_t (Pharm::ScreeningDBAccessor::*)() const>(&Pharm::ScreeningDBAccessor::getNumPharmacophores))
+        .add_property("numBytesRead", &Pharm::ScreeningDBAccessor::getNumBytesRead)
+        .add_property("dataDecodingTime", &Pharm::ScreeningDBAccessor::getDataDecodingTime);
 
     python::register_ptr_to_python<Pharm::ScreeningDBAccessor::SharedPointer>();
 }
@@ -31,10 +31,46 @@
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
 #include "Base/CopyAssOp.hpp"
+#include "Base/GILGuard.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    std::size_t searchDB(CDPL::Pharm::ScreeningProcessor& proc, const CDPL::Pharm::FeatureContainer& query, 
+                         std::size_t mol_start_idx, std::size_t mol_end_idx)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(query) &&
+                                                  !CDPLPythonBase::isPythonImplemented(proc.getDBAccessor()));
+
+        return proc.searchDB(query, mol_start_idx, mol_end_idx);
+    }
+
+    std::size_t searchDBMultiQuery(CDPL::Pharm::ScreeningProcessor& proc, const boost::python::object& queries, 
+                                   std::size_t mol_start_idx, std::size_t mol_end_idx)
+    {
+        using namespace boost;
+        using namespace CDPL;
+
+        Pharm::ScreeningProcessor::QueryPharmacophoreList query_list;
+        bool release_gil = !CDPLPythonBase::isPythonImplemented(proc.getDBAccessor());
+
+        for (std::size_t i = 0, num_queries = python::len(queries); i < num_queries; i++) {
+            const Pharm::FeatureContainer& query = python::extract<const Pharm::FeatureContainer&>(queries[i]);
+
+            query_list.push_back(&query);
+            release_gil &= !CDPLPythonBase::isPythonImplemented(query);
+        }
+
+        CDPLPythonBase::GILReleaseGuard gil_guard(release_gil);
+
+        return proc.searchDB(query_list, mol_start_idx, mol_end_idx);
+    }
+}
+
+
 void CDPLPythonPharm::exportScreeningProcessor()
 {
     using namespace boost;
@@ -53,9 +89,9 @@ void CDPLPythonPharm::exportScreeningProcessor()
 
     python::class_<Pharm::ScreeningProcessor::SearchHit/*, boost::noncopyable*/>("SearchHit", python::no_init)
         .def(python::init<const Pharm::ScreeningProcessor&, const Pharm::FeatureContainer&, const Pharm::FeatureContainer&, const Chem::Molecule&, 
-             const Math::Matrix4D&, std::size_t, std::size_t, std::size_t>(
+             const Math::Matrix4D&, std::size_t, std::size_t, std::size_t, std::size_t>(
                  (python::arg("self"), python::arg("hit_prov"), python::arg("qry_pharm"), python::arg("hit_pharm"), python::arg("mol"), 
-                  python::arg("xform"), python::arg("pharm_idx"), python::arg("mol_idx"), python::arg("conf_idx")))
+                  python::arg("xform"), python::arg("pharm_idx"), python::arg("mol_idx"), python::arg("conf_idx"), python::arg("qry_pharm_idx") = 0))
              [python::with_custodian_and_ward<1, 2, python::with_custodian_and_ward<1, 3, python::with_custodian_and_ward<1, 4, 
               python::with_custodian_and_ward<1, 5, python::with_custodian_and_ward<1, 5> > > > >()])
         .def(python::init<const Pharm::ScreeningProcessor::SearchHit&>((python::arg("self"), python::arg("hit")))
@@ -77,6 +113,7 @@ void CDPLPythonPharm::exportScreeningProcessor()
         .def("getHitPharmacophoreIndex", &Pharm::ScreeningProcessor::SearchHit::getHitPharmacophoreIndex, python::arg("self"))
         .def("getHitMoleculeIndex", &Pharm::ScreeningProcessor::SearchHit::getHitMoleculeIndex, python::arg("self"))
         .def("getHitConformationIndex", &Pharm::ScreeningProcessor::SearchHit::getHitConformationIndex, python::arg("self"))
+        .def("getQueryPharmacophoreIndex", &Pharm::ScreeningProcessor::SearchHit::getQueryPharmacophoreIndex, python::arg("self"))
         .add_property("hitProvider", 
                       python::make_function(&Pharm::ScreeningProcessor::SearchHit::getHitProvider,
                                             python::return_internal_reference<>()))
@@ -94,7 +131,8 @@ void CDPLPythonPharm::exportScreeningProcessor()
                                             python::return_internal_reference<>()))
         .add_property("hitPharmacophoreIndex", &Pharm::ScreeningProcessor::SearchHit::getHitPharmacophoreIndex)
         .add_property("hitMoleculeIndex", &Pharm::ScreeningProcessor::SearchHit::getHitMoleculeIndex)
-        .add_property("hitConformationIndex", &Pharm::ScreeningProcessor::SearchHit::getHitConformationIndex);
+        .add_property("hitConformationIndex", &Pharm::ScreeningProcessor::SearchHit::getHitConformationIndex)
+        .add_property("queryPharmacophoreIndex", &Pharm::ScreeningProcessor::SearchHit::getQueryPharmacophoreIndex);
 
     cl
         .def(python::init<Pharm::ScreeningDBAccessor&>((python::arg("self"), python::arg("db_acc")))
@@ -130,8 +168,14 @@ void CDPLPythonPharm::exportScreeningProcessor()
              (python::arg("self"), python::arg("func")))
         .def("getScoringFunction", &Pharm::ScreeningProcessor::getScoringFunction, 
              python::arg("self"), python::return_internal_reference<>())
-        .def("searchDB", &Pharm::ScreeningProcessor::searchDB, 
+        .def("searchDB", &searchDBMultiQuery, 
+             (python::arg("self"), python::arg("queries"), python::arg("mol_start_idx") = 0, python::arg("mol_end_idx") = 0))
+        .def("searchDB", &searchDB, 
              (python::arg("self"), python::arg("query"), python::arg("mol_start_idx") = 0, python::arg("mol_end_idx") = 0))
+        .def("getStatistics", &Pharm::ScreeningProcessor::getStatistics, 
+             python::arg("self"), python::return_internal_reference<>())
+        .add_property("statistics", python::make_function(&Pharm::ScreeningProcessor::getStatistics,
+                                                          python::return_internal_reference<>()))
         .add_property("dbAcccessor", python::make_function(&Pharm::ScreeningProcessor::getDBAccessor,
                                                            python::return_internal_reference<>()),
                       python::make_function(&Pharm::ScreeningProcessor::setDBAccessor, 
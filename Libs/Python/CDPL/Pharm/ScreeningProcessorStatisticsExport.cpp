@@ -0,0 +1,124 @@
+/* 
+ * ScreeningProcessorStatisticsExport.cpp 
+ *
+ * This file is part of the Utilical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/Pharm/ScreeningProcessorStatistics.hpp"
+
+#include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/CopyAssOp.hpp"
+
+#include "ClassExports.hpp"
+
+
+void CDPLPythonPharm::exportScreeningProcessorStatistics()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    python::class_<Pharm::ScreeningProcessorStatistics> cl("ScreeningProcessorStatistics", python::no_init);
+    python::scope scope = cl;
+
+    python::enum_<Pharm::ScreeningProcessorStatistics::Stage>("Stage")
+        .value("FEATURE_COUNT_FILTER", Pharm::ScreeningProcessorStatistics::FEATURE_COUNT_FILTER)
+        .value("TWO_POINT_PHARMACOPHORE_FILTER", Pharm::ScreeningProcessorStatistics::TWO_POINT_PHARMACOPHORE_FILTER)
+        .value("TOPOLOGICAL_ALIGNMENT", Pharm::ScreeningProcessorStatistics::TOPOLOGICAL_ALIGNMENT)
+        .value("SPATIAL_ALIGNMENT", Pharm::ScreeningProcessorStatistics::SPATIAL_ALIGNMENT)
+        .value("XVOLUME_CLASH_FILTER", Pharm::ScreeningProcessorStatistics::XVOLUME_CLASH_FILTER)
+        .value("SCORING", Pharm::ScreeningProcessorStatistics::SCORING)
+        .export_values();
+
+    python::enum_<Pharm::ScreeningProcessorStatistics::Counter>("Counter")
+        .value("NUM_SCREENED_PHARMACOPHORES", Pharm::ScreeningProcessorStatistics::NUM_SCREENED_PHARMACOPHORES)
+        .value("NUM_SKIPPED_PHARMACOPHORES", Pharm::ScreeningProcessorStatistics::NUM_SKIPPED_PHARMACOPHORES)
+        .value("NUM_LOADED_PHARMACOPHORES", Pharm::ScreeningProcessorStatistics::NUM_LOADED_PHARMACOPHORES)
+        .value("NUM_LOADED_MOLECULES", Pharm::ScreeningProcessorStatistics::NUM_LOADED_MOLECULES)
+        .value("NUM_BYTES_READ", Pharm::ScreeningProcessorStatistics::NUM_BYTES_READ)
+        .value("NUM_HITS", Pharm::ScreeningProcessorStatistics::NUM_HITS)
+        .export_values();
+
+    cl
+        .def(python::init<>(python::arg("self")))
+        .def(python::init<const Pharm::ScreeningProcessorStatistics&>((python::arg("self"), python::arg("stats"))))
+        .def(CDPLPythonBase::ObjectIdentityCheckVisitor<Pharm::ScreeningProcessorStatistics>())
+        .def("assign", CDPLPythonBase::copyAssOp<Pharm::ScreeningProcessorStatistics>(), 
+             (python::arg("self"), python::arg("stats")), python::return_self<>())
+        .def("clear", &Pharm::ScreeningProcessorStatistics::clear, python::arg("self"))
+        .def("getTotalTime", &Pharm::ScreeningProcessorStatistics::getTotalTime, python::arg("self"))
+        .def("setTotalTime", &Pharm::ScreeningProcessorStatistics::setTotalTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("getNumTested", &Pharm::ScreeningProcessorStatistics::getNumTested, 
+             (python::arg("self"), python::arg("stage")))
+        .def("getNumPassed", &Pharm::ScreeningProcessorStatistics::getNumPassed, 
+             (python::arg("self"), python::arg("stage")))
+        .def("getPassRate", &Pharm::ScreeningProcessorStatistics::getPassRate, 
+             (python::arg("self"), python::arg("stage")))
+        .def("setStageCounts", &Pharm::ScreeningProcessorStatistics::setStageCounts, 
+             (python::arg("self"), python::arg("stage"), python::arg("num_tested"), python::arg("num_passed")))
+        .def("addStageCounts", &Pharm::ScreeningProcessorStatistics::addStageCounts, 
+             (python::arg("self"), python::arg("stage"), python::arg("num_tested"), python::arg("num_passed")))
+        .def("getStageTime", &Pharm::ScreeningProcessorStatistics::getStageTime, 
+             (python::arg("self"), python::arg("stage")))
+        .def("setStageTime", &Pharm::ScreeningProcessorStatistics::setStageTime, 
+             (python::arg("self"), python::arg("stage"), python::arg("time")))
+        .def("addStageTime", &Pharm::ScreeningProcessorStatistics::addStageTime, 
+             (python::arg("self"), python::arg("stage"), python::arg("time")))
+        .def("getCounter", &Pharm::ScreeningProcessorStatistics::getCounter, 
+             (python::arg("self"), python::arg("counter")))
+        .def("setCounter", &Pharm::ScreeningProcessorStatistics::setCounter, 
+             (python::arg("self"), python::arg("counter"), python::arg("value")))
+        .def("increaseCounter", &Pharm::ScreeningProcessorStatistics::increaseCounter, 
+             (python::arg("self"), python::arg("counter"), python::arg("inc") = 1))
+        .def("getPharmacophoreLoadTime", &Pharm::ScreeningProcessorStatistics::getPharmacophoreLoadTime, python::arg("self"))
+        .def("setPharmacophoreLoadTime", &Pharm::ScreeningProcessorStatistics::setPharmacophoreLoadTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("addPharmacophoreLoadTime", &Pharm::ScreeningProcessorStatistics::addPharmacophoreLoadTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("getMoleculeLoadTime", &Pharm::ScreeningProcessorStatistics::getMoleculeLoadTime, python::arg("self"))
+        .def("setMoleculeLoadTime", &Pharm::ScreeningProcessorStatistics::setMoleculeLoadTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("addMoleculeLoadTime", &Pharm::ScreeningProcessorStatistics::addMoleculeLoadTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("getDataDecodingTime", &Pharm::ScreeningProcessorStatistics::getDataDecodingTime, python::arg("self"))
+        .def("setDataDecodingTime", &Pharm::ScreeningProcessorStatistics::setDataDecodingTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("addDataDecodingTime", &Pharm::ScreeningProcessorStatistics::addDataDecodingTime, 
+             (python::arg("self"), python::arg("time")))
+        .def("__iadd__", &Pharm::ScreeningProcessorStatistics::operator+=, (python::arg("self"), python::arg("stats")), 
+             python::return_self<>())
+        .def("getStageName", &Pharm::ScreeningProcessorStatistics::getStageName, python::arg("stage"))
+        .staticmethod("getStageName")
+        .def("getCounterName", &Pharm::ScreeningProcessorStatistics::getCounterName, python::arg("counter"))
+        .staticmethod("getCounterName")
+        .def_readonly("NUM_STAGES", Pharm::ScreeningProcessorStatistics::NUM_STAGES)
+        .def_readonly("NUM_COUNTERS", Pharm::ScreeningProcessorStatistics::NUM_COUNTERS)
+        .add_property("totalTime", &Pharm::ScreeningProcessorStatistics::getTotalTime, &Pharm::ScreeningProcessorStatistics::setTotalTime)
+        .add_property("pharmacophoreLoadTime", &Pharm::ScreeningProcessorStatistics::getPharmacophoreLoadTime, 
+                      &Pharm::ScreeningProcessorStatistics::setPharmacophoreLoadTime)
+        .add_property("moleculeLoadTime", &Pharm::ScreeningProcessorStatistics::getMoleculeLoadTime, 
+                      &Pharm::ScreeningProcessorStatistics::setMoleculeLoadTime)
+        .add_property("dataDecodingTime", &Pharm::ScreeningProcessorStatistics::getDataDecodingTime, 
+                      &Pharm::ScreeningProcessorStatistics::setDataDecodingTime);
+}
@@ -28,10 +28,23 @@
 #include "CDPL/Chem/MolecularGraph.hpp"
 
 #include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/GILGuard.hpp"
 
 #include "ClassExports.hpp"
 
 
+namespace
+{
+
+    bool process(CDPL::Shape::ScreeningProcessor& proc, const CDPL::Chem::MolecularGraph& molgraph)
+    {
+        CDPLPythonBase::GILReleaseGuard gil_guard(!CDPLPythonBase::isPythonImplemented(molgraph));
+
+        return proc.process(molgraph);
+    }
+}
+
+
 void CDPLPythonShape::exportScreeningProcessor()
 {
     using namespace boost;
@@ -58,7 +71,7 @@ void CDPLPythonShape::exportScreeningProcessor()
              python::arg("self"))
         .def("getQuery", &Shape::ScreeningProcessor::getQuery,
              (python::arg("self"), python::arg("idx")), python::return_internal_reference<>())
-        .def("process", static_cast<bool (Shape::ScreeningProcessor::*)(const Chem::MolecularGraph&)>(&Shape::ScreeningProcessor::process), 
+        .def("process", &process, 
              (python::arg("self"), python::arg("molgraph")))
         .add_property("hitCallback", python::make_function(&Shape::ScreeningProcessor::getHitCallback,
                                                            python::return_internal_reference<>()),
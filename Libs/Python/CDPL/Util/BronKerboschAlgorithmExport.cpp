@@ -39,11 +39,17 @@ void CDPLPythonUtil::exportBronKerboschAlgorithm()
     python::class_<Util::BronKerboschAlgorithm>("BronKerboschAlgorithm", python::no_init)
     .def(python::init<>(python::arg("self")))
     .def(python::init<const Util::BronKerboschAlgorithm&>((python::arg("self"), python::arg("bka"))))
-    .def(python::init<const Util::BitSetArray&>((python::arg("self"), python::arg("adj_mtx"))))
+    .def(python::init<const Util::BitSetArray&, std::size_t>((python::arg("self"), python::arg("adj_mtx"), python::arg("min_clique_size") = 0)))
     .def(CDPLPythonBase::ObjectIdentityCheckVisitor<Util::BronKerboschAlgorithm>())    
-    .def("init", &Util::BronKerboschAlgorithm::init, (python::arg("self"), python::arg("adj_mtx")))
+    .def("init", &Util::BronKerboschAlgorithm::init, (python::arg("self"), python::arg("adj_mtx"), python::arg("min_clique_size") = 0))
     .def("nextClique", &Util::BronKerboschAlgorithm::nextClique, 
          (python::arg("self"), python::arg("clique")))
+    .def("getMinCliqueSize", &Util::BronKerboschAlgorithm::getMinCliqueSize, python::arg("self"))
+    .def("getNumEmittedCliques", &Util::BronKerboschAlgorithm::getNumEmittedCliques, python::arg("self"))
+    .def("getNumPrunedBranches", &Util::BronKerboschAlgorithm::getNumPrunedBranches, python::arg("self"))
     .def("assign", &Util::BronKerboschAlgorithm::operator=, 
-         (python::arg("self"), python::arg("bka")), python::return_self<>());
+         (python::arg("self"), python::arg("bka")), python::return_self<>())
+    .add_property("minCliqueSize", &Util::BronKerboschAlgorithm::getMinCliqueSize)
+    .add_property("numEmittedCliques", &Util::BronKerboschAlgorithm::getNumEmittedCliques)
+    .add_property("numPrunedBranches", &Util::BronKerboschAlgorithm::getNumPrunedBranches);
 }
@@ -32,6 +32,7 @@ namespace CDPLPythonUtil
     void exportBitSet();
     void exportArrays();
     void exportBronKerboschAlgorithm();
+    void exportMaxCliqueAlgorithm();
     void exportDGCoordinatesGenerator();
     void exportCompressionStreams();
 } // namespace CDPLPythonUtil
@@ -0,0 +1,56 @@
+/* 
+ * MaxCliqueAlgorithmExport.cpp 
+ *
+ * This file is part of the Chemical Data Processing Toolkit
+ *
+ * Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING. If not, write to
+ * the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+ * Boston, MA 02111-1307, USA.
+ */
+
+
+#include <boost/python.hpp>
+
+#include "CDPL/Util/MaxCliqueAlgorithm.hpp"
+
+#include "Base/ObjectIdentityCheckVisitor.hpp"
+#include "Base/CopyAssOp.hpp"
+
+#include "ClassExports.hpp"
+
+
+void CDPLPythonUtil::exportMaxCliqueAlgorithm()
+{
+    using namespace boost;
+    using namespace CDPL;
+
+    python::class_<Util::MaxCliqueAlgorithm>("MaxCliqueAlgorithm", python::no_init)
+    .def(python::init<>(python::arg("self")))
+    .def(python::init<const Util::MaxCliqueAlgorithm&>((python::arg("self"), python::arg("mca"))))
+    .def(python::init<const Util::BitSetArray&, std::size_t>((python::arg("self"), python::arg("adj_mtx"), python::arg("min_clique_size") = 0)))
+    .def(CDPLPythonBase::ObjectIdentityCheckVisitor<Util::MaxCliqueAlgorithm>())    
+    .def("init", &Util::MaxCliqueAlgorithm::init, (python::arg("self"), python::arg("adj_mtx"), python::arg("min_clique_size") = 0))
+    .def("findMaxClique", &Util::MaxCliqueAlgorithm::findMaxClique, 
+         (python::arg("self"), python::arg("clique")))
+    .def("getMinCliqueSize", &Util::MaxCliqueAlgorithm::getMinCliqueSize, python::arg("self"))
+    .def("getNumSearchNodes", &Util::MaxCliqueAlgorithm::getNumSearchNodes, python::arg("self"))
+    .def("getNumPrunedBranches", &Util::MaxCliqueAlgorithm::getNumPrunedBranches, python::arg("self"))
+    .def("assign", CDPLPythonBase::copyAssOp<Util::MaxCliqueAlgorithm>(), 
+         (python::arg("self"), python::arg("mca")), python::return_self<>())
+    .add_property("minCliqueSize", &Util::MaxCliqueAlgorithm::getMinCliqueSize)
+    .add_property("numSearchNodes", &Util::MaxCliqueAlgorithm::getNumSearchNodes)
+    .add_property("numPrunedBranches", &Util::MaxCliqueAlgorithm::getNumPrunedBranches);
+}
@@ -0,0 +1,66 @@
+## 
+# MMFF94ParameterFileToCArray.py 
+#
+# This file is part of the Chemical Data Processing Toolkit
+#
+# Copyright (C) 2003 Thomas Seidel <thomas.seidel@univie.ac.at>
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program; see the file COPYING. If not, write to
+# the Free Software Foundation, Inc., 59 Temple Place - Suite 330,
+# Boston, MA 02111-1307, USA.
+##
+
+
+import sys
+
+
+def convert():
+    if len(sys.argv) < 4:
+        print('Usage:', sys.argv[0], '[input file] [output file] [num. columns]', file=sys.stderr)
+        sys.exit(2)
+
+    num_cols = int(sys.argv[3])
+    in_file = open(sys.argv[1], 'r')
+    out_file = open(sys.argv[2], 'w')
+
+    for line_no, line in enumerate(in_file, 1):
+        line = line.strip()
+
+        if not line or line[0] == '*':
+            continue
+
+        if line == '$':
+            break
+
+        tokens = line.split()
+
+        if len(tokens) < num_cols:
+            print('Error: line', line_no, 'of', sys.argv[1], 'has less than', num_cols, 'columns', file=sys.stderr)
+            sys.exit(1)
+
+        for token in tokens[:num_cols]:
+            try:
+                float(token)
+            except ValueError:
+                print('Error: non-numeric value', repr(token), 'in line', line_no, 'of', sys.argv[1], file=sys.stderr)
+                sys.exit(1)
+
+        out_file.write('{ ' + ', '.join(tokens[:num_cols]) + ' },\n')
+
+    out_file.flush()
+    out_file.close()
+    in_file.close()
+
+if __name__ == '__main__':
+    convert()